@@ -0,0 +1,193 @@
+/********************************************************************************
+ *                                                                              *
+ * This file is part of IfcOpenShell.                                           *
+ *                                                                              *
+ * IfcOpenShell is free software: you can redistribute it and/or modify         *
+ * it under the terms of the Lesser GNU General Public License as published by  *
+ * the Free Software Foundation, either version 3.0 of the License, or          *
+ * (at your option) any later version.                                          *
+ *                                                                              *
+ * IfcOpenShell is distributed in the hope that it will be useful,              *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of               *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                 *
+ * Lesser GNU General Public License for more details.                          *
+ *                                                                              *
+ * You should have received a copy of the Lesser GNU General Public License     *
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.         *
+ *                                                                              *
+ ********************************************************************************/
+
+/********************************************************************************
+ *                                                                              *
+ * Checks that the disk cache keys of the representations of products stay the  *
+ * same when a file is saved again with its products renamed and its instances  *
+ * numbered differently, so that such a file is served from the cache, and      *
+ * that a key changes when the geometry of a representation is modified.        *
+ *                                                                              *
+ ********************************************************************************/
+
+#include <iostream>
+#include <sstream>
+#include <map>
+
+#include "../ifcparse/IfcFile.h"
+#include "../ifcgeom/IfcGeomDiskCacheKey.h"
+
+using namespace IfcSchema;
+
+namespace {
+	typedef std::map<std::pair<std::string, unsigned int>, IfcGeom::DiskCacheKey> keys_t;
+
+	// Computes the keys of all representations of products, identified by the
+	// GlobalId of the product and the position of the representation
+	void compute_keys(IfcParse::IfcFile& file, keys_t& keys) {
+		IfcProduct::list::ptr products = file.entitiesByType<IfcProduct>();
+		for (IfcProduct::list::it it = products->begin(); it != products->end(); ++it) {
+			IfcProduct* product = *it;
+			if (!product->hasRepresentation()) {
+				continue;
+			}
+			IfcRelVoidsElement::list::ptr openings(new IfcRelVoidsElement::list);
+			if (product->as<IfcElement>()) {
+				openings = product->as<IfcElement>()->HasOpenings();
+			}
+			IfcRepresentation::list::ptr representations = product->Representation()->Representations();
+			unsigned int i = 0;
+			for (IfcRepresentation::list::it jt = representations->begin(); jt != representations->end(); ++jt, ++i) {
+				keys[std::make_pair(product->GlobalId(), i)].add_representation(*jt, product, openings, true);
+			}
+		}
+	}
+
+	// Renumbers the instances in the reverse order, outside of string literals
+	std::string renumber(const std::string& data, unsigned int max_id) {
+		std::string result;
+		bool in_string = false;
+		for (std::string::size_type i = 0; i < data.size(); ++i) {
+			const char c = data[i];
+			if (c == '\'') {
+				in_string = !in_string;
+			}
+			if (in_string || c != '#' || i + 1 == data.size() || !isdigit(data[i + 1])) {
+				result += c;
+				continue;
+			}
+			std::string::size_type j = i + 1;
+			unsigned int id = 0;
+			for (; j < data.size() && isdigit(data[j]); ++j) {
+				id = id * 10 + (data[j] - '0');
+			}
+			std::stringstream ss;
+			ss << "#" << (2 * max_id + 1 - id);
+			result += ss.str();
+			i = j - 1;
+		}
+		return result;
+	}
+}
+
+int main(int argc, char** argv) {
+
+	if ( argc != 2 ) {
+		std::cout << "usage: IfcGeomDiskCacheKeyTest <filename.ifc>" << std::endl;
+		return 1;
+	}
+
+	IfcParse::IfcFile original_file;
+	if ( ! original_file.Init(argv[1]) ) {
+		std::cout << "Unable to parse .ifc file" << std::endl;
+		return 1;
+	}
+
+	keys_t original_keys;
+	compute_keys(original_file, original_keys);
+
+	unsigned int max_id = 0;
+	for (IfcParse::IfcFile::const_iterator it = original_file.begin(); it != original_file.end(); ++it) {
+		max_id = std::max(max_id, it->first);
+	}
+
+	IfcRoot::list::ptr roots = original_file.entitiesByType<IfcRoot>();
+	for (IfcRoot::list::it it = roots->begin(); it != roots->end(); ++it) {
+		(*it)->setName("Renamed");
+		(*it)->setDescription("Saved again");
+		if ((*it)->as<IfcElement>()) {
+			(*it)->as<IfcElement>()->setTag("Retagged");
+		}
+	}
+
+	std::stringstream saved;
+	saved << original_file;
+	std::stringstream renumbered(renumber(saved.str(), max_id));
+	renumbered.seekg(0, std::ios::end);
+	const size_t length = renumbered.tellg();
+	renumbered.seekg(0, std::ios::beg);
+
+	IfcParse::IfcFile file;
+	if ( ! file.Init(renumbered, length) ) {
+		std::cout << "Unable to parse the file saved again" << std::endl;
+		return 1;
+	}
+
+	keys_t keys;
+	compute_keys(file, keys);
+
+	size_t num_hits = 0, num_misses = 0;
+	for (keys_t::const_iterator it = original_keys.begin(); it != original_keys.end(); ++it) {
+		keys_t::const_iterator jt = keys.find(it->first);
+		bool hit = jt != keys.end() && jt->second.str() == it->second.str();
+		// The styles of cached shapes refer to instances by their position
+		if (hit) {
+			const std::vector<IfcUtil::IfcBaseClass*>& a = it->second.instances();
+			const std::vector<IfcUtil::IfcBaseClass*>& b = jt->second.instances();
+			hit = a.size() == b.size();
+			for (size_t i = 0; hit && i < a.size(); ++i) {
+				hit = a[i]->type() == b[i]->type();
+			}
+		}
+		if (hit) {
+			++num_hits;
+		} else if (num_misses++ < 10) {
+			std::cout << "Representation " << it->first.second << " of " << it->first.first << " has a different key" << std::endl;
+		}
+	}
+
+	std::cout << num_hits << " of " << original_keys.size() << " representations have the same key after saving again" << std::endl;
+
+	// Moves a point of the first representation that has one
+	size_t num_changed = 0;
+	IfcProduct::list::ptr products = file.entitiesByType<IfcProduct>();
+	for (IfcProduct::list::it it = products->begin(); it != products->end() && !num_changed; ++it) {
+		if (!(*it)->hasRepresentation() || !(*it)->Representation()->Representations()->size()) {
+			continue;
+		}
+		// The points of the items, rather than those of the context of the representation
+		IfcRepresentation* representation = *(*it)->Representation()->Representations()->begin();
+		if (!representation->Items()->size()) {
+			continue;
+		}
+		IfcCartesianPoint::list::ptr points = IfcParse::traverse(*representation->Items()->begin())->as<IfcCartesianPoint>();
+		if (points->size()) {
+			IfcCartesianPoint* point = *points->begin();
+			std::vector<double> coordinates = point->Coordinates();
+			coordinates[0] += 1.;
+			point->setCoordinates(coordinates);
+
+			keys_t changed_keys;
+			compute_keys(file, changed_keys);
+			for (keys_t::const_iterator jt = changed_keys.begin(); jt != changed_keys.end(); ++jt) {
+				if (jt->second.str() != keys[jt->first].str()) {
+					++num_changed;
+				}
+			}
+			if (changed_keys[std::make_pair((*it)->GlobalId(), 0U)].str() == keys[std::make_pair((*it)->GlobalId(), 0U)].str()) {
+				std::cout << "Moving a point of " << (*it)->GlobalId() << " does not change its key" << std::endl;
+				num_changed = 0;
+				break;
+			}
+			std::cout << num_changed << " representations have a different key after moving a point" << std::endl;
+		}
+	}
+
+	return num_misses == 0 && num_changed > 0 ? 0 : 1;
+}
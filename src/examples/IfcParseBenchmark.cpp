@@ -0,0 +1,318 @@
+/********************************************************************************
+ *                                                                              *
+ * This file is part of IfcOpenShell.                                           *
+ *                                                                              *
+ * IfcOpenShell is free software: you can redistribute it and/or modify         *
+ * it under the terms of the Lesser GNU General Public License as published by  *
+ * the Free Software Foundation, either version 3.0 of the License, or          *
+ * (at your option) any later version.                                          *
+ *                                                                              *
+ * IfcOpenShell is distributed in the hope that it will be useful,              *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of               *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                 *
+ * Lesser GNU General Public License for more details.                          *
+ *                                                                              *
+ * You should have received a copy of the Lesser GNU General Public License     *
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.         *
+ *                                                                              *
+ ********************************************************************************/
+
+/********************************************************************************
+ *                                                                              *
+ * Measures the rate at which the lexer skips to token delimiters in the file   *
+ * using byte-wise comparisons, SSE2 and AVX2, as far as the library has been   *
+ * compiled for these instructions. Subsequently measures the time it takes to  *
+ * scan the file and to decode the coordinates of all cartesian points          *
+ * in a file, which for most files are the bulk of the numbers in it. The       *
+ * points are loaded on first access, so this includes reading their tokens.    *
+ * Subsequently measures the subtype checks of filtering all products in the    *
+ * file by a number of building element types. Finally measures the time and   *
+ * memory it takes to reassign the placements of up to 100000 products, each   *
+ * edit being followed by a query for the instances referring to the product.  *
+ *                                                                              *
+ * With --compare-io, instead compares opening the file by its name, which on   *
+ * POSIX systems maps it into memory, to reading it into a buffer from a        *
+ * stream. For both, reports the time to scan the file and to load all points,  *
+ * and the anonymous and file-backed resident memory afterwards.                *
+ *                                                                              *
+ ********************************************************************************/
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <sstream>
+
+#include <boost/date_time/posix_time/posix_time.hpp>
+
+#ifdef __linux__
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+#include "../ifcparse/IfcFile.h"
+
+using namespace IfcSchema;
+
+namespace {
+	// Skips to every delimiter of the general tokens in the buffer, like
+	// IfcSpfLexer::Next() does, and returns the number of delimiters
+	size_t skip_to_delimiters(const std::string& buffer, IfcParse::IfcSpfStream::instruction_set instructions) {
+		const char* it = buffer.data();
+		const char* end = it + buffer.size();
+		size_t num_delimiters = 0;
+		for (;;) {
+			it = IfcParse::IfcSpfStream::FindFirstOf(it, end, "()=,;/'", instructions);
+			if (it == end) {
+				break;
+			}
+			++num_delimiters;
+			++it;
+		}
+		return num_delimiters;
+	}
+
+	// Returns the resident memory of the process in bytes, or zero if it cannot be determined
+	size_t resident_memory() {
+#ifdef __linux__
+		std::ifstream statm("/proc/self/statm");
+		size_t total, resident;
+		if (statm >> total >> resident) {
+			return resident * (size_t) sysconf(_SC_PAGESIZE);
+		}
+#endif
+		return 0;
+	}
+
+	// Reads the anonymous and file-backed parts of the resident memory of the
+	// process in bytes, returns false if they cannot be determined
+	bool resident_memory_by_kind(size_t& anonymous, size_t& file_backed) {
+#ifdef __linux__
+		std::ifstream status("/proc/self/status");
+		std::string line;
+		int num_found = 0;
+		while (std::getline(status, line)) {
+			std::istringstream iss(line);
+			std::string key;
+			size_t kb;
+			if (!(iss >> key >> kb)) {
+				continue;
+			}
+			if (key == "RssAnon:") {
+				anonymous = kb * 1024;
+				++num_found;
+			} else if (key == "RssFile:") {
+				file_backed = kb * 1024;
+				++num_found;
+			}
+		}
+		return num_found == 2;
+#else
+		return false;
+#endif
+	}
+
+	// Opens the file either by its name or by reading it from a stream, and
+	// reports the time to scan it and to load all points and the resident memory
+	void measure_input(const std::string& filename, bool from_stream) {
+		const boost::posix_time::ptime start = boost::posix_time::microsec_clock::universal_time();
+
+		IfcParse::IfcFile file;
+		bool success;
+		if (from_stream) {
+			std::ifstream stream(filename.c_str(), std::ios_base::binary);
+			stream.seekg(0, std::ios_base::end);
+			const size_t size = static_cast<size_t>(stream.tellg());
+			stream.seekg(0, std::ios_base::beg);
+			success = file.Init(stream, size);
+		} else {
+			success = file.Init(filename);
+		}
+		if (!success) {
+			std::cout << "Unable to parse .ifc file" << std::endl;
+			return;
+		}
+
+		const boost::posix_time::ptime scanned = boost::posix_time::microsec_clock::universal_time();
+
+		IfcCartesianPoint::list::ptr points = file.entitiesByType<IfcCartesianPoint>();
+		size_t num_coordinates = 0;
+		for (IfcCartesianPoint::list::it it = points->begin(); it != points->end(); ++it) {
+			num_coordinates += (*it)->Coordinates().size();
+		}
+
+		const boost::posix_time::ptime loaded = boost::posix_time::microsec_clock::universal_time();
+
+		std::cout << (from_stream ? "Read from stream: " : "Opened by name:   ")
+			<< "scanned in " << (scanned - start).total_microseconds() / 1.e6 << "s, loaded "
+			<< num_coordinates << " coordinates in " << (loaded - scanned).total_microseconds() / 1.e6 << "s";
+		size_t anonymous = 0, file_backed = 0;
+		if (resident_memory_by_kind(anonymous, file_backed)) {
+			std::cout << ", resident memory " << anonymous / 1024 << "kB anonymous, "
+				<< file_backed / 1024 << "kB file-backed";
+		}
+		std::cout << std::endl;
+	}
+}
+
+int main(int argc, char** argv) {
+
+	const bool compare_io = argc == 3 && std::string(argv[1]) == "--compare-io";
+	if ( argc != 2 && !compare_io ) {
+		std::cout << "usage: IfcParseBenchmark [--compare-io] <filename.ifc>" << std::endl;
+		return 1;
+	}
+
+	if ( compare_io ) {
+		for (int i = 0; i < 2; ++i) {
+#ifdef __linux__
+			// Every measurement is performed in a separate process, so that the
+			// memory of the other does not affect it
+			const pid_t pid = fork();
+			if (pid == 0) {
+				measure_input(argv[2], i == 1);
+				std::cout.flush();
+				_exit(0);
+			} else if (pid > 0) {
+				waitpid(pid, 0, 0);
+				continue;
+			}
+#endif
+			measure_input(argv[2], i == 1);
+		}
+		return 0;
+	}
+
+	{
+		std::ifstream stream(argv[1], std::ios_base::binary);
+		const std::string buffer((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+
+		const char* const instruction_set_names[] = { "byte-wise comparisons", "SSE2", "AVX2" };
+		const int num_repetitions = 5;
+		for (int i = IfcParse::IfcSpfStream::INSTRUCTIONS_SCALAR; i <= IfcParse::IfcSpfStream::INSTRUCTIONS_AVX2; ++i) {
+			const IfcParse::IfcSpfStream::instruction_set instructions = static_cast<IfcParse::IfcSpfStream::instruction_set>(i);
+			if (instructions > IfcParse::IfcSpfStream::SupportedInstructionSet()) {
+				std::cout << "Skipping to delimiters using " << instruction_set_names[i] << " is not available" << std::endl;
+				continue;
+			}
+			// The best of a number of repetitions is reported, so that the buffer is in the cache
+			double skip_time = 0.;
+			size_t num_delimiters = 0;
+			for (int j = 0; j < num_repetitions; ++j) {
+				const boost::posix_time::ptime before = boost::posix_time::microsec_clock::universal_time();
+				num_delimiters = skip_to_delimiters(buffer, instructions);
+				const double t = (boost::posix_time::microsec_clock::universal_time() - before).total_microseconds() / 1.e6;
+				if (j == 0 || t < skip_time) {
+					skip_time = t;
+				}
+			}
+			std::cout << "Skipped to " << num_delimiters << " delimiters in " << buffer.size() << " bytes using " << instruction_set_names[i] << " in " << skip_time << "s";
+			if ( skip_time > 0. ) {
+				std::cout << " (" << static_cast<size_t>(buffer.size() / skip_time) << " bytes/s)";
+			}
+			std::cout << std::endl;
+		}
+	}
+
+	const boost::posix_time::ptime start = boost::posix_time::microsec_clock::universal_time();
+
+	IfcParse::IfcFile file;
+	if ( ! file.Init(argv[1]) ) {
+		std::cout << "Unable to parse .ifc file" << std::endl;
+		return 1;
+	}
+
+	const boost::posix_time::ptime scanned = boost::posix_time::microsec_clock::universal_time();
+
+	IfcCartesianPoint::list::ptr points = file.entitiesByType<IfcCartesianPoint>();
+	size_t num_coordinates = 0;
+	double sum = 0.;
+	for ( IfcCartesianPoint::list::it it = points->begin(); it != points->end(); ++ it ) {
+		const std::vector<double> coordinates = (*it)->Coordinates();
+		num_coordinates += coordinates.size();
+		for ( std::vector<double>::const_iterator jt = coordinates.begin(); jt != coordinates.end(); ++ jt ) {
+			sum += *jt;
+		}
+	}
+
+	const boost::posix_time::ptime decoded = boost::posix_time::microsec_clock::universal_time();
+	const double scan_time = (scanned - start).total_microseconds() / 1.e6;
+	const double decode_time = (decoded - scanned).total_microseconds() / 1.e6;
+
+	std::cout << "Scanned " << argv[1] << " in " << scan_time << "s" << std::endl;
+	std::cout << "Decoded " << num_coordinates << " coordinates of " << points->size() << " points in " << decode_time << "s";
+	if ( decode_time > 0. ) {
+		std::cout << " (" << static_cast<size_t>(num_coordinates / decode_time) << " coordinates/s)";
+	}
+	std::cout << std::endl;
+	// The sum is printed so that the decoding is not optimized away
+	std::cout << "Sum of coordinates " << sum << std::endl;
+
+	IfcProduct::list::ptr products = file.entitiesByType<IfcProduct>();
+	size_t num_matches = 0;
+	const int num_repetitions = 100;
+	for (int i = 0; i < num_repetitions; ++i) {
+		num_matches += products->as<IfcWall>()->size();
+		num_matches += products->as<IfcWallStandardCase>()->size();
+		num_matches += products->as<IfcBuildingElement>()->size();
+		num_matches += products->as<IfcElement>()->size();
+		num_matches += products->as<IfcOpeningElement>()->size();
+	}
+
+	const boost::posix_time::ptime filtered = boost::posix_time::microsec_clock::universal_time();
+	const double filter_time = (filtered - decoded).total_microseconds() / 1.e6;
+	const size_t num_checks = products->size() * 5 * num_repetitions;
+
+	std::cout << "Performed " << num_checks << " subtype checks on " << products->size() << " products in " << filter_time << "s";
+	if ( filter_time > 0. ) {
+		std::cout << " (" << static_cast<size_t>(num_checks / filter_time) << " checks/s)";
+	}
+	std::cout << std::endl;
+	std::cout << "Number of matches " << num_matches << std::endl;
+
+	// The placements of the products are alternated between two placements. The
+	// first round populates the cached lists of referencing instances, which
+	// should only be invalidated for the instances whose references change, the
+	// subsequent rounds are measured.
+	IfcLocalPlacement* placements[2];
+	for (int i = 0; i < 2; ++i) {
+		IfcCartesianPoint* location = new IfcCartesianPoint(std::vector<double>(3, static_cast<double>(i)));
+		IfcLocalPlacement* placement = new IfcLocalPlacement(0, new IfcAxis2Placement3D(location, 0, 0));
+		placements[i] = file.addEntity(placement)->as<IfcLocalPlacement>();
+	}
+
+	const size_t num_edited_products = std::min(static_cast<size_t>(products->size()), static_cast<size_t>(100000));
+	const int num_edit_rounds = 5;
+	size_t num_references = 0;
+	boost::posix_time::ptime edits_started;
+	size_t memory_before_edits = 0;
+	for (int i = 0; i < num_edit_rounds; ++i) {
+		if (i == 1) {
+			edits_started = boost::posix_time::microsec_clock::universal_time();
+			memory_before_edits = resident_memory();
+		}
+		IfcProduct::list::it it = products->begin();
+		for (size_t j = 0; j < num_edited_products; ++j, ++it) {
+			(*it)->setObjectPlacement(placements[(i + j) % 2]);
+			IfcEntityList::ptr references = file.entitiesByReference((*it)->entity->id());
+			num_references += references ? references->size() : 0;
+		}
+	}
+
+	const boost::posix_time::ptime edited = boost::posix_time::microsec_clock::universal_time();
+	const double edit_time = (edited - edits_started).total_microseconds() / 1.e6;
+	const size_t memory_after_edits = resident_memory();
+	const size_t num_edits = num_edited_products * (num_edit_rounds - 1);
+
+	std::cout << "Reassigned the placements of " << num_edited_products << " products " << (num_edit_rounds - 1) << " times in " << edit_time << "s";
+	if ( num_edits > 0 ) {
+		std::cout << " (" << (edit_time * 1.e6 / num_edits) << "us/edit";
+		if ( memory_before_edits > 0 ) {
+			const double memory_growth = static_cast<double>(memory_after_edits) - static_cast<double>(memory_before_edits);
+			std::cout << ", " << (memory_growth / num_edits) << " bytes/edit";
+		}
+		std::cout << ")";
+	}
+	std::cout << std::endl;
+	std::cout << "Number of references " << num_references << std::endl;
+}
@@ -0,0 +1,165 @@
+/********************************************************************************
+ *                                                                              *
+ * This file is part of IfcOpenShell.                                           *
+ *                                                                              *
+ * IfcOpenShell is free software: you can redistribute it and/or modify         *
+ * it under the terms of the Lesser GNU General Public License as published by  *
+ * the Free Software Foundation, either version 3.0 of the License, or          *
+ * (at your option) any later version.                                          *
+ *                                                                              *
+ * IfcOpenShell is distributed in the hope that it will be useful,              *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of               *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                 *
+ * Lesser GNU General Public License for more details.                          *
+ *                                                                              *
+ * You should have received a copy of the Lesser GNU General Public License     *
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.         *
+ *                                                                              *
+ ********************************************************************************/
+
+/********************************************************************************
+ *                                                                              *
+ * Reads a file from a number of threads at once. Every thread looks up all     *
+ * instances in an order of its own, which loads their attributes on first      *
+ * access, and queries the instances by type and reference and their inverse    *
+ * relations. The results are compared to those of a single thread reading a    *
+ * separate copy of the file. This is repeated with the supertype index built   *
+ * eagerly and lazily.                                                          *
+ *                                                                              *
+ ********************************************************************************/
+
+#include <algorithm>
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+#include <boost/bind.hpp>
+#include <boost/date_time/posix_time/posix_time.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/thread.hpp>
+
+#include "../ifcparse/IfcFile.h"
+
+using namespace IfcSchema;
+
+namespace {
+	void append_ids(std::stringstream& ss, IfcEntityList::ptr instances) {
+		std::vector<unsigned int> ids;
+		if (instances) {
+			for (IfcEntityList::it it = instances->begin(); it != instances->end(); ++it) {
+				ids.push_back((*it)->entity->id());
+			}
+		}
+		// The order of the lists depends on the order in which instances are loaded
+		std::sort(ids.begin(), ids.end());
+		ss << " [";
+		for (std::vector<unsigned int>::const_iterator it = ids.begin(); it != ids.end(); ++it) {
+			ss << (it == ids.begin() ? "" : ",") << *it;
+		}
+		ss << "]";
+	}
+
+	// Returns everything that is read about the instance by the threads
+	std::string describe(IfcParse::IfcFile& file, unsigned int id) {
+		std::stringstream ss;
+		IfcUtil::IfcBaseClass* instance = file.entityById(id);
+		ss << instance->entity->toString();
+		append_ids(ss, file.entitiesByReference(id));
+		append_ids(ss, file.getInverse(id, Type::UNDEFINED, -1));
+		append_ids(ss, file.getInverse(id, IfcRelDefinesByProperties::Class(), 4));
+		IfcEntityList::ptr of_type = file.entitiesByType(instance->type());
+		ss << " " << (of_type ? of_type->size() : 0);
+		if (instance->is(IfcRoot::Class())) {
+			IfcRoot* root = instance->as<IfcRoot>();
+			ss << " " << (file.entityByGuid(root->GlobalId()) == instance);
+		}
+		return ss.str();
+	}
+
+	// Describes the instances in an order that depends on the seed
+	void describe_all(IfcParse::IfcFile& file, const std::vector<unsigned int>& ids, unsigned int seed, std::vector<std::string>& descriptions) {
+		std::vector<size_t> order(ids.size());
+		for (size_t i = 0; i < order.size(); ++i) {
+			order[i] = i;
+		}
+		// A linear congruential generator of our own, as std::rand() is not
+		// guaranteed to be thread-safe
+		for (size_t i = order.size(); i > 1; --i) {
+			seed = seed * 1103515245 + 12345;
+			std::swap(order[i - 1], order[(seed >> 8) % i]);
+		}
+		descriptions.resize(ids.size());
+		for (std::vector<size_t>::const_iterator it = order.begin(); it != order.end(); ++it) {
+			try {
+				descriptions[*it] = describe(file, ids[*it]);
+			} catch (const IfcParse::IfcException& e) {
+				descriptions[*it] = e.what();
+			}
+		}
+	}
+}
+
+int main(int argc, char** argv) {
+
+	if ( argc != 2 && argc != 3 ) {
+		std::cout << "usage: IfcParseStressTest <filename.ifc> [<number of threads>]" << std::endl;
+		return 1;
+	}
+
+	const unsigned int num_threads = argc == 3
+		? boost::lexical_cast<unsigned int>(argv[2])
+		: std::max(boost::thread::hardware_concurrency(), 2U);
+
+	IfcParse::IfcFile reference_file;
+	if ( ! reference_file.Init(argv[1]) ) {
+		std::cout << "Unable to parse .ifc file" << std::endl;
+		return 1;
+	}
+
+	std::vector<unsigned int> ids;
+	for (IfcParse::IfcFile::const_iterator it = reference_file.begin(); it != reference_file.end(); ++it) {
+		ids.push_back(it->first);
+	}
+	std::sort(ids.begin(), ids.end());
+
+	std::vector<std::string> expected;
+	describe_all(reference_file, ids, 0, expected);
+
+	size_t num_mismatches = 0;
+	for (int eager = 0; eager < 2; ++eager) {
+		IfcParse::IfcFile file(eager != 0);
+		if ( ! file.Init(argv[1]) ) {
+			std::cout << "Unable to parse .ifc file" << std::endl;
+			return 1;
+		}
+
+		const boost::posix_time::ptime start = boost::posix_time::microsec_clock::universal_time();
+
+		std::vector< std::vector<std::string> > results(num_threads);
+		boost::thread_group threads;
+		for (unsigned int i = 0; i < num_threads; ++i) {
+			threads.create_thread(boost::bind(&describe_all, boost::ref(file), boost::cref(ids), i + 1, boost::ref(results[i])));
+		}
+		threads.join_all();
+
+		const double elapsed = (boost::posix_time::microsec_clock::universal_time() - start).total_microseconds() / 1.e6;
+
+		size_t num_mismatches_in_pass = 0;
+		for (unsigned int i = 0; i < num_threads; ++i) {
+			for (size_t j = 0; j < ids.size(); ++j) {
+				if (results[i][j] != expected[j]) {
+					if (num_mismatches_in_pass++ < 10) {
+						std::cout << "Thread " << i << " read #" << ids[j] << " as:" << std::endl << results[i][j] << std::endl
+							<< "instead of:" << std::endl << expected[j] << std::endl;
+					}
+				}
+			}
+		}
+		num_mismatches += num_mismatches_in_pass;
+
+		std::cout << num_threads << " threads read " << ids.size() << " instances with the supertype index built "
+			<< (eager ? "eagerly" : "lazily") << " in " << elapsed << "s, " << num_mismatches_in_pass << " mismatches" << std::endl;
+	}
+
+	return num_mismatches == 0 ? 0 : 1;
+}
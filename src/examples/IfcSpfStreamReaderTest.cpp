@@ -0,0 +1,89 @@
+/********************************************************************************
+ *                                                                              *
+ * This file is part of IfcOpenShell.                                           *
+ *                                                                              *
+ * IfcOpenShell is free software: you can redistribute it and/or modify         *
+ * it under the terms of the Lesser GNU General Public License as published by  *
+ * the Free Software Foundation, either version 3.0 of the License, or          *
+ * (at your option) any later version.                                          *
+ *                                                                              *
+ * IfcOpenShell is distributed in the hope that it will be useful,              *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of               *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                 *
+ * Lesser GNU General Public License for more details.                          *
+ *                                                                              *
+ * You should have received a copy of the Lesser GNU General Public License     *
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.         *
+ *                                                                              *
+ ********************************************************************************/
+
+/********************************************************************************
+ *                                                                              *
+ * Reads a file in a single pass with IfcSpfStreamReader and compares the       *
+ * instances, their types and their attributes to those of the same file       *
+ * parsed by IfcFile. A small window size can be specified to have the window   *
+ * of the reader grow for instances that do not fit.                            *
+ *                                                                              *
+ ********************************************************************************/
+
+#include <fstream>
+#include <iostream>
+
+#include <boost/lexical_cast.hpp>
+
+#include "../ifcparse/IfcFile.h"
+#include "../ifcparse/IfcSpfStreamReader.h"
+
+int main(int argc, char** argv) {
+
+	if ( argc != 2 && argc != 3 ) {
+		std::cout << "usage: IfcSpfStreamReaderTest <filename.ifc> [<window size in bytes>]" << std::endl;
+		return 1;
+	}
+
+	const size_t window_size = argc == 3
+		? boost::lexical_cast<size_t>(argv[2])
+		: 1 << 20;
+
+	IfcParse::IfcFile file;
+	if ( ! file.Init(argv[1]) ) {
+		std::cout << "Unable to parse .ifc file" << std::endl;
+		return 1;
+	}
+
+	std::ifstream stream(argv[1], std::ios::in | std::ios::binary);
+	IfcParse::IfcSpfStreamReader reader(stream, window_size);
+	if ( ! reader.valid() ) {
+		std::cout << "Unable to read .ifc file from stream" << std::endl;
+		return 1;
+	}
+
+	size_t num_instances = 0, num_mismatches = 0;
+	while (IfcEntityInstanceData* data = reader.next()) {
+		++num_instances;
+		std::string expected;
+		try {
+			expected = file.entityById(data->id())->entity->toString();
+		} catch (const IfcParse::IfcException& e) {
+			expected = e.what();
+		}
+		const std::string read = data->toString();
+		if (read != expected && num_mismatches++ < 10) {
+			std::cout << "Read:" << std::endl << read << std::endl << "instead of:" << std::endl << expected << std::endl;
+		}
+	}
+
+	// Simple types that are instantiated for the values of select attributes are
+	// included in the instances of the file, but are not read as instances.
+	size_t num_expected = 0;
+	for (IfcParse::IfcFile::const_iterator it = file.begin(); it != file.end(); ++it) {
+		if (!IfcSchema::Type::IsSimple(it->second->type())) {
+			++num_expected;
+		}
+	}
+
+	std::cout << "Read " << num_instances << " of " << num_expected << " instances, "
+		<< num_mismatches << " of which differ" << std::endl;
+
+	return num_instances == num_expected && num_mismatches == 0 ? 0 : 1;
+}
@@ -32,6 +32,7 @@
 #include "../ifcconvert/WavefrontObjSerializer.h"
 #include "../ifcconvert/XmlSerializer.h"
 #include "../ifcconvert/SvgSerializer.h"
+#include "../ifcconvert/util.h"
 
 #include "../ifcgeom/IfcGeomIterator.h"
 #include "../ifcgeom/IfcGeomRenderStyles.h"
@@ -43,6 +44,9 @@
 
 #include <boost/program_options.hpp>
 #include <boost/make_shared.hpp>
+#include <boost/bind.hpp>
+#include <boost/scoped_ptr.hpp>
+#include <boost/thread/thread.hpp>
 
 #include <fstream>
 #include <sstream>
@@ -167,7 +171,24 @@ size_t read_filters_from_file(const std::string&, inclusion_filter&, inclusion_t
 void parse_filter(geom_filter &, const std::vector<std::string>&);
 std::vector<IfcGeom::filter_t> setup_filters(const std::vector<geom_filter>&, const std::string&);
 
-bool init_input_file(const std::string& filename, IfcParse::IfcFile& ifc_file, bool no_progress, bool mmap);
+bool init_input_file(const std::string& filename, IfcParse::IfcFile& ifc_file, bool no_progress, bool mmap, unsigned num_threads);
+
+// A triangulated element handed from the geometry stage to the serialization stage,
+// together with the progress of the iterator at the time it was created.
+struct queued_element {
+	IfcGeom::TriangulationElement<real_t>* element;
+	int progress;
+};
+
+typedef util::bounded_queue<queued_element> element_queue;
+
+// The number of elements that the geometry stage is allowed to be ahead of the serializer
+static const size_t element_queue_capacity = 64;
+
+// Creates the elements of the iterator and pushes them onto the queue until it is closed.
+// Sets failed if an error prevented the elements from being created.
+void enqueue_elements(IfcGeom::Iterator<real_t>& context_iterator, element_queue& queue, bool& failed);
+void print_progress(int progress, int& old_progress, bool quiet, bool stderr_progress);
 
 #if defined(_MSC_VER) && defined(_UNICODE)
 int wmain(int argc, wchar_t** argv) {
@@ -183,13 +204,16 @@ int main(int argc, char** argv) {
 #endif
 
 	double deflection_tolerance;
+	double cache_budget;
 	inclusion_filter include_filter;
 	inclusion_traverse_filter include_traverse_filter;
 	exclusion_filter exclude_filter;
 	exclusion_traverse_filter exclude_traverse_filter;
 	path_t filter_filename;
 	path_t default_material_filename;
+	path_t cache_directory;
 	std::string log_format;
+	int num_threads;
 
     po::options_description generic_options("Command line options");
 	generic_options.add_options()
@@ -200,7 +224,13 @@ int main(int argc, char** argv) {
 		("stderr-progress", "output progress to stderr stream")
 		("yes,y", "answer 'yes' automatically to possible confirmation queries (e.g. overwriting an existing output file)")
 		("no-progress", "suppress possible progress bar type of prints that use carriage return")
-		("log-format", po::value<std::string>(&log_format), "log format: plain or json");
+		("log-format", po::value<std::string>(&log_format), "log format: plain or json")
+		("threads,j", po::value<int>(&num_threads)->default_value(1),
+			"number of threads used for scanning the input file and creating geometry, 0 uses the number of hardware threads")
+		("schedule-by-cost", "create the geometry of the representations that are estimated to take longest first. "
+			"Elements are then written in the order in which they are completed")
+		("log-timings", "log the time it took to process every representation along with its estimated cost, "
+			"shown with --verbose");
 
     po::options_description fileio_options;
 	fileio_options.add_options()
@@ -282,6 +312,12 @@ int main(int argc, char** argv) {
             "model in other modelling application in any case.")
         ("deflection-tolerance", po::value<double>(&deflection_tolerance)->default_value(1e-3),
             "Sets the deflection tolerance of the mesher, 1e-3 by default if not specified.")
+        ("cache-budget", po::value<double>(&cache_budget)->default_value(128.),
+            "Sets the memory, in megabytes, that the cache of converted geometry may use per thread, "
+            "after which the least recently used entries are evicted. 0 disables the cache.")
+        ("cache-dir", new po::typed_value<path_t, char_t>(&cache_directory),
+            "Specifies an existing directory in which the shapes and triangulations of elements are stored. "
+            "Subsequent conversions with the same settings read them from it, for the elements that have not changed.")
         ("generate-uvs",
             "Generates UVs (texture coordinates) by using simple box projection. Requires normals. "
             "Not guaranteed to work properly if used with --weld-vertices.")
@@ -401,6 +437,14 @@ int main(int argc, char** argv) {
 	const bool site_local_placement = vmap.count("site-local-placement") != 0;
 	const bool building_local_placement = vmap.count("building-local-placement") != 0;
 	const bool generate_uvs = vmap.count("generate-uvs") != 0;
+	const bool schedule_by_cost = vmap.count("schedule-by-cost") != 0;
+	const bool log_timings = vmap.count("log-timings") != 0;
+
+	if (num_threads < 0) {
+		cerr_ << "[Error] Invalid value for --threads" << std::endl;
+		print_usage();
+		return EXIT_FAILURE;
+	}
 
     if (!quiet || vmap.count("version")) {
 		print_version();
@@ -527,7 +571,7 @@ int main(int argc, char** argv) {
     if (output_extension == XML) {
         int exit_code = EXIT_FAILURE;
         try {
-            if (init_input_file(IfcUtil::path::to_utf8(input_filename), ifc_file, no_progress || quiet, mmap)) {
+            if (init_input_file(IfcUtil::path::to_utf8(input_filename), ifc_file, no_progress || quiet, mmap, num_threads)) {
                 time_t start, end;
                 time(&start);
                 XmlSerializer s(IfcUtil::path::to_utf8(output_temp_filename));
@@ -616,6 +660,7 @@ int main(int argc, char** argv) {
 	settings.set(SerializerSettings::USE_ELEMENT_TYPES, use_element_types);
 	settings.set(SerializerSettings::USE_ELEMENT_HIERARCHY, use_element_hierarchy);
     settings.set_deflection_tolerance(deflection_tolerance);
+    settings.set_cache_budget(static_cast<size_t>(std::max(cache_budget, 0.) * 1024 * 1024));
     settings.precision = precision;
 
 	boost::shared_ptr<GeometrySerializer> serializer; /**< @todo use std::unique_ptr when possible */
@@ -686,7 +731,7 @@ int main(int argc, char** argv) {
 	time_t start,end;
 	time(&start);
 	
-    if (!init_input_file(IfcUtil::path::to_utf8(input_filename), ifc_file, no_progress || quiet, mmap)) {
+    if (!init_input_file(IfcUtil::path::to_utf8(input_filename), ifc_file, no_progress || quiet, mmap, num_threads)) {
         write_log(!quiet);
 		serializer.reset();
         IfcUtil::path::delete_file(IfcUtil::path::to_utf8(output_temp_filename)); /**< @todo Windows Unicode support */
@@ -694,6 +739,14 @@ int main(int argc, char** argv) {
     }
 
     IfcGeom::Iterator<real_t> context_iterator(settings, &ifc_file, filter_funcs);
+    // Unless scheduled by cost, elements are returned in the order of a single thread, so that the output
+    // does not depend on the number of threads. Otherwise this would require retaining all elements.
+    context_iterator.set_num_threads(num_threads, !schedule_by_cost);
+    context_iterator.set_schedule_by_cost(schedule_by_cost);
+    context_iterator.set_log_timings(log_timings);
+    if (vmap.count("cache-dir")) {
+        context_iterator.set_disk_cache_directory(IfcUtil::path::to_utf8(cache_directory));
+    }
     if (!context_iterator.initialize()) {
         /// @todo It would be nice to know and print separate error prints for a case where we found no entities
         /// and for a case we found no entities that satisfy our filtering criteria.
@@ -761,37 +814,61 @@ int main(int argc, char** argv) {
 	// non-null return value guarantees that a successfully processed product is 
 	// available. 
 	size_t num_created = 0;
-	
-	do {
-        IfcGeom::Element<real_t> *geom_object = context_iterator.get();
 
-		if (is_tesselated)
-		{
-			serializer->write(static_cast<const IfcGeom::TriangulationElement<real_t>*>(geom_object));
+	if (is_tesselated) {
+		// Geometry creation, including triangulation, and serialization run as a two-stage
+		// pipeline on separate threads, so that writing the output overlaps with creating
+		// the next elements. The BRep elements stay with the geometry stage as the kernel
+		// caches shapes that are shared between representations. For the same reason
+		// triangulation is not a stage of its own: meshing stores the triangulation on
+		// these shared shapes and would race with the kernel on another thread. With
+		// --threads it is instead spread over the worker threads of the iterator.
+		element_queue queue(element_queue_capacity);
+		bool geometry_failed = false, serialization_failed = false;
+		boost::thread geometry_stage(boost::bind(&enqueue_elements, boost::ref(context_iterator), boost::ref(queue), boost::ref(geometry_failed)));
+
+		queued_element queued;
+		try {
+			while (queue.pop(queued)) {
+				boost::scoped_ptr< IfcGeom::TriangulationElement<real_t> > element(queued.element);
+				serializer->write(element.get());
+				++num_created;
+
+				if (!no_progress) {
+					print_progress(queued.progress, old_progress, quiet, stderr_progress);
+				}
+			}
+		} catch (const std::exception& e) {
+			Logger::Error(e);
+			serialization_failed = true;
+		} catch (...) {
+			Logger::Error("Unknown error while writing output");
+			serialization_failed = true;
 		}
-		else
-		{
-			serializer->write(static_cast<const IfcGeom::BRepElement<real_t>*>(geom_object));
+
+		// Closing the queue stops the geometry stage if serialization has failed
+		queue.close();
+		geometry_stage.join();
+		while (queue.pop(queued)) {
+			delete queued.element;
 		}
 
-        if (!no_progress) {
-			if (quiet) {
-				const int progress = context_iterator.progress();
-				for (; old_progress < progress; ++old_progress) {
-					std::cout << ".";
-					if (stderr_progress)
-						std::cerr << ".";
-				}
-				std::cout << std::flush;
-				if (stderr_progress)
-					std::cerr << std::flush;
-			} else {
-				const int progress = context_iterator.progress() / 2;
-				if (old_progress != progress) Logger::ProgressBar(progress);
-				old_progress = progress;
+		if (geometry_failed || serialization_failed) {
+			serializer.reset();
+			IfcUtil::path::delete_file(IfcUtil::path::to_utf8(output_temp_filename));
+			write_log(!quiet);
+			return EXIT_FAILURE;
+		}
+	} else {
+		do {
+			IfcGeom::Element<real_t> *geom_object = context_iterator.get();
+			serializer->write(static_cast<const IfcGeom::BRepElement<real_t>*>(geom_object));
+
+			if (!no_progress) {
+				print_progress(context_iterator.progress(), old_progress, quiet, stderr_progress);
 			}
-        }
-    } while (++num_created, context_iterator.next());
+		} while (++num_created, context_iterator.next());
+	}
 
 	if (!no_progress && quiet) {
 		for (; old_progress < 100; ++old_progress) {
@@ -807,6 +884,23 @@ int main(int argc, char** argv) {
 			" objects)                                ");
 	}
 
+	const IfcGeom::CacheStatistics cache_statistics = context_iterator.cache_statistics();
+	std::stringstream cache_msg;
+	cache_msg << "Geometry cache: " << cache_statistics.hits << " hits, " << cache_statistics.misses << " misses, "
+		<< cache_statistics.evictions << " evictions, peak size " << cache_statistics.peak_size / (1024. * 1024.) << " MB";
+	Logger::Notice(cache_msg.str());
+
+	if (vmap.count("cache-dir")) {
+		const IfcGeom::DiskCacheStatistics disk_cache_statistics = context_iterator.disk_cache_statistics();
+		std::stringstream disk_cache_msg;
+		disk_cache_msg << "Disk cache: shapes " << disk_cache_statistics.shape_hits << " hits, "
+			<< disk_cache_statistics.shape_misses << " misses, triangulations "
+			<< disk_cache_statistics.triangulation_hits << " hits, "
+			<< disk_cache_statistics.triangulation_misses << " misses, "
+			<< disk_cache_statistics.writes << " writes";
+		Logger::Status(disk_cache_msg.str());
+	}
+
     serializer->finalize();
     // Make sure the dtor is explicitly run here (e.g. output files are closed before renaming them).
     serializer.reset();
@@ -830,6 +924,47 @@ int main(int argc, char** argv) {
     return successful ? EXIT_SUCCESS : EXIT_FAILURE;
 }
 
+void enqueue_elements(IfcGeom::Iterator<real_t>& context_iterator, element_queue& queue, bool& failed)
+{
+	try {
+		do {
+			const IfcGeom::TriangulationElement<real_t>* element = static_cast<const IfcGeom::TriangulationElement<real_t>*>(context_iterator.get());
+			// The copy shares the triangulation, but unlike the element of the iterator remains valid after next()
+			queued_element queued = { new IfcGeom::TriangulationElement<real_t>(*element, element->geometry_pointer()), context_iterator.progress() };
+			if (!queue.push(queued)) {
+				// The serialization stage has stopped
+				delete queued.element;
+				break;
+			}
+		} while (context_iterator.next());
+	} catch (const std::exception& e) {
+		Logger::Error(e);
+		failed = true;
+	} catch (...) {
+		Logger::Error("Unknown error while creating geometry");
+		failed = true;
+	}
+	queue.close();
+}
+
+void print_progress(int progress, int& old_progress, bool quiet, bool stderr_progress)
+{
+	if (quiet) {
+		for (; old_progress < progress; ++old_progress) {
+			std::cout << ".";
+			if (stderr_progress)
+				std::cerr << ".";
+		}
+		std::cout << std::flush;
+		if (stderr_progress)
+			std::cerr << std::flush;
+	} else {
+		progress /= 2;
+		if (old_progress != progress) Logger::ProgressBar(progress);
+		old_progress = progress;
+	}
+}
+
 std::string format_duration(time_t start, time_t end)
 {
     int seconds = (int)difftime(end, start);
@@ -860,7 +995,7 @@ void write_log(bool header) {
 	}
 }
 
-bool init_input_file(const std::string &filename, IfcParse::IfcFile &ifc_file, bool no_progress, bool mmap)
+bool init_input_file(const std::string &filename, IfcParse::IfcFile &ifc_file, bool no_progress, bool mmap, unsigned num_threads)
 {
     time_t start, end;
 
@@ -869,10 +1004,10 @@ bool init_input_file(const std::string &filename, IfcParse::IfcFile &ifc_file, b
 
     time(&start);
 #ifdef USE_MMAP
-	if (!ifc_file.Init(filename, mmap)) {
+	if (!ifc_file.Init(new IfcParse::IfcSpfStream(filename, mmap), num_threads)) {
 #else
 	(void)mmap;
-	if (!ifc_file.Init(filename)) {
+	if (!ifc_file.Init(new IfcParse::IfcSpfStream(filename), num_threads)) {
 #endif
         Logger::Error("Unable to parse input file '" + filename + "'");
         return false;
@@ -22,8 +22,11 @@
 
 #include <sstream>
 #include <vector>
+#include <deque>
 
 #include <boost/shared_ptr.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/condition_variable.hpp>
 
 namespace util {
 	class string_buffer {
@@ -62,6 +65,61 @@ namespace util {
 		boost::shared_ptr<float_item> add(const double& d);
 		std::string str() const;
 	};
+
+	/// A queue of limited capacity for passing items from one thread to another.
+	/// push() blocks while the queue is full and pop() while it is empty. Once
+	/// closed, items can no longer be pushed, the remaining ones can be popped.
+	template <typename T>
+	class bounded_queue {
+	private:
+		boost::mutex mutex;
+		boost::condition_variable not_full, not_empty;
+		std::deque<T> items;
+		size_t capacity;
+		bool closed;
+		bounded_queue(const bounded_queue&); // N/I
+		bounded_queue& operator=(const bounded_queue&); // N/I
+	public:
+		explicit bounded_queue(size_t capacity) : capacity(capacity), closed(false) {}
+
+		/// Returns false, without adding the item, if the queue has been closed
+		bool push(const T& t) {
+			boost::mutex::scoped_lock lock(mutex);
+			while (items.size() >= capacity && !closed) {
+				not_full.wait(lock);
+			}
+			if (closed) {
+				return false;
+			}
+			items.push_back(t);
+			not_empty.notify_one();
+			return true;
+		}
+
+		/// Signals that no more items will be pushed, also by the producer when
+		/// the consumer stops early
+		void close() {
+			boost::mutex::scoped_lock lock(mutex);
+			closed = true;
+			not_empty.notify_all();
+			not_full.notify_all();
+		}
+
+		/// Returns false when the queue is closed and all items have been popped
+		bool pop(T& t) {
+			boost::mutex::scoped_lock lock(mutex);
+			while (items.empty() && !closed) {
+				not_empty.wait(lock);
+			}
+			if (items.empty()) {
+				return false;
+			}
+			t = items.front();
+			items.pop_front();
+			not_full.notify_one();
+			return true;
+		}
+	};
 }
 
 #endif
@@ -19,6 +19,7 @@
 
 import codegen
 import templates
+import perfect_hash
 
 from schema import OrderedCaseInsensitiveDict
 
@@ -42,19 +43,20 @@ class Implementation(codegen.Base):
         for name, enum in mapping.schema.enumerations.items():
             short_name = name[:-4] if name.endswith("Enum") else name
             context = locals()
+            table = perfect_hash.Table(enum.values)
             write(
                 templates.enumeration_function,
                 max_id = len(enum.values),
                 name = name,
                 values = catc(map(stringify, enum.values)),
-                from_string_statements = catnl(templates.enum_from_string_stmt%dict(context,**locals()) for value in enum.values)
+                hash_keys = catc(map(stringify, table.keys)),
+                hash_values = catc(templates.enum_value%dict(context,**locals()) for value in table.keys),
+                hash_displacements = catc(map(str, table.displacements))
             )
 
         write = lambda str, **kwargs: entity_implementations.append(str%kwargs)
 
         for name, type in mapping.schema.entities.items():
-            parent_type_test = "" if not type.supertypes or len(type.supertypes) != 1 \
-                else templates.parent_type_test%(type.supertypes[0])
             constructor_arguments = mapping.get_assignable_arguments(type, include_derived = True)
             constructor_arguments_str = catc("%(full_type)s v%(index)d_%(name)s"%a for a in constructor_arguments if not a['is_derived'])
             attributes = []
@@ -149,7 +151,6 @@ class Implementation(codegen.Base):
             write(
                 templates.entity_implementation,
                 name                       = name,
-                parent_type_test           = parent_type_test,
                 constructor_arguments      = constructor_arguments_str,
                 constructor_implementation = cat(constructor_implementations),
                 attributes                 = nl(catnl(attributes)),
@@ -162,13 +163,9 @@ class Implementation(codegen.Base):
         schema_entity_statements += [templates.schema_entity_stmt%locals() for name, type in mapping.schema.entities.items()]
 
         enumerable_types = sorted(set([name for name, type in mapping.schema.types.items()] + [name for name, type in mapping.schema.entities.items()]))
-        max_len = max(map(len, enumerable_types))
         type_name_strings = catc(map(stringify, enumerable_types))
-        string_map_statements = [templates.string_map_statement % {
-            'uppercase_name' : name.upper(),
-            'name'           : name,
-            'padding'        : ' ' * (max_len - len(name))
-        } for name in enumerable_types]
+        type_by_uppercase_name = dict((name.upper(), name) for name in enumerable_types)
+        type_table = perfect_hash.Table(name.upper() for name in enumerable_types)
         
         enumeration_index_by_str = OrderedCaseInsensitiveDict((j,i) for i,j in enumerate(enumerable_types))
         def get_parent_id(s):
@@ -179,6 +176,36 @@ class Implementation(codegen.Base):
 
         parent_type_statements = ",".join(map(str, map(get_parent_id, enumerable_types)))
 
+        simple_types = set(map(str, mapping.schema.simpletypes.keys()))
+        def get_supertype(name):
+            e = mapping.schema.entities.get(name)
+            if e:
+                return e.supertypes[0] if len(e.supertypes) == 1 else None
+            elif name in simple_types:
+                return mapping.simple_type_parent(name)
+
+        subtypes = OrderedCaseInsensitiveDict((name, []) for name in enumerable_types)
+        root_types = []
+        for name in enumerable_types:
+            supertype = get_supertype(name)
+            if supertype: subtypes[str(supertype)].append(name)
+            else: root_types.append(name)
+
+        type_range_begin, type_range_end = OrderedCaseInsensitiveDict(), OrderedCaseInsensitiveDict()
+        def number_types(name, n):
+            type_range_begin[name] = n
+            for subtype in subtypes[name]:
+                n = number_types(subtype, n + 1)
+            type_range_end[name] = n
+            return n
+
+        n = -1
+        for name in root_types:
+            n = number_types(name, n + 1)
+        # Type::UNDEFINED is numbered last, so that no type is a subtype of it
+        type_range_begin_statements = ",".join(map(str, [type_range_begin[name] for name in enumerable_types] + [n + 1]))
+        type_range_end_statements = ",".join(map(str, [type_range_end[name] for name in enumerable_types] + [n + 1]))
+
         max_id = len(enumerable_types)
 
         simple_type_statements = cator("v == Type::%s"%name for name in selectable_simple_types)
@@ -189,9 +216,6 @@ class Implementation(codegen.Base):
             attr_type = mapping.make_argument_type(type)
             superclass = mapping.simple_type_parent(class_name)
             
-            simpletype_impl_is = templates.simpletype_impl_is_with_supertype if superclass \
-                else templates.simpletype_impl_is_without_supertype
-                
             constructor = templates.constructor_single_initlist if superclass \
                 else templates.constructor
             
@@ -212,7 +236,6 @@ class Implementation(codegen.Base):
             simple_type_impl.extend(map(compose, map(lambda x: (class_name, attr_type, superclass, "(IfcEntityInstanceData*)0")+x, (
                 ('getArgumentType', templates.const_function,       'IfcUtil::ArgumentType', ('unsigned int i',),           templates.simpletype_impl_argument_type       ),
                 ('getArgument',     templates.const_function,       'Argument*',             ('unsigned int i',),           templates.simpletype_impl_argument            ),
-                ('is',              templates.const_function,       'bool',                  ('Type::Enum v',),             simpletype_impl_is                            ),
                 ('type',            templates.const_function,       'Type::Enum',            (),                            templates.simpletype_impl_type                ),
                 ('Class',           templates.function,             'Type::Enum',            (),                            templates.simpletype_impl_class               ),
                 ('',                          constructor,          '',                      ('IfcEntityInstanceData* e',), templates.simpletype_impl_explicit_constructor),
@@ -228,9 +251,13 @@ class Implementation(codegen.Base):
             'enumeration_functions'    : cat(enumeration_functions),
             'schema_entity_statements' : catnl(schema_entity_statements),
             'type_name_strings'        : type_name_strings,
-            'string_map_statements'    : catnl(string_map_statements),
+            'type_hash_keys'           : catc(map(stringify, type_table.keys)),
+            'type_hash_values'         : catc(templates.type_value % {'name': type_by_uppercase_name[key]} for key in type_table.keys),
+            'type_hash_displacements'  : catc(map(str, type_table.displacements)),
             'simple_type_statement'    : simple_type_statements,
             'parent_type_statements'   : parent_type_statements,
+            'type_range_begin'         : type_range_begin_statements,
+            'type_range_end'           : type_range_end_statements,
             'entity_implementations'   : catnl(entity_implementations),
             'simple_type_impl'         : catnl(simple_type_impl)
         }
@@ -0,0 +1,82 @@
+###############################################################################
+#                                                                             #
+# This file is part of IfcOpenShell.                                          #
+#                                                                             #
+# IfcOpenShell is free software: you can redistribute it and/or modify        #
+# it under the terms of the Lesser GNU General Public License as published by #
+# the Free Software Foundation, either version 3.0 of the License, or         #
+# (at your option) any later version.                                         #
+#                                                                             #
+# IfcOpenShell is distributed in the hope that it will be useful,             #
+# but WITHOUT ANY WARRANTY; without even the implied warranty of              #
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                #
+# Lesser GNU General Public License for more details.                         #
+#                                                                             #
+# You should have received a copy of the Lesser GNU General Public License    #
+# along with this program. If not, see <http://www.gnu.org/licenses/>.        #
+#                                                                             #
+###############################################################################
+
+# Generates minimal perfect hash tables, by the hash and displace method, for
+# looking up keywords with IfcParse::perfect_hash::lookup(). The hash function
+# needs to be identical to the one in src/ifcparse/IfcPerfectHash.h.
+
+MASK = 0xffffffff
+
+def hash(s, seed):
+    h = 2166136261 ^ seed
+    for c in s.encode('ascii'):
+        h ^= c
+        h = (h * 16777619) & MASK
+    h ^= h >> 16
+    h = (h * 0x85ebca6b) & MASK
+    h ^= h >> 13
+    h = (h * 0xc2b2ae35) & MASK
+    h ^= h >> 16
+    return h
+
+class Table:
+    """
+    A minimal perfect hash table for a list of distinct keys. The keys are
+    divided over buckets by their hash with seed zero. For the buckets with
+    more than one key a seed is searched for, for which the keys hash into
+    free slots. The keys of the other buckets are put in the remaining free
+    slots directly, which is stored as a negative displacement.
+    """
+    def __init__(self, keys):
+        keys = list(keys)
+        assert len(keys) and len(set(keys)) == len(keys), "Keys are empty or not unique"
+        n = len(keys)
+        buckets = [[] for i in range(n)]
+        for k in keys:
+            buckets[hash(k, 0) % n].append(k)
+
+        self.displacements = [0] * n
+        self.slots = [None] * n
+
+        for b in sorted(range(n), key=lambda b: -len(buckets[b])):
+            bucket = buckets[b]
+            if len(bucket) <= 1: break
+            seed = 1
+            while True:
+                slots = [hash(k, seed) % n for k in bucket]
+                if len(set(slots)) == len(slots) and all(self.slots[s] is None for s in slots):
+                    break
+                seed += 1
+            self.displacements[b] = seed
+            for k, s in zip(bucket, slots):
+                self.slots[s] = k
+
+        free = [s for s in range(n) if self.slots[s] is None]
+        for b in range(n):
+            if len(buckets[b]) == 1:
+                s = free.pop()
+                self.displacements[b] = -s - 1
+                self.slots[s] = buckets[b][0]
+
+        self.keys = self.slots
+
+    def lookup(self, key):
+        d = self.displacements[hash(key, 0) % len(self.displacements)]
+        slot = -d - 1 if d < 0 else hash(key, d) % len(self.keys)
+        return slot if self.keys[slot] == key else -1
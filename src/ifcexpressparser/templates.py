@@ -47,8 +47,7 @@ const char* const Identifier = "%(schema_name_upper)s";
 %(declarations)s
 
 %(class_definitions)s
-IFC_PARSE_API void InitStringMap();
-IFC_PARSE_API IfcUtil::IfcBaseClass* SchemaEntity(IfcEntityInstanceData* e = 0);
+IFC_PARSE_API IfcUtil::IfcBaseClass* SchemaEntity(IfcEntityInstanceData* e = 0, IfcParse::IfcArena* arena = 0);
 }
 
 #endif
@@ -72,6 +71,7 @@ namespace Type {
         %(types)s, UNDEFINED
     } Enum;
     IFC_PARSE_API boost::optional<Enum> Parent(Enum v);
+    IFC_PARSE_API bool IsSubtypeOf(Enum v, Enum w);
     IFC_PARSE_API Enum FromString(const std::string& s);
     IFC_PARSE_API const std::string& ToString(Enum v);
     IFC_PARSE_API bool IsSimple(Enum v);
@@ -114,6 +114,7 @@ implementation= """
 #include "../ifcparse/%(schema_name)s.h"
 #include "../ifcparse/IfcException.h"
 #include "../ifcparse/IfcWrite.h"
+#include "../ifcparse/IfcPerfectHash.h"
 
 #include <map>
 
@@ -121,7 +122,7 @@ using namespace %(schema_name)s;
 using namespace IfcParse;
 using namespace IfcWrite;
 
-IfcUtil::IfcBaseClass* %(schema_name)s::SchemaEntity(IfcEntityInstanceData* e) {
+IfcUtil::IfcBaseClass* %(schema_name)s::SchemaEntity(IfcEntityInstanceData* e, IfcParse::IfcArena* arena) {
     switch(e->type()) {
 %(schema_entity_statements)s
         default: throw IfcException("Unable to find find keyword in schema"); break;
@@ -134,16 +135,13 @@ const std::string& Type::ToString(Enum v) {
     return names[v];
 }
 
-static std::map<std::string,Type::Enum> string_map;
-void %(schema_name)s::InitStringMap() {
-%(string_map_statements)s
-}
-
 Type::Enum Type::FromString(const std::string& s) {
-    if (string_map.empty()) InitStringMap();
-    std::map<std::string,Type::Enum>::const_iterator it = string_map.find(s);
-    if ( it == string_map.end() ) throw IfcException("Unable to find find keyword in schema");
-    else return it->second;
+    static const char* const keys[] = { %(type_hash_keys)s };
+    static const Type::Enum values[] = { %(type_hash_values)s };
+    static const int displacements[] = { %(type_hash_displacements)s };
+    const int i = IfcParse::perfect_hash::lookup(s, displacements, %(max_id)d, keys, %(max_id)d);
+    if ( i < 0 ) throw IfcException("Unable to find find keyword in schema");
+    else return values[i];
 }
 
 static int parent_map[] = {%(parent_type_statements)s};
@@ -156,6 +154,15 @@ boost::optional<Type::Enum> Type::Parent(Enum v){
     }
 }
 
+// The types are numbered in depth-first order of the inheritance tree, so that
+// a type and its subtypes occupy the range [type_range_begin, type_range_end]
+static const unsigned short type_range_begin[] = {%(type_range_begin)s};
+static const unsigned short type_range_end[] = {%(type_range_end)s};
+bool Type::IsSubtypeOf(Enum v, Enum w) {
+    const unsigned short i = type_range_begin[v];
+    return i >= type_range_begin[w] && i <= type_range_end[w];
+}
+
 bool Type::IsSimple(Enum v) {
     return %(simple_type_statement)s;
 }
@@ -355,7 +362,6 @@ class IFC_PARSE_API %(name)s : public %(superclass)s {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit %(name)s (IfcEntityInstanceData* e);
@@ -367,8 +373,6 @@ public:
 simpletype_impl_comment = "// Function implementations for %(name)s"
 simpletype_impl_argument_type = "if (i == 0) { return %(attr_type)s; } else { throw IfcParse::IfcAttributeOutOfRangeException(\"Argument index out of range\"); }"
 simpletype_impl_argument = "return entity->getArgument(i);"
-simpletype_impl_is_with_supertype = "return v == Type::%(class_name)s || %(superclass)s::is(v);"
-simpletype_impl_is_without_supertype = "return v == %(class_name)s::Class();"
 simpletype_impl_type = "return Type::%(class_name)s;"
 simpletype_impl_class = "return Type::%(class_name)s;"
 simpletype_impl_explicit_constructor = "entity = e;"
@@ -397,8 +401,7 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const {%(argument_entity_function_body)s}
     virtual const char* getArgumentName(unsigned int i) const {%(argument_name_function_body)s}
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-%(inverse)s    bool is(Type::Enum v) const;
-    Type::Enum type() const;
+%(inverse)s    Type::Enum type() const;
     static Type::Enum Class();
     %(name)s (IfcEntityInstanceData* e);
     %(name)s (%(constructor_arguments)s);
@@ -414,14 +417,17 @@ const char* %(name)s::ToString(%(name)s v) {
 }
 
 %(name)s::%(name)s %(name)s::FromString(const std::string& s) {
-%(from_string_statements)s
-    throw IfcException("Unable to find find keyword in schema");
+    static const char* const keys[] = { %(hash_keys)s };
+    static const %(name)s values[] = { %(hash_values)s };
+    static const int displacements[] = { %(hash_displacements)s };
+    const int i = IfcParse::perfect_hash::lookup(s, displacements, %(max_id)d, keys, %(max_id)d);
+    if ( i < 0 ) throw IfcException("Unable to find find keyword in schema");
+    else return values[i];
 }
 """
 
 entity_implementation = """// Function implementations for %(name)s
-%(attributes)s%(inverse)sbool %(name)s::is(Type::Enum v) const { return v == Type::%(name)s%(parent_type_test)s; }
-Type::Enum %(name)s::type() const { return Type::%(name)s; }
+%(attributes)s%(inverse)sType::Enum %(name)s::type() const { return Type::%(name)s; }
 Type::Enum %(name)s::Class() { return Type::%(name)s; }
 %(name)s::%(name)s(IfcEntityInstanceData* e) : %(superclass)s { if (!e) return; if (e->type() != Type::%(name)s) throw IfcException("Unable to find find keyword in schema"); entity = e; }
 %(name)s::%(name)s(%(constructor_arguments)s) : %(superclass)s {entity = new IfcEntityInstanceData(Class()); %(constructor_implementation)s }
@@ -442,13 +448,12 @@ list_list_type = "IfcTemplatedEntityListList< %(instance_type)s >::ptr"
 untyped_list = "IfcEntityList::ptr"
 inverse_attr = "IfcTemplatedEntityList< %(entity)s >::ptr %(name)s() const; // INVERSE %(entity)s::%(attribute)s"
 
-enum_from_string_stmt = '    if (s == "%(value)s") return ::%(schema_name)s::%(name)s::%(short_name)s_%(value)s;'
+enum_value = '::%(schema_name)s::%(name)s::%(short_name)s_%(value)s'
 
-schema_entity_stmt = '        case Type::%(name)s: return new %(name)s(e); break;'
-string_map_statement = '    string_map["%(uppercase_name)s"%(padding)s] = Type::%(name)s;'
+schema_entity_stmt = '        case Type::%(name)s: return arena ? new (arena) %(name)s(e) : new %(name)s(e); break;'
+type_value = 'Type::%(name)s'
 parent_type_stmt = '    if(v==%(name)s%(padding)s) { return %(parent)s; }'
 
-parent_type_test = " || %s::is(v)"
 
 optional_attr_stmt = "return !entity->getArgument(%(index)d)->isNull();"
 
@@ -460,9 +465,9 @@ get_attr_stmt_nested_array = "IfcEntityListList::ptr es = *entity->getArgument(%
 
 get_inverse = "return entity->getInverse(Type::%(type)s, %(index)d)->as<%(type)s>();"
 
-set_attr_stmt       = "{IfcWrite::IfcWriteArgument* attr = new IfcWrite::IfcWriteArgument();attr->set(v"                                                                     +");entity->setArgument(%(index)d,attr);}"
-set_attr_stmt_enum  = "{IfcWrite::IfcWriteArgument* attr = new IfcWrite::IfcWriteArgument();attr->set(IfcWrite::IfcWriteArgument::EnumerationReference(v,%(type)s::ToString(v)));entity->setArgument(%(index)d,attr);}"
-set_attr_stmt_array = "{IfcWrite::IfcWriteArgument* attr = new IfcWrite::IfcWriteArgument();attr->set(v->generalize()"                                                       +");entity->setArgument(%(index)d,attr);}"
+set_attr_stmt       = "{IfcWrite::IfcWriteArgument* attr = new IfcWrite::IfcWriteArgument();attr->set(v"                                                                     +");entity->setArgument(%(index)d,attr);delete attr;}"
+set_attr_stmt_enum  = "{IfcWrite::IfcWriteArgument* attr = new IfcWrite::IfcWriteArgument();attr->set(IfcWrite::IfcWriteArgument::EnumerationReference(v,%(type)s::ToString(v)));entity->setArgument(%(index)d,attr);delete attr;}"
+set_attr_stmt_array = "{IfcWrite::IfcWriteArgument* attr = new IfcWrite::IfcWriteArgument();attr->set(v->generalize()"                                                       +");entity->setArgument(%(index)d,attr);delete attr;}"
 
 constructor_stmt          = "{IfcWrite::IfcWriteArgument* attr = new IfcWrite::IfcWriteArgument();attr->set((%(name)s)"                                                                                +");entity->setArgument(%(index)d,attr);}"
 constructor_stmt_enum     = "{IfcWrite::IfcWriteArgument* attr = new IfcWrite::IfcWriteArgument();attr->set((IfcWrite::IfcWriteArgument::EnumerationReference(%(name)s,%(type)s::ToString(%(name)s)))" +");entity->setArgument(%(index)d,attr);}"
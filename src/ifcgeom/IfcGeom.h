@@ -53,6 +53,7 @@ inline static bool ALMOST_THE_SAME(const T& a, const T& b, double tolerance=ALMO
 #include "../ifcgeom/IfcGeomRepresentation.h" 
 #include "../ifcgeom/IfcRepresentationShapeItem.h"
 #include "../ifcgeom/IfcGeomShapeType.h"
+#include "../ifcgeom/IfcGeomCache.h"
 #include "ifc_geom_api.h"
 
 // Define this in case you want to conserve memory usage at all cost. This has been
@@ -66,9 +67,8 @@ inline static bool ALMOST_THE_SAME(const T& a, const T& b, double tolerance=ALMO
 
 #else
 
-#define IN_CACHE(T,E,t,e) std::map<int,t>::const_iterator it = cache.T.find(E->entity->id());\
-if ( it != cache.T.end() ) { e = it->second; return true; }
-#define CACHE(T,E,e) cache.T[E->entity->id()] = e;
+#define IN_CACHE(T,E,t,e) if ( cache.T.find(E->entity->id(), e) ) { return true; }
+#define CACHE(T,E,e) cache.T.insert(E->entity->id(), e);
 
 #endif
 
@@ -91,10 +91,31 @@ namespace IfcGeom {
 			: geometry_exception("Too many faces for operation") {}
 	};
 
-class IFC_GEOM_API Cache {
+class DiskCache;
+class DiskCacheKey;
+
+class IFC_GEOM_API Cache : public CacheLru {
 public:
 #include "IfcRegisterCreateCache.h"
-	std::map<int, TopoDS_Shape> Shape;
+	CacheMap<TopoDS_Shape> Shape;
+
+	/// By default the entries are estimated to take at most 128 megabytes
+	explicit Cache(size_t budget = 128 * 1024 * 1024)
+		: CacheLru(budget)
+	{
+#include "IfcRegisterInitCache.h"
+		Shape.attach(this);
+	}
+
+	void clear() {
+#include "IfcRegisterPurgeCache.h"
+		Shape.clear();
+		clear_entries();
+	}
+
+private:
+	Cache(const Cache&); // N/I
+	Cache& operator=(const Cache&); // N/I
 };
 
 class IFC_GEOM_API Kernel {
@@ -115,6 +136,9 @@ private:
 
 	std::map<int, SurfaceStyle> style_cache;
 
+	// Not owned, shared with the kernels of other threads
+	DiskCache* disk_cache;
+
 	const SurfaceStyle* internalize_surface_style(const std::pair<IfcSchema::IfcSurfaceStyle*, IfcSchema::IfcSurfaceStyleShading*>& shading_style);
 
 	 // For stopping PlacementRelTo recursion in convert(const IfcSchema::IfcObjectPlacement* l, gp_Trsf& trsf)
@@ -130,6 +154,7 @@ public:
 		, ifc_planeangle_unit(-1.0)
 		, modelling_precision(0.00001)
 		, dimensionality(1.)
+		, disk_cache(0)
 		, placement_rel_to(IfcSchema::Type::UNDEFINED)
 	{}
 
@@ -147,6 +172,12 @@ public:
 		setValue(GV_PRECISION,                other.getValue(GV_PRECISION));
 		setValue(GV_DIMENSIONALITY,           other.getValue(GV_DIMENSIONALITY));
 		setValue(GV_DEFLECTION_TOLERANCE,     other.getValue(GV_DEFLECTION_TOLERANCE));
+		placement_rel_to = other.placement_rel_to;
+		disk_cache = other.disk_cache;
+#ifndef NO_CACHE
+		// Only the budget of the cache is copied, not its contents
+		cache.set_budget(other.cache.budget());
+#endif
 		return *this;
 	}
 
@@ -272,6 +303,10 @@ public:
 
     static std::map<std::string, IfcSchema::IfcPresentationLayerAssignment*> get_layers(IfcSchema::IfcProduct* prod);
 
+	/// Adds the settings and the content of the instances that are read in the conversion
+	/// of the representation of the product to its key in the disk cache.
+	void disk_cache_key(const IteratorSettings&, IfcSchema::IfcRepresentation*, IfcSchema::IfcProduct*, IfcSchema::IfcRelVoidsElement::list::ptr openings, DiskCacheKey& key);
+
 	template <typename P>
     IfcGeom::BRepElement<P>* create_brep_for_representation_and_product(
         const IteratorSettings&, IfcSchema::IfcRepresentation*, IfcSchema::IfcProduct*);
@@ -336,14 +371,34 @@ public:
 	}
 
 	void purge_cache() { 
-		// Rather hack-ish, but a stopgap solution to keep memory under control
-		// for large files. SurfaceStyles need to be kept at all costs, as they
-		// are read later on when serializing Collada files.
+		// SurfaceStyles need to be kept at all costs, as they are read later on
+		// when serializing Collada files.
 #ifndef NO_CACHE
-		cache = Cache(); 
+		cache.clear();
 #endif
 	}
 
+	/// Sets the estimated memory, in bytes, that the cache of converted geometry
+	/// may use, after which the least recently used entries are evicted. Zero
+	/// disables the cache.
+	void set_cache_budget(size_t budget) {
+#ifndef NO_CACHE
+		cache.set_budget(budget);
+#endif
+	}
+
+	CacheStatistics cache_statistics() const {
+#ifndef NO_CACHE
+		return cache.statistics();
+#else
+		return CacheStatistics();
+#endif
+	}
+
+	/// Sets a cache of converted shapes that persists between runs, which is not
+	/// owned by the kernel. Null, the default, disables it.
+	void set_disk_cache(DiskCache* cache) { disk_cache = cache; }
+
 	void set_conversion_placement_rel_to(IfcSchema::Type::Enum type);
 
 #include "IfcRegisterGeomHeader.h"
@@ -0,0 +1,216 @@
+/********************************************************************************
+ *                                                                              *
+ * This file is part of IfcOpenShell.                                           *
+ *                                                                              *
+ * IfcOpenShell is free software: you can redistribute it and/or modify         *
+ * it under the terms of the Lesser GNU General Public License as published by  *
+ * the Free Software Foundation, either version 3.0 of the License, or          *
+ * (at your option) any later version.                                          *
+ *                                                                              *
+ * IfcOpenShell is distributed in the hope that it will be useful,              *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of               *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                 *
+ * Lesser GNU General Public License for more details.                          *
+ *                                                                              *
+ * You should have received a copy of the Lesser GNU General Public License     *
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.         *
+ *                                                                              *
+ ********************************************************************************/
+
+/********************************************************************************
+ *                                                                              *
+ * The building blocks of the cache of converted geometry of IfcGeom::Kernel.   *
+ * For every cached type there is an IfcGeom::CacheMap, keyed by the id of the  *
+ * entity instance. The entries of all maps of a cache are kept in a single     *
+ * list by IfcGeom::CacheLru, ordered by their last use, along with an estimate *
+ * of their memory usage. When the estimated memory usage exceeds the budget    *
+ * the least recently used entries are evicted.                                 *
+ *                                                                              *
+ ********************************************************************************/
+
+#ifndef IFCGEOMCACHE_H
+#define IFCGEOMCACHE_H
+
+#include <list>
+#include <utility>
+#include <cstddef>
+
+#include <boost/unordered_map.hpp>
+
+#include "ifc_geom_api.h"
+
+class TopoDS_Shape;
+
+namespace IfcGeom {
+
+	/// Counters to tune the budget of the cache against a model
+	struct CacheStatistics {
+		size_t hits;
+		size_t misses;
+		size_t evictions;
+		/// The highest estimated memory usage in bytes, when combined the sum of
+		/// the peaks of the caches, hence an upper bound of their combined peak
+		size_t peak_size;
+
+		CacheStatistics() : hits(0), misses(0), evictions(0), peak_size(0) {}
+
+		CacheStatistics& operator+=(const CacheStatistics& other) {
+			hits += other.hits;
+			misses += other.misses;
+			evictions += other.evictions;
+			peak_size += other.peak_size;
+			return *this;
+		}
+	};
+
+	/// The memory used by a cached value in addition to its size, zero unless
+	/// the value refers to data elsewhere. For shapes this is estimated from
+	/// the number of faces and edges.
+	template <typename V>
+	inline size_t cache_size_of(const V&) { return 0; }
+
+	IFC_GEOM_API size_t cache_size_of(const TopoDS_Shape& shape);
+
+	class CacheLru {
+	public:
+		class map_base {
+		public:
+			virtual void erase(int id) = 0;
+		protected:
+			~map_base() {}
+		};
+
+		struct entry {
+			map_base* map;
+			int id;
+			size_t size;
+		};
+
+		// Most recently used first
+		typedef std::list<entry> entries_t;
+
+	private:
+		entries_t entries_;
+		size_t budget_;
+		size_t size_;
+		CacheStatistics statistics_;
+
+		CacheLru(const CacheLru&); // N/I
+		CacheLru& operator=(const CacheLru&); // N/I
+
+	public:
+		explicit CacheLru(size_t budget)
+			: budget_(budget)
+			, size_(0)
+		{}
+
+		size_t budget() const { return budget_; }
+		void set_budget(size_t budget) {
+			budget_ = budget;
+			evict();
+		}
+
+		/// The estimated memory used by the entries, in bytes
+		size_t size() const { return size_; }
+		const CacheStatistics& statistics() const { return statistics_; }
+
+		entries_t::iterator add(map_base* map, int id, size_t size) {
+			entry e = { map, id, size };
+			entries_.push_front(e);
+			size_ += size;
+			return entries_.begin();
+		}
+
+		void hit(entries_t::iterator it) {
+			++statistics_.hits;
+			entries_.splice(entries_.begin(), entries_, it);
+		}
+
+		void miss() {
+			++statistics_.misses;
+		}
+
+		void remove(entries_t::iterator it) {
+			size_ -= it->size;
+			entries_.erase(it);
+		}
+
+		void evict() {
+			while (size_ > budget_ && !entries_.empty()) {
+				const entry e = entries_.back();
+				entries_.pop_back();
+				size_ -= e.size;
+				++statistics_.evictions;
+				e.map->erase(e.id);
+			}
+			// Called after every insertion, so this is the peak once the entries
+			// over budget have been evicted
+			if (size_ > statistics_.peak_size) {
+				statistics_.peak_size = size_;
+			}
+		}
+
+	protected:
+		/// To be called after the maps have been cleared
+		void clear_entries() {
+			entries_.clear();
+			size_ = 0;
+		}
+	};
+
+	template <typename V>
+	class CacheMap : public CacheLru::map_base {
+	private:
+		typedef boost::unordered_map<int, std::pair<V, CacheLru::entries_t::iterator> > map_t;
+
+		CacheLru* lru_;
+		map_t map_;
+
+		CacheMap(const CacheMap&); // N/I
+		CacheMap& operator=(const CacheMap&); // N/I
+
+	public:
+		CacheMap() : lru_(0) {}
+
+		void attach(CacheLru* lru) { lru_ = lru; }
+
+		bool find(int id, V& v) {
+			typename map_t::iterator it = map_.find(id);
+			if (it == map_.end()) {
+				lru_->miss();
+				return false;
+			}
+			lru_->hit(it->second.second);
+			v = it->second.first;
+			return true;
+		}
+
+		void insert(int id, const V& v) {
+			if (lru_->budget() == 0) {
+				return;
+			}
+			typename map_t::iterator it = map_.find(id);
+			if (it != map_.end()) {
+				lru_->remove(it->second.second);
+				map_.erase(it);
+			}
+			// Approximates the memory of a node in the map
+			const size_t size = sizeof(typename map_t::value_type) + sizeof(CacheLru::entry) + 4 * sizeof(void*) + cache_size_of(v);
+			map_.insert(std::make_pair(id, std::make_pair(v, lru_->add(this, id, size))));
+			lru_->evict();
+		}
+
+		void erase(int id) {
+			map_.erase(id);
+		}
+
+		void clear() {
+			map_.clear();
+		}
+
+		size_t size() const { return map_.size(); }
+	};
+
+}
+
+#endif
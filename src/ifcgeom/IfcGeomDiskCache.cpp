@@ -0,0 +1,500 @@
+/********************************************************************************
+ *                                                                              *
+ * This file is part of IfcOpenShell.                                           *
+ *                                                                              *
+ * IfcOpenShell is free software: you can redistribute it and/or modify         *
+ * it under the terms of the Lesser GNU General Public License as published by  *
+ * the Free Software Foundation, either version 3.0 of the License, or          *
+ * (at your option) any later version.                                          *
+ *                                                                              *
+ * IfcOpenShell is distributed in the hope that it will be useful,              *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of               *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                 *
+ * Lesser GNU General Public License for more details.                          *
+ *                                                                              *
+ * You should have received a copy of the Lesser GNU General Public License     *
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.         *
+ *                                                                              *
+ ********************************************************************************/
+
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+#ifdef _WIN32
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
+
+#include <boost/thread/thread.hpp>
+
+#include <Standard_Version.hxx>
+#include <Standard_Failure.hxx>
+#include <Precision.hxx>
+#include <BinTools.hxx>
+#include <gp_Trsf.hxx>
+
+#include "../ifcparse/IfcParse.h"
+#include "../ifcparse/IfcLogger.h"
+#include "../ifcparse/utils.h"
+
+#include "../ifcgeom/IfcGeomDiskCache.h"
+
+namespace {
+
+	int process_id() {
+#ifdef _WIN32
+		return _getpid();
+#else
+		return getpid();
+#endif
+	}
+
+	// Identifies the layout of the files, to be incremented when it changes
+	const std::string file_header = "IfcOpenShell-cache-2";
+
+	// The files are only read by the machine that wrote them, hence values are
+	// stored in their native representation.
+	class writer {
+	private:
+		std::string& data_;
+	public:
+		explicit writer(std::string& data) : data_(data) {}
+
+		template <typename T>
+		writer& operator<<(const T& t) {
+			data_.append(reinterpret_cast<const char*>(&t), sizeof(T));
+			return *this;
+		}
+
+		writer& operator<<(const std::string& s) {
+			*this << (unsigned) s.size();
+			data_.append(s);
+			return *this;
+		}
+
+		template <typename T>
+		writer& operator<<(const std::vector<T>& v) {
+			*this << (unsigned) v.size();
+			if (!v.empty()) {
+				data_.append(reinterpret_cast<const char*>(&v[0]), v.size() * sizeof(T));
+			}
+			return *this;
+		}
+	};
+
+	class reader {
+	private:
+		const std::string& data_;
+		size_t position_;
+		bool good_;
+
+		const char* take_(size_t n) {
+			if (!good_ || data_.size() - position_ < n) {
+				good_ = false;
+				return 0;
+			}
+			const char* p = data_.data() + position_;
+			position_ += n;
+			return p;
+		}
+	public:
+		explicit reader(const std::string& data) : data_(data), position_(0), good_(true) {}
+
+		/// Whether all values could be read
+		bool good() const { return good_; }
+		/// Whether all values could be read and nothing remains
+		bool done() const { return good_ && position_ == data_.size(); }
+
+		template <typename T>
+		reader& operator>>(T& t) {
+			const char* p = take_(sizeof(T));
+			if (p) {
+				memcpy(&t, p, sizeof(T));
+			}
+			return *this;
+		}
+
+		reader& operator>>(std::string& s) {
+			unsigned n = 0;
+			*this >> n;
+			const char* p = take_(n);
+			if (p) {
+				s.assign(p, n);
+			}
+			return *this;
+		}
+
+		template <typename T>
+		reader& operator>>(std::vector<T>& v) {
+			unsigned n = 0;
+			*this >> n;
+			const char* p = take_((size_t) n * sizeof(T));
+			if (p) {
+				v.resize(n);
+				if (n) {
+					memcpy(&v[0], p, (size_t) n * sizeof(T));
+				}
+			}
+			return *this;
+		}
+	};
+
+	template <typename T>
+	void write_optional(writer& w, const boost::optional<T>& t) {
+		w << !!t;
+		if (t) {
+			w << *t;
+		}
+	}
+
+	template <typename T>
+	void read_optional(reader& r, boost::optional<T>& t) {
+		bool has_value = false;
+		r >> has_value;
+		if (has_value) {
+			T value;
+			r >> value;
+			t = value;
+		}
+	}
+
+	void write_color(writer& w, const boost::optional<IfcGeom::SurfaceStyle::ColorComponent>& c) {
+		w << !!c;
+		if (c) {
+			w << c->R() << c->G() << c->B();
+		}
+	}
+
+	void read_color(reader& r, boost::optional<IfcGeom::SurfaceStyle::ColorComponent>& c) {
+		bool has_value = false;
+		r >> has_value;
+		if (has_value) {
+			double rgb[3];
+			r >> rgb[0] >> rgb[1] >> rgb[2];
+			c = IfcGeom::SurfaceStyle::ColorComponent(rgb[0], rgb[1], rgb[2]);
+		}
+	}
+
+	// Styles that are derived from an instance refer to it by its position in the
+	// key, as the instance has a different id when the file is saved again. Returns
+	// false if the style cannot be recreated that way.
+	bool write_style(writer& w, const IfcGeom::SurfaceStyle& style, const std::map<unsigned int, int>& positions) {
+		boost::optional<int> position;
+		IfcGeom::SurfaceStyle named, unnamed;
+		if (style.Id()) {
+			std::map<unsigned int, int>::const_iterator it = positions.find((unsigned int) *style.Id());
+			if (it == positions.end()) {
+				return false;
+			}
+			position = it->second;
+			named = IfcGeom::SurfaceStyle(*style.Id(), style.original_name());
+			unnamed = IfcGeom::SurfaceStyle(*style.Id());
+		} else {
+			named = IfcGeom::SurfaceStyle(style.original_name());
+		}
+		const bool has_name = style.Name() == named.Name();
+		if (!has_name && style.Name() != unnamed.Name()) {
+			return false;
+		}
+		write_optional(w, position);
+		w << style.original_name() << has_name;
+		write_color(w, style.Diffuse());
+		write_color(w, style.Specular());
+		write_optional(w, style.Transparency());
+		write_optional(w, style.Specularity());
+		return true;
+	}
+
+	bool read_style(reader& r, IfcGeom::SurfaceStyle& style, const std::vector<IfcUtil::IfcBaseClass*>& instances) {
+		boost::optional<int> position;
+		std::string original_name;
+		bool has_name = false;
+		read_optional(r, position);
+		r >> original_name >> has_name;
+		if (!r.good()) {
+			return false;
+		}
+		if (position) {
+			if (*position < 0 || (size_t) *position >= instances.size()) {
+				return false;
+			}
+			const int id = (int) instances[*position]->entity->id();
+			style = has_name ? IfcGeom::SurfaceStyle(id, original_name) : IfcGeom::SurfaceStyle(id);
+		} else {
+			style = has_name ? IfcGeom::SurfaceStyle(original_name) : IfcGeom::SurfaceStyle();
+		}
+		read_color(r, style.Diffuse());
+		read_color(r, style.Specular());
+		read_optional(r, style.Transparency());
+		read_optional(r, style.Specularity());
+		return r.good();
+	}
+
+	void write_placement(writer& w, const gp_GTrsf& trsf) {
+		w << (int) trsf.Form();
+		for (int i = 1; i <= 3; ++i) {
+			for (int j = 1; j <= 4; ++j) {
+				w << trsf.Value(i, j);
+			}
+		}
+	}
+
+	void read_placement(reader& r, gp_GTrsf& trsf) {
+		int form = 0;
+		double v[3][4];
+		r >> form;
+		for (int i = 0; i < 3; ++i) {
+			for (int j = 0; j < 4; ++j) {
+				r >> v[i][j];
+			}
+		}
+		if (form == gp_Identity) {
+			trsf = gp_GTrsf();
+		} else if (form == gp_Other) {
+			trsf = gp_GTrsf();
+			for (int i = 0; i < 3; ++i) {
+				for (int j = 0; j < 4; ++j) {
+					trsf.SetValue(i + 1, j + 1, v[i][j]);
+				}
+			}
+		} else {
+			// Recreated as an affine transformation so that shapes are moved rather
+			// than converted to NURBS when the placement is applied.
+			gp_Trsf t;
+#if OCC_VERSION_HEX < 0x70000
+			t.SetValues(
+				v[0][0], v[0][1], v[0][2], v[0][3],
+				v[1][0], v[1][1], v[1][2], v[1][3],
+				v[2][0], v[2][1], v[2][2], v[2][3],
+				Precision::Angular(), Precision::Confusion());
+#else
+			t.SetValues(
+				v[0][0], v[0][1], v[0][2], v[0][3],
+				v[1][0], v[1][1], v[1][2], v[1][3],
+				v[2][0], v[2][1], v[2][2], v[2][3]);
+#endif
+			trsf = gp_GTrsf(t);
+		}
+	}
+
+}
+
+IfcGeom::DiskCache::DiskCache(const std::string& directory)
+	: directory_(directory)
+	, write_failed_(false)
+{
+	if (!directory_.empty() && directory_[directory_.size() - 1] != '/' && directory_[directory_.size() - 1] != '\\') {
+		directory_ += "/";
+	}
+}
+
+bool IfcGeom::DiskCache::read_shapes(const DiskCacheKey& key, IfcRepresentationShapeItems& shapes, bool& layerset_applied, bool& material_style_applied) {
+	std::string data;
+	if (!read_(filename_(key.str(), ".brep"), data)) {
+		boost::mutex::scoped_lock lock(mutex_);
+		++statistics_.shape_misses;
+		return false;
+	}
+
+	reader r(data);
+	std::string header;
+	bool layerset = false, material_style = false;
+	unsigned num_shapes = 0;
+	r >> header >> layerset >> material_style >> num_shapes;
+
+	IfcRepresentationShapeItems result;
+	for (unsigned i = 0; r.good() && header == file_header && i < num_shapes; ++i) {
+		gp_GTrsf placement;
+		read_placement(r, placement);
+
+		std::string shape_data;
+		r >> shape_data;
+		TopoDS_Shape shape;
+		try {
+			std::istringstream stream(shape_data, std::ios::in | std::ios::binary);
+			BinTools::Read(shape, stream);
+		} catch (const Standard_Failure&) {
+			break;
+		}
+
+		bool has_style = false;
+		r >> has_style;
+		const SurfaceStyle* style = 0;
+		if (has_style) {
+			SurfaceStyle s;
+			if (!read_style(r, s, key.instances())) {
+				break;
+			}
+			style = internalize_style_(s);
+		}
+
+		result.push_back(IfcRepresentationShapeItem(placement, shape, style));
+	}
+
+	const bool success = r.done() && header == file_header && result.size() == num_shapes;
+
+	boost::mutex::scoped_lock lock(mutex_);
+	if (success) {
+		++statistics_.shape_hits;
+		layerset_applied = layerset;
+		material_style_applied = material_style;
+		shapes.swap(result);
+	} else {
+		++statistics_.shape_misses;
+	}
+	return success;
+}
+
+void IfcGeom::DiskCache::write_shapes(const DiskCacheKey& key, const IfcRepresentationShapeItems& shapes, bool layerset_applied, bool material_style_applied) {
+	// The first position of the instances by their id
+	std::map<unsigned int, int> positions;
+	const std::vector<IfcUtil::IfcBaseClass*>& instances = key.instances();
+	for (size_t i = 0; i < instances.size(); ++i) {
+		positions.insert(std::make_pair(instances[i]->entity->id(), (int) i));
+	}
+
+	std::string data;
+	writer w(data);
+	w << file_header << layerset_applied << material_style_applied << (unsigned) shapes.size();
+	for (IfcRepresentationShapeItems::const_iterator it = shapes.begin(); it != shapes.end(); ++it) {
+		write_placement(w, it->Placement());
+
+		std::ostringstream stream(std::ios::out | std::ios::binary);
+		try {
+			BinTools::Write(it->Shape(), stream);
+		} catch (const Standard_Failure&) {
+			return;
+		}
+		w << stream.str();
+
+		w << it->hasStyle();
+		if (it->hasStyle() && !write_style(w, it->Style(), positions)) {
+			return;
+		}
+	}
+	write_(filename_(key.str(), ".brep"), data);
+}
+
+template <typename P>
+IfcGeom::Representation::Triangulation<P>* IfcGeom::DiskCache::read_triangulation(const Representation::BRep& shape_model) {
+	if (shape_model.cache_key().empty()) {
+		return 0;
+	}
+
+	DiskCacheKey key;
+	key << shape_model.cache_key() << shape_model.settings().deflection_tolerance() << (int) sizeof(P);
+
+	std::string data;
+	if (!read_(filename_(key.str(), ".tri"), data)) {
+		boost::mutex::scoped_lock lock(mutex_);
+		++statistics_.triangulation_misses;
+		return 0;
+	}
+
+	reader r(data);
+	std::string header;
+	std::vector<P> verts, normals, uvs;
+	std::vector<int> faces, edges, material_ids;
+	r >> header >> verts >> faces >> edges >> normals >> uvs >> material_ids;
+
+	const bool success = r.done() && header == file_header;
+	{
+		boost::mutex::scoped_lock lock(mutex_);
+		if (success) {
+			++statistics_.triangulation_hits;
+		} else {
+			++statistics_.triangulation_misses;
+		}
+	}
+
+	return success
+		? new Representation::Triangulation<P>(shape_model, verts, faces, edges, normals, uvs, material_ids)
+		: 0;
+}
+
+template <typename P>
+void IfcGeom::DiskCache::write_triangulation(const Representation::BRep& shape_model, const Representation::Triangulation<P>& triangulation) {
+	if (shape_model.cache_key().empty()) {
+		return;
+	}
+
+	DiskCacheKey key;
+	key << shape_model.cache_key() << shape_model.settings().deflection_tolerance() << (int) sizeof(P);
+
+	std::string data;
+	writer w(data);
+	w << file_header
+		<< triangulation.verts()
+		<< triangulation.faces()
+		<< triangulation.edges()
+		<< triangulation.normals()
+		<< triangulation.uvs()
+		<< triangulation.material_ids();
+	write_(filename_(key.str(), ".tri"), data);
+}
+
+IfcGeom::DiskCacheStatistics IfcGeom::DiskCache::statistics() const {
+	boost::mutex::scoped_lock lock(mutex_);
+	return statistics_;
+}
+
+std::string IfcGeom::DiskCache::filename_(const std::string& key, const std::string& extension) const {
+	return directory_ + key + extension;
+}
+
+bool IfcGeom::DiskCache::read_(const std::string& filename, std::string& data) {
+	std::ifstream stream(IfcUtil::path::from_utf8(filename).c_str(), std::ios::in | std::ios::binary);
+	if (!stream.is_open()) {
+		return false;
+	}
+	std::ostringstream contents(std::ios::out | std::ios::binary);
+	contents << stream.rdbuf();
+	data = contents.str();
+	return true;
+}
+
+void IfcGeom::DiskCache::write_(const std::string& filename, const std::string& data) {
+	// Written to a temporary file first, so that other processes and threads never
+	// read a partially written file. The name is unique per process and thread, as
+	// the same entry can be written concurrently by several processes that share
+	// the cache directory and by several threads of the iterator.
+	std::stringstream temp_filename;
+	temp_filename << filename << "." << process_id() << "." << boost::this_thread::get_id() << ".tmp";
+
+	bool success;
+	{
+		std::ofstream stream(IfcUtil::path::from_utf8(temp_filename.str()).c_str(), std::ios::out | std::ios::binary);
+		stream.write(data.data(), data.size());
+		success = stream.good();
+	}
+	success = success && IfcUtil::path::rename_file(temp_filename.str(), filename);
+	if (!success) {
+		IfcUtil::path::delete_file(temp_filename.str());
+	}
+
+	boost::mutex::scoped_lock lock(mutex_);
+	if (success) {
+		++statistics_.writes;
+	} else if (!write_failed_) {
+		write_failed_ = true;
+		Logger::Warning("Unable to write to cache directory " + directory_);
+	}
+}
+
+const IfcGeom::SurfaceStyle* IfcGeom::DiskCache::internalize_style_(const SurfaceStyle& style) {
+	// Items of the kernel that refer to the same style refer to a different instance,
+	// serializers identify materials by their name so that this does not matter.
+	boost::mutex::scoped_lock lock(mutex_);
+	std::map<std::string, SurfaceStyle>::iterator it = styles_.find(style.Name());
+	if (it == styles_.end()) {
+		it = styles_.insert(std::make_pair(style.Name(), style)).first;
+	}
+	return &it->second;
+}
+
+template IFC_GEOM_API IfcGeom::Representation::Triangulation<float>* IfcGeom::DiskCache::read_triangulation<float>(const Representation::BRep& shape_model);
+template IFC_GEOM_API IfcGeom::Representation::Triangulation<double>* IfcGeom::DiskCache::read_triangulation<double>(const Representation::BRep& shape_model);
+template IFC_GEOM_API void IfcGeom::DiskCache::write_triangulation<float>(const Representation::BRep& shape_model, const Representation::Triangulation<float>& triangulation);
+template IFC_GEOM_API void IfcGeom::DiskCache::write_triangulation<double>(const Representation::BRep& shape_model, const Representation::Triangulation<double>& triangulation);
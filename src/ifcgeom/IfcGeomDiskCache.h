@@ -0,0 +1,103 @@
+/********************************************************************************
+ *                                                                              *
+ * This file is part of IfcOpenShell.                                           *
+ *                                                                              *
+ * IfcOpenShell is free software: you can redistribute it and/or modify         *
+ * it under the terms of the Lesser GNU General Public License as published by  *
+ * the Free Software Foundation, either version 3.0 of the License, or          *
+ * (at your option) any later version.                                          *
+ *                                                                              *
+ * IfcOpenShell is distributed in the hope that it will be useful,              *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of               *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                 *
+ * Lesser GNU General Public License for more details.                          *
+ *                                                                              *
+ * You should have received a copy of the Lesser GNU General Public License     *
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.         *
+ *                                                                              *
+ ********************************************************************************/
+
+/********************************************************************************
+ *                                                                              *
+ * A cache of converted geometry in a directory that persists between runs.     *
+ * The shapes of a representation of a product are stored in the binary format  *
+ * of Open Cascade under an IfcGeom::DiskCacheKey of the instances that are     *
+ * read to create them, along with the settings that affect them. Their         *
+ * triangulations are stored under that same key combined with the settings of  *
+ * the mesher. Hence, as long as an element and the settings stay the same,     *
+ * subsequent runs can skip its conversion, including the boolean operations,   *
+ * and its triangulation.                                                       *
+ *                                                                              *
+ ********************************************************************************/
+
+#ifndef IFCGEOMDISKCACHE_H
+#define IFCGEOMDISKCACHE_H
+
+#include <map>
+#include <string>
+#include <vector>
+#include <cstddef>
+
+#include <boost/thread/mutex.hpp>
+
+#include "../ifcgeom/IfcGeomDiskCacheKey.h"
+#include "../ifcgeom/IfcGeomRepresentation.h"
+#include "../ifcgeom/IfcGeomRenderStyles.h"
+#include "ifc_geom_api.h"
+
+namespace IfcGeom {
+
+	struct DiskCacheStatistics {
+		size_t shape_hits;
+		size_t shape_misses;
+		size_t triangulation_hits;
+		size_t triangulation_misses;
+		size_t writes;
+
+		DiskCacheStatistics()
+			: shape_hits(0), shape_misses(0)
+			, triangulation_hits(0), triangulation_misses(0)
+			, writes(0) {}
+	};
+
+	class IFC_GEOM_API DiskCache {
+	public:
+		explicit DiskCache(const std::string& directory);
+
+		/// Reads the shapes stored under the key, returns false if there are none. The
+		/// styles of the shapes are owned by the cache. Whether layer sets and the style
+		/// of the material of the product have been applied to the shapes is returned
+		/// as well, so that the id of the representation can be recreated.
+		bool read_shapes(const DiskCacheKey& key, IfcRepresentationShapeItems& shapes, bool& layerset_applied, bool& material_style_applied);
+		/// Stores the shapes, unless they have a style that is derived from an instance
+		/// that is not part of the key.
+		void write_shapes(const DiskCacheKey& key, const IfcRepresentationShapeItems& shapes, bool layerset_applied, bool material_style_applied);
+
+		/// Reads the triangulation of the shape model, if the shape model has a cache key
+		/// and its triangulation with the same settings has been stored, or returns null.
+		template <typename P>
+		Representation::Triangulation<P>* read_triangulation(const Representation::BRep& shape_model);
+		template <typename P>
+		void write_triangulation(const Representation::BRep& shape_model, const Representation::Triangulation<P>& triangulation);
+
+		DiskCacheStatistics statistics() const;
+
+	private:
+		std::string directory_;
+		std::map<std::string, SurfaceStyle> styles_;
+		DiskCacheStatistics statistics_;
+		bool write_failed_;
+		mutable boost::mutex mutex_;
+
+		DiskCache(const DiskCache&); // N/I
+		DiskCache& operator=(const DiskCache&); // N/I
+
+		std::string filename_(const std::string& key, const std::string& extension) const;
+		bool read_(const std::string& filename, std::string& data);
+		void write_(const std::string& filename, const std::string& data);
+		const SurfaceStyle* internalize_style_(const SurfaceStyle& style);
+	};
+
+}
+
+#endif
@@ -0,0 +1,317 @@
+/********************************************************************************
+ *                                                                              *
+ * This file is part of IfcOpenShell.                                           *
+ *                                                                              *
+ * IfcOpenShell is free software: you can redistribute it and/or modify         *
+ * it under the terms of the Lesser GNU General Public License as published by  *
+ * the Free Software Foundation, either version 3.0 of the License, or          *
+ * (at your option) any later version.                                          *
+ *                                                                              *
+ * IfcOpenShell is distributed in the hope that it will be useful,              *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of               *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                 *
+ * Lesser GNU General Public License for more details.                          *
+ *                                                                              *
+ * You should have received a copy of the Lesser GNU General Public License     *
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.         *
+ *                                                                              *
+ ********************************************************************************/
+
+#include <algorithm>
+#include <sstream>
+#include <iomanip>
+
+#include "../ifcgeom/IfcGeomDiskCacheKey.h"
+
+namespace {
+
+	// The GlobalId, OwnerHistory, Name and Description of rooted instances, the
+	// ObjectType of objects and the Tag of elements are not read by the kernel.
+	bool is_descriptive(IfcUtil::IfcBaseClass* instance, unsigned int i) {
+		if (!instance->is(IfcSchema::Type::IfcRoot)) {
+			return false;
+		}
+		return i < 4
+			|| (i == 4 && instance->is(IfcSchema::Type::IfcObject))
+			|| (i == 7 && instance->is(IfcSchema::Type::IfcElement));
+	}
+
+}
+
+IfcGeom::DiskCacheKey& IfcGeom::DiskCacheKey::operator<<(const std::string& s) {
+	// The length is included so that consecutive strings are delimited
+	const unsigned n = (unsigned) s.size();
+	sha1_.process_bytes(&n, sizeof(n));
+	sha1_.process_bytes(s.data(), s.size());
+	return *this;
+}
+
+IfcGeom::DiskCacheKey& IfcGeom::DiskCacheKey::operator<<(double d) {
+	sha1_.process_bytes(&d, sizeof(d));
+	return *this;
+}
+
+IfcGeom::DiskCacheKey& IfcGeom::DiskCacheKey::operator<<(int i) {
+	sha1_.process_bytes(&i, sizeof(i));
+	return *this;
+}
+
+IfcGeom::DiskCacheKey& IfcGeom::DiskCacheKey::add_representation(IfcSchema::IfcRepresentation* representation, IfcSchema::IfcProduct* product,
+	IfcSchema::IfcRelVoidsElement::list::ptr openings, bool include_connected_walls)
+{
+	// Only the placement of the product is read, other instances can refer to it
+	register_(product);
+	*this << IfcSchema::Type::ToString(product->type());
+	if (product->hasObjectPlacement()) {
+		add_instance_(product->ObjectPlacement());
+	} else {
+		*this << std::string("$");
+	}
+	add_instance_(representation);
+
+	std::vector<DiskCacheKey> keys;
+
+	// The styles of representation items are assigned by means of inverse attributes
+	const size_t num_instances = instances_.size();
+	for (size_t i = 0; i < num_instances; ++i) {
+		if (!instances_[i]->is(IfcSchema::Type::IfcRepresentationItem)) {
+			continue;
+		}
+		IfcSchema::IfcStyledItem::list::ptr styled_items = instances_[i]->as<IfcSchema::IfcRepresentationItem>()->StyledByItem();
+		for (IfcSchema::IfcStyledItem::list::it it = styled_items->begin(); it != styled_items->end(); ++it) {
+			keys.push_back(DiskCacheKey(this));
+			keys.back().add_instance_(*it);
+		}
+	}
+	merge_(keys);
+
+	IfcSchema::IfcRelAssociatesMaterial::list::ptr associated_materials = product->HasAssociations()->as<IfcSchema::IfcRelAssociatesMaterial>();
+	for (IfcSchema::IfcRelAssociatesMaterial::list::it it = associated_materials->begin(); it != associated_materials->end(); ++it) {
+		keys.push_back(DiskCacheKey(this));
+		DiskCacheKey& key = keys.back();
+		key.add_instance_((*it)->RelatingMaterial());
+		// As are the styles of materials
+		for (size_t i = 0; i < key.instances_.size(); ++i) {
+			if (!key.instances_[i]->is(IfcSchema::Type::IfcMaterial)) {
+				continue;
+			}
+			IfcSchema::IfcMaterialDefinitionRepresentation::list::ptr defs = key.instances_[i]->as<IfcSchema::IfcMaterial>()->HasRepresentation();
+			for (IfcSchema::IfcMaterialDefinitionRepresentation::list::it jt = defs->begin(); jt != defs->end(); ++jt) {
+				key.add_instance_(*jt);
+			}
+		}
+	}
+	merge_(keys);
+
+	if (openings) {
+		for (IfcSchema::IfcRelVoidsElement::list::it it = openings->begin(); it != openings->end(); ++it) {
+			keys.push_back(DiskCacheKey(this));
+			keys.back().add_product_((*it)->RelatedOpeningElement());
+		}
+		merge_(keys);
+	}
+
+	// Layer sets of walls are folded along the walls they are connected to
+	if (include_connected_walls && product->as<IfcSchema::IfcWall>()) {
+		IfcSchema::IfcWall* wall = product->as<IfcSchema::IfcWall>();
+		IfcSchema::IfcRelConnectsElements::list::ptr connections(new IfcSchema::IfcRelConnectsElements::list);
+		connections->push(wall->ConnectedFrom());
+		connections->push(wall->ConnectedTo());
+		for (IfcSchema::IfcRelConnectsElements::list::it it = connections->begin(); it != connections->end(); ++it) {
+			keys.push_back(DiskCacheKey(this));
+			keys.back().add_instance_(*it);
+		}
+		merge_(keys);
+	}
+
+	return *this;
+}
+
+std::string IfcGeom::DiskCacheKey::str() const {
+	// Obtaining the digest alters the state of the hash
+	boost::uuids::detail::sha1 sha1 = sha1_;
+	boost::uuids::detail::sha1::digest_type digest;
+	sha1.get_digest(digest);
+	std::stringstream ss;
+	ss << std::hex << std::setfill('0');
+	// The digest is an array of five 32 bit words on older versions of Boost and
+	// of twenty bytes on newer versions.
+	const size_t word_size = sizeof(digest) / sizeof(digest[0]) == 5 ? 8 : 2;
+	for (size_t i = 0; i < sizeof(digest) / sizeof(digest[0]); ++i) {
+		ss << std::setw(word_size) << (unsigned) digest[i];
+	}
+	return ss.str();
+}
+
+void IfcGeom::DiskCacheKey::add_instance_(IfcUtil::IfcBaseClass* instance) {
+	// Every save of a file updates the owner histories
+	if (instance->is(IfcSchema::Type::IfcOwnerHistory)) {
+		*this << std::string("IfcOwnerHistory");
+		return;
+	}
+
+	// Instances that have been added before are referred to by their position
+	std::map<IfcUtil::IfcBaseClass*, int>::const_iterator it = positions_.find(instance);
+	if (it != positions_.end()) {
+		*this << std::string("#") << it->second;
+		return;
+	}
+	int level = 1;
+	for (const DiskCacheKey* parent = parent_; parent; parent = parent->parent_, ++level) {
+		it = parent->positions_.find(instance);
+		if (it != parent->positions_.end()) {
+			*this << std::string("^") << level << it->second;
+			return;
+		}
+	}
+
+	register_(instance);
+	*this << IfcSchema::Type::ToString(instance->type());
+	const unsigned int count = instance->entity->getArgumentCount();
+	*this << (int) count;
+	for (unsigned int i = 0; i < count; ++i) {
+		if (is_descriptive(instance, i)) {
+			*this << std::string("-");
+		} else {
+			add_argument_(instance->entity->getArgument(i));
+		}
+	}
+
+	// Placements are converted relative to the placement of a type of product, if set
+	if (instance->is(IfcSchema::Type::IfcObjectPlacement)) {
+		IfcSchema::IfcProduct::list::ptr products = instance->as<IfcSchema::IfcObjectPlacement>()->PlacesObject();
+		std::vector<std::string> types;
+		for (IfcSchema::IfcProduct::list::it jt = products->begin(); jt != products->end(); ++jt) {
+			types.push_back(IfcSchema::Type::ToString((*jt)->type()));
+		}
+		std::sort(types.begin(), types.end());
+		*this << (int) types.size();
+		for (std::vector<std::string>::const_iterator jt = types.begin(); jt != types.end(); ++jt) {
+			*this << *jt;
+		}
+	}
+}
+
+void IfcGeom::DiskCacheKey::add_argument_(Argument* argument) {
+	const IfcUtil::ArgumentType type = argument->type();
+	*this << (int) type;
+	switch (type) {
+	case IfcUtil::Argument_INT:
+		*this << static_cast<int>(*argument);
+		break;
+	case IfcUtil::Argument_BOOL:
+		*this << static_cast<bool>(*argument);
+		break;
+	case IfcUtil::Argument_DOUBLE:
+		*this << static_cast<double>(*argument);
+		break;
+	case IfcUtil::Argument_STRING:
+		*this << static_cast<std::string>(*argument);
+		break;
+	case IfcUtil::Argument_ENTITY_INSTANCE:
+		add_instance_(*argument);
+		break;
+	case IfcUtil::Argument_AGGREGATE_OF_INT: {
+		const std::vector<int> values = *argument;
+		*this << (int) values.size();
+		for (std::vector<int>::const_iterator it = values.begin(); it != values.end(); ++it) {
+			*this << *it;
+		}
+		break; }
+	case IfcUtil::Argument_AGGREGATE_OF_DOUBLE: {
+		const std::vector<double> values = *argument;
+		*this << (int) values.size();
+		for (std::vector<double>::const_iterator it = values.begin(); it != values.end(); ++it) {
+			*this << *it;
+		}
+		break; }
+	case IfcUtil::Argument_AGGREGATE_OF_STRING: {
+		const std::vector<std::string> values = *argument;
+		*this << (int) values.size();
+		for (std::vector<std::string>::const_iterator it = values.begin(); it != values.end(); ++it) {
+			*this << *it;
+		}
+		break; }
+	case IfcUtil::Argument_AGGREGATE_OF_ENTITY_INSTANCE: {
+		IfcEntityList::ptr instances = *argument;
+		*this << (int) instances->size();
+		for (IfcEntityList::it it = instances->begin(); it != instances->end(); ++it) {
+			add_instance_(*it);
+		}
+		break; }
+	case IfcUtil::Argument_AGGREGATE_OF_AGGREGATE_OF_INT: {
+		const std::vector< std::vector<int> > values = *argument;
+		*this << (int) values.size();
+		for (std::vector< std::vector<int> >::const_iterator it = values.begin(); it != values.end(); ++it) {
+			*this << (int) it->size();
+			for (std::vector<int>::const_iterator jt = it->begin(); jt != it->end(); ++jt) {
+				*this << *jt;
+			}
+		}
+		break; }
+	case IfcUtil::Argument_AGGREGATE_OF_AGGREGATE_OF_DOUBLE: {
+		const std::vector< std::vector<double> > values = *argument;
+		*this << (int) values.size();
+		for (std::vector< std::vector<double> >::const_iterator it = values.begin(); it != values.end(); ++it) {
+			*this << (int) it->size();
+			for (std::vector<double>::const_iterator jt = it->begin(); jt != it->end(); ++jt) {
+				*this << *jt;
+			}
+		}
+		break; }
+	case IfcUtil::Argument_AGGREGATE_OF_AGGREGATE_OF_ENTITY_INSTANCE: {
+		IfcEntityListList::ptr instances = *argument;
+		*this << instances->size();
+		for (IfcEntityListList::outer_it it = instances->begin(); it != instances->end(); ++it) {
+			*this << (int) it->size();
+			for (IfcEntityListList::inner_it jt = it->begin(); jt != it->end(); ++jt) {
+				add_instance_(*jt);
+			}
+		}
+		break; }
+	default:
+		// Null, derived, enumerations, binaries and empty aggregates, none of
+		// which refer to other instances
+		*this << argument->toString();
+	}
+}
+
+void IfcGeom::DiskCacheKey::add_product_(IfcSchema::IfcProduct* product) {
+	register_(product);
+	*this << IfcSchema::Type::ToString(product->type());
+	if (product->hasObjectPlacement()) {
+		add_instance_(product->ObjectPlacement());
+	} else {
+		*this << std::string("$");
+	}
+	if (product->hasRepresentation()) {
+		add_instance_(product->Representation());
+	} else {
+		*this << std::string("$");
+	}
+}
+
+void IfcGeom::DiskCacheKey::register_(IfcUtil::IfcBaseClass* instance) {
+	if (positions_.find(instance) == positions_.end()) {
+		positions_[instance] = (int) instances_.size();
+		instances_.push_back(instance);
+	}
+}
+
+void IfcGeom::DiskCacheKey::merge_(std::vector<DiskCacheKey>& keys) {
+	std::vector< std::pair<std::string, size_t> > digests;
+	for (size_t i = 0; i < keys.size(); ++i) {
+		digests.push_back(std::make_pair(keys[i].str(), i));
+	}
+	std::sort(digests.begin(), digests.end());
+
+	*this << (int) digests.size();
+	for (std::vector< std::pair<std::string, size_t> >::const_iterator it = digests.begin(); it != digests.end(); ++it) {
+		*this << it->first;
+		const std::vector<IfcUtil::IfcBaseClass*>& instances = keys[it->second].instances_;
+		for (std::vector<IfcUtil::IfcBaseClass*>::const_iterator jt = instances.begin(); jt != instances.end(); ++jt) {
+			register_(*jt);
+		}
+	}
+	keys.clear();
+}
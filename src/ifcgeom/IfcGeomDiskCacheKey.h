@@ -0,0 +1,94 @@
+/********************************************************************************
+ *                                                                              *
+ * This file is part of IfcOpenShell.                                           *
+ *                                                                              *
+ * IfcOpenShell is free software: you can redistribute it and/or modify         *
+ * it under the terms of the Lesser GNU General Public License as published by  *
+ * the Free Software Foundation, either version 3.0 of the License, or          *
+ * (at your option) any later version.                                          *
+ *                                                                              *
+ * IfcOpenShell is distributed in the hope that it will be useful,              *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of               *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                 *
+ * Lesser GNU General Public License for more details.                          *
+ *                                                                              *
+ * You should have received a copy of the Lesser GNU General Public License     *
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.         *
+ *                                                                              *
+ ********************************************************************************/
+
+/********************************************************************************
+ *                                                                              *
+ * The key under which the shapes of a representation of a product are stored   *
+ * in an IfcGeom::DiskCache. It is a hash of the content of the instances the   *
+ * shapes are created from: the representation items and their styles, the      *
+ * placement of the product, its materials and openings. Instances refer to     *
+ * each other by the position at which they are first encountered, rather than  *
+ * by their id, and attributes that do not affect the geometry, such as names,  *
+ * are left out. Hence, the key stays the same when a file is saved again with  *
+ * a different numbering of instances or when elements are renamed.             *
+ *                                                                              *
+ ********************************************************************************/
+
+#ifndef IFCGEOMDISKCACHEKEY_H
+#define IFCGEOMDISKCACHEKEY_H
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include <boost/version.hpp>
+
+#if BOOST_VERSION >= 106600
+#include <boost/uuid/detail/sha1.hpp>
+#else
+#include <boost/uuid/sha1.hpp>
+#endif
+
+#include "../ifcparse/IfcParse.h"
+
+#include "ifc_geom_api.h"
+
+namespace IfcGeom {
+
+	class IFC_GEOM_API DiskCacheKey {
+	private:
+		boost::uuids::detail::sha1 sha1_;
+		std::vector<IfcUtil::IfcBaseClass*> instances_;
+		std::map<IfcUtil::IfcBaseClass*, int> positions_;
+		const DiskCacheKey* parent_;
+
+		explicit DiskCacheKey(const DiskCacheKey* parent) : parent_(parent) {}
+
+		void add_instance_(IfcUtil::IfcBaseClass* instance);
+		void add_argument_(Argument* argument);
+		void add_product_(IfcSchema::IfcProduct* product);
+		void register_(IfcUtil::IfcBaseClass* instance);
+		/// Adds the digests of instances that are found by means of inverse attributes,
+		/// in an order that does not depend on the order of the instances in the file.
+		void merge_(std::vector<DiskCacheKey>& keys);
+	public:
+		DiskCacheKey() : parent_(0) {}
+
+		DiskCacheKey& operator<<(const std::string& s);
+		DiskCacheKey& operator<<(double d);
+		DiskCacheKey& operator<<(int i);
+		DiskCacheKey& operator<<(bool b) { return *this << (int) b; }
+
+		/// Adds the content that determines the shapes of the representation of the
+		/// product. The openings are to be null if they are not subtracted. The walls
+		/// the product is connected to are included if its layer sets are folded.
+		DiskCacheKey& add_representation(IfcSchema::IfcRepresentation* representation, IfcSchema::IfcProduct* product,
+			IfcSchema::IfcRelVoidsElement::list::ptr openings, bool include_connected_walls);
+
+		/// The instances that have been added, in the order of their positions. Positions
+		/// can be used to refer to instances in the cache across files.
+		const std::vector<IfcUtil::IfcBaseClass*>& instances() const { return instances_; }
+
+		/// The hexadecimal digest of everything that has been added
+		std::string str() const;
+	};
+
+}
+
+#endif
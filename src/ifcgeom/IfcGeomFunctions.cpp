@@ -150,6 +150,7 @@
 #include "../ifcparse/IfcFile.h"
 #include "../ifcgeom/IfcGeom.h"
 #include "../ifcgeom/IfcGeomTree.h"
+#include "../ifcgeom/IfcGeomDiskCache.h"
 
 #if OCC_VERSION_HEX < 0x60900
 #ifdef _MSC_VER
@@ -1433,6 +1434,27 @@ const IfcSchema::IfcMaterial* IfcGeom::Kernel::get_single_material_association(c
 	return single_material;
 }
 
+void IfcGeom::Kernel::disk_cache_key(const IteratorSettings& settings, IfcSchema::IfcRepresentation* representation, IfcSchema::IfcProduct* product, IfcSchema::IfcRelVoidsElement::list::ptr openings, DiskCacheKey& key) {
+	key << std::string(IFCOPENSHELL_VERSION) << (int) OCC_VERSION_HEX;
+#ifdef USE_IFC4
+	key << std::string("IFC4");
+#else
+	key << std::string("IFC2X3");
+#endif
+	for (IteratorSettings::SettingField setting = 1; setting <= IteratorSettings::BUILDING_LOCAL_PLACEMENT; setting <<= 1) {
+		key << settings.get(setting);
+	}
+	for (int value = GV_DEFLECTION_TOLERANCE; value <= GV_DIMENSIONALITY; ++value) {
+		key << getValue((GeomValue) value);
+	}
+	key << (int) placement_rel_to;
+
+	if (settings.get(IteratorSettings::DISABLE_OPENING_SUBTRACTIONS)) {
+		openings.reset();
+	}
+	key.add_representation(representation, product, openings, settings.get(IteratorSettings::APPLY_LAYERSETS));
+}
+
 template <typename P>
 IfcGeom::BRepElement<P>* IfcGeom::Kernel::create_brep_for_representation_and_product(
     const IteratorSettings& settings, IfcSchema::IfcRepresentation* representation, IfcSchema::IfcProduct* product)
@@ -1444,11 +1466,25 @@ IfcGeom::BRepElement<P>* IfcGeom::Kernel::create_brep_for_representation_and_pro
 	IfcGeom::Representation::BRep* shape;
 	IfcGeom::IfcRepresentationShapeItems shapes, shapes2;
 
-	if ( !convert_shapes(representation, shapes) ) {
+	// Does the IfcElement have any IfcOpenings?
+	// Note that openings for IfcOpeningElements are not processed
+	IfcSchema::IfcRelVoidsElement::list::ptr openings = find_openings(product);
+
+	// On a hit in the disk cache the shapes are read including the layer sets,
+	// material styles and opening subtractions that have been applied to them.
+	DiskCacheKey cache_key;
+	bool from_disk_cache = false;
+	bool layerset_applied = false, material_style_applied = false;
+	if (disk_cache) {
+		disk_cache_key(settings, representation, product, openings, cache_key);
+		from_disk_cache = disk_cache->read_shapes(cache_key, shapes, layerset_applied, material_style_applied);
+	}
+
+	if ( !from_disk_cache && !convert_shapes(representation, shapes) ) {
 		return 0;
 	}
 
-	if (settings.get(IteratorSettings::APPLY_LAYERSETS)) {
+	if (!from_disk_cache && settings.get(IteratorSettings::APPLY_LAYERSETS)) {
 		TopoDS_Shape merge;
 		if (flatten_shape_list(shapes, merge, false)) {
 			if (count(merge, TopAbs_FACE) > 0) {
@@ -1457,16 +1493,7 @@ IfcGeom::BRepElement<P>* IfcGeom::Kernel::create_brep_for_representation_and_pro
 				std::vector< std::vector<Handle_Geom_Surface> > folded_layers;
 				std::vector<const SurfaceStyle*> styles;
 				if (convert_layerset(product, layers, styles, thickness)) {
-
-					IfcSchema::IfcRelAssociates::list::ptr associations = product->HasAssociations();
-					for (IfcSchema::IfcRelAssociates::list::it it = associations->begin(); it != associations->end(); ++it) {
-						IfcSchema::IfcRelAssociatesMaterial* associates_material = (**it).as<IfcSchema::IfcRelAssociatesMaterial>();
-						if (associates_material) {
-							unsigned layerset_id = associates_material->RelatingMaterial()->entity->id();
-							representation_id_builder << "-layerset-" << layerset_id;
-							break;
-						}
-					}
+					layerset_applied = true;
 					
 					if (styles.size() > 1) {
 						// If there's only a single layer there is no need to manipulate geometries.
@@ -1492,7 +1519,17 @@ IfcGeom::BRepElement<P>* IfcGeom::Kernel::create_brep_for_representation_and_pro
 		}
 	}
 
-	bool material_style_applied = false;
+	if (layerset_applied) {
+		IfcSchema::IfcRelAssociates::list::ptr associations = product->HasAssociations();
+		for (IfcSchema::IfcRelAssociates::list::it it = associations->begin(); it != associations->end(); ++it) {
+			IfcSchema::IfcRelAssociatesMaterial* associates_material = (**it).as<IfcSchema::IfcRelAssociatesMaterial>();
+			if (associates_material) {
+				unsigned layerset_id = associates_material->RelatingMaterial()->entity->id();
+				representation_id_builder << "-layerset-" << layerset_id;
+				break;
+			}
+		}
+	}
 
 	const IfcSchema::IfcMaterial* single_material = get_single_material_association(product);
 	if (single_material) {
@@ -1516,7 +1553,7 @@ IfcGeom::BRepElement<P>* IfcGeom::Kernel::create_brep_for_representation_and_pro
 		}
     }
 
-	if (material_style_applied) {
+	if (material_style_applied && single_material) {
 		representation_id_builder << "-material-" << single_material->entity->id();
 	}
 
@@ -1542,19 +1579,28 @@ IfcGeom::BRepElement<P>* IfcGeom::Kernel::create_brep_for_representation_and_pro
 		Logger::Error("Failed to construct placement");
 	}
 
-	// Does the IfcElement have any IfcOpenings?
-	// Note that openings for IfcOpeningElements are not processed
-	IfcSchema::IfcRelVoidsElement::list::ptr openings = find_openings(product);
-
 	const std::string product_type = IfcSchema::Type::ToString(product->type());
 	ElementSettings element_settings(settings, getValue(GV_LENGTH_UNIT), product_type);
 
-    if (!settings.get(IfcGeom::IteratorSettings::DISABLE_OPENING_SUBTRACTIONS) && openings && openings->size()) {
+	// The id of a representation read from the disk cache is recreated from the
+	// instances in this file, as they may have been numbered differently.
+	const bool subtract_openings = !settings.get(IfcGeom::IteratorSettings::DISABLE_OPENING_SUBTRACTIONS) && openings && openings->size();
+	if (subtract_openings) {
 		representation_id_builder << "-openings";
 		for (IfcSchema::IfcRelVoidsElement::list::it it = openings->begin(); it != openings->end(); ++it) {
 			representation_id_builder << "-" << (*it)->entity->id();
 		}
+	}
 
+	const std::string cache_key_digest = disk_cache ? cache_key.str() : std::string();
+
+	if (from_disk_cache) {
+		if (settings.get(IteratorSettings::USE_WORLD_COORDS)) {
+			trsf = gp_Trsf();
+			representation_id_builder << "-world-coords";
+		}
+		shape = new IfcGeom::Representation::BRep(element_settings, representation_id_builder.str(), shapes, cache_key_digest);
+	} else if (subtract_openings) {
 		IfcGeom::IfcRepresentationShapeItems opened_shapes;
 		bool caught_error = false;
 		try {
@@ -1595,16 +1641,20 @@ IfcGeom::BRepElement<P>* IfcGeom::Kernel::create_brep_for_representation_and_pro
 			trsf = gp_Trsf();
 			representation_id_builder << "-world-coords";
 		}
-		shape = new IfcGeom::Representation::BRep(element_settings, representation_id_builder.str(), opened_shapes);
+		shape = new IfcGeom::Representation::BRep(element_settings, representation_id_builder.str(), opened_shapes, cache_key_digest);
     } else if (settings.get(IteratorSettings::USE_WORLD_COORDS)) {
 		for ( IfcGeom::IfcRepresentationShapeItems::iterator it = shapes.begin(); it != shapes.end(); ++ it ) {
 			it->prepend(trsf);
 		}
 		trsf = gp_Trsf();
 		representation_id_builder << "-world-coords";
-		shape = new IfcGeom::Representation::BRep(element_settings, representation_id_builder.str(), shapes);
+		shape = new IfcGeom::Representation::BRep(element_settings, representation_id_builder.str(), shapes, cache_key_digest);
 	} else {
-		shape = new IfcGeom::Representation::BRep(element_settings, representation_id_builder.str(), shapes);
+		shape = new IfcGeom::Representation::BRep(element_settings, representation_id_builder.str(), shapes, cache_key_digest);
+	}
+
+	if (disk_cache && !from_disk_cache) {
+		disk_cache->write_shapes(cache_key, shape->shapes(), layerset_applied, material_style_applied);
 	}
 
 	std::string context_string = "";
@@ -53,6 +53,16 @@
  * IfcGeom::Iterator::progress()                                                *
  *   returns an int in [0..100] that indicates the overall progress             *
  *                                                                              *
+ * IfcGeom::Iterator::set_num_threads()                                         *
+ *   distributes the representations over a number of worker threads, each     *
+ *   with a Kernel of its own, when called before initialize()                  *
+ *                                                                              *
+ * IfcGeom::Iterator::set_schedule_by_cost()                                    *
+ *   hands out the representations that are estimated to take longest first    *
+ *                                                                              *
+ * IfcGeom::Iterator::set_disk_cache_directory()                                *
+ *   reuses the shapes and triangulations of elements from previous runs        *
+ *                                                                              *
  ********************************************************************************/
 
 #ifndef IFCGEOMITERATOR_H
@@ -60,11 +70,19 @@
 
 #include <map>
 #include <set>
+#include <deque>
+#include <sstream>
 #include <vector>
 #include <limits>
 #include <algorithm>
 
 #include <boost/algorithm/string.hpp>
+#include <boost/bind.hpp>
+#include <boost/scoped_ptr.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/condition_variable.hpp>
+#include <boost/date_time/posix_time/posix_time.hpp>
 
 #include <gp_Mat.hxx>
 #include <gp_Mat2d.hxx>
@@ -76,6 +94,7 @@
 #include "../ifcparse/IfcFile.h"
 
 #include "../ifcgeom/IfcGeom.h"
+#include "../ifcgeom/IfcGeomDiskCache.h"
 #include "../ifcgeom/IfcGeomElement.h"
 #include "../ifcgeom/IfcGeomMaterial.h"
 #include "../ifcgeom/IfcGeomIteratorSettings.h"
@@ -138,6 +157,46 @@ namespace IfcGeom {
             IfcSchema::IfcProduct* product;
         };
 
+		// The elements created for a single product, in the parallel mode these
+		// are created ahead by the worker threads
+		struct shape_result {
+			BRepElement<P>* shape_model;
+			SerializedElement<P>* serialization;
+			TriangulationElement<P>* triangulation;
+		};
+		typedef std::vector<shape_result> shape_results;
+
+		unsigned num_threads_;
+		bool ordered_;
+		bool schedule_by_cost_;
+		bool log_timings_;
+
+		// State shared between the worker threads and the thread calling next(),
+		// guarded by worker_mutex_. Representation tasks_[task_order_[i]] is handed
+		// out to a worker if i < next_task_ and its results are stored in
+		// finished_tasks_ until they are consumed. When scheduling by cost, the
+		// workers first claim the tasks i < next_estimate_ to estimate their cost
+		// task_costs_[i], and wait until num_estimates_done_ covers all tasks.
+		boost::thread_group workers_;
+		std::vector<Kernel*> worker_kernels_;
+		boost::mutex worker_mutex_;
+		boost::condition_variable task_available_;
+		boost::condition_variable results_available_;
+		std::vector<IfcSchema::IfcRepresentation*> tasks_;
+		std::vector<size_t> task_order_;
+		std::vector<double> task_costs_;
+		size_t next_estimate_;
+		size_t num_estimates_done_;
+		boost::posix_time::ptime estimates_started_;
+		size_t next_task_;
+		size_t num_tasks_consumed_;
+		bool stopping_;
+		std::map<size_t, shape_results*> finished_tasks_;
+		std::deque<shape_result> pending_results_;
+
+		// Shared by the kernels of all threads
+		boost::scoped_ptr<DiskCache> disk_cache_;
+
 		void initUnits() {
 			IfcSchema::IfcProject::list::ptr projects = ifc_file->entitiesByType<IfcSchema::IfcProject>();
 			if (projects->size() == 1) {
@@ -285,6 +344,10 @@ namespace IfcGeom {
 			representation_iterator = representations->begin();
 			ifcproducts.reset();
 
+			if (use_workers_()) {
+				start_workers_();
+			}
+
 			if (!create()) {
 				return false;
 			}
@@ -337,6 +400,54 @@ namespace IfcGeom {
 
 		int progress() const { return 100 * done / total; }
 
+		/// Sets the number of threads that create geometry, 0 uses the number of
+		/// hardware threads. To be called before initialize(). By default the
+		/// elements are returned in the same order as with a single thread,
+		/// otherwise they are returned in the order in which the representations
+		/// are completed.
+		void set_num_threads(unsigned num_threads, bool ordered = true) {
+			num_threads_ = num_threads ? num_threads : std::max(1U, boost::thread::hardware_concurrency());
+			ordered_ = ordered;
+		}
+
+		unsigned num_threads() const { return num_threads_; }
+
+		/// The hits, misses and evictions of the geometry caches of all threads,
+		/// to be read after all elements have been returned
+		CacheStatistics cache_statistics() const {
+			CacheStatistics statistics = kernel.cache_statistics();
+			for (std::vector<Kernel*>::const_iterator it = worker_kernels_.begin(); it != worker_kernels_.end(); ++it) {
+				statistics += (*it)->cache_statistics();
+			}
+			return statistics;
+		}
+
+		/// Hands out the representations to the worker threads in the order of their
+		/// estimated cost, most expensive first, so that these do not end up as the
+		/// long tail of the conversion. To be called before initialize(). In ordered
+		/// mode the elements are retained until it is their turn to be returned, so
+		/// this is best combined with returning them in the order of completion.
+		void set_schedule_by_cost(bool schedule_by_cost) { schedule_by_cost_ = schedule_by_cost; }
+
+		/// Logs, as notices, the time it took to process every representation along
+		/// with its estimated cost, to calibrate the estimate, as well as the time it
+		/// took to estimate the costs when scheduling by cost. To be called before
+		/// initialize().
+		void set_log_timings(bool log_timings) { log_timings_ = log_timings; }
+
+		/// Stores the shapes and triangulations of the elements in the directory, which
+		/// needs to exist, and reads them from it instead of creating them if they have
+		/// been stored before with the same settings. To be called before initialize().
+		void set_disk_cache_directory(const std::string& directory) {
+			disk_cache_.reset(new DiskCache(directory));
+			kernel.set_disk_cache(disk_cache_.get());
+		}
+
+		/// The hits, misses and writes of the disk cache, if set
+		DiskCacheStatistics disk_cache_statistics() const {
+			return disk_cache_ ? disk_cache_->statistics() : DiskCacheStatistics();
+		}
+
 		const std::string& getUnitName() const { return unit_name; }
 
         /// @note Double always as per IFC specification.
@@ -355,13 +466,6 @@ namespace IfcGeom {
 	private:
 		// Move to the next IfcRepresentation
 		void _nextShape() {
-			// In order to conserve memory and reduce cache insertion times, the cache is
-			// cleared after an arbitrary number of processed representations. This has been
-			// benchmarked extensively: https://github.com/IfcOpenShell/IfcOpenShell/pull/47
-			static const int clear_interval = 64;
-			if (done % clear_interval == clear_interval - 1) {
-				kernel.purge_cache();
-			}
 			ifcproducts.reset();
 			++ representation_iterator;
 			++ done;
@@ -369,7 +473,7 @@ namespace IfcGeom {
 
 		bool geometry_reuse_ok_for_current_representation_;
 
-		bool reuse_ok_(const IfcSchema::IfcProduct::list::ptr& products) {
+		bool reuse_ok_(Kernel& geometry_kernel, const IfcSchema::IfcProduct::list::ptr& products) {
 			// With world coords enabled, object transformations are directly applied to
 			// the BRep. There is no way to re-use the geometry for multiple products.
 			if (settings.get(IteratorSettings::USE_WORLD_COORDS)) {
@@ -381,7 +485,7 @@ namespace IfcGeom {
 			for (IfcSchema::IfcProduct::list::it it = products->begin(); it != products->end(); ++it) {
 				IfcSchema::IfcProduct* product = *it;
 
-				if (!settings.get(IteratorSettings::DISABLE_OPENING_SUBTRACTIONS) && kernel.find_openings(product)->size()) {
+				if (!settings.get(IteratorSettings::DISABLE_OPENING_SUBTRACTIONS) && geometry_kernel.find_openings(product)->size()) {
 					return false;
 				}
 
@@ -399,7 +503,7 @@ namespace IfcGeom {
 				}
 
 				// Note that this can be a nullptr (!), but the fact that set size should be one still holds
-				associated_single_materials.insert(kernel.get_single_material_association(product));
+				associated_single_materials.insert(geometry_kernel.get_single_material_association(product));
                 if (associated_single_materials.size() > 1) return false;
 			}
 
@@ -433,7 +537,7 @@ namespace IfcGeom {
                         continue;
                     }
 
-                    geometry_reuse_ok_for_current_representation_ = reuse_ok_(ifcproducts);
+                    geometry_reuse_ok_for_current_representation_ = reuse_ok_(kernel, ifcproducts);
 
 					IfcSchema::IfcRepresentationMap::list::ptr maps = representation->RepresentationMap();
 
@@ -456,7 +560,7 @@ namespace IfcGeom {
                     IfcSchema::IfcRepresentation* representation_mapped_to = kernel.representation_mapped_to(representation);
 					if (representation_mapped_to) {
                         representation_processed_as_mapped_item = geometry_reuse_ok_for_current_representation_ && (
-                            ok_mapped_representations->contains(representation_mapped_to) || reuse_ok_(kernel.products_represented_by(representation_mapped_to)));
+                            ok_mapped_representations->contains(representation_mapped_to) || reuse_ok_(kernel, kernel.products_represented_by(representation_mapped_to)));
 					}
 
 					if (representation_processed_as_mapped_item) {
@@ -505,6 +609,350 @@ namespace IfcGeom {
 			current_shape_model = 0;
 		}
 
+		static void free_result_(const shape_result& result) {
+			delete result.triangulation;
+			delete result.serialization;
+			delete result.shape_model;
+		}
+
+		// Scheduling and timing are implemented by the worker threads only, so
+		// these are used for a single thread as well when either is requested.
+		bool use_workers_() const {
+			return num_threads_ > 1 || schedule_by_cost_ || log_timings_;
+		}
+
+		// The number of representations that the workers are allowed to be ahead
+		// of the elements that are consumed, to keep memory usage bounded when the
+		// elements are consumed more slowly than they are created. When the elements
+		// are returned in order, but not handed out in order, there can be no limit.
+		size_t max_tasks_ahead_() const {
+			if (ordered_ && schedule_by_cost_) {
+				return std::numeric_limits<size_t>::max() / 2;
+			}
+			return 16 * num_threads_;
+		}
+
+		static size_t boolean_depth_(IfcSchema::IfcBooleanResult* result) {
+			size_t depth = 0;
+			IfcUtil::IfcBaseClass* operands[] = { result->FirstOperand(), result->SecondOperand() };
+			for (int i = 0; i < 2; ++i) {
+				if (operands[i]->is(IfcSchema::Type::IfcBooleanResult)) {
+					depth = std::max(depth, boolean_depth_(operands[i]->as<IfcSchema::IfcBooleanResult>()));
+				}
+			}
+			return depth + 1;
+		}
+
+		// An estimate of the time it takes to process a representation, in arbitrary
+		// units. The weights are a first guess, to be calibrated using set_log_timings().
+		// Called by the worker threads, each with its own kernel.
+		double estimate_cost_(Kernel& geometry_kernel, IfcSchema::IfcRepresentation* representation) {
+			size_t num_items = 0, num_points = 0, num_openings = 0, boolean_depth = 0;
+			try {
+				num_items = representation->Items()->size();
+
+				// Includes the items of mapped representations
+				IfcEntityList::ptr instances = ifc_file->traverse(representation);
+				for (IfcEntityList::it it = instances->begin(); it != instances->end(); ++it) {
+					if ((*it)->is(IfcSchema::Type::IfcCartesianPoint)) {
+						++num_points;
+					} else if ((*it)->is(IfcSchema::Type::IfcBooleanResult)) {
+						boolean_depth = std::max(boolean_depth, boolean_depth_((*it)->as<IfcSchema::IfcBooleanResult>()));
+					}
+				}
+
+				if (!settings.get(IteratorSettings::DISABLE_OPENING_SUBTRACTIONS)) {
+					IfcSchema::IfcProduct::list::ptr products = geometry_kernel.products_represented_by(representation);
+					for (IfcSchema::IfcProduct::list::it it = products->begin(); it != products->end(); ++it) {
+						num_openings += geometry_kernel.find_openings(*it)->size();
+					}
+				}
+			} catch (const std::exception& e) {
+				Logger::Error(e);
+			}
+			return 1. + num_items + num_points / 100. + 10. * num_openings + 10. * boolean_depth;
+		}
+
+		struct by_cost_descending {
+			by_cost_descending(const std::vector<double>& costs) : costs(costs) {}
+			bool operator()(size_t a, size_t b) const { return costs[a] > costs[b]; }
+			const std::vector<double>& costs;
+		};
+
+		void start_workers_() {
+			tasks_.assign(representations->begin(), representations->end());
+			task_order_.resize(tasks_.size());
+			for (size_t i = 0; i < tasks_.size(); ++i) {
+				task_order_[i] = i;
+			}
+			if (schedule_by_cost_) {
+				// Estimated by the workers, as traversing every representation and
+				// finding the openings of its products takes a while for large files
+				task_costs_.assign(tasks_.size(), 0.);
+				next_estimate_ = num_estimates_done_ = 0;
+				estimates_started_ = boost::posix_time::microsec_clock::universal_time();
+			}
+			next_task_ = num_tasks_consumed_ = 0;
+			stopping_ = false;
+			for (unsigned i = 0; i < num_threads_; ++i) {
+				// The copy takes over the units, precision and other values of the kernel,
+				// but starts with empty caches, which are therefore not shared between threads.
+				worker_kernels_.push_back(new Kernel(kernel));
+				workers_.create_thread(boost::bind(&Iterator::work_, this, worker_kernels_.back()));
+			}
+		}
+
+		void stop_workers_() {
+			{
+				boost::mutex::scoped_lock lock(worker_mutex_);
+				stopping_ = true;
+			}
+			task_available_.notify_all();
+			workers_.join_all();
+
+			for (typename std::map<size_t, shape_results*>::const_iterator it = finished_tasks_.begin(); it != finished_tasks_.end(); ++it) {
+				std::for_each(it->second->begin(), it->second->end(), &Iterator::free_result_);
+				delete it->second;
+			}
+			finished_tasks_.clear();
+			std::for_each(pending_results_.begin(), pending_results_.end(), &Iterator::free_result_);
+			pending_results_.clear();
+		}
+
+		// Estimates the costs of batches of representations not yet claimed by other
+		// workers, the worker finishing the last batch orders the tasks by their cost.
+		// Returns once all costs are known, or the workers are stopped.
+		void estimate_costs_(Kernel& worker_kernel) {
+			const size_t batch_size = 64;
+			for (;;) {
+				size_t begin, end;
+				{
+					boost::mutex::scoped_lock lock(worker_mutex_);
+					if (stopping_ || next_estimate_ == tasks_.size()) {
+						break;
+					}
+					begin = next_estimate_;
+					end = next_estimate_ = std::min(begin + batch_size, tasks_.size());
+				}
+
+				for (size_t i = begin; i < end; ++i) {
+					task_costs_[i] = estimate_cost_(worker_kernel, tasks_[i]);
+				}
+
+				bool all_done;
+				{
+					boost::mutex::scoped_lock lock(worker_mutex_);
+					num_estimates_done_ += end - begin;
+					all_done = num_estimates_done_ == tasks_.size();
+					if (all_done) {
+						std::stable_sort(task_order_.begin(), task_order_.end(), by_cost_descending(task_costs_));
+					}
+				}
+				if (all_done) {
+					if (log_timings_) {
+						const boost::posix_time::time_duration elapsed = boost::posix_time::microsec_clock::universal_time() - estimates_started_;
+						std::stringstream ss;
+						ss << "Estimated the cost of " << tasks_.size() << " representations in " << elapsed.total_microseconds() / 1.e6 << "s";
+						Logger::Message(Logger::LOG_NOTICE, ss.str());
+					}
+					task_available_.notify_all();
+				}
+			}
+
+			boost::mutex::scoped_lock lock(worker_mutex_);
+			while (!stopping_ && num_estimates_done_ < tasks_.size()) {
+				task_available_.wait(lock);
+			}
+		}
+
+		void work_(Kernel* worker_kernel) {
+			if (schedule_by_cost_) {
+				estimate_costs_(*worker_kernel);
+			}
+			for (;;) {
+				size_t task;
+				{
+					boost::mutex::scoped_lock lock(worker_mutex_);
+					while (!stopping_ && next_task_ < tasks_.size() && next_task_ >= num_tasks_consumed_ + max_tasks_ahead_()) {
+						task_available_.wait(lock);
+					}
+					if (stopping_ || next_task_ == tasks_.size()) {
+						return;
+					}
+					task = task_order_[next_task_++];
+				}
+
+				// Without scheduling by cost, the cost is only estimated for the log
+				const double cost = schedule_by_cost_
+					? task_costs_[task]
+					: log_timings_ ? estimate_cost_(*worker_kernel, tasks_[task]) : 0.;
+
+				const boost::posix_time::ptime start = boost::posix_time::microsec_clock::universal_time();
+
+				shape_results* results = new shape_results;
+				create_shape_models_for_representation_(*worker_kernel, tasks_[task], *results);
+
+				if (log_timings_) {
+					const boost::posix_time::time_duration elapsed = boost::posix_time::microsec_clock::universal_time() - start;
+					std::stringstream ss;
+					ss << "Processed representation in " << elapsed.total_microseconds() / 1.e6 << "s, estimated cost " << cost;
+					Logger::Message(Logger::LOG_NOTICE, ss.str(), tasks_[task]->entity);
+				}
+
+				{
+					boost::mutex::scoped_lock lock(worker_mutex_);
+					finished_tasks_[task] = results;
+				}
+				results_available_.notify_all();
+			}
+		}
+
+		// Reads the triangulation from the disk cache if it has been stored before,
+		// otherwise creates it and stores it. Called by all threads.
+		TriangulationElement<P>* triangulate_(const BRepElement<P>& shape_model) {
+			if (disk_cache_) {
+				Representation::Triangulation<P>* triangulation = disk_cache_->read_triangulation<P>(shape_model.geometry());
+				if (triangulation) {
+					return new TriangulationElement<P>(shape_model, boost::shared_ptr<Representation::Triangulation<P> >(triangulation));
+				}
+			}
+			TriangulationElement<P>* element = new TriangulationElement<P>(shape_model);
+			if (disk_cache_) {
+				disk_cache_->write_triangulation(shape_model.geometry(), element->geometry());
+			}
+			return element;
+		}
+
+		// Creates the elements for all products of a representation, this mirrors
+		// create_shape_model_for_next_entity() and create() for the worker threads,
+		// except that mapped representations are not memoized in ok_mapped_representations.
+		void create_shape_models_for_representation_(Kernel& geometry_kernel, IfcSchema::IfcRepresentation* representation, shape_results& results) {
+			try {
+				IfcSchema::IfcProduct::list::ptr products(new IfcSchema::IfcProduct::list);
+				IfcSchema::IfcProduct::list::ptr unfiltered_products = geometry_kernel.products_represented_by(representation);
+				for (IfcSchema::IfcProduct::list::it it = unfiltered_products->begin(); it != unfiltered_products->end(); ++it) {
+					IfcSchema::IfcProduct* prod = *it;
+					if (boost::all(filters_, filter_match(prod))) {
+						products->push(prod);
+					}
+				}
+
+				if (products->size() == 0) {
+					return;
+				}
+
+				const bool reuse_ok = reuse_ok_(geometry_kernel, products);
+
+				IfcSchema::IfcRepresentationMap::list::ptr maps = representation->RepresentationMap();
+				if (!reuse_ok && maps->size() == 1 && (*maps->begin())->MapUsage()->size() > 0) {
+					// The products are processed by means of their immediate representations
+					return;
+				}
+
+				IfcSchema::IfcRepresentation* representation_mapped_to = geometry_kernel.representation_mapped_to(representation);
+				if (representation_mapped_to && reuse_ok && reuse_ok_(geometry_kernel, geometry_kernel.products_represented_by(representation_mapped_to))) {
+					// Processed as part of its mapped representation
+					return;
+				}
+
+				for (IfcSchema::IfcProduct::list::it it = products->begin(); it != products->end(); ++it) {
+					IfcSchema::IfcProduct* product = *it;
+					Logger::SetProduct(product);
+
+					shape_result result = { 0, 0, 0 };
+					if (results.empty() || !reuse_ok) {
+						result.shape_model = geometry_kernel.create_brep_for_representation_and_product<P>(settings, representation, product);
+					} else {
+						result.shape_model = geometry_kernel.create_brep_for_processed_representation(settings, representation, product, results.back().shape_model);
+					}
+
+					Logger::SetProduct(boost::none);
+
+					if (!result.shape_model) {
+						break;
+					}
+
+					if (settings.get(IteratorSettings::USE_BREP_DATA)) {
+						try {
+							result.serialization = new SerializedElement<P>(*result.shape_model);
+						} catch (...) {
+							Logger::Message(Logger::LOG_ERROR, "Getting a serialized element from model failed.");
+						}
+					} else if (!settings.get(IteratorSettings::DISABLE_TRIANGULATION)) {
+						try {
+							if (results.empty() || !reuse_ok || !results.back().triangulation) {
+								result.triangulation = triangulate_(*result.shape_model);
+							} else {
+								result.triangulation = new TriangulationElement<P>(*result.shape_model, results.back().triangulation->geometry_pointer());
+							}
+						} catch (...) {
+							Logger::Message(Logger::LOG_ERROR, "Getting a triangulation element from model failed.");
+						}
+					}
+
+					results.push_back(result);
+				}
+			} catch (const std::exception& e) {
+				Logger::Error(e);
+			} catch (const Standard_Failure& e) {
+				if (e.GetMessageString() && strlen(e.GetMessageString())) {
+					Logger::Error(e.GetMessageString());
+				} else {
+					Logger::Error("Unknown error creating geometry");
+				}
+			} catch (...) {
+				Logger::Error("Unknown error creating geometry");
+			}
+
+			Logger::SetProduct(boost::none);
+		}
+
+		// Waits for the results of the next representation, which in ordered mode is
+		// the first representation that has not been consumed, otherwise any finished
+		// representation. Returns false when all representations have been consumed.
+		bool take_finished_task_() {
+			{
+				boost::mutex::scoped_lock lock(worker_mutex_);
+				for (;;) {
+					if (num_tasks_consumed_ == tasks_.size()) {
+						return false;
+					}
+					typename std::map<size_t, shape_results*>::iterator it = ordered_
+						? finished_tasks_.find(num_tasks_consumed_)
+						: finished_tasks_.begin();
+					if (it != finished_tasks_.end()) {
+						pending_results_.insert(pending_results_.end(), it->second->begin(), it->second->end());
+						delete it->second;
+						finished_tasks_.erase(it);
+						done = static_cast<int>(++num_tasks_consumed_);
+						break;
+					}
+					results_available_.wait(lock);
+				}
+			}
+			task_available_.notify_all();
+			return true;
+		}
+
+		IfcSchema::IfcProduct* create_from_workers_() {
+			free_shapes();
+
+			while (pending_results_.empty()) {
+				if (!take_finished_task_()) {
+					representations.reset();
+					return 0;
+				}
+			}
+
+			const shape_result& result = pending_results_.front();
+			current_shape_model = result.shape_model;
+			current_serialization = result.serialization;
+			current_triangulation = result.triangulation;
+			pending_results_.pop_front();
+
+			return current_shape_model->product();
+		}
+
     public:
         /// Returns what would be the product for the next shape representation
         /// @todo Double-check and test the impl.
@@ -654,6 +1102,10 @@ namespace IfcGeom {
 		}
 
 		IfcSchema::IfcProduct* create() {
+			if (use_workers_()) {
+				return create_from_workers_();
+			}
+
 			IfcGeom::BRepElement<P>* next_shape_model = 0;
 			IfcGeom::SerializedElement<P>* next_serialization = 0;
 			IfcGeom::TriangulationElement<P>* next_triangulation = 0;
@@ -682,7 +1134,7 @@ namespace IfcGeom {
 				} else if (!settings.get(IteratorSettings::DISABLE_TRIANGULATION)) {
 					try {
 						if (ifcproduct_iterator == ifcproducts->begin() || !geometry_reuse_ok_for_current_representation_) {
-							next_triangulation = new TriangulationElement<P>(*next_shape_model);
+							next_triangulation = triangulate_(*next_shape_model);
 						} else {
 							next_triangulation = new TriangulationElement<P>(*next_shape_model, current_triangulation->geometry_pointer());
 						}
@@ -706,10 +1158,19 @@ namespace IfcGeom {
 			current_shape_model = 0;
 			current_serialization = 0;
 
+			num_threads_ = 1;
+			ordered_ = true;
+			schedule_by_cost_ = false;
+			log_timings_ = false;
+			next_estimate_ = num_estimates_done_ = 0;
+			next_task_ = num_tasks_consumed_ = 0;
+			stopping_ = false;
+
 			unit_name = "METER";
 			unit_magnitude = 1.f;
 
             kernel.setValue(IfcGeom::Kernel::GV_MAX_FACES_TO_SEW, settings.get(IteratorSettings::SEW_SHELLS) ? 1000 : -1);
+			kernel.set_cache_budget(settings.cache_budget());
             kernel.setValue(IfcGeom::Kernel::GV_DIMENSIONALITY, (settings.get(IteratorSettings::INCLUDE_CURVES)
                 ? (settings.get(IteratorSettings::EXCLUDE_SOLIDS_AND_SURFACES) ? -1. : 0.) : +1.));
 			if (settings.get(IteratorSettings::BUILDING_LOCAL_PLACEMENT)) {
@@ -739,7 +1200,7 @@ namespace IfcGeom {
 			ifc_file->Init(filename);
 			_initialize();
 		}
-		Iterator(const IteratorSettings& settings, void* data, int length)
+		Iterator(const IteratorSettings& settings, void* data, size_t length)
 			: settings(settings)
 			, ifc_file(new IfcParse::IfcFile)
 			, owns_ifc_file(true)
@@ -747,7 +1208,7 @@ namespace IfcGeom {
 			ifc_file->Init(data, length);
 			_initialize();
 		}
-		Iterator(const IteratorSettings& settings, std::istream& filestream, int length)
+		Iterator(const IteratorSettings& settings, std::istream& filestream, size_t length)
 			: settings(settings)
 			, ifc_file(new IfcParse::IfcFile)
 			, owns_ifc_file(true)
@@ -757,11 +1218,18 @@ namespace IfcGeom {
 		}
 
 		~Iterator() {
+			// The workers need to be stopped before the file is deleted
+			stop_workers_();
+
 			if (owns_ifc_file) {
 				delete ifc_file;
 			}
 
 			free_shapes();
+
+			for (std::vector<Kernel*>::const_iterator it = worker_kernels_.begin(); it != worker_kernels_.end(); ++it) {
+				delete *it;
+			}
 		}
 	};
 }
@@ -93,6 +93,7 @@ namespace IfcGeom
         IteratorSettings()
             : settings_(WELD_VERTICES) // OR options that default to true here
             , deflection_tolerance_(1.e-3)
+            , cache_budget_(128 * 1024 * 1024)
         {
         }
 
@@ -110,6 +111,12 @@ namespace IfcGeom
             }
         }
 
+        /// The estimated memory, in bytes, that the cache of converted geometry may use
+        /// per thread, after which the least recently used entries are evicted. Zero
+        /// disables the cache. 128 megabytes by default.
+        size_t cache_budget() const { return cache_budget_; }
+        void set_cache_budget(size_t value) { cache_budget_ = value; }
+
         /// Get boolean value for a single settings or for a combination of settings.
         bool get(SettingField setting) const
         {
@@ -131,6 +138,7 @@ namespace IfcGeom
     protected:
         SettingField settings_;
         double deflection_tolerance_;
+        size_t cache_budget_;
     };
 
     class IFC_GEOM_API ElementSettings : public IteratorSettings
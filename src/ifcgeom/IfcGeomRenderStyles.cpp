@@ -20,6 +20,7 @@
 #include <boost/optional/optional.hpp>
 #include <boost/property_tree/json_parser.hpp>
 #include <boost/property_tree/ptree.hpp>
+#include <boost/thread/mutex.hpp>
 
 #include <map>
 
@@ -138,6 +139,8 @@ const IfcGeom::SurfaceStyle* IfcGeom::Kernel::get_style(const IfcSchema::IfcMate
 static std::map<std::string, IfcGeom::SurfaceStyle> default_materials;
 static IfcGeom::SurfaceStyle default_material;
 static bool default_materials_initialized = false;
+// Default styles are looked up and added by the threads of the geometry iterator
+static boost::mutex default_materials_mutex;
 
 void InitDefaultMaterials() {
 	default_materials.insert(std::make_pair("IfcSite", IfcGeom::SurfaceStyle("IfcSite")));
@@ -197,6 +200,7 @@ boost::optional<IfcGeom::SurfaceStyle::ColorComponent> read_colour_component(con
 }
 
 void IfcGeom::set_default_style_file(const std::string& json_file) {
+  boost::mutex::scoped_lock lock(default_materials_mutex);
   if (!default_materials_initialized) InitDefaultMaterials();
   default_materials.clear();
 
@@ -236,6 +240,7 @@ void IfcGeom::set_default_style_file(const std::string& json_file) {
 }
 
 const IfcGeom::SurfaceStyle* IfcGeom::get_default_style(const std::string& s) {
+	boost::mutex::scoped_lock lock(default_materials_mutex);
 	if (!default_materials_initialized) InitDefaultMaterials();
 	std::map<std::string, IfcGeom::SurfaceStyle>::const_iterator it = default_materials.find(s);
 	if (it == default_materials.end()) {
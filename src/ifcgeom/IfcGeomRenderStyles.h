@@ -86,6 +86,9 @@ namespace IfcGeom {
         /// Original name, if available, e.g. "Metal - Aluminium"
         const std::string& original_name() const { return original_name_; }
 
+		/// Id of the entity instance the style is derived from, if any
+		const boost::optional<int>& Id() const { return id; }
+
 		const boost::optional<ColorComponent>& Diffuse() const { return diffuse; }
 		const boost::optional<ColorComponent>& Specular() const { return specular; }
 		const boost::optional<double>& Transparency() const { return transparency; }
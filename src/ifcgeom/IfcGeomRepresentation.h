@@ -60,13 +60,15 @@ namespace IfcGeom {
 		class IFC_GEOM_API BRep : public Representation {
 		private:
 			std::string id_;
+			std::string cache_key_;
 			const IfcGeom::IfcRepresentationShapeItems shapes_;
 			BRep(const BRep& other);
 			BRep& operator=(const BRep& other);
 		public:
-			BRep(const ElementSettings& settings, const std::string& id, const IfcGeom::IfcRepresentationShapeItems& shapes)
+			BRep(const ElementSettings& settings, const std::string& id, const IfcGeom::IfcRepresentationShapeItems& shapes, const std::string& cache_key = "")
 				: Representation(settings)
 				, id_(id)
+				, cache_key_(cache_key)
 				, shapes_(shapes)
 			{}
 			virtual ~BRep() {}
@@ -74,6 +76,8 @@ namespace IfcGeom {
 			IfcGeom::IfcRepresentationShapeItems::const_iterator end() const { return shapes_.end(); }
 			const IfcGeom::IfcRepresentationShapeItems& shapes() const { return shapes_; }
 			const std::string& id() const { return id_; }
+			/// The key under which the shapes are stored in an IfcGeom::DiskCache, empty if none
+			const std::string& cache_key() const { return cache_key_; }
 			TopoDS_Compound as_compound() const;
 		};
 
@@ -130,28 +134,7 @@ namespace IfcGeom {
 			{
 				for ( IfcGeom::IfcRepresentationShapeItems::const_iterator iit = shape_model.begin(); iit != shape_model.end(); ++ iit ) {
 
-					int surface_style_id = -1;
-					if (iit->hasStyle()) {
-						Material adapter(&iit->Style());
-						std::vector<Material>::const_iterator jt = std::find(_materials.begin(), _materials.end(), adapter);
-						if (jt == _materials.end()) {
-							surface_style_id = (int)_materials.size();
-							_materials.push_back(adapter);
-						} else {
-							surface_style_id = (int)(jt - _materials.begin());
-						}
-					}
-
-					if (settings().get(IteratorSettings::APPLY_DEFAULT_MATERIALS) && surface_style_id == -1) {
-						Material material(IfcGeom::get_default_style(settings().element_type()));
-						std::vector<Material>::const_iterator mit = std::find(_materials.begin(), _materials.end(), material);
-						if (mit == _materials.end()) {
-							surface_style_id = (int)_materials.size();
-							_materials.push_back(material);
-						} else {
-							surface_style_id = (int)(mit - _materials.begin());
-						}
-					}
+					const int surface_style_id = addMaterial(*iit);
 
 					const TopoDS_Shape& s = iit->Shape();
 					const gp_GTrsf& trsf = iit->Placement();
@@ -344,6 +327,26 @@ namespace IfcGeom {
                     BRepTools::Clean(s);
 				}
 			}
+
+			/// Restores a triangulation of the shape model from the buffers of a
+			/// triangulation that was created from it before, see IfcGeom::DiskCache.
+			/// The materials are derived from the shape model in the same way.
+			Triangulation(const BRep& shape_model, const std::vector<P>& verts, const std::vector<int>& faces, const std::vector<int>& edges,
+				const std::vector<P>& normals, const std::vector<P>& uvs, const std::vector<int>& material_ids)
+				: Representation(shape_model.settings())
+				, id_(shape_model.id())
+				, _verts(verts)
+				, _faces(faces)
+				, _edges(edges)
+				, _normals(normals)
+				, uvs_(uvs)
+				, _material_ids(material_ids)
+			{
+				for ( IfcGeom::IfcRepresentationShapeItems::const_iterator iit = shape_model.begin(); iit != shape_model.end(); ++ iit ) {
+					addMaterial(*iit);
+				}
+			}
+
 			virtual ~Triangulation() {}
 
             /// Generates UVs for a single mesh using box projection.
@@ -377,6 +380,34 @@ namespace IfcGeom {
             }
 
 		private:
+			// Returns the index of the material of the shape item, or -1 if it has none
+			int addMaterial(const IfcGeom::IfcRepresentationShapeItem& item) {
+				int surface_style_id = -1;
+				if (item.hasStyle()) {
+					Material adapter(&item.Style());
+					std::vector<Material>::const_iterator jt = std::find(_materials.begin(), _materials.end(), adapter);
+					if (jt == _materials.end()) {
+						surface_style_id = (int)_materials.size();
+						_materials.push_back(adapter);
+					} else {
+						surface_style_id = (int)(jt - _materials.begin());
+					}
+				}
+
+				if (settings().get(IteratorSettings::APPLY_DEFAULT_MATERIALS) && surface_style_id == -1) {
+					Material material(IfcGeom::get_default_style(settings().element_type()));
+					std::vector<Material>::const_iterator mit = std::find(_materials.begin(), _materials.end(), material);
+					if (mit == _materials.end()) {
+						surface_style_id = (int)_materials.size();
+						_materials.push_back(material);
+					} else {
+						surface_style_id = (int)(mit - _materials.begin());
+					}
+				}
+
+				return surface_style_id;
+			}
+
 			// Welds vertices that belong to different faces
 			int addVertex(int material_index, const gp_XYZ& p) {
                 const bool convert = settings().get(IteratorSettings::CONVERT_BACK_UNITS);
@@ -1119,34 +1119,39 @@ bool IfcGeom::Kernel::convert(const IfcSchema::IfcAdvancedBrep* l, TopoDS_Shape&
 
 bool IfcGeom::Kernel::convert(const IfcSchema::IfcTriangulatedFaceSet* l, TopoDS_Shape& shape) {
 	IfcSchema::IfcCartesianPointList3D* point_list = l->Coordinates();
-	const std::vector< std::vector<double> > coordinates = point_list->CoordList();
+
+	// The coordinates and indices are decoded into flat vectors, rather than
+	// into a vector per point and per triangle as by CoordList() and
+	// CoordIndex(), as these lists tend to be large.
+	std::vector<double> coordinates;
+	unsigned int dimensions;
+	if (!point_list->getArgumentByName("CoordList")->flatten(coordinates, dimensions) || (dimensions != 3 && !coordinates.empty())) {
+		Logger::Message(Logger::LOG_ERROR, "Invalid dimensions encountered on Coordinates", l->entity);
+		return false;
+	}
 	std::vector<gp_Pnt> points;
-	points.reserve(coordinates.size());
-	for (std::vector< std::vector<double> >::const_iterator it = coordinates.begin(); it != coordinates.end(); ++it) {
-		const std::vector<double>& coords = *it;
-		if (coords.size() != 3) {
-			Logger::Message(Logger::LOG_ERROR, "Invalid dimensions encountered on Coordinates", l->entity);
-			return false;
-		}
-		points.push_back(gp_Pnt(coords[0] * getValue(GV_LENGTH_UNIT),
-		                        coords[1] * getValue(GV_LENGTH_UNIT),
-		                        coords[2] * getValue(GV_LENGTH_UNIT)));
+	points.reserve(coordinates.size() / 3);
+	for (std::vector<double>::const_iterator it = coordinates.begin(); it != coordinates.end(); it += 3) {
+		points.push_back(gp_Pnt(it[0] * getValue(GV_LENGTH_UNIT),
+		                        it[1] * getValue(GV_LENGTH_UNIT),
+		                        it[2] * getValue(GV_LENGTH_UNIT)));
 	}
 
-	std::vector< std::vector<int> > indices = l->CoordIndex();
+	std::vector<int> indices;
+	unsigned int vertices_per_face;
+	if (!l->getArgumentByName("CoordIndex")->flatten(indices, vertices_per_face) || (vertices_per_face != 3 && !indices.empty())) {
+		Logger::Message(Logger::LOG_ERROR, "Invalid dimensions encountered on CoordIndex", l->entity);
+		return false;
+	}
 	
 	std::vector<TopoDS_Face> faces;
-	faces.reserve(indices.size());
+	faces.reserve(indices.size() / 3);
 
-	for(std::vector< std::vector<int> >::const_iterator it = indices.begin(); it != indices.end(); ++ it) {
-		const std::vector<int>& tri = *it;
-		if (tri.size() != 3) {
-			Logger::Message(Logger::LOG_ERROR, "Invalid dimensions encountered on CoordIndex", l->entity);
-			return false;
-		}
+	for(std::vector<int>::const_iterator it = indices.begin(); it != indices.end(); it += 3) {
+		const int* tri = &*it;
 
-		const int min_index = *std::min_element(tri.begin(), tri.end());
-		const int max_index = *std::max_element(tri.begin(), tri.end());
+		const int min_index = *std::min_element(tri, tri + 3);
+		const int max_index = *std::max_element(tri, tri + 3);
 
 		if (min_index < 1 || max_index > (int) points.size()) {
 			Logger::Message(Logger::LOG_ERROR, "Contents of CoordIndex out of bounds", l->entity);
@@ -852,21 +852,22 @@ bool IfcGeom::Kernel::convert(const IfcSchema::IfcSubedge* l, TopoDS_Wire& resul
 bool IfcGeom::Kernel::convert(const IfcSchema::IfcIndexedPolyCurve* l, TopoDS_Wire& result) {
 	
 	IfcSchema::IfcCartesianPointList* point_list = l->Points();
-	std::vector< std::vector<double> > coordinates;
-	if (point_list->as<IfcSchema::IfcCartesianPointList2D>()) {
-		coordinates = point_list->as<IfcSchema::IfcCartesianPointList2D>()->CoordList();
-	} else if (point_list->as<IfcSchema::IfcCartesianPointList3D>()) {
-		coordinates = point_list->as<IfcSchema::IfcCartesianPointList3D>()->CoordList();
+	std::vector<double> coordinates;
+	unsigned int dimensions = 0;
+	if (point_list->as<IfcSchema::IfcCartesianPointList2D>() || point_list->as<IfcSchema::IfcCartesianPointList3D>()) {
+		if (!point_list->getArgumentByName("CoordList")->flatten(coordinates, dimensions)) {
+			throw IfcParse::IfcException("Invalid dimensions encountered on IfcCartesianPointList");
+		}
 	}
 
 	std::vector<gp_Pnt> points;
-	points.reserve(coordinates.size());
-	for (std::vector< std::vector<double> >::const_iterator it = coordinates.begin(); it != coordinates.end(); ++it) {
-		const std::vector<double>& coords = *it;
+	points.reserve(dimensions ? coordinates.size() / dimensions : 0);
+	for (size_t i = 0; dimensions && i < coordinates.size(); i += dimensions) {
+		const double* coords = &coordinates[i];
 		points.push_back(gp_Pnt(
-			coords.size() < 1 ? 0. : coords[0] * getValue(GV_LENGTH_UNIT),
-			coords.size() < 2 ? 0. : coords[1] * getValue(GV_LENGTH_UNIT),
-			coords.size() < 3 ? 0. : coords[2] * getValue(GV_LENGTH_UNIT)));
+			coords[0] * getValue(GV_LENGTH_UNIT),
+			dimensions < 2 ? 0. : coords[1] * getValue(GV_LENGTH_UNIT),
+			dimensions < 3 ? 0. : coords[2] * getValue(GV_LENGTH_UNIT)));
 	}
 
 	int max_index = points.size();
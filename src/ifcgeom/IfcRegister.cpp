@@ -17,6 +17,8 @@
 *                                                                              *
 ********************************************************************************/
 
+#include <TopExp_Explorer.hxx>
+
 #include "IfcGeom.h"
 #include "IfcGeomShapeType.h"
 
@@ -50,8 +52,7 @@ bool IfcGeom::Kernel::convert_shape(const IfcBaseClass* l, TopoDS_Shape& r) {
 	bool ignored = false;
 
 #ifndef NO_CACHE
-	std::map<int,TopoDS_Shape>::const_iterator it = cache.Shape.find(id);
-	if ( it != cache.Shape.end() ) { r = it->second; return true; }
+	if ( cache.Shape.find(id, r) ) { return true; }
 #endif
 	const bool include_curves = getValue(GV_DIMENSIONALITY) != +1;
 	const bool include_solids_and_surfaces = getValue(GV_DIMENSIONALITY) != -1;
@@ -88,7 +89,7 @@ bool IfcGeom::Kernel::convert_shape(const IfcBaseClass* l, TopoDS_Shape& r) {
 		const double precision = getValue(GV_PRECISION);
 		apply_tolerance(r, precision);
 #ifndef NO_CACHE
-		cache.Shape[id] = r;
+		cache.Shape.insert(id, r);
 #endif
 	} else if (!ignored) {
 		const char* const msg = processed
@@ -119,4 +120,17 @@ bool IfcGeom::Kernel::convert_curve(const IfcBaseClass* l, Handle(Geom_Curve)& r
 #include "IfcRegisterConvertCurve.h"
 	Logger::Message(Logger::LOG_ERROR,"No operation defined for:",l->entity);
 	return false;
-}
\ No newline at end of file
+}
+
+size_t IfcGeom::cache_size_of(const TopoDS_Shape& shape) {
+	// Rough averages of the memory of a face including its surface and of
+	// an edge including its curves. Shared edges are counted for every face.
+	size_t size = 0;
+	for (TopExp_Explorer exp(shape, TopAbs_FACE); exp.More(); exp.Next()) {
+		size += 1024;
+	}
+	for (TopExp_Explorer exp(shape, TopAbs_EDGE); exp.More(); exp.Next()) {
+		size += 256;
+	}
+	return size;
+}
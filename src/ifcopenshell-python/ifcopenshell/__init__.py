@@ -59,8 +59,17 @@ from .file import file
 from .entity_instance import entity_instance
 
 
-def open(fn=None):
-    return file(ifcopenshell_wrapper.open(os.path.abspath(fn))) if fn else file()
+def open(fn=None, index=None):
+    if not fn:
+        return file()
+    elif index:
+        return file(ifcopenshell_wrapper.open(os.path.abspath(fn), os.path.abspath(index)))
+    else:
+        return file(ifcopenshell_wrapper.open(os.path.abspath(fn)))
+
+
+def open_binary(fn):
+    return file(ifcopenshell_wrapper.open_binary(os.path.abspath(fn)))
 
 
 def create_entity(type, *args, **kwargs):
@@ -35,6 +35,7 @@
 #endif
 
 #include "../ifcparse/IfcEntityList.h"
+#include "../ifcparse/IfcArena.h"
 
 #include <boost/shared_ptr.hpp>
 #include <boost/dynamic_bitset.hpp>
@@ -73,6 +74,13 @@ public:
 	virtual operator std::vector< std::vector<double> >() const;
 	virtual operator IfcEntityListList::ptr() const;
 
+	/// Decodes an aggregate of aggregates of numbers, e.g. the CoordList of
+	/// an IfcCartesianPointList3D, into a single contiguous vector, in which
+	/// the elements of the i-th aggregate start at i * stride. Returns false
+	/// if the aggregates are not all of the same size.
+	virtual bool flatten(std::vector<int>& values, unsigned int& stride) const;
+	virtual bool flatten(std::vector<double>& values, unsigned int& stride) const;
+
 	virtual bool isNull() const = 0;
 	virtual unsigned int size() const = 0;
 
@@ -81,6 +89,15 @@ public:
 	virtual std::string toString(bool upper=false) const = 0;
 	
 	virtual ~Argument() {};
+
+	static void* operator new(size_t size) { return ::operator new(size); }
+	static void operator delete(void* p) { ::operator delete(p); }
+	/// Allocates the argument from the arena, which is not to be null. Arguments
+	/// allocated from an arena are released along with the arena and should
+	/// not be deleted.
+	static void* operator new(size_t size, IfcParse::IfcArena* arena) { return arena->allocate(size); }
+	/// Only called when the constructor throws, the memory is released along with the arena
+	static void operator delete(void*, IfcParse::IfcArena*) {}
 };
 
 #endif
@@ -4451,7 +4451,6 @@ class IFC_PARSE_API IfcAbsorbedDoseMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcAbsorbedDoseMeasure (IfcEntityInstanceData* e);
@@ -4467,7 +4466,6 @@ class IFC_PARSE_API IfcAccelerationMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcAccelerationMeasure (IfcEntityInstanceData* e);
@@ -4486,7 +4484,6 @@ class IFC_PARSE_API IfcAmountOfSubstanceMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcAmountOfSubstanceMeasure (IfcEntityInstanceData* e);
@@ -4502,7 +4499,6 @@ class IFC_PARSE_API IfcAngularVelocityMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcAngularVelocityMeasure (IfcEntityInstanceData* e);
@@ -4520,7 +4516,6 @@ class IFC_PARSE_API IfcAreaMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcAreaMeasure (IfcEntityInstanceData* e);
@@ -4536,7 +4531,6 @@ class IFC_PARSE_API IfcBoolean : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcBoolean (IfcEntityInstanceData* e);
@@ -4558,7 +4552,6 @@ class IFC_PARSE_API IfcComplexNumber : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcComplexNumber (IfcEntityInstanceData* e);
@@ -4617,7 +4610,6 @@ class IFC_PARSE_API IfcCompoundPlaneAngleMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcCompoundPlaneAngleMeasure (IfcEntityInstanceData* e);
@@ -4634,7 +4626,6 @@ class IFC_PARSE_API IfcContextDependentMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcContextDependentMeasure (IfcEntityInstanceData* e);
@@ -4651,7 +4642,6 @@ class IFC_PARSE_API IfcCountMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcCountMeasure (IfcEntityInstanceData* e);
@@ -4669,7 +4659,6 @@ class IFC_PARSE_API IfcCurvatureMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcCurvatureMeasure (IfcEntityInstanceData* e);
@@ -4692,7 +4681,6 @@ class IFC_PARSE_API IfcDayInMonthNumber : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcDayInMonthNumber (IfcEntityInstanceData* e);
@@ -4704,7 +4692,6 @@ class IFC_PARSE_API IfcDaylightSavingHour : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcDaylightSavingHour (IfcEntityInstanceData* e);
@@ -4721,7 +4708,6 @@ class IFC_PARSE_API IfcDescriptiveMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcDescriptiveMeasure (IfcEntityInstanceData* e);
@@ -4739,7 +4725,6 @@ class IFC_PARSE_API IfcDimensionCount : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcDimensionCount (IfcEntityInstanceData* e);
@@ -4755,7 +4740,6 @@ class IFC_PARSE_API IfcDoseEquivalentMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcDoseEquivalentMeasure (IfcEntityInstanceData* e);
@@ -4772,7 +4756,6 @@ class IFC_PARSE_API IfcDynamicViscosityMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcDynamicViscosityMeasure (IfcEntityInstanceData* e);
@@ -4788,7 +4771,6 @@ class IFC_PARSE_API IfcElectricCapacitanceMeasure : public IfcUtil::IfcBaseType
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcElectricCapacitanceMeasure (IfcEntityInstanceData* e);
@@ -4804,7 +4786,6 @@ class IFC_PARSE_API IfcElectricChargeMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcElectricChargeMeasure (IfcEntityInstanceData* e);
@@ -4820,7 +4801,6 @@ class IFC_PARSE_API IfcElectricConductanceMeasure : public IfcUtil::IfcBaseType
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcElectricConductanceMeasure (IfcEntityInstanceData* e);
@@ -4838,7 +4818,6 @@ class IFC_PARSE_API IfcElectricCurrentMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcElectricCurrentMeasure (IfcEntityInstanceData* e);
@@ -4854,7 +4833,6 @@ class IFC_PARSE_API IfcElectricResistanceMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcElectricResistanceMeasure (IfcEntityInstanceData* e);
@@ -4870,7 +4848,6 @@ class IFC_PARSE_API IfcElectricVoltageMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcElectricVoltageMeasure (IfcEntityInstanceData* e);
@@ -4886,7 +4863,6 @@ class IFC_PARSE_API IfcEnergyMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcEnergyMeasure (IfcEntityInstanceData* e);
@@ -4911,7 +4887,6 @@ class IFC_PARSE_API IfcFontStyle : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcFontStyle (IfcEntityInstanceData* e);
@@ -4934,7 +4909,6 @@ class IFC_PARSE_API IfcFontVariant : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcFontVariant (IfcEntityInstanceData* e);
@@ -4968,7 +4942,6 @@ class IFC_PARSE_API IfcFontWeight : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcFontWeight (IfcEntityInstanceData* e);
@@ -4984,7 +4957,6 @@ class IFC_PARSE_API IfcForceMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcForceMeasure (IfcEntityInstanceData* e);
@@ -5000,7 +4972,6 @@ class IFC_PARSE_API IfcFrequencyMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcFrequencyMeasure (IfcEntityInstanceData* e);
@@ -5026,7 +4997,6 @@ class IFC_PARSE_API IfcGloballyUniqueId : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcGloballyUniqueId (IfcEntityInstanceData* e);
@@ -5042,7 +5012,6 @@ class IFC_PARSE_API IfcHeatFluxDensityMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcHeatFluxDensityMeasure (IfcEntityInstanceData* e);
@@ -5056,7 +5025,6 @@ class IFC_PARSE_API IfcHeatingValueMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcHeatingValueMeasure (IfcEntityInstanceData* e);
@@ -5068,7 +5036,6 @@ class IFC_PARSE_API IfcHourInDay : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcHourInDay (IfcEntityInstanceData* e);
@@ -5093,7 +5060,6 @@ class IFC_PARSE_API IfcIdentifier : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcIdentifier (IfcEntityInstanceData* e);
@@ -5109,7 +5075,6 @@ class IFC_PARSE_API IfcIlluminanceMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcIlluminanceMeasure (IfcEntityInstanceData* e);
@@ -5125,7 +5090,6 @@ class IFC_PARSE_API IfcInductanceMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcInductanceMeasure (IfcEntityInstanceData* e);
@@ -5143,7 +5107,6 @@ class IFC_PARSE_API IfcInteger : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcInteger (IfcEntityInstanceData* e);
@@ -5161,7 +5124,6 @@ class IFC_PARSE_API IfcIntegerCountRateMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcIntegerCountRateMeasure (IfcEntityInstanceData* e);
@@ -5175,7 +5137,6 @@ class IFC_PARSE_API IfcIonConcentrationMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcIonConcentrationMeasure (IfcEntityInstanceData* e);
@@ -5191,7 +5152,6 @@ class IFC_PARSE_API IfcIsothermalMoistureCapacityMeasure : public IfcUtil::IfcBa
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcIsothermalMoistureCapacityMeasure (IfcEntityInstanceData* e);
@@ -5207,7 +5167,6 @@ class IFC_PARSE_API IfcKinematicViscosityMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcKinematicViscosityMeasure (IfcEntityInstanceData* e);
@@ -5232,7 +5191,6 @@ class IFC_PARSE_API IfcLabel : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcLabel (IfcEntityInstanceData* e);
@@ -5250,7 +5208,6 @@ class IFC_PARSE_API IfcLengthMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcLengthMeasure (IfcEntityInstanceData* e);
@@ -5266,7 +5223,6 @@ class IFC_PARSE_API IfcLinearForceMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcLinearForceMeasure (IfcEntityInstanceData* e);
@@ -5282,7 +5238,6 @@ class IFC_PARSE_API IfcLinearMomentMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcLinearMomentMeasure (IfcEntityInstanceData* e);
@@ -5298,7 +5253,6 @@ class IFC_PARSE_API IfcLinearStiffnessMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcLinearStiffnessMeasure (IfcEntityInstanceData* e);
@@ -5314,7 +5268,6 @@ class IFC_PARSE_API IfcLinearVelocityMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcLinearVelocityMeasure (IfcEntityInstanceData* e);
@@ -5330,7 +5283,6 @@ class IFC_PARSE_API IfcLogical : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcLogical (IfcEntityInstanceData* e);
@@ -5346,7 +5298,6 @@ class IFC_PARSE_API IfcLuminousFluxMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcLuminousFluxMeasure (IfcEntityInstanceData* e);
@@ -5364,7 +5315,6 @@ class IFC_PARSE_API IfcLuminousIntensityDistributionMeasure : public IfcUtil::If
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcLuminousIntensityDistributionMeasure (IfcEntityInstanceData* e);
@@ -5382,7 +5332,6 @@ class IFC_PARSE_API IfcLuminousIntensityMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcLuminousIntensityMeasure (IfcEntityInstanceData* e);
@@ -5398,7 +5347,6 @@ class IFC_PARSE_API IfcMagneticFluxDensityMeasure : public IfcUtil::IfcBaseType
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcMagneticFluxDensityMeasure (IfcEntityInstanceData* e);
@@ -5414,7 +5362,6 @@ class IFC_PARSE_API IfcMagneticFluxMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcMagneticFluxMeasure (IfcEntityInstanceData* e);
@@ -5430,7 +5377,6 @@ class IFC_PARSE_API IfcMassDensityMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcMassDensityMeasure (IfcEntityInstanceData* e);
@@ -5446,7 +5392,6 @@ class IFC_PARSE_API IfcMassFlowRateMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcMassFlowRateMeasure (IfcEntityInstanceData* e);
@@ -5464,7 +5409,6 @@ class IFC_PARSE_API IfcMassMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcMassMeasure (IfcEntityInstanceData* e);
@@ -5482,7 +5426,6 @@ class IFC_PARSE_API IfcMassPerLengthMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcMassPerLengthMeasure (IfcEntityInstanceData* e);
@@ -5494,7 +5437,6 @@ class IFC_PARSE_API IfcMinuteInHour : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcMinuteInHour (IfcEntityInstanceData* e);
@@ -5510,7 +5452,6 @@ class IFC_PARSE_API IfcModulusOfElasticityMeasure : public IfcUtil::IfcBaseType
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcModulusOfElasticityMeasure (IfcEntityInstanceData* e);
@@ -5526,7 +5467,6 @@ class IFC_PARSE_API IfcModulusOfLinearSubgradeReactionMeasure : public IfcUtil::
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcModulusOfLinearSubgradeReactionMeasure (IfcEntityInstanceData* e);
@@ -5542,7 +5482,6 @@ class IFC_PARSE_API IfcModulusOfRotationalSubgradeReactionMeasure : public IfcUt
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcModulusOfRotationalSubgradeReactionMeasure (IfcEntityInstanceData* e);
@@ -5562,7 +5501,6 @@ class IFC_PARSE_API IfcModulusOfSubgradeReactionMeasure : public IfcUtil::IfcBas
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcModulusOfSubgradeReactionMeasure (IfcEntityInstanceData* e);
@@ -5578,7 +5516,6 @@ class IFC_PARSE_API IfcMoistureDiffusivityMeasure : public IfcUtil::IfcBaseType
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcMoistureDiffusivityMeasure (IfcEntityInstanceData* e);
@@ -5594,7 +5531,6 @@ class IFC_PARSE_API IfcMolecularWeightMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcMolecularWeightMeasure (IfcEntityInstanceData* e);
@@ -5610,7 +5546,6 @@ class IFC_PARSE_API IfcMomentOfInertiaMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcMomentOfInertiaMeasure (IfcEntityInstanceData* e);
@@ -5625,7 +5560,6 @@ class IFC_PARSE_API IfcMonetaryMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcMonetaryMeasure (IfcEntityInstanceData* e);
@@ -5692,7 +5626,6 @@ class IFC_PARSE_API IfcMonthInYearNumber : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcMonthInYearNumber (IfcEntityInstanceData* e);
@@ -5709,7 +5642,6 @@ class IFC_PARSE_API IfcNumericMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcNumericMeasure (IfcEntityInstanceData* e);
@@ -5723,7 +5655,6 @@ class IFC_PARSE_API IfcPHMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcPHMeasure (IfcEntityInstanceData* e);
@@ -5741,7 +5672,6 @@ class IFC_PARSE_API IfcParameterValue : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcParameterValue (IfcEntityInstanceData* e);
@@ -5757,7 +5687,6 @@ class IFC_PARSE_API IfcPlanarForceMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcPlanarForceMeasure (IfcEntityInstanceData* e);
@@ -5779,7 +5708,6 @@ class IFC_PARSE_API IfcPlaneAngleMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcPlaneAngleMeasure (IfcEntityInstanceData* e);
@@ -5796,7 +5724,6 @@ class IFC_PARSE_API IfcPositiveLengthMeasure : public IfcLengthMeasure {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcPositiveLengthMeasure (IfcEntityInstanceData* e);
@@ -5813,7 +5740,6 @@ class IFC_PARSE_API IfcPositivePlaneAngleMeasure : public IfcPlaneAngleMeasure {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcPositivePlaneAngleMeasure (IfcEntityInstanceData* e);
@@ -5829,7 +5755,6 @@ class IFC_PARSE_API IfcPowerMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcPowerMeasure (IfcEntityInstanceData* e);
@@ -5849,7 +5774,6 @@ class IFC_PARSE_API IfcPresentableText : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcPresentableText (IfcEntityInstanceData* e);
@@ -5865,7 +5789,6 @@ class IFC_PARSE_API IfcPressureMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcPressureMeasure (IfcEntityInstanceData* e);
@@ -5881,7 +5804,6 @@ class IFC_PARSE_API IfcRadioActivityMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcRadioActivityMeasure (IfcEntityInstanceData* e);
@@ -5902,7 +5824,6 @@ class IFC_PARSE_API IfcRatioMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcRatioMeasure (IfcEntityInstanceData* e);
@@ -5920,7 +5841,6 @@ class IFC_PARSE_API IfcReal : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcReal (IfcEntityInstanceData* e);
@@ -5936,7 +5856,6 @@ class IFC_PARSE_API IfcRotationalFrequencyMeasure : public IfcUtil::IfcBaseType
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcRotationalFrequencyMeasure (IfcEntityInstanceData* e);
@@ -5953,7 +5872,6 @@ class IFC_PARSE_API IfcRotationalMassMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcRotationalMassMeasure (IfcEntityInstanceData* e);
@@ -5969,7 +5887,6 @@ class IFC_PARSE_API IfcRotationalStiffnessMeasure : public IfcUtil::IfcBaseType
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcRotationalStiffnessMeasure (IfcEntityInstanceData* e);
@@ -5981,7 +5898,6 @@ class IFC_PARSE_API IfcSecondInMinute : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcSecondInMinute (IfcEntityInstanceData* e);
@@ -5997,7 +5913,6 @@ class IFC_PARSE_API IfcSectionModulusMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcSectionModulusMeasure (IfcEntityInstanceData* e);
@@ -6013,7 +5928,6 @@ class IFC_PARSE_API IfcSectionalAreaIntegralMeasure : public IfcUtil::IfcBaseTyp
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcSectionalAreaIntegralMeasure (IfcEntityInstanceData* e);
@@ -6029,7 +5943,6 @@ class IFC_PARSE_API IfcShearModulusMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcShearModulusMeasure (IfcEntityInstanceData* e);
@@ -6047,7 +5960,6 @@ class IFC_PARSE_API IfcSolidAngleMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcSolidAngleMeasure (IfcEntityInstanceData* e);
@@ -6063,7 +5975,6 @@ class IFC_PARSE_API IfcSoundPowerMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcSoundPowerMeasure (IfcEntityInstanceData* e);
@@ -6079,7 +5990,6 @@ class IFC_PARSE_API IfcSoundPressureMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcSoundPressureMeasure (IfcEntityInstanceData* e);
@@ -6095,7 +6005,6 @@ class IFC_PARSE_API IfcSpecificHeatCapacityMeasure : public IfcUtil::IfcBaseType
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcSpecificHeatCapacityMeasure (IfcEntityInstanceData* e);
@@ -6113,7 +6022,6 @@ class IFC_PARSE_API IfcSpecularExponent : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcSpecularExponent (IfcEntityInstanceData* e);
@@ -6133,7 +6041,6 @@ class IFC_PARSE_API IfcSpecularRoughness : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcSpecularRoughness (IfcEntityInstanceData* e);
@@ -6149,7 +6056,6 @@ class IFC_PARSE_API IfcTemperatureGradientMeasure : public IfcUtil::IfcBaseType
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcTemperatureGradientMeasure (IfcEntityInstanceData* e);
@@ -6171,7 +6077,6 @@ class IFC_PARSE_API IfcText : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcText (IfcEntityInstanceData* e);
@@ -6192,7 +6097,6 @@ class IFC_PARSE_API IfcTextAlignment : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcTextAlignment (IfcEntityInstanceData* e);
@@ -6216,7 +6120,6 @@ class IFC_PARSE_API IfcTextDecoration : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcTextDecoration (IfcEntityInstanceData* e);
@@ -6246,7 +6149,6 @@ class IFC_PARSE_API IfcTextFontName : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcTextFontName (IfcEntityInstanceData* e);
@@ -6267,7 +6169,6 @@ class IFC_PARSE_API IfcTextTransformation : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcTextTransformation (IfcEntityInstanceData* e);
@@ -6283,7 +6184,6 @@ class IFC_PARSE_API IfcThermalAdmittanceMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcThermalAdmittanceMeasure (IfcEntityInstanceData* e);
@@ -6299,7 +6199,6 @@ class IFC_PARSE_API IfcThermalConductivityMeasure : public IfcUtil::IfcBaseType
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcThermalConductivityMeasure (IfcEntityInstanceData* e);
@@ -6314,7 +6213,6 @@ class IFC_PARSE_API IfcThermalExpansionCoefficientMeasure : public IfcUtil::IfcB
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcThermalExpansionCoefficientMeasure (IfcEntityInstanceData* e);
@@ -6329,7 +6227,6 @@ class IFC_PARSE_API IfcThermalResistanceMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcThermalResistanceMeasure (IfcEntityInstanceData* e);
@@ -6345,7 +6242,6 @@ class IFC_PARSE_API IfcThermalTransmittanceMeasure : public IfcUtil::IfcBaseType
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcThermalTransmittanceMeasure (IfcEntityInstanceData* e);
@@ -6363,7 +6259,6 @@ class IFC_PARSE_API IfcThermodynamicTemperatureMeasure : public IfcUtil::IfcBase
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcThermodynamicTemperatureMeasure (IfcEntityInstanceData* e);
@@ -6381,7 +6276,6 @@ class IFC_PARSE_API IfcTimeMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcTimeMeasure (IfcEntityInstanceData* e);
@@ -6396,7 +6290,6 @@ class IFC_PARSE_API IfcTimeStamp : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcTimeStamp (IfcEntityInstanceData* e);
@@ -6412,7 +6305,6 @@ class IFC_PARSE_API IfcTorqueMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcTorqueMeasure (IfcEntityInstanceData* e);
@@ -6428,7 +6320,6 @@ class IFC_PARSE_API IfcVaporPermeabilityMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcVaporPermeabilityMeasure (IfcEntityInstanceData* e);
@@ -6446,7 +6337,6 @@ class IFC_PARSE_API IfcVolumeMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcVolumeMeasure (IfcEntityInstanceData* e);
@@ -6462,7 +6352,6 @@ class IFC_PARSE_API IfcVolumetricFlowRateMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcVolumetricFlowRateMeasure (IfcEntityInstanceData* e);
@@ -6478,7 +6367,6 @@ class IFC_PARSE_API IfcWarpingConstantMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcWarpingConstantMeasure (IfcEntityInstanceData* e);
@@ -6494,7 +6382,6 @@ class IFC_PARSE_API IfcWarpingMomentMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcWarpingMomentMeasure (IfcEntityInstanceData* e);
@@ -6506,7 +6393,6 @@ class IFC_PARSE_API IfcYearNumber : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcYearNumber (IfcEntityInstanceData* e);
@@ -6542,7 +6428,6 @@ class IFC_PARSE_API IfcBoxAlignment : public IfcLabel {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcBoxAlignment (IfcEntityInstanceData* e);
@@ -6558,7 +6443,6 @@ class IFC_PARSE_API IfcNormalisedRatioMeasure : public IfcRatioMeasure {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcNormalisedRatioMeasure (IfcEntityInstanceData* e);
@@ -6575,7 +6459,6 @@ class IFC_PARSE_API IfcPositiveRatioMeasure : public IfcRatioMeasure {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcPositiveRatioMeasure (IfcEntityInstanceData* e);
@@ -6618,7 +6501,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcRoleEnum; case 1: return Type::IfcLabel; case 2: return Type::IfcText; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Role"; case 1: return "UserDefinedRole"; case 2: return "Description"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcActorRole (IfcEntityInstanceData* e);
@@ -6657,7 +6539,6 @@ public:
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcPerson >::ptr OfPerson() const; // INVERSE IfcPerson::Addresses
     IfcTemplatedEntityList< IfcOrganization >::ptr OfOrganization() const; // INVERSE IfcOrganization::Addresses
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcAddress (IfcEntityInstanceData* e);
@@ -6686,7 +6567,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcOrganization; case 1: return Type::IfcLabel; case 2: return Type::IfcLabel; case 3: return Type::IfcIdentifier; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "ApplicationDeveloper"; case 1: return "Version"; case 2: return "ApplicationFullName"; case 3: return "ApplicationIdentifier"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcApplication (IfcEntityInstanceData* e);
@@ -6755,7 +6635,6 @@ public:
     IfcTemplatedEntityList< IfcReferencesValueDocument >::ptr ValuesReferenced() const; // INVERSE IfcReferencesValueDocument::ReferencingValues
     IfcTemplatedEntityList< IfcAppliedValueRelationship >::ptr ValueOfComponents() const; // INVERSE IfcAppliedValueRelationship::ComponentOfTotal
     IfcTemplatedEntityList< IfcAppliedValueRelationship >::ptr IsComponentIn() const; // INVERSE IfcAppliedValueRelationship::Components
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcAppliedValue (IfcEntityInstanceData* e);
@@ -6810,7 +6689,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcAppliedValue; case 1: return Type::IfcAppliedValue; case 2: return Type::IfcArithmeticOperatorEnum; case 3: return Type::IfcLabel; case 4: return Type::IfcText; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "ComponentOfTotal"; case 1: return "Components"; case 2: return "ArithmeticOperator"; case 3: return "Name"; case 4: return "Description"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcAppliedValueRelationship (IfcEntityInstanceData* e);
@@ -6857,7 +6735,6 @@ public:
     IfcTemplatedEntityList< IfcApprovalActorRelationship >::ptr Actors() const; // INVERSE IfcApprovalActorRelationship::Approval
     IfcTemplatedEntityList< IfcApprovalRelationship >::ptr IsRelatedWith() const; // INVERSE IfcApprovalRelationship::RelatedApproval
     IfcTemplatedEntityList< IfcApprovalRelationship >::ptr Relates() const; // INVERSE IfcApprovalRelationship::RelatingApproval
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcApproval (IfcEntityInstanceData* e);
@@ -6878,7 +6755,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcActorSelect; case 1: return Type::IfcApproval; case 2: return Type::IfcActorRole; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Actor"; case 1: return "Approval"; case 2: return "Role"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcApprovalActorRelationship (IfcEntityInstanceData* e);
@@ -6897,7 +6773,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcProperty; case 1: return Type::IfcApproval; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "ApprovedProperties"; case 1: return "Approval"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcApprovalPropertyRelationship (IfcEntityInstanceData* e);
@@ -6929,7 +6804,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcApproval; case 1: return Type::IfcApproval; case 2: return Type::IfcText; case 3: return Type::IfcLabel; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "RelatedApproval"; case 1: return "RelatingApproval"; case 2: return "Description"; case 3: return "Name"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcApprovalRelationship (IfcEntityInstanceData* e);
@@ -6963,7 +6837,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcLabel; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Name"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcBoundaryCondition (IfcEntityInstanceData* e);
@@ -7014,7 +6887,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 1: return Type::IfcModulusOfLinearSubgradeReactionMeasure; case 2: return Type::IfcModulusOfLinearSubgradeReactionMeasure; case 3: return Type::IfcModulusOfLinearSubgradeReactionMeasure; case 4: return Type::IfcModulusOfRotationalSubgradeReactionMeasure; case 5: return Type::IfcModulusOfRotationalSubgradeReactionMeasure; case 6: return Type::IfcModulusOfRotationalSubgradeReactionMeasure; } return IfcBoundaryCondition::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 1: return "LinearStiffnessByLengthX"; case 2: return "LinearStiffnessByLengthY"; case 3: return "LinearStiffnessByLengthZ"; case 4: return "RotationalStiffnessByLengthX"; case 5: return "RotationalStiffnessByLengthY"; case 6: return "RotationalStiffnessByLengthZ"; } return IfcBoundaryCondition::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcBoundaryEdgeCondition (IfcEntityInstanceData* e);
@@ -7050,7 +6922,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 1: return Type::IfcModulusOfSubgradeReactionMeasure; case 2: return Type::IfcModulusOfSubgradeReactionMeasure; case 3: return Type::IfcModulusOfSubgradeReactionMeasure; } return IfcBoundaryCondition::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 1: return "LinearStiffnessByAreaX"; case 2: return "LinearStiffnessByAreaY"; case 3: return "LinearStiffnessByAreaZ"; } return IfcBoundaryCondition::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcBoundaryFaceCondition (IfcEntityInstanceData* e);
@@ -7101,7 +6972,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 1: return Type::IfcLinearStiffnessMeasure; case 2: return Type::IfcLinearStiffnessMeasure; case 3: return Type::IfcLinearStiffnessMeasure; case 4: return Type::IfcRotationalStiffnessMeasure; case 5: return Type::IfcRotationalStiffnessMeasure; case 6: return Type::IfcRotationalStiffnessMeasure; } return IfcBoundaryCondition::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 1: return "LinearStiffnessX"; case 2: return "LinearStiffnessY"; case 3: return "LinearStiffnessZ"; case 4: return "RotationalStiffnessX"; case 5: return "RotationalStiffnessY"; case 6: return "RotationalStiffnessZ"; } return IfcBoundaryCondition::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcBoundaryNodeCondition (IfcEntityInstanceData* e);
@@ -7129,7 +6999,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 7: return Type::IfcWarpingMomentMeasure; } return IfcBoundaryNodeCondition::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 7: return "WarpingStiffness"; } return IfcBoundaryNodeCondition::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcBoundaryNodeConditionWarping (IfcEntityInstanceData* e);
@@ -7150,7 +7019,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcDayInMonthNumber; case 1: return Type::IfcMonthInYearNumber; case 2: return Type::IfcYearNumber; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "DayComponent"; case 1: return "MonthComponent"; case 2: return "YearComponent"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcCalendarDate (IfcEntityInstanceData* e);
@@ -7206,7 +7074,6 @@ public:
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Source"; case 1: return "Edition"; case 2: return "EditionDate"; case 3: return "Name"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcClassificationItem >::ptr Contains() const; // INVERSE IfcClassificationItem::ItemOf
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcClassification (IfcEntityInstanceData* e);
@@ -7231,7 +7098,6 @@ public:
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcClassificationItemRelationship >::ptr IsClassifiedItemIn() const; // INVERSE IfcClassificationItemRelationship::RelatedItems
     IfcTemplatedEntityList< IfcClassificationItemRelationship >::ptr IsClassifyingItemIn() const; // INVERSE IfcClassificationItemRelationship::RelatingItem
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcClassificationItem (IfcEntityInstanceData* e);
@@ -7250,7 +7116,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcClassificationItem; case 1: return Type::IfcClassificationItem; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "RelatingItem"; case 1: return "RelatedItems"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcClassificationItemRelationship (IfcEntityInstanceData* e);
@@ -7267,7 +7132,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcClassificationNotationFacet; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "NotationFacets"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcClassificationNotation (IfcEntityInstanceData* e);
@@ -7284,7 +7148,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcLabel; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "NotationValue"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcClassificationNotationFacet (IfcEntityInstanceData* e);
@@ -7311,7 +7174,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcLabel; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Name"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcColourSpecification (IfcEntityInstanceData* e);
@@ -7339,7 +7201,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcConnectionGeometry (IfcEntityInstanceData* e);
@@ -7377,7 +7238,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcPointOrVertexPoint; case 1: return Type::IfcPointOrVertexPoint; } return IfcConnectionGeometry::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "PointOnRelatingElement"; case 1: return "PointOnRelatedElement"; } return IfcConnectionGeometry::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcConnectionPointGeometry (IfcEntityInstanceData* e);
@@ -7400,7 +7260,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcAxis2Placement; case 1: return Type::IfcAxis2Placement; case 2: return Type::IfcProfileDef; } return IfcConnectionGeometry::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "LocationAtRelatingElement"; case 1: return "LocationAtRelatedElement"; case 2: return "ProfileOfPort"; } return IfcConnectionGeometry::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcConnectionPortGeometry (IfcEntityInstanceData* e);
@@ -7430,7 +7289,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcSurfaceOrFaceSurface; case 1: return Type::IfcSurfaceOrFaceSurface; } return IfcConnectionGeometry::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "SurfaceOnRelatingElement"; case 1: return "SurfaceOnRelatedElement"; } return IfcConnectionGeometry::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcConnectionSurfaceGeometry (IfcEntityInstanceData* e);
@@ -7496,7 +7354,6 @@ public:
     IfcTemplatedEntityList< IfcPropertyConstraintRelationship >::ptr PropertiesForConstraint() const; // INVERSE IfcPropertyConstraintRelationship::RelatingConstraint
     IfcTemplatedEntityList< IfcConstraintAggregationRelationship >::ptr Aggregates() const; // INVERSE IfcConstraintAggregationRelationship::RelatingConstraint
     IfcTemplatedEntityList< IfcConstraintAggregationRelationship >::ptr IsAggregatedIn() const; // INVERSE IfcConstraintAggregationRelationship::RelatedConstraints
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcConstraint (IfcEntityInstanceData* e);
@@ -7536,7 +7393,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcLabel; case 1: return Type::IfcText; case 2: return Type::IfcConstraint; case 3: return Type::IfcConstraint; case 4: return Type::IfcLogicalOperatorEnum; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Name"; case 1: return "Description"; case 2: return "RelatingConstraint"; case 3: return "RelatedConstraints"; case 4: return "LogicalAggregator"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcConstraintAggregationRelationship (IfcEntityInstanceData* e);
@@ -7555,7 +7411,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcConstraint; case 1: return Type::IfcClassificationNotationSelect; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "ClassifiedConstraint"; case 1: return "RelatedClassifications"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcConstraintClassificationRelationship (IfcEntityInstanceData* e);
@@ -7592,7 +7447,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcLabel; case 1: return Type::IfcText; case 2: return Type::IfcConstraint; case 3: return Type::IfcConstraint; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Name"; case 1: return "Description"; case 2: return "RelatingConstraint"; case 3: return "RelatedConstraints"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcConstraintRelationship (IfcEntityInstanceData* e);
@@ -7615,7 +7469,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcHourInDay; case 1: return Type::IfcMinuteInHour; case 2: return Type::IfcAheadOrBehind; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "HourOffset"; case 1: return "MinuteOffset"; case 2: return "Sense"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcCoordinatedUniversalTimeOffset (IfcEntityInstanceData* e);
@@ -7683,7 +7536,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 6: return Type::IfcLabel; case 7: return Type::IfcText; } return IfcAppliedValue::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 6: return "CostType"; case 7: return "Condition"; } return IfcAppliedValue::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcCostValue (IfcEntityInstanceData* e);
@@ -7727,7 +7579,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcMonetaryUnit; case 1: return Type::IfcMonetaryUnit; case 2: return Type::IfcPositiveRatioMeasure; case 3: return Type::IfcDateAndTime; case 4: return Type::IfcLibraryInformation; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "RelatingMonetaryUnit"; case 1: return "RelatedMonetaryUnit"; case 2: return "ExchangeRate"; case 3: return "RateDateTime"; case 4: return "RateSource"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcCurrencyRelationship (IfcEntityInstanceData* e);
@@ -7754,7 +7605,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcLabel; case 1: return Type::IfcCurveStyleFontPattern; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Name"; case 1: return "PatternList"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcCurveStyleFont (IfcEntityInstanceData* e);
@@ -7790,7 +7640,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcLabel; case 1: return Type::IfcCurveStyleFontSelect; case 2: return Type::IfcPositiveRatioMeasure; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Name"; case 1: return "CurveFont"; case 2: return "CurveFontScaling"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcCurveStyleFontAndScaling (IfcEntityInstanceData* e);
@@ -7819,7 +7668,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcLengthMeasure; case 1: return Type::IfcPositiveLengthMeasure; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "VisibleSegmentLength"; case 1: return "InvisibleSegmentLength"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcCurveStyleFontPattern (IfcEntityInstanceData* e);
@@ -7838,7 +7686,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcCalendarDate; case 1: return Type::IfcLocalTime; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "DateComponent"; case 1: return "TimeComponent"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcDateAndTime (IfcEntityInstanceData* e);
@@ -7869,7 +7716,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcDerivedUnitElement; case 1: return Type::IfcDerivedUnitEnum; case 2: return Type::IfcLabel; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Elements"; case 1: return "UnitType"; case 2: return "UserDefinedType"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcDerivedUnit (IfcEntityInstanceData* e);
@@ -7898,7 +7744,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcNamedUnit; case 1: return Type::UNDEFINED; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Unit"; case 1: return "Exponent"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcDerivedUnitElement (IfcEntityInstanceData* e);
@@ -7950,7 +7795,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::UNDEFINED; case 1: return Type::UNDEFINED; case 2: return Type::UNDEFINED; case 3: return Type::UNDEFINED; case 4: return Type::UNDEFINED; case 5: return Type::UNDEFINED; case 6: return Type::UNDEFINED; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "LengthExponent"; case 1: return "MassExponent"; case 2: return "TimeExponent"; case 3: return "ElectricCurrentExponent"; case 4: return "ThermodynamicTemperatureExponent"; case 5: return "AmountOfSubstanceExponent"; case 6: return "LuminousIntensityExponent"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcDimensionalExponents (IfcEntityInstanceData* e);
@@ -7982,7 +7826,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcLabel; case 1: return Type::IfcLabel; case 2: return Type::IfcLabel; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "FileExtension"; case 1: return "MimeContentType"; case 2: return "MimeSubtype"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcDocumentElectronicFormat (IfcEntityInstanceData* e);
@@ -8093,7 +7936,6 @@ public:
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcDocumentInformationRelationship >::ptr IsPointedTo() const; // INVERSE IfcDocumentInformationRelationship::RelatedDocuments
     IfcTemplatedEntityList< IfcDocumentInformationRelationship >::ptr IsPointer() const; // INVERSE IfcDocumentInformationRelationship::RelatingDocument
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcDocumentInformation (IfcEntityInstanceData* e);
@@ -8126,7 +7968,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcDocumentInformation; case 1: return Type::IfcDocumentInformation; case 2: return Type::IfcLabel; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "RelatingDocument"; case 1: return "RelatedDocuments"; case 2: return "RelationshipType"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcDocumentInformationRelationship (IfcEntityInstanceData* e);
@@ -8153,7 +7994,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcLabel; case 1: return Type::IfcText; case 2: return Type::IfcDraughtingCallout; case 3: return Type::IfcDraughtingCallout; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Name"; case 1: return "Description"; case 2: return "RelatingDraughtingCallout"; case 3: return "RelatedDraughtingCallout"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcDraughtingCalloutRelationship (IfcEntityInstanceData* e);
@@ -8176,7 +8016,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 6: return Type::IfcLabel; case 7: return Type::IfcEnvironmentalImpactCategoryEnum; case 8: return Type::IfcLabel; } return IfcAppliedValue::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 6: return "ImpactType"; case 7: return "Category"; case 8: return "UserDefinedCategory"; } return IfcAppliedValue::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcEnvironmentalImpactValue (IfcEntityInstanceData* e);
@@ -8215,7 +8054,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcLabel; case 1: return Type::IfcIdentifier; case 2: return Type::IfcLabel; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Location"; case 1: return "ItemReference"; case 2: return "Name"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcExternalReference (IfcEntityInstanceData* e);
@@ -8237,7 +8075,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcExternalReference::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcExternalReference::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcExternallyDefinedHatchStyle (IfcEntityInstanceData* e);
@@ -8258,7 +8095,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcExternalReference::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcExternalReference::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcExternallyDefinedSurfaceStyle (IfcEntityInstanceData* e);
@@ -8281,7 +8117,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcExternalReference::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcExternalReference::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcExternallyDefinedSymbol (IfcEntityInstanceData* e);
@@ -8302,7 +8137,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcExternalReference::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcExternalReference::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcExternallyDefinedTextFont (IfcEntityInstanceData* e);
@@ -8354,7 +8188,6 @@ public:
     IfcTemplatedEntityList< IfcGrid >::ptr PartOfV() const; // INVERSE IfcGrid::VAxes
     IfcTemplatedEntityList< IfcGrid >::ptr PartOfU() const; // INVERSE IfcGrid::UAxes
     IfcTemplatedEntityList< IfcVirtualGridIntersection >::ptr HasIntersections() const; // INVERSE IfcVirtualGridIntersection::IntersectingAxes
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcGridAxis (IfcEntityInstanceData* e);
@@ -8377,7 +8210,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcDateTimeSelect; case 1: return Type::IfcValue; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "TimeStamp"; case 1: return "ListValues"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcIrregularTimeSeriesValue (IfcEntityInstanceData* e);
@@ -8423,7 +8255,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcLabel; case 1: return Type::IfcLabel; case 2: return Type::IfcOrganization; case 3: return Type::IfcCalendarDate; case 4: return Type::IfcLibraryReference; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Name"; case 1: return "Version"; case 2: return "Publisher"; case 3: return "VersionDate"; case 4: return "LibraryReference"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcLibraryInformation (IfcEntityInstanceData* e);
@@ -8445,7 +8276,6 @@ public:
     virtual const char* getArgumentName(unsigned int i) const { return IfcExternalReference::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcLibraryInformation >::ptr ReferenceIntoLibrary() const; // INVERSE IfcLibraryInformation::LibraryReference
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcLibraryReference (IfcEntityInstanceData* e);
@@ -8485,7 +8315,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcPlaneAngleMeasure; case 1: return Type::IfcPlaneAngleMeasure; case 2: return Type::IfcLuminousIntensityDistributionMeasure; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "MainPlaneAngle"; case 1: return "SecondaryPlaneAngle"; case 2: return "LuminousIntensity"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcLightDistributionData (IfcEntityInstanceData* e);
@@ -8508,7 +8337,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcLightDistributionCurveEnum; case 1: return Type::IfcLightDistributionData; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "LightDistributionCurve"; case 1: return "DistributionData"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcLightIntensityDistribution (IfcEntityInstanceData* e);
@@ -8541,7 +8369,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcHourInDay; case 1: return Type::IfcMinuteInHour; case 2: return Type::IfcSecondInMinute; case 3: return Type::IfcCoordinatedUniversalTimeOffset; case 4: return Type::IfcDaylightSavingHour; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "HourComponent"; case 1: return "MinuteComponent"; case 2: return "SecondComponent"; case 3: return "Zone"; case 4: return "DaylightSavingOffset"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcLocalTime (IfcEntityInstanceData* e);
@@ -8591,7 +8418,6 @@ public:
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcMaterialDefinitionRepresentation >::ptr HasRepresentation() const; // INVERSE IfcMaterialDefinitionRepresentation::RepresentedMaterial
     IfcTemplatedEntityList< IfcMaterialClassificationRelationship >::ptr ClassifiedAs() const; // INVERSE IfcMaterialClassificationRelationship::ClassifiedMaterial
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcMaterial (IfcEntityInstanceData* e);
@@ -8616,7 +8442,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcClassificationNotationSelect; case 1: return Type::IfcMaterial; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "MaterialClassifications"; case 1: return "ClassifiedMaterial"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcMaterialClassificationRelationship (IfcEntityInstanceData* e);
@@ -8675,7 +8500,6 @@ public:
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Material"; case 1: return "LayerThickness"; case 2: return "IsVentilated"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcMaterialLayerSet >::ptr ToMaterialLayerSet() const; // INVERSE IfcMaterialLayerSet::MaterialLayers
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcMaterialLayer (IfcEntityInstanceData* e);
@@ -8730,7 +8554,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcMaterialLayer; case 1: return Type::IfcLabel; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "MaterialLayers"; case 1: return "LayerSetName"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcMaterialLayerSet (IfcEntityInstanceData* e);
@@ -8861,7 +8684,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcMaterialLayerSet; case 1: return Type::IfcLayerSetDirectionEnum; case 2: return Type::IfcDirectionSenseEnum; case 3: return Type::IfcLengthMeasure; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "ForLayerSet"; case 1: return "LayerSetDirection"; case 2: return "DirectionSense"; case 3: return "OffsetFromReferenceLine"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcMaterialLayerSetUsage (IfcEntityInstanceData* e);
@@ -8895,7 +8717,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcMaterial; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Materials"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcMaterialList (IfcEntityInstanceData* e);
@@ -8936,7 +8757,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcMaterial; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Material"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcMaterialProperties (IfcEntityInstanceData* e);
@@ -8966,7 +8786,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcValue; case 1: return Type::IfcUnit; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "ValueComponent"; case 1: return "UnitComponent"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcMeasureWithUnit (IfcEntityInstanceData* e);
@@ -9001,7 +8820,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 1: return Type::IfcDynamicViscosityMeasure; case 2: return Type::IfcModulusOfElasticityMeasure; case 3: return Type::IfcModulusOfElasticityMeasure; case 4: return Type::IfcPositiveRatioMeasure; case 5: return Type::IfcThermalExpansionCoefficientMeasure; } return IfcMaterialProperties::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 1: return "DynamicViscosity"; case 2: return "YoungModulus"; case 3: return "ShearModulus"; case 4: return "PoissonRatio"; case 5: return "ThermalExpansionCoefficient"; } return IfcMaterialProperties::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcMechanicalMaterialProperties (IfcEntityInstanceData* e);
@@ -9044,7 +8862,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 6: return Type::IfcPressureMeasure; case 7: return Type::IfcPressureMeasure; case 8: return Type::IfcPositiveRatioMeasure; case 9: return Type::IfcModulusOfElasticityMeasure; case 10: return Type::IfcPressureMeasure; case 11: return Type::IfcPositiveRatioMeasure; case 12: return Type::IfcRelaxation; } return IfcMechanicalMaterialProperties::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 6: return "YieldStress"; case 7: return "UltimateStress"; case 8: return "UltimateStrain"; case 9: return "HardeningModule"; case 10: return "ProportionalStress"; case 11: return "PlasticStrain"; case 12: return "Relaxations"; } return IfcMechanicalMaterialProperties::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcMechanicalSteelMaterialProperties (IfcEntityInstanceData* e);
@@ -9121,7 +8938,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 7: return Type::IfcBenchmarkEnum; case 8: return Type::IfcLabel; case 9: return Type::IfcMetricValueSelect; } return IfcConstraint::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 7: return "Benchmark"; case 8: return "ValueSource"; case 9: return "DataValue"; } return IfcConstraint::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcMetric (IfcEntityInstanceData* e);
@@ -9143,7 +8959,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcCurrencyEnum; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Currency"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcMonetaryUnit (IfcEntityInstanceData* e);
@@ -9168,7 +8983,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcDimensionalExponents; case 1: return Type::IfcUnitEnum; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Dimensions"; case 1: return "UnitType"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcNamedUnit (IfcEntityInstanceData* e);
@@ -9195,7 +9009,6 @@ public:
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcProduct >::ptr PlacesObject() const; // INVERSE IfcProduct::ObjectPlacement
     IfcTemplatedEntityList< IfcLocalPlacement >::ptr ReferencedByPlacements() const; // INVERSE IfcLocalPlacement::PlacementRelTo
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcObjectPlacement (IfcEntityInstanceData* e);
@@ -9236,7 +9049,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 7: return Type::IfcMetric; case 8: return Type::IfcMetric; case 9: return Type::IfcObjectiveEnum; case 10: return Type::IfcLabel; } return IfcConstraint::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 7: return "BenchmarkValues"; case 8: return "ResultValues"; case 9: return "ObjectiveQualifier"; case 10: return "UserDefinedQualifier"; } return IfcConstraint::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcObjective (IfcEntityInstanceData* e);
@@ -9287,7 +9099,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 1: return Type::IfcPositiveRatioMeasure; case 2: return Type::IfcPositiveRatioMeasure; case 3: return Type::IfcPositiveRatioMeasure; case 4: return Type::IfcPositiveRatioMeasure; case 5: return Type::IfcPositiveRatioMeasure; case 6: return Type::IfcPositiveRatioMeasure; case 7: return Type::IfcPositiveRatioMeasure; case 8: return Type::IfcPositiveRatioMeasure; case 9: return Type::IfcPositiveRatioMeasure; } return IfcMaterialProperties::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 1: return "VisibleTransmittance"; case 2: return "SolarTransmittance"; case 3: return "ThermalIrTransmittance"; case 4: return "ThermalIrEmissivityBack"; case 5: return "ThermalIrEmissivityFront"; case 6: return "VisibleReflectanceBack"; case 7: return "VisibleReflectanceFront"; case 8: return "SolarReflectanceFront"; case 9: return "SolarReflectanceBack"; } return IfcMaterialProperties::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcOpticalMaterialProperties (IfcEntityInstanceData* e);
@@ -9335,7 +9146,6 @@ public:
     IfcTemplatedEntityList< IfcOrganizationRelationship >::ptr IsRelatedBy() const; // INVERSE IfcOrganizationRelationship::RelatedOrganizations
     IfcTemplatedEntityList< IfcOrganizationRelationship >::ptr Relates() const; // INVERSE IfcOrganizationRelationship::RelatingOrganization
     IfcTemplatedEntityList< IfcPersonAndOrganization >::ptr Engages() const; // INVERSE IfcPersonAndOrganization::TheOrganization
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcOrganization (IfcEntityInstanceData* e);
@@ -9369,7 +9179,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcLabel; case 1: return Type::IfcText; case 2: return Type::IfcOrganization; case 3: return Type::IfcOrganization; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Name"; case 1: return "Description"; case 2: return "RelatingOrganization"; case 3: return "RelatedOrganizations"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcOrganizationRelationship (IfcEntityInstanceData* e);
@@ -9425,7 +9234,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcPersonAndOrganization; case 1: return Type::IfcApplication; case 2: return Type::IfcStateEnum; case 3: return Type::IfcChangeActionEnum; case 4: return Type::IfcTimeStamp; case 5: return Type::IfcPersonAndOrganization; case 6: return Type::IfcApplication; case 7: return Type::IfcTimeStamp; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "OwningUser"; case 1: return "OwningApplication"; case 2: return "State"; case 3: return "ChangeAction"; case 4: return "LastModifiedDate"; case 5: return "LastModifyingUser"; case 6: return "LastModifyingApplication"; case 7: return "CreationDate"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcOwnerHistory (IfcEntityInstanceData* e);
@@ -9494,7 +9302,6 @@ public:
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Id"; case 1: return "FamilyName"; case 2: return "GivenName"; case 3: return "MiddleNames"; case 4: return "PrefixTitles"; case 5: return "SuffixTitles"; case 6: return "Roles"; case 7: return "Addresses"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcPersonAndOrganization >::ptr EngagedIn() const; // INVERSE IfcPersonAndOrganization::ThePerson
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPerson (IfcEntityInstanceData* e);
@@ -9524,7 +9331,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcPerson; case 1: return Type::IfcOrganization; case 2: return Type::IfcActorRole; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "ThePerson"; case 1: return "TheOrganization"; case 2: return "Roles"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPersonAndOrganization (IfcEntityInstanceData* e);
@@ -9552,7 +9358,6 @@ public:
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Name"; case 1: return "Description"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcPhysicalComplexQuantity >::ptr PartOfComplex() const; // INVERSE IfcPhysicalComplexQuantity::HasQuantities
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPhysicalQuantity (IfcEntityInstanceData* e);
@@ -9580,7 +9385,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 2: return Type::IfcNamedUnit; } return IfcPhysicalQuantity::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 2: return "Unit"; } return IfcPhysicalQuantity::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPhysicalSimpleQuantity (IfcEntityInstanceData* e);
@@ -9638,7 +9442,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 3: return Type::IfcLabel; case 4: return Type::IfcLabel; case 5: return Type::IfcLabel; case 6: return Type::IfcLabel; case 7: return Type::IfcLabel; case 8: return Type::IfcLabel; case 9: return Type::IfcLabel; } return IfcAddress::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 3: return "InternalLocation"; case 4: return "AddressLines"; case 5: return "PostalBox"; case 6: return "Town"; case 7: return "Region"; case 8: return "PostalCode"; case 9: return "Country"; } return IfcAddress::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPostalAddress (IfcEntityInstanceData* e);
@@ -9662,7 +9465,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcLabel; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Name"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPreDefinedItem (IfcEntityInstanceData* e);
@@ -9683,7 +9485,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcPreDefinedItem::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcPreDefinedItem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPreDefinedSymbol (IfcEntityInstanceData* e);
@@ -9698,7 +9499,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcPreDefinedSymbol::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcPreDefinedSymbol::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPreDefinedTerminatorSymbol (IfcEntityInstanceData* e);
@@ -9723,7 +9523,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcPreDefinedItem::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcPreDefinedItem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPreDefinedTextFont (IfcEntityInstanceData* e);
@@ -9768,7 +9567,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcLabel; case 1: return Type::IfcText; case 2: return Type::IfcLayeredItem; case 3: return Type::IfcIdentifier; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Name"; case 1: return "Description"; case 2: return "AssignedItems"; case 3: return "Identifier"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPresentationLayerAssignment (IfcEntityInstanceData* e);
@@ -9811,7 +9609,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 4: return Type::UNDEFINED; case 5: return Type::UNDEFINED; case 6: return Type::UNDEFINED; case 7: return Type::IfcPresentationStyleSelect; } return IfcPresentationLayerAssignment::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 4: return "LayerOn"; case 5: return "LayerFrozen"; case 6: return "LayerBlocked"; case 7: return "LayerStyles"; } return IfcPresentationLayerAssignment::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPresentationLayerWithStyle (IfcEntityInstanceData* e);
@@ -9835,7 +9632,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcLabel; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Name"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPresentationStyle (IfcEntityInstanceData* e);
@@ -9857,7 +9653,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcPresentationStyleSelect; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Styles"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPresentationStyleAssignment (IfcEntityInstanceData* e);
@@ -9901,7 +9696,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcLabel; case 1: return Type::IfcText; case 2: return Type::IfcRepresentation; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Name"; case 1: return "Description"; case 2: return "Representations"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcProductRepresentation (IfcEntityInstanceData* e);
@@ -9932,7 +9726,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 1: return Type::IfcSpecificHeatCapacityMeasure; case 2: return Type::IfcPositiveRatioMeasure; case 3: return Type::IfcPositiveRatioMeasure; case 4: return Type::IfcPositiveRatioMeasure; } return IfcMaterialProperties::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 1: return "SpecificHeatCapacity"; case 2: return "N20Content"; case 3: return "COContent"; case 4: return "CO2Content"; } return IfcMaterialProperties::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcProductsOfCombustionProperties (IfcEntityInstanceData* e);
@@ -10124,7 +9917,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcProfileTypeEnum; case 1: return Type::IfcLabel; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "ProfileType"; case 1: return "ProfileName"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcProfileDef (IfcEntityInstanceData* e);
@@ -10158,7 +9950,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcLabel; case 1: return Type::IfcProfileDef; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "ProfileName"; case 1: return "ProfileDefinition"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcProfileProperties (IfcEntityInstanceData* e);
@@ -10186,7 +9977,6 @@ public:
     IfcTemplatedEntityList< IfcPropertyDependencyRelationship >::ptr PropertyForDependance() const; // INVERSE IfcPropertyDependencyRelationship::DependingProperty
     IfcTemplatedEntityList< IfcPropertyDependencyRelationship >::ptr PropertyDependsOn() const; // INVERSE IfcPropertyDependencyRelationship::DependantProperty
     IfcTemplatedEntityList< IfcComplexProperty >::ptr PartOfComplex() const; // INVERSE IfcComplexProperty::HasProperties
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcProperty (IfcEntityInstanceData* e);
@@ -10213,7 +10003,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcConstraint; case 1: return Type::IfcProperty; case 2: return Type::IfcLabel; case 3: return Type::IfcText; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "RelatingConstraint"; case 1: return "RelatedProperties"; case 2: return "Name"; case 3: return "Description"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPropertyConstraintRelationship (IfcEntityInstanceData* e);
@@ -10254,7 +10043,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcProperty; case 1: return Type::IfcProperty; case 2: return Type::IfcLabel; case 3: return Type::IfcText; case 4: return Type::IfcText; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "DependingProperty"; case 1: return "DependantProperty"; case 2: return "Name"; case 3: return "Description"; case 4: return "Expression"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPropertyDependencyRelationship (IfcEntityInstanceData* e);
@@ -10325,7 +10113,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcLabel; case 1: return Type::IfcValue; case 2: return Type::IfcUnit; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Name"; case 1: return "EnumerationValues"; case 2: return "Unit"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPropertyEnumeration (IfcEntityInstanceData* e);
@@ -10347,7 +10134,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 3: return Type::IfcAreaMeasure; } return IfcPhysicalSimpleQuantity::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 3: return "AreaValue"; } return IfcPhysicalSimpleQuantity::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcQuantityArea (IfcEntityInstanceData* e);
@@ -10369,7 +10155,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 3: return Type::IfcCountMeasure; } return IfcPhysicalSimpleQuantity::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 3: return "CountValue"; } return IfcPhysicalSimpleQuantity::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcQuantityCount (IfcEntityInstanceData* e);
@@ -10391,7 +10176,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 3: return Type::IfcLengthMeasure; } return IfcPhysicalSimpleQuantity::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 3: return "LengthValue"; } return IfcPhysicalSimpleQuantity::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcQuantityLength (IfcEntityInstanceData* e);
@@ -10413,7 +10197,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 3: return Type::IfcTimeMeasure; } return IfcPhysicalSimpleQuantity::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 3: return "TimeValue"; } return IfcPhysicalSimpleQuantity::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcQuantityTime (IfcEntityInstanceData* e);
@@ -10435,7 +10218,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 3: return Type::IfcVolumeMeasure; } return IfcPhysicalSimpleQuantity::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 3: return "VolumeValue"; } return IfcPhysicalSimpleQuantity::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcQuantityVolume (IfcEntityInstanceData* e);
@@ -10457,7 +10239,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 3: return Type::IfcMassMeasure; } return IfcPhysicalSimpleQuantity::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 3: return "WeightValue"; } return IfcPhysicalSimpleQuantity::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcQuantityWeight (IfcEntityInstanceData* e);
@@ -10484,7 +10265,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcDocumentSelect; case 1: return Type::IfcAppliedValue; case 2: return Type::IfcLabel; case 3: return Type::IfcText; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "ReferencedDocument"; case 1: return "ReferencingValues"; case 2: return "Name"; case 3: return "Description"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcReferencesValueDocument (IfcEntityInstanceData* e);
@@ -10529,7 +10309,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcAreaMeasure; case 1: return Type::IfcLabel; case 2: return Type::IfcReinforcingBarSurfaceEnum; case 3: return Type::IfcLengthMeasure; case 4: return Type::IfcPositiveLengthMeasure; case 5: return Type::IfcCountMeasure; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "TotalCrossSectionArea"; case 1: return "SteelGrade"; case 2: return "BarSurface"; case 3: return "EffectiveDepth"; case 4: return "NominalBarDiameter"; case 5: return "BarCount"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcReinforcementBarProperties (IfcEntityInstanceData* e);
@@ -10548,7 +10327,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcNormalisedRatioMeasure; case 1: return Type::IfcNormalisedRatioMeasure; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "RelaxationValue"; case 1: return "InitialStress"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRelaxation (IfcEntityInstanceData* e);
@@ -10628,7 +10406,6 @@ public:
     IfcTemplatedEntityList< IfcRepresentationMap >::ptr RepresentationMap() const; // INVERSE IfcRepresentationMap::MappedRepresentation
     IfcTemplatedEntityList< IfcPresentationLayerAssignment >::ptr LayerAssignments() const; // INVERSE IfcPresentationLayerAssignment::AssignedItems
     IfcTemplatedEntityList< IfcProductRepresentation >::ptr OfProductRepresentation() const; // INVERSE IfcProductRepresentation::Representations
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRepresentation (IfcEntityInstanceData* e);
@@ -10663,7 +10440,6 @@ public:
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "ContextIdentifier"; case 1: return "ContextType"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcRepresentation >::ptr RepresentationsInContext() const; // INVERSE IfcRepresentation::ContextOfItems
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRepresentationContext (IfcEntityInstanceData* e);
@@ -10711,7 +10487,6 @@ public:
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcPresentationLayerAssignment >::ptr LayerAssignments() const; // INVERSE IfcPresentationLayerAssignment::AssignedItems
     IfcTemplatedEntityList< IfcStyledItem >::ptr StyledByItem() const; // INVERSE IfcStyledItem::Item
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRepresentationItem (IfcEntityInstanceData* e);
@@ -10744,7 +10519,6 @@ public:
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "MappingOrigin"; case 1: return "MappedRepresentation"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcMappedItem >::ptr MapUsage() const; // INVERSE IfcMappedItem::MappingSource
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRepresentationMap (IfcEntityInstanceData* e);
@@ -10777,7 +10551,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 2: return Type::IfcPositiveLengthMeasure; case 3: return Type::IfcPositiveLengthMeasure; case 4: return Type::IfcPositiveLengthMeasure; case 5: return Type::IfcPositiveLengthMeasure; case 6: return Type::IfcRibPlateDirectionEnum; } return IfcProfileProperties::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 2: return "Thickness"; case 3: return "RibHeight"; case 4: return "RibWidth"; case 5: return "RibSpacing"; case 6: return "Direction"; } return IfcProfileProperties::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRibPlateProfileProperties (IfcEntityInstanceData* e);
@@ -10820,7 +10593,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcGloballyUniqueId; case 1: return Type::IfcOwnerHistory; case 2: return Type::IfcLabel; case 3: return Type::IfcText; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "GlobalId"; case 1: return "OwnerHistory"; case 2: return "Name"; case 3: return "Description"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRoot (IfcEntityInstanceData* e);
@@ -10851,7 +10623,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 2: return Type::IfcSIPrefix; case 3: return Type::IfcSIUnitName; } return IfcNamedUnit::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 2: return "Prefix"; case 3: return "Name"; } return IfcNamedUnit::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcSIUnit (IfcEntityInstanceData* e);
@@ -10881,7 +10652,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcSectionTypeEnum; case 1: return Type::IfcProfileDef; case 2: return Type::IfcProfileDef; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "SectionType"; case 1: return "StartProfile"; case 2: return "EndProfile"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcSectionProperties (IfcEntityInstanceData* e);
@@ -10922,7 +10692,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcLengthMeasure; case 1: return Type::IfcLengthMeasure; case 2: return Type::IfcLengthMeasure; case 3: return Type::IfcReinforcingBarRoleEnum; case 4: return Type::IfcSectionProperties; case 5: return Type::IfcReinforcementBarProperties; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "LongitudinalStartPosition"; case 1: return "LongitudinalEndPosition"; case 2: return "TransversePosition"; case 3: return "ReinforcementRole"; case 4: return "SectionDefinition"; case 5: return "CrossSectionReinforcementDefinitions"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcSectionReinforcementProperties (IfcEntityInstanceData* e);
@@ -10996,7 +10765,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcShapeModel; case 1: return Type::IfcLabel; case 2: return Type::IfcText; case 3: return Type::UNDEFINED; case 4: return Type::IfcProductDefinitionShape; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "ShapeRepresentations"; case 1: return "Name"; case 2: return "Description"; case 3: return "ProductDefinitional"; case 4: return "PartOfProductDefinitionShape"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcShapeAspect (IfcEntityInstanceData* e);
@@ -11029,7 +10797,6 @@ public:
     virtual const char* getArgumentName(unsigned int i) const { return IfcRepresentation::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcShapeAspect >::ptr OfShapeAspect() const; // INVERSE IfcShapeAspect::ShapeRepresentations
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcShapeModel (IfcEntityInstanceData* e);
@@ -11178,7 +10945,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcShapeModel::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcShapeModel::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcShapeRepresentation (IfcEntityInstanceData* e);
@@ -11195,7 +10961,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcProperty::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcProperty::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcSimpleProperty (IfcEntityInstanceData* e);
@@ -11217,7 +10982,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcLabel; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Name"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcStructuralConnectionCondition (IfcEntityInstanceData* e);
@@ -11239,7 +11003,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcLabel; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Name"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcStructuralLoad (IfcEntityInstanceData* e);
@@ -11256,7 +11019,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcStructuralLoad::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcStructuralLoad::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcStructuralLoadStatic (IfcEntityInstanceData* e);
@@ -11287,7 +11049,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 1: return Type::IfcThermodynamicTemperatureMeasure; case 2: return Type::IfcThermodynamicTemperatureMeasure; case 3: return Type::IfcThermodynamicTemperatureMeasure; } return IfcStructuralLoadStatic::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 1: return "DeltaT_Constant"; case 2: return "DeltaT_Y"; case 3: return "DeltaT_Z"; } return IfcStructuralLoadStatic::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcStructuralLoadTemperature (IfcEntityInstanceData* e);
@@ -11306,7 +11067,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcRepresentation::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcRepresentation::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcStyleModel (IfcEntityInstanceData* e);
@@ -11368,7 +11128,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcRepresentationItem; case 1: return Type::IfcPresentationStyleAssignment; case 2: return Type::IfcLabel; } return IfcRepresentationItem::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Item"; case 1: return "Styles"; case 2: return "Name"; } return IfcRepresentationItem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcStyledItem (IfcEntityInstanceData* e);
@@ -11389,7 +11148,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcStyleModel::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcStyleModel::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcStyledRepresentation (IfcEntityInstanceData* e);
@@ -11416,7 +11174,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 1: return Type::IfcSurfaceSide; case 2: return Type::IfcSurfaceStyleElementSelect; } return IfcPresentationStyle::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 1: return "Side"; case 2: return "Styles"; } return IfcPresentationStyle::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcSurfaceStyle (IfcEntityInstanceData* e);
@@ -11457,7 +11214,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcColourRgb; case 1: return Type::IfcColourRgb; case 2: return Type::IfcColourRgb; case 3: return Type::IfcColourRgb; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "DiffuseTransmissionColour"; case 1: return "DiffuseReflectionColour"; case 2: return "TransmissionColour"; case 3: return "ReflectanceColour"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcSurfaceStyleLighting (IfcEntityInstanceData* e);
@@ -11486,7 +11242,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcReal; case 1: return Type::IfcReal; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "RefractionIndex"; case 1: return "DispersionFactor"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcSurfaceStyleRefraction (IfcEntityInstanceData* e);
@@ -11510,7 +11265,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcColourRgb; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "SurfaceColour"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcSurfaceStyleShading (IfcEntityInstanceData* e);
@@ -11545,7 +11299,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcSurfaceTexture; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Textures"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcSurfaceStyleWithTextures (IfcEntityInstanceData* e);
@@ -11666,7 +11419,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::UNDEFINED; case 1: return Type::UNDEFINED; case 2: return Type::IfcSurfaceTextureEnum; case 3: return Type::IfcCartesianTransformationOperator2D; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "RepeatS"; case 1: return "RepeatT"; case 2: return "TextureType"; case 3: return "TextureTransform"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcSurfaceTexture (IfcEntityInstanceData* e);
@@ -11688,7 +11440,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 1: return Type::IfcSymbolStyleSelect; } return IfcPresentationStyle::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 1: return "StyleOfSymbol"; } return IfcPresentationStyle::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcSymbolStyle (IfcEntityInstanceData* e);
@@ -11723,7 +11474,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::UNDEFINED; case 1: return Type::IfcTableRow; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Name"; case 1: return "Rows"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcTable (IfcEntityInstanceData* e);
@@ -11757,7 +11507,6 @@ public:
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "RowCells"; case 1: return "IsHeading"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcTable >::ptr OfTable() const; // INVERSE IfcTable::Rows
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcTableRow (IfcEntityInstanceData* e);
@@ -11805,7 +11554,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 3: return Type::IfcLabel; case 4: return Type::IfcLabel; case 5: return Type::IfcLabel; case 6: return Type::IfcLabel; case 7: return Type::IfcLabel; } return IfcAddress::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 3: return "TelephoneNumbers"; case 4: return "FacsimileNumbers"; case 5: return "PagerNumber"; case 6: return "ElectronicMailAddresses"; case 7: return "WWWHomePageURL"; } return IfcAddress::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcTelecomAddress (IfcEntityInstanceData* e);
@@ -11866,7 +11614,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 1: return Type::IfcCharacterStyleSelect; case 2: return Type::IfcTextStyleSelect; case 3: return Type::IfcTextFontSelect; } return IfcPresentationStyle::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 1: return "TextCharacterAppearance"; case 2: return "TextStyle"; case 3: return "TextFontStyle"; } return IfcPresentationStyle::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcTextStyle (IfcEntityInstanceData* e);
@@ -11971,7 +11718,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 1: return Type::IfcTextFontName; case 2: return Type::IfcFontStyle; case 3: return Type::IfcFontVariant; case 4: return Type::IfcFontWeight; case 5: return Type::IfcSizeSelect; } return IfcPreDefinedTextFont::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 1: return "FontFamily"; case 2: return "FontStyle"; case 3: return "FontVariant"; case 4: return "FontWeight"; case 5: return "FontSize"; } return IfcPreDefinedTextFont::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcTextStyleFontModel (IfcEntityInstanceData* e);
@@ -12010,7 +11756,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcColour; case 1: return Type::IfcColour; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Colour"; case 1: return "BackgroundColour"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcTextStyleForDefinedFont (IfcEntityInstanceData* e);
@@ -12073,7 +11818,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcSizeSelect; case 1: return Type::IfcTextAlignment; case 2: return Type::IfcTextDecoration; case 3: return Type::IfcSizeSelect; case 4: return Type::IfcSizeSelect; case 5: return Type::IfcTextTransformation; case 6: return Type::IfcSizeSelect; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "TextIndent"; case 1: return "TextAlign"; case 2: return "TextDecoration"; case 3: return "LetterSpacing"; case 4: return "WordSpacing"; case 5: return "TextTransform"; case 6: return "LineHeight"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcTextStyleTextModel (IfcEntityInstanceData* e);
@@ -12129,7 +11873,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcPositiveLengthMeasure; case 1: return Type::IfcPositiveLengthMeasure; case 2: return Type::IfcPlaneAngleMeasure; case 3: return Type::IfcPlaneAngleMeasure; case 4: return Type::IfcSizeSelect; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "BoxHeight"; case 1: return "BoxWidth"; case 2: return "BoxSlantAngle"; case 3: return "BoxRotateAngle"; case 4: return "CharacterSpacing"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcTextStyleWithBoxCharacteristics (IfcEntityInstanceData* e);
@@ -12155,7 +11898,6 @@ public:
     virtual const char* getArgumentName(unsigned int i) const { (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcAnnotationSurface >::ptr AnnotatedSurface() const; // INVERSE IfcAnnotationSurface::TextureCoordinates
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcTextureCoordinate (IfcEntityInstanceData* e);
@@ -12205,7 +11947,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcLabel; case 1: return Type::IfcSimpleValue; } return IfcTextureCoordinate::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Mode"; case 1: return "Parameter"; } return IfcTextureCoordinate::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcTextureCoordinateGenerator (IfcEntityInstanceData* e);
@@ -12272,7 +12013,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcVertexBasedTextureMap; } return IfcTextureCoordinate::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "TextureMaps"; } return IfcTextureCoordinate::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcTextureMap (IfcEntityInstanceData* e);
@@ -12316,7 +12056,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcParameterValue; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Coordinates"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcTextureVertex (IfcEntityInstanceData* e);
@@ -12347,7 +12086,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 1: return Type::IfcSpecificHeatCapacityMeasure; case 2: return Type::IfcThermodynamicTemperatureMeasure; case 3: return Type::IfcThermodynamicTemperatureMeasure; case 4: return Type::IfcThermalConductivityMeasure; } return IfcMaterialProperties::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 1: return "SpecificHeatCapacity"; case 2: return "BoilingPoint"; case 3: return "FreezingPoint"; case 4: return "ThermalConductivity"; } return IfcMaterialProperties::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcThermalMaterialProperties (IfcEntityInstanceData* e);
@@ -12397,7 +12135,6 @@ public:
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Name"; case 1: return "Description"; case 2: return "StartTime"; case 3: return "EndTime"; case 4: return "TimeSeriesDataType"; case 5: return "DataOrigin"; case 6: return "UserDefinedDataOrigin"; case 7: return "Unit"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcTimeSeriesReferenceRelationship >::ptr DocumentedBy() const; // INVERSE IfcTimeSeriesReferenceRelationship::ReferencedTimeSeries
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcTimeSeries (IfcEntityInstanceData* e);
@@ -12416,7 +12153,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcTimeSeries; case 1: return Type::IfcDocumentSelect; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "ReferencedTimeSeries"; case 1: return "TimeSeriesReferences"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcTimeSeriesReferenceRelationship (IfcEntityInstanceData* e);
@@ -12442,7 +12178,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcValue; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "ListValues"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcTimeSeriesValue (IfcEntityInstanceData* e);
@@ -12461,7 +12196,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcRepresentationItem::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcRepresentationItem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcTopologicalRepresentationItem (IfcEntityInstanceData* e);
@@ -12509,7 +12243,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcShapeModel::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcShapeModel::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcTopologyRepresentation (IfcEntityInstanceData* e);
@@ -12531,7 +12264,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcUnit; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Units"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcUnitAssignment (IfcEntityInstanceData* e);
@@ -12555,7 +12287,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcTopologicalRepresentationItem::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcTopologicalRepresentationItem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcVertex (IfcEntityInstanceData* e);
@@ -12574,7 +12305,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcTextureVertex; case 1: return Type::IfcCartesianPoint; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "TextureVertices"; case 1: return "TexturePoints"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcVertexBasedTextureMap (IfcEntityInstanceData* e);
@@ -12600,7 +12330,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcPoint; } return IfcVertex::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "VertexGeometry"; } return IfcVertex::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcVertexPoint (IfcEntityInstanceData* e);
@@ -12679,7 +12408,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcGridAxis; case 1: return Type::IfcLengthMeasure; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "IntersectingAxes"; case 1: return "OffsetDistances"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcVirtualGridIntersection (IfcEntityInstanceData* e);
@@ -12722,7 +12450,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 1: return Type::UNDEFINED; case 2: return Type::IfcIonConcentrationMeasure; case 3: return Type::IfcIonConcentrationMeasure; case 4: return Type::IfcIonConcentrationMeasure; case 5: return Type::IfcNormalisedRatioMeasure; case 6: return Type::IfcPHMeasure; case 7: return Type::IfcNormalisedRatioMeasure; } return IfcMaterialProperties::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 1: return "IsPotable"; case 2: return "Hardness"; case 3: return "AlkalinityConcentration"; case 4: return "AcidityConcentration"; case 5: return "ImpuritiesContent"; case 6: return "PHLevel"; case 7: return "DissolvedSolidsContent"; } return IfcMaterialProperties::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcWaterProperties (IfcEntityInstanceData* e);
@@ -12737,7 +12464,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcStyledItem::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcStyledItem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcAnnotationOccurrence (IfcEntityInstanceData* e);
@@ -12752,7 +12478,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcAnnotationOccurrence::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcAnnotationOccurrence::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcAnnotationSurfaceOccurrence (IfcEntityInstanceData* e);
@@ -12767,7 +12492,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcAnnotationOccurrence::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcAnnotationOccurrence::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcAnnotationSymbolOccurrence (IfcEntityInstanceData* e);
@@ -12782,7 +12506,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcAnnotationOccurrence::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcAnnotationOccurrence::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcAnnotationTextOccurrence (IfcEntityInstanceData* e);
@@ -12817,7 +12540,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 2: return Type::IfcCurve; } return IfcProfileDef::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 2: return "OuterCurve"; } return IfcProfileDef::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcArbitraryClosedProfileDef (IfcEntityInstanceData* e);
@@ -12849,7 +12571,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 2: return Type::IfcBoundedCurve; } return IfcProfileDef::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 2: return "Curve"; } return IfcProfileDef::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcArbitraryOpenProfileDef (IfcEntityInstanceData* e);
@@ -12885,7 +12606,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 3: return Type::IfcCurve; } return IfcArbitraryClosedProfileDef::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 3: return "InnerCurves"; } return IfcArbitraryClosedProfileDef::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcArbitraryProfileDefWithVoids (IfcEntityInstanceData* e);
@@ -12914,7 +12634,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 4: return Type::IfcIdentifier; case 5: return Type::UNDEFINED; } return IfcSurfaceTexture::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 4: return "RasterFormat"; case 5: return "RasterCode"; } return IfcSurfaceTexture::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcBlobTexture (IfcEntityInstanceData* e);
@@ -12960,7 +12679,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 3: return Type::IfcPositiveLengthMeasure; } return IfcArbitraryOpenProfileDef::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 3: return "Thickness"; } return IfcArbitraryOpenProfileDef::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcCenterLineProfileDef (IfcEntityInstanceData* e);
@@ -13000,7 +12718,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 3: return Type::IfcClassification; } return IfcExternalReference::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 3: return "ReferencedSource"; } return IfcExternalReference::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcClassificationReference (IfcEntityInstanceData* e);
@@ -13037,7 +12754,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 1: return Type::IfcNormalisedRatioMeasure; case 2: return Type::IfcNormalisedRatioMeasure; case 3: return Type::IfcNormalisedRatioMeasure; } return IfcColourSpecification::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 1: return "Red"; case 2: return "Green"; case 3: return "Blue"; } return IfcColourSpecification::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcColourRgb (IfcEntityInstanceData* e);
@@ -13063,7 +12779,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 2: return Type::IfcIdentifier; case 3: return Type::IfcProperty; } return IfcProperty::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 2: return "UsageName"; case 3: return "HasProperties"; } return IfcProperty::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcComplexProperty (IfcEntityInstanceData* e);
@@ -13121,7 +12836,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 2: return Type::IfcProfileDef; case 3: return Type::IfcLabel; } return IfcProfileDef::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 2: return "Profiles"; case 3: return "Label"; } return IfcProfileDef::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcCompositeProfileDef (IfcEntityInstanceData* e);
@@ -13147,7 +12861,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcFace; } return IfcTopologicalRepresentationItem::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "CfsFaces"; } return IfcTopologicalRepresentationItem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcConnectedFaceSet (IfcEntityInstanceData* e);
@@ -13182,7 +12895,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcCurveOrEdgeCurve; case 1: return Type::IfcCurveOrEdgeCurve; } return IfcConnectionGeometry::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "CurveOnRelatingElement"; case 1: return "CurveOnRelatedElement"; } return IfcConnectionGeometry::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcConnectionCurveGeometry (IfcEntityInstanceData* e);
@@ -13230,7 +12942,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 2: return Type::IfcLengthMeasure; case 3: return Type::IfcLengthMeasure; case 4: return Type::IfcLengthMeasure; } return IfcConnectionPointGeometry::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 2: return "EccentricityInX"; case 3: return "EccentricityInY"; case 4: return "EccentricityInZ"; } return IfcConnectionPointGeometry::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcConnectionPointEccentricity (IfcEntityInstanceData* e);
@@ -13254,7 +12965,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 2: return Type::IfcLabel; } return IfcNamedUnit::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 2: return "Name"; } return IfcNamedUnit::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcContextDependentUnit (IfcEntityInstanceData* e);
@@ -13321,7 +13031,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 2: return Type::IfcLabel; case 3: return Type::IfcMeasureWithUnit; } return IfcNamedUnit::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 2: return "Name"; case 3: return "ConversionFactor"; } return IfcNamedUnit::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcConversionBasedUnit (IfcEntityInstanceData* e);
@@ -13367,7 +13076,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 1: return Type::IfcCurveFontOrScaledCurveFontSelect; case 2: return Type::IfcSizeSelect; case 3: return Type::IfcColour; } return IfcPresentationStyle::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 1: return "CurveFont"; case 2: return "CurveWidth"; case 3: return "CurveColour"; } return IfcPresentationStyle::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcCurveStyle (IfcEntityInstanceData* e);
@@ -13476,7 +13184,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 2: return Type::IfcProfileDef; case 3: return Type::IfcCartesianTransformationOperator2D; case 4: return Type::IfcLabel; } return IfcProfileDef::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 2: return "ParentProfile"; case 3: return "Operator"; case 4: return "Label"; } return IfcProfileDef::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcDerivedProfileDef (IfcEntityInstanceData* e);
@@ -13491,7 +13198,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcDraughtingCalloutRelationship::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcDraughtingCalloutRelationship::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcDimensionCalloutRelationship (IfcEntityInstanceData* e);
@@ -13506,7 +13212,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcDraughtingCalloutRelationship::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcDraughtingCalloutRelationship::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcDimensionPair (IfcEntityInstanceData* e);
@@ -13532,7 +13237,6 @@ public:
     virtual const char* getArgumentName(unsigned int i) const { return IfcExternalReference::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcDocumentInformation >::ptr ReferenceToDocument() const; // INVERSE IfcDocumentInformation::DocumentReferences
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcDocumentReference (IfcEntityInstanceData* e);
@@ -13556,7 +13260,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcPreDefinedTextFont::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcPreDefinedTextFont::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcDraughtingPreDefinedTextFont (IfcEntityInstanceData* e);
@@ -13625,7 +13328,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcVertex; case 1: return Type::IfcVertex; } return IfcTopologicalRepresentationItem::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "EdgeStart"; case 1: return "EdgeEnd"; } return IfcTopologicalRepresentationItem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcEdge (IfcEntityInstanceData* e);
@@ -13678,7 +13380,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 2: return Type::IfcCurve; case 3: return Type::UNDEFINED; } return IfcEdge::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 2: return "EdgeGeometry"; case 3: return "SameSense"; } return IfcEdge::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcEdgeCurve (IfcEntityInstanceData* e);
@@ -13735,7 +13436,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 1: return Type::IfcProperty; case 2: return Type::IfcText; case 3: return Type::IfcLabel; } return IfcMaterialProperties::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 1: return "ExtendedProperties"; case 2: return "Description"; case 3: return "Name"; } return IfcMaterialProperties::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcExtendedMaterialProperties (IfcEntityInstanceData* e);
@@ -13796,7 +13496,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcFaceBound; } return IfcTopologicalRepresentationItem::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Bounds"; } return IfcTopologicalRepresentationItem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcFace (IfcEntityInstanceData* e);
@@ -13821,7 +13520,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcLoop; case 1: return Type::UNDEFINED; } return IfcTopologicalRepresentationItem::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Bound"; case 1: return "Orientation"; } return IfcTopologicalRepresentationItem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcFaceBound (IfcEntityInstanceData* e);
@@ -13840,7 +13538,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcFaceBound::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcFaceBound::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcFaceOuterBound (IfcEntityInstanceData* e);
@@ -13896,7 +13593,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 1: return Type::IfcSurface; case 2: return Type::UNDEFINED; } return IfcFace::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 1: return "FaceSurface"; case 2: return "SameSense"; } return IfcFace::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcFaceSurface (IfcEntityInstanceData* e);
@@ -13947,7 +13643,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 1: return Type::IfcForceMeasure; case 2: return Type::IfcForceMeasure; case 3: return Type::IfcForceMeasure; case 4: return Type::IfcForceMeasure; case 5: return Type::IfcForceMeasure; case 6: return Type::IfcForceMeasure; } return IfcStructuralConnectionCondition::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 1: return "TensionFailureX"; case 2: return "TensionFailureY"; case 3: return "TensionFailureZ"; case 4: return "CompressionFailureX"; case 5: return "CompressionFailureY"; case 6: return "CompressionFailureZ"; } return IfcStructuralConnectionCondition::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcFailureConnectionCondition (IfcEntityInstanceData* e);
@@ -13998,7 +13693,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 1: return Type::IfcFillStyleSelect; } return IfcPresentationStyle::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 1: return "FillStyles"; } return IfcPresentationStyle::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcFillAreaStyle (IfcEntityInstanceData* e);
@@ -14029,7 +13723,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 1: return Type::IfcThermodynamicTemperatureMeasure; case 2: return Type::IfcPositiveRatioMeasure; case 3: return Type::IfcHeatingValueMeasure; case 4: return Type::IfcHeatingValueMeasure; } return IfcMaterialProperties::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 1: return "CombustionTemperature"; case 2: return "CarbonContent"; case 3: return "LowerHeatingValue"; case 4: return "HigherHeatingValue"; } return IfcMaterialProperties::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcFuelProperties (IfcEntityInstanceData* e);
@@ -14056,7 +13749,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 1: return Type::IfcMolecularWeightMeasure; case 2: return Type::IfcNormalisedRatioMeasure; case 3: return Type::IfcMassDensityMeasure; } return IfcMaterialProperties::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 1: return "MolecularWeight"; case 2: return "Porosity"; case 3: return "MassDensity"; } return IfcMaterialProperties::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcGeneralMaterialProperties (IfcEntityInstanceData* e);
@@ -14091,7 +13783,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 2: return Type::IfcMassPerLengthMeasure; case 3: return Type::IfcPositiveLengthMeasure; case 4: return Type::IfcPositiveLengthMeasure; case 5: return Type::IfcPositiveLengthMeasure; case 6: return Type::IfcAreaMeasure; } return IfcProfileProperties::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 2: return "PhysicalWeight"; case 3: return "Perimeter"; case 4: return "MinimumPlateThickness"; case 5: return "MaximumPlateThickness"; case 6: return "CrossSectionArea"; } return IfcProfileProperties::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcGeneralProfileProperties (IfcEntityInstanceData* e);
@@ -14171,7 +13862,6 @@ public:
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 2: return "CoordinateSpaceDimension"; case 3: return "Precision"; case 4: return "WorldCoordinateSystem"; case 5: return "TrueNorth"; } return IfcRepresentationContext::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcGeometricRepresentationSubContext >::ptr HasSubContexts() const; // INVERSE IfcGeometricRepresentationSubContext::ParentContext
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcGeometricRepresentationContext (IfcEntityInstanceData* e);
@@ -14204,7 +13894,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcRepresentationItem::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcRepresentationItem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcGeometricRepresentationItem (IfcEntityInstanceData* e);
@@ -14257,7 +13946,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 6: return Type::IfcGeometricRepresentationContext; case 7: return Type::IfcPositiveRatioMeasure; case 8: return Type::IfcGeometricProjectionEnum; case 9: return Type::IfcLabel; } return IfcGeometricRepresentationContext::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 6: return "ParentContext"; case 7: return "TargetScale"; case 8: return "TargetView"; case 9: return "UserDefinedTargetView"; } return IfcGeometricRepresentationContext::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcGeometricRepresentationSubContext (IfcEntityInstanceData* e);
@@ -14281,7 +13969,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcGeometricSetSelect; } return IfcGeometricRepresentationItem::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Elements"; } return IfcGeometricRepresentationItem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcGeometricSet (IfcEntityInstanceData* e);
@@ -14350,7 +14037,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcVirtualGridIntersection; case 1: return Type::IfcVirtualGridIntersection; } return IfcObjectPlacement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "PlacementLocation"; case 1: return "PlacementRefDirection"; } return IfcObjectPlacement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcGridPlacement (IfcEntityInstanceData* e);
@@ -14385,7 +14071,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcSurface; case 1: return Type::UNDEFINED; } return IfcGeometricRepresentationItem::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "BaseSurface"; case 1: return "AgreementFlag"; } return IfcGeometricRepresentationItem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcHalfSpaceSolid (IfcEntityInstanceData* e);
@@ -14420,7 +14105,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 1: return Type::IfcPositiveRatioMeasure; case 2: return Type::IfcPositiveRatioMeasure; case 3: return Type::IfcIsothermalMoistureCapacityMeasure; case 4: return Type::IfcVaporPermeabilityMeasure; case 5: return Type::IfcMoistureDiffusivityMeasure; } return IfcMaterialProperties::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 1: return "UpperVaporResistanceFactor"; case 2: return "LowerVaporResistanceFactor"; case 3: return "IsothermalMoistureCapacity"; case 4: return "VaporPermeability"; case 5: return "MoistureDiffusivity"; } return IfcMaterialProperties::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcHygroscopicMaterialProperties (IfcEntityInstanceData* e);
@@ -14472,7 +14156,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 4: return Type::IfcIdentifier; } return IfcSurfaceTexture::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 4: return "UrlReference"; } return IfcSurfaceTexture::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcImageTexture (IfcEntityInstanceData* e);
@@ -14494,7 +14177,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcIrregularTimeSeriesValue; } return IfcTimeSeries::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "Values"; } return IfcTimeSeries::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcIrregularTimeSeries (IfcEntityInstanceData* e);
@@ -14534,7 +14216,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcLabel; case 1: return Type::IfcColourRgb; case 2: return Type::IfcNormalisedRatioMeasure; case 3: return Type::IfcNormalisedRatioMeasure; } return IfcGeometricRepresentationItem::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Name"; case 1: return "LightColour"; case 2: return "AmbientIntensity"; case 3: return "Intensity"; } return IfcGeometricRepresentationItem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcLightSource (IfcEntityInstanceData* e);
@@ -14555,7 +14236,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcLightSource::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcLightSource::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcLightSourceAmbient (IfcEntityInstanceData* e);
@@ -14582,7 +14262,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 4: return Type::IfcDirection; } return IfcLightSource::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 4: return "Orientation"; } return IfcLightSource::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcLightSourceDirectional (IfcEntityInstanceData* e);
@@ -14623,7 +14302,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 4: return Type::IfcAxis2Placement3D; case 5: return Type::IfcColourRgb; case 6: return Type::IfcThermodynamicTemperatureMeasure; case 7: return Type::IfcLuminousFluxMeasure; case 8: return Type::IfcLightEmissionSourceEnum; case 9: return Type::IfcLightDistributionDataSourceSelect; } return IfcLightSource::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 4: return "Position"; case 5: return "ColourAppearance"; case 6: return "ColourTemperature"; case 7: return "LuminousFlux"; case 8: return "LightEmissionSource"; case 9: return "LightDistributionDataSource"; } return IfcLightSource::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcLightSourceGoniometric (IfcEntityInstanceData* e);
@@ -14669,7 +14347,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 4: return Type::IfcCartesianPoint; case 5: return Type::IfcPositiveLengthMeasure; case 6: return Type::IfcReal; case 7: return Type::IfcReal; case 8: return Type::IfcReal; } return IfcLightSource::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 4: return "Position"; case 5: return "Radius"; case 6: return "ConstantAttenuation"; case 7: return "DistanceAttenuation"; case 8: return "QuadricAttenuation"; } return IfcLightSource::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcLightSourcePositional (IfcEntityInstanceData* e);
@@ -14715,7 +14392,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcDirection; case 10: return Type::IfcReal; case 11: return Type::IfcPositivePlaneAngleMeasure; case 12: return Type::IfcPositivePlaneAngleMeasure; } return IfcLightSourcePositional::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "Orientation"; case 10: return "ConcentrationExponent"; case 11: return "SpreadAngle"; case 12: return "BeamWidthAngle"; } return IfcLightSourcePositional::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcLightSourceSpot (IfcEntityInstanceData* e);
@@ -14789,7 +14465,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcObjectPlacement; case 1: return Type::IfcAxis2Placement; } return IfcObjectPlacement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "PlacementRelTo"; case 1: return "RelativePlacement"; } return IfcObjectPlacement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcLocalPlacement (IfcEntityInstanceData* e);
@@ -14829,7 +14504,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcTopologicalRepresentationItem::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcTopologicalRepresentationItem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcLoop (IfcEntityInstanceData* e);
@@ -14868,7 +14542,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcRepresentationMap; case 1: return Type::IfcCartesianTransformationOperator; } return IfcRepresentationItem::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "MappingSource"; case 1: return "MappingTarget"; } return IfcRepresentationItem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcMappedItem (IfcEntityInstanceData* e);
@@ -14915,7 +14588,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 3: return Type::IfcMaterial; } return IfcProductRepresentation::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 3: return "RepresentedMaterial"; } return IfcProductRepresentation::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcMaterialDefinitionRepresentation (IfcEntityInstanceData* e);
@@ -14954,7 +14626,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 6: return Type::IfcPressureMeasure; case 7: return Type::IfcPositiveLengthMeasure; case 8: return Type::IfcText; case 9: return Type::IfcText; case 10: return Type::IfcNormalisedRatioMeasure; case 11: return Type::IfcText; } return IfcMechanicalMaterialProperties::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 6: return "CompressiveStrength"; case 7: return "MaxAggregateSize"; case 8: return "AdmixturesDescription"; case 9: return "Workability"; case 10: return "ProtectivePoreRatio"; case 11: return "WaterImpermeability"; } return IfcMechanicalMaterialProperties::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcMechanicalConcreteMaterialProperties (IfcEntityInstanceData* e);
@@ -15022,7 +14693,6 @@ public:
     IfcTemplatedEntityList< IfcRelDecomposes >::ptr IsDecomposedBy() const; // INVERSE IfcRelDecomposes::RelatingObject
     IfcTemplatedEntityList< IfcRelDecomposes >::ptr Decomposes() const; // INVERSE IfcRelDecomposes::RelatedObjects
     IfcTemplatedEntityList< IfcRelAssociates >::ptr HasAssociations() const; // INVERSE IfcRelAssociates::RelatedObjects
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcObjectDefinition (IfcEntityInstanceData* e);
@@ -15046,7 +14716,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcVector; } return IfcGeometricRepresentationItem::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "RepeatFactor"; } return IfcGeometricRepresentationItem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcOneDirectionRepeatFactor (IfcEntityInstanceData* e);
@@ -15119,7 +14788,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcConnectedFaceSet::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcConnectedFaceSet::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcOpenShell (IfcEntityInstanceData* e);
@@ -15146,7 +14814,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 2: return Type::IfcEdge; case 3: return Type::UNDEFINED; } return IfcEdge::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 2: return "EdgeElement"; case 3: return "Orientation"; } return IfcEdge::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcOrientedEdge (IfcEntityInstanceData* e);
@@ -15205,7 +14872,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 2: return Type::IfcAxis2Placement2D; } return IfcProfileDef::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 2: return "Position"; } return IfcProfileDef::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcParameterizedProfileDef (IfcEntityInstanceData* e);
@@ -15236,7 +14902,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcOrientedEdge; } return IfcTopologicalRepresentationItem::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "EdgeList"; } return IfcTopologicalRepresentationItem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPath (IfcEntityInstanceData* e);
@@ -15275,7 +14940,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 2: return Type::IfcPhysicalQuantity; case 3: return Type::IfcLabel; case 4: return Type::IfcLabel; case 5: return Type::IfcLabel; } return IfcPhysicalQuantity::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 2: return "HasQuantities"; case 3: return "Discrimination"; case 4: return "Quality"; case 5: return "Usage"; } return IfcPhysicalQuantity::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPhysicalComplexQuantity (IfcEntityInstanceData* e);
@@ -15321,7 +14985,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 4: return Type::IfcInteger; case 5: return Type::IfcInteger; case 6: return Type::IfcInteger; case 7: return Type::UNDEFINED; } return IfcSurfaceTexture::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 4: return "Width"; case 5: return "Height"; case 6: return "ColourComponents"; case 7: return "Pixel"; } return IfcSurfaceTexture::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPixelTexture (IfcEntityInstanceData* e);
@@ -15347,7 +15010,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcCartesianPoint; } return IfcGeometricRepresentationItem::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Location"; } return IfcGeometricRepresentationItem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPlacement (IfcEntityInstanceData* e);
@@ -15372,7 +15034,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcLengthMeasure; case 1: return Type::IfcLengthMeasure; } return IfcGeometricRepresentationItem::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "SizeInX"; case 1: return "SizeInY"; } return IfcGeometricRepresentationItem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPlanarExtent (IfcEntityInstanceData* e);
@@ -15391,7 +15052,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcGeometricRepresentationItem::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcGeometricRepresentationItem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPoint (IfcEntityInstanceData* e);
@@ -15420,7 +15080,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcCurve; case 1: return Type::IfcParameterValue; } return IfcPoint::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "BasisCurve"; case 1: return "PointParameter"; } return IfcPoint::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPointOnCurve (IfcEntityInstanceData* e);
@@ -15452,7 +15111,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcSurface; case 1: return Type::IfcParameterValue; case 2: return Type::IfcParameterValue; } return IfcPoint::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "BasisSurface"; case 1: return "PointParameterU"; case 2: return "PointParameterV"; } return IfcPoint::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPointOnSurface (IfcEntityInstanceData* e);
@@ -15508,7 +15166,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcCartesianPoint; } return IfcLoop::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Polygon"; } return IfcLoop::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPolyLoop (IfcEntityInstanceData* e);
@@ -15586,7 +15243,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 2: return Type::IfcAxis2Placement3D; case 3: return Type::IfcBoundedCurve; } return IfcHalfSpaceSolid::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 2: return "Position"; case 3: return "PolygonalBoundary"; } return IfcHalfSpaceSolid::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPolygonalBoundedHalfSpace (IfcEntityInstanceData* e);
@@ -15605,7 +15261,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcPreDefinedItem::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcPreDefinedItem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPreDefinedColour (IfcEntityInstanceData* e);
@@ -15626,7 +15281,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcPreDefinedItem::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcPreDefinedItem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPreDefinedCurveFont (IfcEntityInstanceData* e);
@@ -15641,7 +15295,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcPreDefinedSymbol::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcPreDefinedSymbol::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPreDefinedDimensionSymbol (IfcEntityInstanceData* e);
@@ -15656,7 +15309,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcPreDefinedSymbol::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcPreDefinedSymbol::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPreDefinedPointMarkerSymbol (IfcEntityInstanceData* e);
@@ -15684,7 +15336,6 @@ public:
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcProduct >::ptr ShapeOfProduct() const; // INVERSE IfcProduct::Representation
     IfcTemplatedEntityList< IfcShapeAspect >::ptr HasShapeAspects() const; // INVERSE IfcShapeAspect::PartOfProductDefinitionShape
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcProductDefinitionShape (IfcEntityInstanceData* e);
@@ -15817,7 +15468,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 2: return Type::IfcValue; case 3: return Type::IfcValue; case 4: return Type::IfcUnit; } return IfcSimpleProperty::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 2: return "UpperBoundValue"; case 3: return "LowerBoundValue"; case 4: return "Unit"; } return IfcSimpleProperty::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPropertyBoundedValue (IfcEntityInstanceData* e);
@@ -15882,7 +15532,6 @@ public:
     virtual const char* getArgumentName(unsigned int i) const { return IfcRoot::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcRelAssociates >::ptr HasAssociations() const; // INVERSE IfcRelAssociates::RelatedObjects
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPropertyDefinition (IfcEntityInstanceData* e);
@@ -15983,7 +15632,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 2: return Type::IfcValue; case 3: return Type::IfcPropertyEnumeration; } return IfcSimpleProperty::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 2: return "EnumerationValues"; case 3: return "EnumerationReference"; } return IfcSimpleProperty::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPropertyEnumeratedValue (IfcEntityInstanceData* e);
@@ -16072,7 +15720,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 2: return Type::IfcValue; case 3: return Type::IfcUnit; } return IfcSimpleProperty::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 2: return "ListValues"; case 3: return "Unit"; } return IfcSimpleProperty::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPropertyListValue (IfcEntityInstanceData* e);
@@ -16111,7 +15758,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 2: return Type::IfcLabel; case 3: return Type::IfcObjectReferenceSelect; } return IfcSimpleProperty::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 2: return "UsageName"; case 3: return "PropertyReference"; } return IfcSimpleProperty::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPropertyReferenceValue (IfcEntityInstanceData* e);
@@ -16169,7 +15815,6 @@ public:
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcRelDefinesByProperties >::ptr PropertyDefinitionOf() const; // INVERSE IfcRelDefinesByProperties::RelatingPropertyDefinition
     IfcTemplatedEntityList< IfcTypeObject >::ptr DefinesType() const; // INVERSE IfcTypeObject::HasPropertySets
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPropertySetDefinition (IfcEntityInstanceData* e);
@@ -16241,7 +15886,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 2: return Type::IfcValue; case 3: return Type::IfcUnit; } return IfcSimpleProperty::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 2: return "NominalValue"; case 3: return "Unit"; } return IfcSimpleProperty::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPropertySingleValue (IfcEntityInstanceData* e);
@@ -16426,7 +16070,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 2: return Type::IfcValue; case 3: return Type::IfcValue; case 4: return Type::IfcText; case 5: return Type::IfcUnit; case 6: return Type::IfcUnit; } return IfcSimpleProperty::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 2: return "DefiningValues"; case 3: return "DefinedValues"; case 4: return "Expression"; case 5: return "DefiningUnit"; case 6: return "DefinedUnit"; } return IfcSimpleProperty::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPropertyTableValue (IfcEntityInstanceData* e);
@@ -16480,7 +16123,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 3: return Type::IfcPositiveLengthMeasure; case 4: return Type::IfcPositiveLengthMeasure; } return IfcParameterizedProfileDef::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 3: return "XDim"; case 4: return "YDim"; } return IfcParameterizedProfileDef::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRectangleProfileDef (IfcEntityInstanceData* e);
@@ -16505,7 +16147,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcTimeMeasure; case 9: return Type::IfcTimeSeriesValue; } return IfcTimeSeries::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "TimeStep"; case 9: return "Values"; } return IfcTimeSeries::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRegularTimeSeries (IfcEntityInstanceData* e);
@@ -16553,7 +16194,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 4: return Type::IfcLabel; case 5: return Type::IfcSectionReinforcementProperties; } return IfcPropertySetDefinition::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 4: return "DefinitionType"; case 5: return "ReinforcementSectionDefinitions"; } return IfcPropertySetDefinition::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcReinforcementDefinitionProperties (IfcEntityInstanceData* e);
@@ -16575,7 +16215,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcRoot::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcRoot::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRelationship (IfcEntityInstanceData* e);
@@ -16629,7 +16268,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 5: return Type::IfcPositiveLengthMeasure; } return IfcRectangleProfileDef::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 5: return "RoundingRadius"; } return IfcRectangleProfileDef::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRoundedRectangleProfileDef (IfcEntityInstanceData* e);
@@ -16705,7 +16343,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcCompositeCurve; case 1: return Type::IfcProfileDef; case 2: return Type::IfcAxis2Placement3D; } return IfcGeometricRepresentationItem::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "SpineCurve"; case 1: return "CrossSections"; case 2: return "CrossSectionPositions"; } return IfcGeometricRepresentationItem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcSectionedSpine (IfcEntityInstanceData* e);
@@ -16732,7 +16369,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 4: return Type::IfcServiceLifeFactorTypeEnum; case 5: return Type::IfcMeasureValue; case 6: return Type::IfcMeasureValue; case 7: return Type::IfcMeasureValue; } return IfcPropertySetDefinition::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 4: return "PredefinedType"; case 5: return "UpperValue"; case 6: return "MostUsedValue"; case 7: return "LowerValue"; } return IfcPropertySetDefinition::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcServiceLifeFactor (IfcEntityInstanceData* e);
@@ -16760,7 +16396,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcShell; } return IfcGeometricRepresentationItem::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "SbsmBoundary"; } return IfcGeometricRepresentationItem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcShellBasedSurfaceModel (IfcEntityInstanceData* e);
@@ -16798,7 +16433,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 1: return Type::IfcLengthMeasure; case 2: return Type::IfcLengthMeasure; case 3: return Type::IfcLengthMeasure; } return IfcStructuralConnectionCondition::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 1: return "SlippageX"; case 2: return "SlippageY"; case 3: return "SlippageZ"; } return IfcStructuralConnectionCondition::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcSlippageConnectionCondition (IfcEntityInstanceData* e);
@@ -16817,7 +16451,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcGeometricRepresentationItem::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcGeometricRepresentationItem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcSolidModel (IfcEntityInstanceData* e);
@@ -16840,7 +16473,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 4: return Type::IfcBoolean; case 5: return Type::IfcSoundScaleEnum; case 6: return Type::IfcSoundValue; } return IfcPropertySetDefinition::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 4: return "IsAttenuating"; case 5: return "SoundScale"; case 6: return "SoundValues"; } return IfcPropertySetDefinition::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcSoundProperties (IfcEntityInstanceData* e);
@@ -16865,7 +16497,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 4: return Type::IfcTimeSeries; case 5: return Type::IfcFrequencyMeasure; case 6: return Type::IfcDerivedMeasureValue; } return IfcPropertySetDefinition::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 4: return "SoundLevelTimeSeries"; case 5: return "Frequency"; case 6: return "SoundLevelSingleValue"; } return IfcPropertySetDefinition::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcSoundValue (IfcEntityInstanceData* e);
@@ -16912,7 +16543,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 4: return Type::IfcPositiveRatioMeasure; case 5: return Type::IfcThermalLoadSourceEnum; case 6: return Type::IfcPropertySourceEnum; case 7: return Type::IfcText; case 8: return Type::IfcPowerMeasure; case 9: return Type::IfcPowerMeasure; case 10: return Type::IfcTimeSeries; case 11: return Type::IfcLabel; case 12: return Type::IfcLabel; case 13: return Type::IfcThermalLoadTypeEnum; } return IfcPropertySetDefinition::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 4: return "ApplicableValueRatio"; case 5: return "ThermalLoadSource"; case 6: return "PropertySource"; case 7: return "SourceDescription"; case 8: return "MaximumValue"; case 9: return "MinimumValue"; case 10: return "ThermalLoadTimeSeriesValues"; case 11: return "UserDefinedThermalLoadSource"; case 12: return "UserDefinedPropertySource"; case 13: return "ThermalLoadType"; } return IfcPropertySetDefinition::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcSpaceThermalLoadProperties (IfcEntityInstanceData* e);
@@ -16961,7 +16591,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 1: return Type::IfcLinearForceMeasure; case 2: return Type::IfcLinearForceMeasure; case 3: return Type::IfcLinearForceMeasure; case 4: return Type::IfcLinearMomentMeasure; case 5: return Type::IfcLinearMomentMeasure; case 6: return Type::IfcLinearMomentMeasure; } return IfcStructuralLoadStatic::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 1: return "LinearForceX"; case 2: return "LinearForceY"; case 3: return "LinearForceZ"; case 4: return "LinearMomentX"; case 5: return "LinearMomentY"; case 6: return "LinearMomentZ"; } return IfcStructuralLoadStatic::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcStructuralLoadLinearForce (IfcEntityInstanceData* e);
@@ -16995,7 +16624,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 1: return Type::IfcPlanarForceMeasure; case 2: return Type::IfcPlanarForceMeasure; case 3: return Type::IfcPlanarForceMeasure; } return IfcStructuralLoadStatic::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 1: return "PlanarForceX"; case 2: return "PlanarForceY"; case 3: return "PlanarForceZ"; } return IfcStructuralLoadStatic::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcStructuralLoadPlanarForce (IfcEntityInstanceData* e);
@@ -17044,7 +16672,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 1: return Type::IfcLengthMeasure; case 2: return Type::IfcLengthMeasure; case 3: return Type::IfcLengthMeasure; case 4: return Type::IfcPlaneAngleMeasure; case 5: return Type::IfcPlaneAngleMeasure; case 6: return Type::IfcPlaneAngleMeasure; } return IfcStructuralLoadStatic::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 1: return "DisplacementX"; case 2: return "DisplacementY"; case 3: return "DisplacementZ"; case 4: return "RotationalDisplacementRX"; case 5: return "RotationalDisplacementRY"; case 6: return "RotationalDisplacementRZ"; } return IfcStructuralLoadStatic::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcStructuralLoadSingleDisplacement (IfcEntityInstanceData* e);
@@ -17066,7 +16693,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 7: return Type::IfcCurvatureMeasure; } return IfcStructuralLoadSingleDisplacement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 7: return "Distortion"; } return IfcStructuralLoadSingleDisplacement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcStructuralLoadSingleDisplacementDistortion (IfcEntityInstanceData* e);
@@ -17116,7 +16742,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 1: return Type::IfcForceMeasure; case 2: return Type::IfcForceMeasure; case 3: return Type::IfcForceMeasure; case 4: return Type::IfcTorqueMeasure; case 5: return Type::IfcTorqueMeasure; case 6: return Type::IfcTorqueMeasure; } return IfcStructuralLoadStatic::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 1: return "ForceX"; case 2: return "ForceY"; case 3: return "ForceZ"; case 4: return "MomentX"; case 5: return "MomentY"; case 6: return "MomentZ"; } return IfcStructuralLoadStatic::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcStructuralLoadSingleForce (IfcEntityInstanceData* e);
@@ -17143,7 +16768,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 7: return Type::IfcWarpingMomentMeasure; } return IfcStructuralLoadSingleForce::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 7: return "WarpingMoment"; } return IfcStructuralLoadSingleForce::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcStructuralLoadSingleForceWarping (IfcEntityInstanceData* e);
@@ -17222,7 +16846,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 7: return Type::IfcMomentOfInertiaMeasure; case 8: return Type::IfcMomentOfInertiaMeasure; case 9: return Type::IfcMomentOfInertiaMeasure; case 10: return Type::IfcMomentOfInertiaMeasure; case 11: return Type::IfcWarpingConstantMeasure; case 12: return Type::IfcLengthMeasure; case 13: return Type::IfcLengthMeasure; case 14: return Type::IfcAreaMeasure; case 15: return Type::IfcAreaMeasure; case 16: return Type::IfcSectionModulusMeasure; case 17: return Type::IfcSectionModulusMeasure; case 18: return Type::IfcSectionModulusMeasure; case 19: return Type::IfcSectionModulusMeasure; case 20: return Type::IfcSectionModulusMeasure; case 21: return Type::IfcLengthMeasure; case 22: return Type::IfcLengthMeasure; } return IfcGeneralProfileProperties::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 7: return "TorsionalConstantX"; case 8: return "MomentOfInertiaYZ"; case 9: return "MomentOfInertiaY"; case 10: return "MomentOfInertiaZ"; case 11: return "WarpingConstant"; case 12: return "ShearCentreZ"; case 13: return "ShearCentreY"; case 14: return "ShearDeformationAreaZ"; case 15: return "ShearDeformationAreaY"; case 16: return "MaximumSectionModulusY"; case 17: return "MinimumSectionModulusY"; case 18: return "MaximumSectionModulusZ"; case 19: return "MinimumSectionModulusZ"; case 20: return "TorsionalSectionModulus"; case 21: return "CentreOfGravityInX"; case 22: return "CentreOfGravityInY"; } return IfcGeneralProfileProperties::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcStructuralProfileProperties (IfcEntityInstanceData* e);
@@ -17253,7 +16876,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 23: return Type::IfcAreaMeasure; case 24: return Type::IfcAreaMeasure; case 25: return Type::IfcPositiveRatioMeasure; case 26: return Type::IfcPositiveRatioMeasure; } return IfcStructuralProfileProperties::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 23: return "ShearAreaZ"; case 24: return "ShearAreaY"; case 25: return "PlasticShapeFactorY"; case 26: return "PlasticShapeFactorZ"; } return IfcStructuralProfileProperties::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcStructuralSteelProfileProperties (IfcEntityInstanceData* e);
@@ -17280,7 +16902,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 2: return Type::IfcEdge; } return IfcEdge::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 2: return "ParentEdge"; } return IfcEdge::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcSubedge (IfcEntityInstanceData* e);
@@ -17304,7 +16925,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcGeometricRepresentationItem::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcGeometricRepresentationItem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcSurface (IfcEntityInstanceData* e);
@@ -17412,7 +17032,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 1: return Type::IfcNormalisedRatioMeasure; case 2: return Type::IfcColourOrFactor; case 3: return Type::IfcColourOrFactor; case 4: return Type::IfcColourOrFactor; case 5: return Type::IfcColourOrFactor; case 6: return Type::IfcColourOrFactor; case 7: return Type::IfcSpecularHighlightSelect; case 8: return Type::IfcReflectanceMethodEnum; } return IfcSurfaceStyleShading::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 1: return "Transparency"; case 2: return "DiffuseColour"; case 3: return "TransmissionColour"; case 4: return "DiffuseTransmissionColour"; case 5: return "ReflectionColour"; case 6: return "SpecularColour"; case 7: return "SpecularHighlight"; case 8: return "ReflectanceMethod"; } return IfcSurfaceStyleShading::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcSurfaceStyleRendering (IfcEntityInstanceData* e);
@@ -17450,7 +17069,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcProfileDef; case 1: return Type::IfcAxis2Placement3D; } return IfcSolidModel::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "SweptArea"; case 1: return "Position"; } return IfcSolidModel::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcSweptAreaSolid (IfcEntityInstanceData* e);
@@ -17538,7 +17156,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcCurve; case 1: return Type::IfcPositiveLengthMeasure; case 2: return Type::IfcPositiveLengthMeasure; case 3: return Type::IfcParameterValue; case 4: return Type::IfcParameterValue; } return IfcSolidModel::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Directrix"; case 1: return "Radius"; case 2: return "InnerRadius"; case 3: return "StartParam"; case 4: return "EndParam"; } return IfcSolidModel::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcSweptDiskSolid (IfcEntityInstanceData* e);
@@ -17563,7 +17180,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcProfileDef; case 1: return Type::IfcAxis2Placement3D; } return IfcSurface::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "SweptCurve"; case 1: return "Position"; } return IfcSurface::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcSweptSurface (IfcEntityInstanceData* e);
@@ -17646,7 +17262,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 3: return Type::IfcPositiveLengthMeasure; case 4: return Type::IfcPositiveLengthMeasure; case 5: return Type::IfcPositiveLengthMeasure; case 6: return Type::IfcPositiveLengthMeasure; case 7: return Type::IfcPositiveLengthMeasure; case 8: return Type::IfcPositiveLengthMeasure; case 9: return Type::IfcPositiveLengthMeasure; case 10: return Type::IfcPlaneAngleMeasure; case 11: return Type::IfcPlaneAngleMeasure; case 12: return Type::IfcPositiveLengthMeasure; } return IfcParameterizedProfileDef::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 3: return "Depth"; case 4: return "FlangeWidth"; case 5: return "WebThickness"; case 6: return "FlangeThickness"; case 7: return "FilletRadius"; case 8: return "FlangeEdgeRadius"; case 9: return "WebEdgeRadius"; case 10: return "WebSlope"; case 11: return "FlangeSlope"; case 12: return "CentreOfGravityInY"; } return IfcParameterizedProfileDef::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcTShapeProfileDef (IfcEntityInstanceData* e);
@@ -17663,7 +17278,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 3: return Type::IfcAnnotationCurveOccurrence; } return IfcAnnotationSymbolOccurrence::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 3: return "AnnotatedCurve"; } return IfcAnnotationSymbolOccurrence::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcTerminatorSymbol (IfcEntityInstanceData* e);
@@ -17697,7 +17311,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcPresentableText; case 1: return Type::IfcAxis2Placement; case 2: return Type::IfcTextPath; } return IfcGeometricRepresentationItem::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Literal"; case 1: return "Placement"; case 2: return "Path"; } return IfcGeometricRepresentationItem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcTextLiteral (IfcEntityInstanceData* e);
@@ -17726,7 +17339,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 3: return Type::IfcPlanarExtent; case 4: return Type::IfcBoxAlignment; } return IfcTextLiteral::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 3: return "Extent"; case 4: return "BoxAlignment"; } return IfcTextLiteral::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcTextLiteralWithExtent (IfcEntityInstanceData* e);
@@ -17790,7 +17402,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 3: return Type::IfcPositiveLengthMeasure; case 4: return Type::IfcPositiveLengthMeasure; case 5: return Type::IfcPositiveLengthMeasure; case 6: return Type::IfcLengthMeasure; } return IfcParameterizedProfileDef::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 3: return "BottomXDim"; case 4: return "TopXDim"; case 5: return "YDim"; case 6: return "TopXOffset"; } return IfcParameterizedProfileDef::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcTrapeziumProfileDef (IfcEntityInstanceData* e);
@@ -17815,7 +17426,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 1: return Type::IfcVector; } return IfcOneDirectionRepeatFactor::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 1: return "SecondRepeatFactor"; } return IfcOneDirectionRepeatFactor::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcTwoDirectionRepeatFactor (IfcEntityInstanceData* e);
@@ -17879,7 +17489,6 @@ public:
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 4: return "ApplicableOccurrence"; case 5: return "HasPropertySets"; } return IfcObjectDefinition::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcRelDefinesByType >::ptr ObjectTypeOf() const; // INVERSE IfcRelDefinesByType::RelatingType
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcTypeObject (IfcEntityInstanceData* e);
@@ -17969,7 +17578,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 6: return Type::IfcRepresentationMap; case 7: return Type::IfcLabel; } return IfcTypeObject::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 6: return "RepresentationMaps"; case 7: return "Tag"; } return IfcTypeObject::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcTypeProduct (IfcEntityInstanceData* e);
@@ -18042,7 +17650,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 3: return Type::IfcPositiveLengthMeasure; case 4: return Type::IfcPositiveLengthMeasure; case 5: return Type::IfcPositiveLengthMeasure; case 6: return Type::IfcPositiveLengthMeasure; case 7: return Type::IfcPositiveLengthMeasure; case 8: return Type::IfcPositiveLengthMeasure; case 9: return Type::IfcPlaneAngleMeasure; case 10: return Type::IfcPositiveLengthMeasure; } return IfcParameterizedProfileDef::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 3: return "Depth"; case 4: return "FlangeWidth"; case 5: return "WebThickness"; case 6: return "FlangeThickness"; case 7: return "FilletRadius"; case 8: return "EdgeRadius"; case 9: return "FlangeSlope"; case 10: return "CentreOfGravityInX"; } return IfcParameterizedProfileDef::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcUShapeProfileDef (IfcEntityInstanceData* e);
@@ -18069,7 +17676,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcDirection; case 1: return Type::IfcLengthMeasure; } return IfcGeometricRepresentationItem::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Orientation"; case 1: return "Magnitude"; } return IfcGeometricRepresentationItem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcVector (IfcEntityInstanceData* e);
@@ -18098,7 +17704,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcVertex; } return IfcLoop::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "LoopVertex"; } return IfcLoop::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcVertexLoop (IfcEntityInstanceData* e);
@@ -18257,7 +17862,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 4: return Type::IfcPositiveLengthMeasure; case 5: return Type::IfcPositiveLengthMeasure; case 6: return Type::IfcPositiveLengthMeasure; case 7: return Type::IfcPositiveLengthMeasure; case 8: return Type::IfcNormalisedRatioMeasure; case 9: return Type::IfcNormalisedRatioMeasure; case 10: return Type::IfcNormalisedRatioMeasure; case 11: return Type::IfcNormalisedRatioMeasure; case 12: return Type::IfcShapeAspect; } return IfcPropertySetDefinition::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 4: return "LiningDepth"; case 5: return "LiningThickness"; case 6: return "TransomThickness"; case 7: return "MullionThickness"; case 8: return "FirstTransomOffset"; case 9: return "SecondTransomOffset"; case 10: return "FirstMullionOffset"; case 11: return "SecondMullionOffset"; case 12: return "ShapeAspectStyle"; } return IfcPropertySetDefinition::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcWindowLiningProperties (IfcEntityInstanceData* e);
@@ -18339,7 +17943,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 4: return Type::IfcWindowPanelOperationEnum; case 5: return Type::IfcWindowPanelPositionEnum; case 6: return Type::IfcPositiveLengthMeasure; case 7: return Type::IfcPositiveLengthMeasure; case 8: return Type::IfcShapeAspect; } return IfcPropertySetDefinition::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 4: return "OperationType"; case 5: return "PanelPosition"; case 6: return "FrameDepth"; case 7: return "FrameThickness"; case 8: return "ShapeAspectStyle"; } return IfcPropertySetDefinition::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcWindowPanelProperties (IfcEntityInstanceData* e);
@@ -18383,7 +17986,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcWindowStyleConstructionEnum; case 9: return Type::IfcWindowStyleOperationEnum; case 10: return Type::UNDEFINED; case 11: return Type::UNDEFINED; } return IfcTypeProduct::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "ConstructionType"; case 9: return "OperationType"; case 10: return "ParameterTakesPrecedence"; case 11: return "Sizeable"; } return IfcTypeProduct::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcWindowStyle (IfcEntityInstanceData* e);
@@ -18444,7 +18046,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 3: return Type::IfcPositiveLengthMeasure; case 4: return Type::IfcPositiveLengthMeasure; case 5: return Type::IfcPositiveLengthMeasure; case 6: return Type::IfcPositiveLengthMeasure; case 7: return Type::IfcPositiveLengthMeasure; case 8: return Type::IfcPositiveLengthMeasure; } return IfcParameterizedProfileDef::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 3: return "Depth"; case 4: return "FlangeWidth"; case 5: return "WebThickness"; case 6: return "FlangeThickness"; case 7: return "FilletRadius"; case 8: return "EdgeRadius"; } return IfcParameterizedProfileDef::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcZShapeProfileDef (IfcEntityInstanceData* e);
@@ -18459,7 +18060,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcAnnotationOccurrence::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcAnnotationOccurrence::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcAnnotationCurveOccurrence (IfcEntityInstanceData* e);
@@ -18505,7 +18105,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcCurve; case 1: return Type::IfcCurve; } return IfcGeometricRepresentationItem::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "OuterBoundary"; case 1: return "InnerBoundaries"; } return IfcGeometricRepresentationItem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcAnnotationFillArea (IfcEntityInstanceData* e);
@@ -18528,7 +18127,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 3: return Type::IfcPoint; case 4: return Type::IfcGlobalOrLocalEnum; } return IfcAnnotationOccurrence::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 3: return "FillStyleTarget"; case 4: return "GlobalOrLocal"; } return IfcAnnotationOccurrence::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcAnnotationFillAreaOccurrence (IfcEntityInstanceData* e);
@@ -18549,7 +18147,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcGeometricRepresentationItem; case 1: return Type::IfcTextureCoordinate; } return IfcGeometricRepresentationItem::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Item"; case 1: return "TextureCoordinates"; } return IfcGeometricRepresentationItem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcAnnotationSurface (IfcEntityInstanceData* e);
@@ -18577,7 +18174,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 1: return Type::IfcDirection; } return IfcPlacement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 1: return "Axis"; } return IfcPlacement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcAxis1Placement (IfcEntityInstanceData* e);
@@ -18607,7 +18203,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 1: return Type::IfcDirection; } return IfcPlacement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 1: return "RefDirection"; } return IfcPlacement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcAxis2Placement2D (IfcEntityInstanceData* e);
@@ -18644,7 +18239,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 1: return Type::IfcDirection; case 2: return Type::IfcDirection; } return IfcPlacement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 1: return "Axis"; case 2: return "RefDirection"; } return IfcPlacement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcAxis2Placement3D (IfcEntityInstanceData* e);
@@ -18693,7 +18287,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcBooleanOperator; case 1: return Type::IfcBooleanOperand; case 2: return Type::IfcBooleanOperand; } return IfcGeometricRepresentationItem::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Operator"; case 1: return "FirstOperand"; case 2: return "SecondOperand"; } return IfcGeometricRepresentationItem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcBooleanResult (IfcEntityInstanceData* e);
@@ -18719,7 +18312,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcSurface::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcSurface::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcBoundedSurface (IfcEntityInstanceData* e);
@@ -18767,7 +18359,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcCartesianPoint; case 1: return Type::IfcPositiveLengthMeasure; case 2: return Type::IfcPositiveLengthMeasure; case 3: return Type::IfcPositiveLengthMeasure; } return IfcGeometricRepresentationItem::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Corner"; case 1: return "XDim"; case 2: return "YDim"; case 3: return "ZDim"; } return IfcGeometricRepresentationItem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcBoundingBox (IfcEntityInstanceData* e);
@@ -18814,7 +18405,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 2: return Type::IfcBoundingBox; } return IfcHalfSpaceSolid::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 2: return "Enclosure"; } return IfcHalfSpaceSolid::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcBoxedHalfSpace (IfcEntityInstanceData* e);
@@ -18871,7 +18461,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 3: return Type::IfcPositiveLengthMeasure; case 4: return Type::IfcPositiveLengthMeasure; case 5: return Type::IfcPositiveLengthMeasure; case 6: return Type::IfcPositiveLengthMeasure; case 7: return Type::IfcPositiveLengthMeasure; case 8: return Type::IfcPositiveLengthMeasure; } return IfcParameterizedProfileDef::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 3: return "Depth"; case 4: return "Width"; case 5: return "WallThickness"; case 6: return "Girth"; case 7: return "InternalFilletRadius"; case 8: return "CentreOfGravityInX"; } return IfcParameterizedProfileDef::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcCShapeProfileDef (IfcEntityInstanceData* e);
@@ -18895,7 +18484,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcLengthMeasure; } return IfcPoint::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Coordinates"; } return IfcPoint::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcCartesianPoint (IfcEntityInstanceData* e);
@@ -18957,7 +18545,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcDirection; case 1: return Type::IfcDirection; case 2: return Type::IfcCartesianPoint; case 3: return Type::UNDEFINED; } return IfcGeometricRepresentationItem::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Axis1"; case 1: return "Axis2"; case 2: return "LocalOrigin"; case 3: return "Scale"; } return IfcGeometricRepresentationItem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcCartesianTransformationOperator (IfcEntityInstanceData* e);
@@ -18976,7 +18563,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcCartesianTransformationOperator::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcCartesianTransformationOperator::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcCartesianTransformationOperator2D (IfcEntityInstanceData* e);
@@ -19005,7 +18591,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 4: return Type::UNDEFINED; } return IfcCartesianTransformationOperator2D::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 4: return "Scale2"; } return IfcCartesianTransformationOperator2D::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcCartesianTransformationOperator2DnonUniform (IfcEntityInstanceData* e);
@@ -19029,7 +18614,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 4: return Type::IfcDirection; } return IfcCartesianTransformationOperator::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 4: return "Axis3"; } return IfcCartesianTransformationOperator::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcCartesianTransformationOperator3D (IfcEntityInstanceData* e);
@@ -19064,7 +18648,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 5: return Type::UNDEFINED; case 6: return Type::UNDEFINED; } return IfcCartesianTransformationOperator3D::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 5: return "Scale2"; case 6: return "Scale3"; } return IfcCartesianTransformationOperator3D::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcCartesianTransformationOperator3DnonUniform (IfcEntityInstanceData* e);
@@ -19093,7 +18676,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 3: return Type::IfcPositiveLengthMeasure; } return IfcParameterizedProfileDef::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 3: return "Radius"; } return IfcParameterizedProfileDef::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcCircleProfileDef (IfcEntityInstanceData* e);
@@ -19156,7 +18738,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcConnectedFaceSet::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcConnectedFaceSet::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcClosedShell (IfcEntityInstanceData* e);
@@ -19189,7 +18770,6 @@ public:
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Transition"; case 1: return "SameSense"; case 2: return "ParentCurve"; } return IfcGeometricRepresentationItem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcCompositeCurve >::ptr UsingCurves() const; // INVERSE IfcCompositeCurve::Segments
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcCompositeCurveSegment (IfcEntityInstanceData* e);
@@ -19232,7 +18812,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 3: return Type::IfcPositiveLengthMeasure; case 4: return Type::IfcPositiveLengthMeasure; case 5: return Type::IfcPositiveLengthMeasure; case 6: return Type::IfcPositiveLengthMeasure; case 7: return Type::IfcPositiveLengthMeasure; case 8: return Type::IfcPositiveLengthMeasure; case 9: return Type::IfcPositiveLengthMeasure; case 10: return Type::IfcPositiveLengthMeasure; case 11: return Type::IfcPositiveLengthMeasure; case 12: return Type::IfcPositiveLengthMeasure; case 13: return Type::IfcPositiveLengthMeasure; case 14: return Type::IfcPositiveLengthMeasure; } return IfcParameterizedProfileDef::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 3: return "OverallHeight"; case 4: return "BaseWidth2"; case 5: return "Radius"; case 6: return "HeadWidth"; case 7: return "HeadDepth2"; case 8: return "HeadDepth3"; case 9: return "WebThickness"; case 10: return "BaseWidth4"; case 11: return "BaseDepth1"; case 12: return "BaseDepth2"; case 13: return "BaseDepth3"; case 14: return "CentreOfGravityInY"; } return IfcParameterizedProfileDef::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcCraneRailAShapeProfileDef (IfcEntityInstanceData* e);
@@ -19269,7 +18848,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 3: return Type::IfcPositiveLengthMeasure; case 4: return Type::IfcPositiveLengthMeasure; case 5: return Type::IfcPositiveLengthMeasure; case 6: return Type::IfcPositiveLengthMeasure; case 7: return Type::IfcPositiveLengthMeasure; case 8: return Type::IfcPositiveLengthMeasure; case 9: return Type::IfcPositiveLengthMeasure; case 10: return Type::IfcPositiveLengthMeasure; case 11: return Type::IfcPositiveLengthMeasure; } return IfcParameterizedProfileDef::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 3: return "OverallHeight"; case 4: return "HeadWidth"; case 5: return "Radius"; case 6: return "HeadDepth2"; case 7: return "HeadDepth3"; case 8: return "WebThickness"; case 9: return "BaseDepth1"; case 10: return "BaseDepth2"; case 11: return "CentreOfGravityInY"; } return IfcParameterizedProfileDef::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcCraneRailFShapeProfileDef (IfcEntityInstanceData* e);
@@ -19291,7 +18869,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcAxis2Placement3D; } return IfcGeometricRepresentationItem::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Position"; } return IfcGeometricRepresentationItem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcCsgPrimitive3D (IfcEntityInstanceData* e);
@@ -19349,7 +18926,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcCsgSelect; } return IfcSolidModel::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "TreeRootExpression"; } return IfcSolidModel::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcCsgSolid (IfcEntityInstanceData* e);
@@ -19373,7 +18949,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcGeometricRepresentationItem::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcGeometricRepresentationItem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcCurve (IfcEntityInstanceData* e);
@@ -19409,7 +18984,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcPlane; case 1: return Type::IfcCurve; case 2: return Type::IfcCurve; } return IfcBoundedSurface::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "BasisSurface"; case 1: return "OuterBoundary"; case 2: return "InnerBoundaries"; } return IfcBoundedSurface::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcCurveBoundedPlane (IfcEntityInstanceData* e);
@@ -19436,7 +19010,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcDefinedSymbolSelect; case 1: return Type::IfcCartesianTransformationOperator2D; } return IfcGeometricRepresentationItem::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Definition"; case 1: return "Target"; } return IfcGeometricRepresentationItem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcDefinedSymbol (IfcEntityInstanceData* e);
@@ -19452,7 +19025,6 @@ public:
     virtual const char* getArgumentName(unsigned int i) const { return IfcAnnotationCurveOccurrence::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcTerminatorSymbol >::ptr AnnotatedBySymbols() const; // INVERSE IfcTerminatorSymbol::AnnotatedCurve
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcDimensionCurve (IfcEntityInstanceData* e);
@@ -19469,7 +19041,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 4: return Type::IfcDimensionExtentUsage; } return IfcTerminatorSymbol::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 4: return "Role"; } return IfcTerminatorSymbol::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcDimensionCurveTerminator (IfcEntityInstanceData* e);
@@ -19493,7 +19064,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::UNDEFINED; } return IfcGeometricRepresentationItem::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "DirectionRatios"; } return IfcGeometricRepresentationItem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcDirection (IfcEntityInstanceData* e);
@@ -19659,7 +19229,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 4: return Type::IfcPositiveLengthMeasure; case 5: return Type::IfcPositiveLengthMeasure; case 6: return Type::IfcPositiveLengthMeasure; case 7: return Type::IfcPositiveLengthMeasure; case 8: return Type::IfcPositiveLengthMeasure; case 9: return Type::IfcLengthMeasure; case 10: return Type::IfcLengthMeasure; case 11: return Type::IfcLengthMeasure; case 12: return Type::IfcPositiveLengthMeasure; case 13: return Type::IfcPositiveLengthMeasure; case 14: return Type::IfcShapeAspect; } return IfcPropertySetDefinition::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 4: return "LiningDepth"; case 5: return "LiningThickness"; case 6: return "ThresholdDepth"; case 7: return "ThresholdThickness"; case 8: return "TransomThickness"; case 9: return "TransomOffset"; case 10: return "LiningOffset"; case 11: return "ThresholdOffset"; case 12: return "CasingThickness"; case 13: return "CasingDepth"; case 14: return "ShapeAspectStyle"; } return IfcPropertySetDefinition::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcDoorLiningProperties (IfcEntityInstanceData* e);
@@ -19741,7 +19310,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 4: return Type::IfcPositiveLengthMeasure; case 5: return Type::IfcDoorPanelOperationEnum; case 6: return Type::IfcNormalisedRatioMeasure; case 7: return Type::IfcDoorPanelPositionEnum; case 8: return Type::IfcShapeAspect; } return IfcPropertySetDefinition::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 4: return "PanelDepth"; case 5: return "PanelOperation"; case 6: return "PanelWidth"; case 7: return "PanelPosition"; case 8: return "ShapeAspectStyle"; } return IfcPropertySetDefinition::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcDoorPanelProperties (IfcEntityInstanceData* e);
@@ -19793,7 +19361,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcDoorStyleOperationEnum; case 9: return Type::IfcDoorStyleConstructionEnum; case 10: return Type::UNDEFINED; case 11: return Type::UNDEFINED; } return IfcTypeProduct::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "OperationType"; case 9: return "ConstructionType"; case 10: return "ParameterTakesPrecedence"; case 11: return "Sizeable"; } return IfcTypeProduct::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcDoorStyle (IfcEntityInstanceData* e);
@@ -19812,7 +19379,6 @@ public:
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcDraughtingCalloutRelationship >::ptr IsRelatedFromCallout() const; // INVERSE IfcDraughtingCalloutRelationship::RelatedDraughtingCallout
     IfcTemplatedEntityList< IfcDraughtingCalloutRelationship >::ptr IsRelatedToCallout() const; // INVERSE IfcDraughtingCalloutRelationship::RelatingDraughtingCallout
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcDraughtingCallout (IfcEntityInstanceData* e);
@@ -19898,7 +19464,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcPreDefinedColour::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcPreDefinedColour::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcDraughtingPreDefinedColour (IfcEntityInstanceData* e);
@@ -19925,7 +19490,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcPreDefinedCurveFont::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcPreDefinedCurveFont::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcDraughtingPreDefinedCurveFont (IfcEntityInstanceData* e);
@@ -19953,7 +19517,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcOrientedEdge; } return IfcLoop::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "EdgeList"; } return IfcLoop::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcEdgeLoop (IfcEntityInstanceData* e);
@@ -20054,7 +19617,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 4: return Type::IfcLabel; case 5: return Type::IfcPhysicalQuantity; } return IfcPropertySetDefinition::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 4: return "MethodOfMeasurement"; case 5: return "Quantities"; } return IfcPropertySetDefinition::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcElementQuantity (IfcEntityInstanceData* e);
@@ -20095,7 +19657,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcLabel; } return IfcTypeProduct::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "ElementType"; } return IfcTypeProduct::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcElementType (IfcEntityInstanceData* e);
@@ -20117,7 +19678,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcAxis2Placement3D; } return IfcSurface::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Position"; } return IfcSurface::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcElementarySurface (IfcEntityInstanceData* e);
@@ -20153,7 +19713,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 3: return Type::IfcPositiveLengthMeasure; case 4: return Type::IfcPositiveLengthMeasure; } return IfcParameterizedProfileDef::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 3: return "SemiAxis1"; case 4: return "SemiAxis2"; } return IfcParameterizedProfileDef::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcEllipseProfileDef (IfcEntityInstanceData* e);
@@ -20176,7 +19735,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 4: return Type::IfcEnergySequenceEnum; case 5: return Type::IfcLabel; } return IfcPropertySetDefinition::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 4: return "EnergySequence"; case 5: return "UserDefinedEnergySequence"; } return IfcPropertySetDefinition::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcEnergyProperties (IfcEntityInstanceData* e);
@@ -20265,7 +19823,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 2: return Type::IfcDirection; case 3: return Type::IfcPositiveLengthMeasure; } return IfcSweptAreaSolid::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 2: return "ExtrudedDirection"; case 3: return "Depth"; } return IfcSweptAreaSolid::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcExtrudedAreaSolid (IfcEntityInstanceData* e);
@@ -20294,7 +19851,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcConnectedFaceSet; } return IfcGeometricRepresentationItem::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "FbsmFaces"; } return IfcGeometricRepresentationItem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcFaceBasedSurfaceModel (IfcEntityInstanceData* e);
@@ -20382,7 +19938,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcCurveStyle; case 1: return Type::IfcHatchLineDistanceSelect; case 2: return Type::IfcCartesianPoint; case 3: return Type::IfcCartesianPoint; case 4: return Type::IfcPlaneAngleMeasure; } return IfcGeometricRepresentationItem::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "HatchLineAppearance"; case 1: return "StartOfNextHatchLine"; case 2: return "PointOfReferenceHatchLine"; case 3: return "PatternStart"; case 4: return "HatchLineAngle"; } return IfcGeometricRepresentationItem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcFillAreaStyleHatching (IfcEntityInstanceData* e);
@@ -20410,7 +19965,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcAnnotationSymbolOccurrence; } return IfcGeometricRepresentationItem::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Symbol"; } return IfcGeometricRepresentationItem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcFillAreaStyleTileSymbolWithStyle (IfcEntityInstanceData* e);
@@ -20438,7 +19992,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcOneDirectionRepeatFactor; case 1: return Type::IfcFillAreaStyleTileShapeSelect; case 2: return Type::IfcPositiveRatioMeasure; } return IfcGeometricRepresentationItem::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "TilingPattern"; case 1: return "Tiles"; case 2: return "TilingScale"; } return IfcGeometricRepresentationItem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcFillAreaStyleTiles (IfcEntityInstanceData* e);
@@ -20509,7 +20062,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 4: return Type::IfcPropertySourceEnum; case 5: return Type::IfcTimeSeries; case 6: return Type::IfcTimeSeries; case 7: return Type::IfcTimeSeries; case 8: return Type::IfcMaterial; case 9: return Type::IfcTimeSeries; case 10: return Type::IfcLabel; case 11: return Type::IfcThermodynamicTemperatureMeasure; case 12: return Type::IfcThermodynamicTemperatureMeasure; case 13: return Type::IfcTimeSeries; case 14: return Type::IfcTimeSeries; case 15: return Type::IfcDerivedMeasureValue; case 16: return Type::IfcPositiveRatioMeasure; case 17: return Type::IfcLinearVelocityMeasure; case 18: return Type::IfcPressureMeasure; } return IfcPropertySetDefinition::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 4: return "PropertySource"; case 5: return "FlowConditionTimeSeries"; case 6: return "VelocityTimeSeries"; case 7: return "FlowrateTimeSeries"; case 8: return "Fluid"; case 9: return "PressureTimeSeries"; case 10: return "UserDefinedPropertySource"; case 11: return "TemperatureSingleValue"; case 12: return "WetBulbTemperatureSingleValue"; case 13: return "WetBulbTemperatureTimeSeries"; case 14: return "TemperatureTimeSeries"; case 15: return "FlowrateSingleValue"; case 16: return "FlowConditionSingleValue"; case 17: return "VelocitySingleValue"; case 18: return "PressureSingleValue"; } return IfcPropertySetDefinition::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcFluidFlowProperties (IfcEntityInstanceData* e);
@@ -20551,7 +20103,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcElementType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcElementType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcFurnishingElementType (IfcEntityInstanceData* e);
@@ -20605,7 +20156,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcAssemblyPlaceEnum; } return IfcFurnishingElementType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "AssemblyPlace"; } return IfcFurnishingElementType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcFurnitureType (IfcEntityInstanceData* e);
@@ -20626,7 +20176,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcGeometricSet::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcGeometricSet::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcGeometricCurveSet (IfcEntityInstanceData* e);
@@ -20720,7 +20269,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 3: return Type::IfcPositiveLengthMeasure; case 4: return Type::IfcPositiveLengthMeasure; case 5: return Type::IfcPositiveLengthMeasure; case 6: return Type::IfcPositiveLengthMeasure; case 7: return Type::IfcPositiveLengthMeasure; } return IfcParameterizedProfileDef::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 3: return "OverallWidth"; case 4: return "OverallDepth"; case 5: return "WebThickness"; case 6: return "FlangeThickness"; case 7: return "FilletRadius"; } return IfcParameterizedProfileDef::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcIShapeProfileDef (IfcEntityInstanceData* e);
@@ -20819,7 +20367,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 3: return Type::IfcPositiveLengthMeasure; case 4: return Type::IfcPositiveLengthMeasure; case 5: return Type::IfcPositiveLengthMeasure; case 6: return Type::IfcPositiveLengthMeasure; case 7: return Type::IfcPositiveLengthMeasure; case 8: return Type::IfcPlaneAngleMeasure; case 9: return Type::IfcPositiveLengthMeasure; case 10: return Type::IfcPositiveLengthMeasure; } return IfcParameterizedProfileDef::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 3: return "Depth"; case 4: return "Width"; case 5: return "Thickness"; case 6: return "FilletRadius"; case 7: return "EdgeRadius"; case 8: return "LegSlope"; case 9: return "CentreOfGravityInX"; case 10: return "CentreOfGravityInY"; } return IfcParameterizedProfileDef::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcLShapeProfileDef (IfcEntityInstanceData* e);
@@ -20852,7 +20399,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcCartesianPoint; case 1: return Type::IfcVector; } return IfcCurve::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Pnt"; case 1: return "Dir"; } return IfcCurve::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcLine (IfcEntityInstanceData* e);
@@ -20932,7 +20478,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcClosedShell; } return IfcSolidModel::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Outer"; } return IfcSolidModel::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcManifoldSolidBrep (IfcEntityInstanceData* e);
@@ -21034,7 +20579,6 @@ public:
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 4: return "ObjectType"; } return IfcObjectDefinition::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcRelDefines >::ptr IsDefinedBy() const; // INVERSE IfcRelDefines::RelatedObjects
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcObject (IfcEntityInstanceData* e);
@@ -21068,7 +20612,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcCurve; case 1: return Type::IfcLengthMeasure; case 2: return Type::UNDEFINED; } return IfcCurve::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "BasisCurve"; case 1: return "Distance"; case 2: return "SelfIntersect"; } return IfcCurve::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcOffsetCurve2D (IfcEntityInstanceData* e);
@@ -21109,7 +20652,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcCurve; case 1: return Type::IfcLengthMeasure; case 2: return Type::UNDEFINED; case 3: return Type::IfcDirection; } return IfcCurve::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "BasisCurve"; case 1: return "Distance"; case 2: return "SelfIntersect"; case 3: return "RefDirection"; } return IfcCurve::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcOffsetCurve3D (IfcEntityInstanceData* e);
@@ -21175,7 +20717,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 4: return Type::IfcPermeableCoveringOperationEnum; case 5: return Type::IfcWindowPanelPositionEnum; case 6: return Type::IfcPositiveLengthMeasure; case 7: return Type::IfcPositiveLengthMeasure; case 8: return Type::IfcShapeAspect; } return IfcPropertySetDefinition::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 4: return "OperationType"; case 5: return "PanelPosition"; case 6: return "FrameDepth"; case 7: return "FrameThickness"; case 8: return "ShapeAspectStyle"; } return IfcPropertySetDefinition::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPermeableCoveringProperties (IfcEntityInstanceData* e);
@@ -21199,7 +20740,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 2: return Type::IfcAxis2Placement; } return IfcPlanarExtent::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 2: return "Placement"; } return IfcPlanarExtent::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPlanarBox (IfcEntityInstanceData* e);
@@ -21249,7 +20789,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcElementarySurface::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcElementarySurface::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPlane (IfcEntityInstanceData* e);
@@ -21306,7 +20845,6 @@ public:
     IfcTemplatedEntityList< IfcRelAssignsToProcess >::ptr OperatesOn() const; // INVERSE IfcRelAssignsToProcess::RelatingProcess
     IfcTemplatedEntityList< IfcRelSequence >::ptr IsSuccessorFrom() const; // INVERSE IfcRelSequence::RelatedProcess
     IfcTemplatedEntityList< IfcRelSequence >::ptr IsPredecessorTo() const; // INVERSE IfcRelSequence::RelatingProcess
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcProcess (IfcEntityInstanceData* e);
@@ -21422,7 +20960,6 @@ public:
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 5: return "ObjectPlacement"; case 6: return "Representation"; } return IfcObject::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcRelAssignsToProduct >::ptr ReferencedBy() const; // INVERSE IfcRelAssignsToProduct::RelatingProduct
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcProduct (IfcEntityInstanceData* e);
@@ -21492,7 +21029,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 5: return Type::IfcLabel; case 6: return Type::IfcLabel; case 7: return Type::IfcRepresentationContext; case 8: return Type::IfcUnitAssignment; } return IfcObject::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 5: return "LongName"; case 6: return "Phase"; case 7: return "RepresentationContexts"; case 8: return "UnitsInContext"; } return IfcObject::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcProject (IfcEntityInstanceData* e);
@@ -21507,7 +21043,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcAnnotationCurveOccurrence::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcAnnotationCurveOccurrence::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcProjectionCurve (IfcEntityInstanceData* e);
@@ -21577,7 +21112,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 4: return Type::IfcProperty; } return IfcPropertySetDefinition::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 4: return "HasProperties"; } return IfcPropertySetDefinition::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPropertySet (IfcEntityInstanceData* e);
@@ -21615,7 +21149,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 7: return Type::IfcObjectTypeEnum; case 8: return Type::IfcLabel; } return IfcProduct::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 7: return "ProxyType"; case 8: return "Tag"; } return IfcProduct::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcProxy (IfcEntityInstanceData* e);
@@ -21662,7 +21195,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 5: return Type::IfcPositiveLengthMeasure; case 6: return Type::IfcPositiveLengthMeasure; case 7: return Type::IfcPositiveLengthMeasure; } return IfcRectangleProfileDef::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 5: return "WallThickness"; case 6: return "InnerFilletRadius"; case 7: return "OuterFilletRadius"; } return IfcRectangleProfileDef::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRectangleHollowProfileDef (IfcEntityInstanceData* e);
@@ -21773,7 +21305,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 1: return Type::IfcPositiveLengthMeasure; case 2: return Type::IfcPositiveLengthMeasure; case 3: return Type::IfcPositiveLengthMeasure; } return IfcCsgPrimitive3D::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 1: return "XLength"; case 2: return "YLength"; case 3: return "Height"; } return IfcCsgPrimitive3D::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRectangularPyramid (IfcEntityInstanceData* e);
@@ -21823,7 +21354,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcSurface; case 1: return Type::IfcParameterValue; case 2: return Type::IfcParameterValue; case 3: return Type::IfcParameterValue; case 4: return Type::IfcParameterValue; case 5: return Type::UNDEFINED; case 6: return Type::UNDEFINED; } return IfcBoundedSurface::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "BasisSurface"; case 1: return "U1"; case 2: return "V1"; case 3: return "U2"; case 4: return "V2"; case 5: return "Usense"; case 6: return "Vsense"; } return IfcBoundedSurface::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRectangularTrimmedSurface (IfcEntityInstanceData* e);
@@ -21857,7 +21387,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 4: return Type::IfcObjectDefinition; case 5: return Type::IfcObjectTypeEnum; } return IfcRelationship::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 4: return "RelatedObjects"; case 5: return "RelatedObjectsType"; } return IfcRelationship::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRelAssigns (IfcEntityInstanceData* e);
@@ -21888,7 +21417,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 6: return Type::IfcActor; case 7: return Type::IfcActorRole; } return IfcRelAssigns::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 6: return "RelatingActor"; case 7: return "ActingRole"; } return IfcRelAssigns::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRelAssignsToActor (IfcEntityInstanceData* e);
@@ -21910,7 +21438,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 6: return Type::IfcControl; } return IfcRelAssigns::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 6: return "RelatingControl"; } return IfcRelAssigns::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRelAssignsToControl (IfcEntityInstanceData* e);
@@ -21940,7 +21467,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 6: return Type::IfcGroup; } return IfcRelAssigns::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 6: return "RelatingGroup"; } return IfcRelAssigns::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRelAssignsToGroup (IfcEntityInstanceData* e);
@@ -21986,7 +21512,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 6: return Type::IfcProcess; case 7: return Type::IfcMeasureWithUnit; } return IfcRelAssigns::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 6: return "RelatingProcess"; case 7: return "QuantityInProcess"; } return IfcRelAssigns::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRelAssignsToProcess (IfcEntityInstanceData* e);
@@ -22013,7 +21538,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 6: return Type::IfcProduct; } return IfcRelAssigns::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 6: return "RelatingProduct"; } return IfcRelAssigns::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRelAssignsToProduct (IfcEntityInstanceData* e);
@@ -22028,7 +21552,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcRelAssignsToControl::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcRelAssignsToControl::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRelAssignsToProjectOrder (IfcEntityInstanceData* e);
@@ -22053,7 +21576,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 6: return Type::IfcResource; } return IfcRelAssigns::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 6: return "RelatingResource"; } return IfcRelAssigns::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRelAssignsToResource (IfcEntityInstanceData* e);
@@ -22113,7 +21635,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 4: return Type::IfcRoot; } return IfcRelationship::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 4: return "RelatedObjects"; } return IfcRelationship::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRelAssociates (IfcEntityInstanceData* e);
@@ -22130,7 +21651,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 5: return Type::IfcAppliedValue; } return IfcRelAssociates::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 5: return "RelatingAppliedValue"; } return IfcRelAssociates::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRelAssociatesAppliedValue (IfcEntityInstanceData* e);
@@ -22150,7 +21670,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 5: return Type::IfcApproval; } return IfcRelAssociates::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 5: return "RelatingApproval"; } return IfcRelAssociates::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRelAssociatesApproval (IfcEntityInstanceData* e);
@@ -22197,7 +21716,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 5: return Type::IfcClassificationNotationSelect; } return IfcRelAssociates::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 5: return "RelatingClassification"; } return IfcRelAssociates::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRelAssociatesClassification (IfcEntityInstanceData* e);
@@ -22220,7 +21738,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 5: return Type::IfcLabel; case 6: return Type::IfcConstraint; } return IfcRelAssociates::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 5: return "Intent"; case 6: return "RelatingConstraint"; } return IfcRelAssociates::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRelAssociatesConstraint (IfcEntityInstanceData* e);
@@ -22244,7 +21761,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 5: return Type::IfcDocumentSelect; } return IfcRelAssociates::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 5: return "RelatingDocument"; } return IfcRelAssociates::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRelAssociatesDocument (IfcEntityInstanceData* e);
@@ -22268,7 +21784,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 5: return Type::IfcLibrarySelect; } return IfcRelAssociates::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 5: return "RelatingLibrary"; } return IfcRelAssociates::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRelAssociatesLibrary (IfcEntityInstanceData* e);
@@ -22379,7 +21894,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 5: return Type::IfcMaterialSelect; } return IfcRelAssociates::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 5: return "RelatingMaterial"; } return IfcRelAssociates::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRelAssociatesMaterial (IfcEntityInstanceData* e);
@@ -22404,7 +21918,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 5: return Type::IfcProfileProperties; case 6: return Type::IfcShapeAspect; case 7: return Type::IfcOrientationSelect; } return IfcRelAssociates::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 5: return "RelatingProfileProperties"; case 6: return "ProfileSectionLocation"; case 7: return "ProfileOrientation"; } return IfcRelAssociates::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRelAssociatesProfileProperties (IfcEntityInstanceData* e);
@@ -22421,7 +21934,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcRelationship::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcRelationship::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRelConnects (IfcEntityInstanceData* e);
@@ -22468,7 +21980,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 4: return Type::IfcConnectionGeometry; case 5: return Type::IfcElement; case 6: return Type::IfcElement; } return IfcRelConnects::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 4: return "ConnectionGeometry"; case 5: return "RelatingElement"; case 6: return "RelatedElement"; } return IfcRelConnects::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRelConnectsElements (IfcEntityInstanceData* e);
@@ -22526,7 +22037,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 7: return Type::UNDEFINED; case 8: return Type::UNDEFINED; case 9: return Type::IfcConnectionTypeEnum; case 10: return Type::IfcConnectionTypeEnum; } return IfcRelConnectsElements::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 7: return "RelatingPriorities"; case 8: return "RelatedPriorities"; case 9: return "RelatedConnectionType"; case 10: return "RelatingConnectionType"; } return IfcRelConnectsElements::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRelConnectsPathElements (IfcEntityInstanceData* e);
@@ -22573,7 +22083,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 4: return Type::IfcPort; case 5: return Type::IfcElement; } return IfcRelConnects::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 4: return "RelatingPort"; case 5: return "RelatedElement"; } return IfcRelConnects::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRelConnectsPortToElement (IfcEntityInstanceData* e);
@@ -22611,7 +22120,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 4: return Type::IfcPort; case 5: return Type::IfcPort; case 6: return Type::IfcElement; } return IfcRelConnects::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 4: return "RelatingPort"; case 5: return "RelatedPort"; case 6: return "RealizingElement"; } return IfcRelConnects::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRelConnectsPorts (IfcEntityInstanceData* e);
@@ -22634,7 +22142,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 4: return Type::IfcStructuralActivityAssignmentSelect; case 5: return Type::IfcStructuralActivity; } return IfcRelConnects::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 4: return "RelatingElement"; case 5: return "RelatedStructuralActivity"; } return IfcRelConnects::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRelConnectsStructuralActivity (IfcEntityInstanceData* e);
@@ -22653,7 +22160,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 4: return Type::IfcElement; case 5: return Type::IfcStructuralMember; } return IfcRelConnects::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 4: return "RelatingElement"; case 5: return "RelatedStructuralMember"; } return IfcRelConnects::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRelConnectsStructuralElement (IfcEntityInstanceData* e);
@@ -22717,7 +22223,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 4: return Type::IfcStructuralMember; case 5: return Type::IfcStructuralConnection; case 6: return Type::IfcBoundaryCondition; case 7: return Type::IfcStructuralConnectionCondition; case 8: return Type::IfcLengthMeasure; case 9: return Type::IfcAxis2Placement3D; } return IfcRelConnects::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 4: return "RelatingStructuralMember"; case 5: return "RelatedStructuralConnection"; case 6: return "AppliedCondition"; case 7: return "AdditionalConditions"; case 8: return "SupportedLength"; case 9: return "ConditionCoordinateSystem"; } return IfcRelConnects::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRelConnectsStructuralMember (IfcEntityInstanceData* e);
@@ -22751,7 +22256,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 10: return Type::IfcConnectionGeometry; } return IfcRelConnectsStructuralMember::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 10: return "ConnectionConstraint"; } return IfcRelConnectsStructuralMember::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRelConnectsWithEccentricity (IfcEntityInstanceData* e);
@@ -22796,7 +22300,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 7: return Type::IfcElement; case 8: return Type::IfcLabel; } return IfcRelConnectsElements::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 7: return "RealizingElements"; case 8: return "ConnectionType"; } return IfcRelConnectsElements::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRelConnectsWithRealizingElements (IfcEntityInstanceData* e);
@@ -22880,7 +22383,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 4: return Type::IfcProduct; case 5: return Type::IfcSpatialStructureElement; } return IfcRelConnects::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 4: return "RelatedElements"; case 5: return "RelatingStructure"; } return IfcRelConnects::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRelContainedInSpatialStructure (IfcEntityInstanceData* e);
@@ -22918,7 +22420,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 4: return Type::IfcElement; case 5: return Type::IfcCovering; } return IfcRelConnects::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 4: return "RelatingBuildingElement"; case 5: return "RelatedCoverings"; } return IfcRelConnects::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRelCoversBldgElements (IfcEntityInstanceData* e);
@@ -22963,7 +22464,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 4: return Type::IfcSpace; case 5: return Type::IfcCovering; } return IfcRelConnects::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 4: return "RelatedSpace"; case 5: return "RelatedCoverings"; } return IfcRelConnects::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRelCoversSpaces (IfcEntityInstanceData* e);
@@ -23011,7 +22511,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 4: return Type::IfcObjectDefinition; case 5: return Type::IfcObjectDefinition; } return IfcRelationship::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 4: return "RelatingObject"; case 5: return "RelatedObjects"; } return IfcRelationship::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRelDecomposes (IfcEntityInstanceData* e);
@@ -23054,7 +22553,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 4: return Type::IfcObject; } return IfcRelationship::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 4: return "RelatedObjects"; } return IfcRelationship::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRelDefines (IfcEntityInstanceData* e);
@@ -23086,7 +22584,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 5: return Type::IfcPropertySetDefinition; } return IfcRelDefines::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 5: return "RelatingPropertyDefinition"; } return IfcRelDefines::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRelDefinesByProperties (IfcEntityInstanceData* e);
@@ -23174,7 +22671,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 5: return Type::IfcTypeObject; } return IfcRelDefines::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 5: return "RelatingType"; } return IfcRelDefines::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRelDefinesByType (IfcEntityInstanceData* e);
@@ -23205,7 +22701,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 4: return Type::IfcOpeningElement; case 5: return Type::IfcElement; } return IfcRelConnects::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 4: return "RelatingOpeningElement"; case 5: return "RelatedBuildingElement"; } return IfcRelConnects::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRelFillsElement (IfcEntityInstanceData* e);
@@ -23232,7 +22727,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 4: return Type::IfcDistributionControlElement; case 5: return Type::IfcDistributionFlowElement; } return IfcRelConnects::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 4: return "RelatedControlElements"; case 5: return "RelatingFlowElement"; } return IfcRelConnects::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRelFlowControlElements (IfcEntityInstanceData* e);
@@ -23263,7 +22757,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 4: return Type::IfcCountMeasure; case 5: return Type::IfcNormalisedRatioMeasure; case 6: return Type::IfcSpatialStructureElement; case 7: return Type::IfcSpaceProgram; case 8: return Type::IfcSpaceProgram; } return IfcRelConnects::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 4: return "DailyInteraction"; case 5: return "ImportanceRating"; case 6: return "LocationOfInteraction"; case 7: return "RelatedSpaceProgram"; case 8: return "RelatingSpaceProgram"; } return IfcRelConnects::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRelInteractionRequirements (IfcEntityInstanceData* e);
@@ -23302,7 +22795,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcRelDecomposes::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcRelDecomposes::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRelNests (IfcEntityInstanceData* e);
@@ -23317,7 +22809,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcRelAssignsToActor::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcRelAssignsToActor::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRelOccupiesSpaces (IfcEntityInstanceData* e);
@@ -23334,7 +22825,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 6: return Type::IfcProperty; } return IfcRelDefinesByProperties::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 6: return "OverridingProperties"; } return IfcRelDefinesByProperties::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRelOverridesProperties (IfcEntityInstanceData* e);
@@ -23386,7 +22876,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 4: return Type::IfcElement; case 5: return Type::IfcFeatureElementAddition; } return IfcRelConnects::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 4: return "RelatingElement"; case 5: return "RelatedFeatureElement"; } return IfcRelConnects::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRelProjectsElement (IfcEntityInstanceData* e);
@@ -23458,7 +22947,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 4: return Type::IfcProduct; case 5: return Type::IfcSpatialStructureElement; } return IfcRelConnects::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 4: return "RelatedElements"; case 5: return "RelatingStructure"; } return IfcRelConnects::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRelReferencedInSpatialStructure (IfcEntityInstanceData* e);
@@ -23473,7 +22961,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcRelAssignsToControl::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcRelAssignsToControl::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRelSchedulesCostItems (IfcEntityInstanceData* e);
@@ -23555,7 +23042,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 4: return Type::IfcProcess; case 5: return Type::IfcProcess; case 6: return Type::IfcTimeMeasure; case 7: return Type::IfcSequenceEnum; } return IfcRelConnects::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 4: return "RelatingProcess"; case 5: return "RelatedProcess"; case 6: return "TimeLag"; case 7: return "SequenceType"; } return IfcRelConnects::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRelSequence (IfcEntityInstanceData* e);
@@ -23600,7 +23086,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 4: return Type::IfcSystem; case 5: return Type::IfcSpatialStructureElement; } return IfcRelConnects::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 4: return "RelatingSystem"; case 5: return "RelatedBuildings"; } return IfcRelConnects::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRelServicesBuildings (IfcEntityInstanceData* e);
@@ -23801,7 +23286,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 4: return Type::IfcSpace; case 5: return Type::IfcElement; case 6: return Type::IfcConnectionGeometry; case 7: return Type::IfcPhysicalOrVirtualEnum; case 8: return Type::IfcInternalOrExternalEnum; } return IfcRelConnects::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 4: return "RelatingSpace"; case 5: return "RelatedBuildingElement"; case 6: return "ConnectionGeometry"; case 7: return "PhysicalOrVirtualBoundary"; case 8: return "InternalOrExternalBoundary"; } return IfcRelConnects::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRelSpaceBoundary (IfcEntityInstanceData* e);
@@ -23826,7 +23310,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 4: return Type::IfcElement; case 5: return Type::IfcFeatureElementSubtraction; } return IfcRelConnects::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 4: return "RelatingBuildingElement"; case 5: return "RelatedOpeningElement"; } return IfcRelConnects::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRelVoidsElement (IfcEntityInstanceData* e);
@@ -23854,7 +23337,6 @@ public:
     virtual const char* getArgumentName(unsigned int i) const { return IfcObject::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcRelAssignsToResource >::ptr ResourceOf() const; // INVERSE IfcRelAssignsToResource::RelatingResource
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcResource (IfcEntityInstanceData* e);
@@ -23950,7 +23432,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 2: return Type::IfcAxis1Placement; case 3: return Type::IfcPlaneAngleMeasure; } return IfcSweptAreaSolid::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 2: return "Axis"; case 3: return "Angle"; } return IfcSweptAreaSolid::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRevolvedAreaSolid (IfcEntityInstanceData* e);
@@ -24035,7 +23516,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 1: return Type::IfcPositiveLengthMeasure; case 2: return Type::IfcPositiveLengthMeasure; } return IfcCsgPrimitive3D::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 1: return "Height"; case 2: return "BottomRadius"; } return IfcCsgPrimitive3D::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRightCircularCone (IfcEntityInstanceData* e);
@@ -24136,7 +23616,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 1: return Type::IfcPositiveLengthMeasure; case 2: return Type::IfcPositiveLengthMeasure; } return IfcCsgPrimitive3D::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 1: return "Height"; case 2: return "Radius"; } return IfcCsgPrimitive3D::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRightCircularCylinder (IfcEntityInstanceData* e);
@@ -24237,7 +23716,6 @@ public:
     IfcTemplatedEntityList< IfcRelReferencedInSpatialStructure >::ptr ReferencesElements() const; // INVERSE IfcRelReferencedInSpatialStructure::RelatingStructure
     IfcTemplatedEntityList< IfcRelServicesBuildings >::ptr ServicedBySystems() const; // INVERSE IfcRelServicesBuildings::RelatedBuildings
     IfcTemplatedEntityList< IfcRelContainedInSpatialStructure >::ptr ContainsElements() const; // INVERSE IfcRelContainedInSpatialStructure::RelatingStructure
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcSpatialStructureElement (IfcEntityInstanceData* e);
@@ -24285,7 +23763,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcElementType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcElementType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcSpatialStructureElementType (IfcEntityInstanceData* e);
@@ -24352,7 +23829,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 1: return Type::IfcPositiveLengthMeasure; } return IfcCsgPrimitive3D::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 1: return "Radius"; } return IfcCsgPrimitive3D::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcSphere (IfcEntityInstanceData* e);
@@ -24484,7 +23960,6 @@ public:
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 7: return "AppliedLoad"; case 8: return "GlobalOrLocal"; } return IfcProduct::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcRelConnectsStructuralActivity >::ptr AssignedToStructuralItem() const; // INVERSE IfcRelConnectsStructuralActivity::RelatedStructuralActivity
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcStructuralActivity (IfcEntityInstanceData* e);
@@ -24586,7 +24061,6 @@ public:
     virtual const char* getArgumentName(unsigned int i) const { return IfcProduct::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcRelConnectsStructuralActivity >::ptr AssignedStructuralActivity() const; // INVERSE IfcRelConnectsStructuralActivity::RelatingElement
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcStructuralItem (IfcEntityInstanceData* e);
@@ -24606,7 +24080,6 @@ public:
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcRelConnectsStructuralElement >::ptr ReferencesElement() const; // INVERSE IfcRelConnectsStructuralElement::RelatedStructuralMember
     IfcTemplatedEntityList< IfcRelConnectsStructuralMember >::ptr ConnectedBy() const; // INVERSE IfcRelConnectsStructuralMember::RelatingStructuralMember
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcStructuralMember (IfcEntityInstanceData* e);
@@ -24641,7 +24114,6 @@ public:
     virtual const char* getArgumentName(unsigned int i) const { return IfcStructuralActivity::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcStructuralAction >::ptr Causes() const; // INVERSE IfcStructuralAction::CausedBy
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcStructuralReaction (IfcEntityInstanceData* e);
@@ -24683,7 +24155,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 7: return Type::IfcStructuralSurfaceTypeEnum; case 8: return Type::IfcPositiveLengthMeasure; } return IfcStructuralMember::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 7: return "PredefinedType"; case 8: return "Thickness"; } return IfcStructuralMember::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcStructuralSurfaceMember (IfcEntityInstanceData* e);
@@ -24719,7 +24190,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcPositiveLengthMeasure; case 10: return Type::IfcShapeAspect; } return IfcStructuralSurfaceMember::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "SubsequentThickness"; case 10: return "VaryingThicknessLocation"; } return IfcStructuralSurfaceMember::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcStructuralSurfaceMemberVarying (IfcEntityInstanceData* e);
@@ -24734,7 +24204,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcDraughtingCallout::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcDraughtingCallout::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcStructuredDimensionCallout (IfcEntityInstanceData* e);
@@ -24826,7 +24295,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 2: return Type::IfcCurve; case 3: return Type::IfcParameterValue; case 4: return Type::IfcParameterValue; case 5: return Type::IfcSurface; } return IfcSweptAreaSolid::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 2: return "Directrix"; case 3: return "StartParam"; case 4: return "EndParam"; case 5: return "ReferenceSurface"; } return IfcSweptAreaSolid::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcSurfaceCurveSweptAreaSolid (IfcEntityInstanceData* e);
@@ -24859,7 +24327,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 2: return Type::IfcDirection; case 3: return Type::IfcLengthMeasure; } return IfcSweptSurface::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 2: return "ExtrudedDirection"; case 3: return "Depth"; } return IfcSweptSurface::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcSurfaceOfLinearExtrusion (IfcEntityInstanceData* e);
@@ -24893,7 +24360,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 2: return Type::IfcAxis1Placement; } return IfcSweptSurface::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 2: return "AxisPosition"; } return IfcSweptSurface::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcSurfaceOfRevolution (IfcEntityInstanceData* e);
@@ -24937,7 +24403,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcFurnishingElementType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcFurnishingElementType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcSystemFurnitureElementType (IfcEntityInstanceData* e);
@@ -25232,7 +24697,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 5: return Type::IfcIdentifier; case 6: return Type::IfcLabel; case 7: return Type::IfcLabel; case 8: return Type::UNDEFINED; case 9: return Type::UNDEFINED; } return IfcProcess::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 5: return "TaskId"; case 6: return "Status"; case 7: return "WorkMethod"; case 8: return "IsMilestone"; case 9: return "Priority"; } return IfcProcess::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcTask (IfcEntityInstanceData* e);
@@ -25312,7 +24776,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcTransportElementTypeEnum; } return IfcElementType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcElementType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcTransportElementType (IfcEntityInstanceData* e);
@@ -25345,7 +24808,6 @@ public:
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 5: return "TheActor"; } return IfcObject::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcRelAssignsToActor >::ptr IsActingUpon() const; // INVERSE IfcRelAssignsToActor::RelatingActor
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcActor (IfcEntityInstanceData* e);
@@ -25533,7 +24995,6 @@ public:
     virtual const char* getArgumentName(unsigned int i) const { return IfcProduct::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcRelContainedInSpatialStructure >::ptr ContainedInStructure() const; // INVERSE IfcRelContainedInSpatialStructure::RelatedElements
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcAnnotation (IfcEntityInstanceData* e);
@@ -25601,7 +25062,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcPositiveLengthMeasure; case 9: return Type::IfcPositiveLengthMeasure; case 10: return Type::IfcPositiveLengthMeasure; case 11: return Type::IfcPositiveLengthMeasure; } return IfcIShapeProfileDef::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "TopFlangeWidth"; case 9: return "TopFlangeThickness"; case 10: return "TopFlangeFilletRadius"; case 11: return "CentreOfGravityInY"; } return IfcIShapeProfileDef::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcAsymmetricIShapeProfileDef (IfcEntityInstanceData* e);
@@ -25721,7 +25181,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 1: return Type::IfcPositiveLengthMeasure; case 2: return Type::IfcPositiveLengthMeasure; case 3: return Type::IfcPositiveLengthMeasure; } return IfcCsgPrimitive3D::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 1: return "XLength"; case 2: return "YLength"; case 3: return "ZLength"; } return IfcCsgPrimitive3D::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcBlock (IfcEntityInstanceData* e);
@@ -25742,7 +25201,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcBooleanResult::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcBooleanResult::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcBooleanClippingResult (IfcEntityInstanceData* e);
@@ -25766,7 +25224,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcCurve::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcCurve::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcBoundedCurve (IfcEntityInstanceData* e);
@@ -25970,7 +25427,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcLengthMeasure; case 10: return Type::IfcLengthMeasure; case 11: return Type::IfcPostalAddress; } return IfcSpatialStructureElement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "ElevationOfRefHeight"; case 10: return "ElevationOfTerrain"; case 11: return "BuildingAddress"; } return IfcSpatialStructureElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcBuilding (IfcEntityInstanceData* e);
@@ -26013,7 +25469,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcElementType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcElementType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcBuildingElementType (IfcEntityInstanceData* e);
@@ -26209,7 +25664,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcLengthMeasure; } return IfcSpatialStructureElement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "Elevation"; } return IfcSpatialStructureElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcBuildingStorey (IfcEntityInstanceData* e);
@@ -26244,7 +25698,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 4: return Type::IfcPositiveLengthMeasure; } return IfcCircleProfileDef::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 4: return "WallThickness"; } return IfcCircleProfileDef::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcCircleHollowProfileDef (IfcEntityInstanceData* e);
@@ -26359,7 +25812,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcColumnTypeEnum; } return IfcBuildingElementType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcBuildingElementType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcColumnType (IfcEntityInstanceData* e);
@@ -26445,7 +25897,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcCompositeCurveSegment; case 1: return Type::UNDEFINED; } return IfcBoundedCurve::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Segments"; case 1: return "SelfIntersect"; } return IfcBoundedCurve::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcCompositeCurve (IfcEntityInstanceData* e);
@@ -26467,7 +25918,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcAxis2Placement; } return IfcCurve::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Position"; } return IfcCurve::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcConic (IfcEntityInstanceData* e);
@@ -26570,7 +26020,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 5: return Type::IfcIdentifier; case 6: return Type::IfcLabel; case 7: return Type::IfcResourceConsumptionEnum; case 8: return Type::IfcMeasureWithUnit; } return IfcResource::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 5: return "ResourceIdentifier"; case 6: return "ResourceGroup"; case 7: return "ResourceConsumption"; case 8: return "BaseQuantity"; } return IfcResource::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcConstructionResource (IfcEntityInstanceData* e);
@@ -26595,7 +26044,6 @@ public:
     virtual const char* getArgumentName(unsigned int i) const { return IfcObject::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcRelAssignsToControl >::ptr Controls() const; // INVERSE IfcRelAssignsToControl::RelatingControl
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcControl (IfcEntityInstanceData* e);
@@ -26645,7 +26093,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcControl::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcControl::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcCostItem (IfcEntityInstanceData* e);
@@ -26726,7 +26173,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 5: return Type::IfcActorSelect; case 6: return Type::IfcActorSelect; case 7: return Type::IfcDateTimeSelect; case 8: return Type::IfcLabel; case 9: return Type::IfcActorSelect; case 10: return Type::IfcDateTimeSelect; case 11: return Type::IfcIdentifier; case 12: return Type::IfcCostScheduleTypeEnum; } return IfcControl::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 5: return "SubmittedBy"; case 6: return "PreparedBy"; case 7: return "SubmittedOn"; case 8: return "Status"; case 9: return "TargetUsers"; case 10: return "UpdateDate"; case 11: return "ID"; case 12: return "PredefinedType"; } return IfcControl::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcCostSchedule (IfcEntityInstanceData* e);
@@ -26822,7 +26268,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcCoveringTypeEnum; } return IfcBuildingElementType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcBuildingElementType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcCoveringType (IfcEntityInstanceData* e);
@@ -26846,7 +26291,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcConstructionResource::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcConstructionResource::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcCrewResource (IfcEntityInstanceData* e);
@@ -26884,7 +26328,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcCurtainWallTypeEnum; } return IfcBuildingElementType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcBuildingElementType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcCurtainWallType (IfcEntityInstanceData* e);
@@ -26899,7 +26342,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcDraughtingCallout::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcDraughtingCallout::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcDimensionCurveDirectedCallout (IfcEntityInstanceData* e);
@@ -26941,7 +26383,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcElementType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcElementType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcDistributionElementType (IfcEntityInstanceData* e);
@@ -27020,7 +26461,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcDistributionElementType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcDistributionElementType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcDistributionFlowElementType (IfcEntityInstanceData* e);
@@ -27061,7 +26501,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 6: return Type::IfcElectricCurrentEnum; case 7: return Type::IfcElectricVoltageMeasure; case 8: return Type::IfcFrequencyMeasure; case 9: return Type::IfcElectricCurrentMeasure; case 10: return Type::IfcElectricCurrentMeasure; case 11: return Type::IfcPowerMeasure; case 12: return Type::IfcPowerMeasure; case 13: return Type::UNDEFINED; } return IfcEnergyProperties::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 6: return "ElectricCurrentType"; case 7: return "InputVoltage"; case 8: return "InputFrequency"; case 9: return "FullLoadCurrent"; case 10: return "MinimumCircuitCurrent"; case 11: return "MaximumPowerInput"; case 12: return "RatedPowerInput"; case 13: return "InputPhase"; } return IfcEnergyProperties::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcElectricalBaseProperties (IfcEntityInstanceData* e);
@@ -27145,7 +26584,6 @@ public:
     IfcTemplatedEntityList< IfcRelSpaceBoundary >::ptr ProvidesBoundaries() const; // INVERSE IfcRelSpaceBoundary::RelatedBuildingElement
     IfcTemplatedEntityList< IfcRelConnectsElements >::ptr ConnectedFrom() const; // INVERSE IfcRelConnectsElements::RelatedElement
     IfcTemplatedEntityList< IfcRelContainedInSpatialStructure >::ptr ContainedInStructure() const; // INVERSE IfcRelContainedInSpatialStructure::RelatedElements
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcElement (IfcEntityInstanceData* e);
@@ -27263,7 +26701,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcAssemblyPlaceEnum; case 9: return Type::IfcElementAssemblyTypeEnum; } return IfcElement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "AssemblyPlace"; case 9: return "PredefinedType"; } return IfcElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcElementAssembly (IfcEntityInstanceData* e);
@@ -27354,7 +26791,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcElement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcElementComponent (IfcEntityInstanceData* e);
@@ -27377,7 +26813,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcElementType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcElementType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcElementComponentType (IfcEntityInstanceData* e);
@@ -27424,7 +26859,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 1: return Type::IfcPositiveLengthMeasure; case 2: return Type::IfcPositiveLengthMeasure; } return IfcConic::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 1: return "SemiAxis1"; case 2: return "SemiAxis2"; } return IfcConic::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcEllipse (IfcEntityInstanceData* e);
@@ -27463,7 +26897,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcDistributionFlowElementType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcDistributionFlowElementType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcEnergyConversionDeviceType (IfcEntityInstanceData* e);
@@ -27478,7 +26911,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcElement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcEquipmentElement (IfcEntityInstanceData* e);
@@ -27493,7 +26925,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcControl::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcControl::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcEquipmentStandard (IfcEntityInstanceData* e);
@@ -27536,7 +26967,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcEvaporativeCoolerTypeEnum; } return IfcEnergyConversionDeviceType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcEnergyConversionDeviceType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcEvaporativeCoolerType (IfcEntityInstanceData* e);
@@ -27579,7 +27009,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcEvaporatorTypeEnum; } return IfcEnergyConversionDeviceType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcEnergyConversionDeviceType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcEvaporatorType (IfcEntityInstanceData* e);
@@ -27617,7 +27046,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcManifoldSolidBrep::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcManifoldSolidBrep::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcFacetedBrep (IfcEntityInstanceData* e);
@@ -27658,7 +27086,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 1: return Type::IfcClosedShell; } return IfcManifoldSolidBrep::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 1: return "Voids"; } return IfcManifoldSolidBrep::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcFacetedBrepWithVoids (IfcEntityInstanceData* e);
@@ -27680,7 +27107,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcElementComponent::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcElementComponent::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcFastener (IfcEntityInstanceData* e);
@@ -27717,7 +27143,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcElementComponentType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcElementComponentType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcFastenerType (IfcEntityInstanceData* e);
@@ -27825,7 +27250,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcElement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcFeatureElement (IfcEntityInstanceData* e);
@@ -27895,7 +27319,6 @@ public:
     virtual const char* getArgumentName(unsigned int i) const { return IfcFeatureElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcRelProjectsElement >::ptr ProjectsElements() const; // INVERSE IfcRelProjectsElement::RelatedFeatureElement
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcFeatureElementAddition (IfcEntityInstanceData* e);
@@ -27960,7 +27383,6 @@ public:
     virtual const char* getArgumentName(unsigned int i) const { return IfcFeatureElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcRelVoidsElement >::ptr VoidsElements() const; // INVERSE IfcRelVoidsElement::RelatedOpeningElement
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcFeatureElementSubtraction (IfcEntityInstanceData* e);
@@ -27998,7 +27420,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcDistributionFlowElementType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcDistributionFlowElementType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcFlowControllerType (IfcEntityInstanceData* e);
@@ -28037,7 +27458,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcDistributionFlowElementType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcDistributionFlowElementType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcFlowFittingType (IfcEntityInstanceData* e);
@@ -28086,7 +27506,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcFlowMeterTypeEnum; } return IfcFlowControllerType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcFlowControllerType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcFlowMeterType (IfcEntityInstanceData* e);
@@ -28123,7 +27542,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcDistributionFlowElementType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcDistributionFlowElementType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcFlowMovingDeviceType (IfcEntityInstanceData* e);
@@ -28169,7 +27587,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcDistributionFlowElementType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcDistributionFlowElementType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcFlowSegmentType (IfcEntityInstanceData* e);
@@ -28190,7 +27607,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcDistributionFlowElementType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcDistributionFlowElementType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcFlowStorageDeviceType (IfcEntityInstanceData* e);
@@ -28211,7 +27627,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcDistributionFlowElementType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcDistributionFlowElementType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcFlowTerminalType (IfcEntityInstanceData* e);
@@ -28234,7 +27649,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcDistributionFlowElementType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcDistributionFlowElementType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcFlowTreatmentDeviceType (IfcEntityInstanceData* e);
@@ -28352,7 +27766,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcElement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcFurnishingElement (IfcEntityInstanceData* e);
@@ -28367,7 +27780,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcControl::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcControl::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcFurnitureStandard (IfcEntityInstanceData* e);
@@ -28384,7 +27796,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcGasTerminalTypeEnum; } return IfcFlowTerminalType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcFlowTerminalType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcGasTerminalType (IfcEntityInstanceData* e);
@@ -28506,7 +27917,6 @@ public:
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 7: return "UAxes"; case 8: return "VAxes"; case 9: return "WAxes"; } return IfcProduct::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcRelContainedInSpatialStructure >::ptr ContainedInStructure() const; // INVERSE IfcRelContainedInSpatialStructure::RelatedElements
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcGrid (IfcEntityInstanceData* e);
@@ -28551,7 +27961,6 @@ public:
     virtual const char* getArgumentName(unsigned int i) const { return IfcObject::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcRelAssignsToGroup >::ptr IsGroupedBy() const; // INVERSE IfcRelAssignsToGroup::RelatingGroup
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcGroup (IfcEntityInstanceData* e);
@@ -28597,7 +28006,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcHeatExchangerTypeEnum; } return IfcEnergyConversionDeviceType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcEnergyConversionDeviceType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcHeatExchangerType (IfcEntityInstanceData* e);
@@ -28640,7 +28048,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcHumidifierTypeEnum; } return IfcEnergyConversionDeviceType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcEnergyConversionDeviceType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcHumidifierType (IfcEntityInstanceData* e);
@@ -28688,7 +28095,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 5: return Type::IfcInventoryTypeEnum; case 6: return Type::IfcActorSelect; case 7: return Type::IfcPerson; case 8: return Type::IfcCalendarDate; case 9: return Type::IfcCostValue; case 10: return Type::IfcCostValue; } return IfcGroup::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 5: return "InventoryType"; case 6: return "Jurisdiction"; case 7: return "ResponsiblePersons"; case 8: return "LastUpdateDate"; case 9: return "CurrentValue"; case 10: return "OriginalValue"; } return IfcGroup::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcInventory (IfcEntityInstanceData* e);
@@ -28732,7 +28138,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcJunctionBoxTypeEnum; } return IfcFlowFittingType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcFlowFittingType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcJunctionBoxType (IfcEntityInstanceData* e);
@@ -28774,7 +28179,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcText; } return IfcConstructionResource::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "SkillSet"; } return IfcConstructionResource::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcLaborResource (IfcEntityInstanceData* e);
@@ -28820,7 +28224,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcLampTypeEnum; } return IfcFlowTerminalType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcFlowTerminalType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcLampType (IfcEntityInstanceData* e);
@@ -28868,7 +28271,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcLightFixtureTypeEnum; } return IfcFlowTerminalType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcFlowTerminalType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcLightFixtureType (IfcEntityInstanceData* e);
@@ -28883,7 +28285,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcDimensionCurveDirectedCallout::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcDimensionCurveDirectedCallout::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcLinearDimension (IfcEntityInstanceData* e);
@@ -28934,7 +28335,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcPositiveLengthMeasure; case 9: return Type::IfcPositiveLengthMeasure; } return IfcFastener::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "NominalDiameter"; case 9: return "NominalLength"; } return IfcFastener::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcMechanicalFastener (IfcEntityInstanceData* e);
@@ -28983,7 +28383,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcFastenerType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcFastenerType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcMechanicalFastenerType (IfcEntityInstanceData* e);
@@ -29101,7 +28500,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcMemberTypeEnum; } return IfcBuildingElementType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcBuildingElementType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcMemberType (IfcEntityInstanceData* e);
@@ -29145,7 +28543,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcMotorConnectionTypeEnum; } return IfcEnergyConversionDeviceType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcEnergyConversionDeviceType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcMotorConnectionType (IfcEntityInstanceData* e);
@@ -29168,7 +28565,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 10: return Type::IfcSpatialStructureElement; case 11: return Type::IfcSpatialStructureElement; case 12: return Type::IfcText; } return IfcTask::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 10: return "MoveFrom"; case 11: return "MoveTo"; case 12: return "PunchList"; } return IfcTask::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcMove (IfcEntityInstanceData* e);
@@ -29194,7 +28590,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 6: return Type::IfcOccupantTypeEnum; } return IfcActor::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 6: return "PredefinedType"; } return IfcActor::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcOccupant (IfcEntityInstanceData* e);
@@ -29411,7 +28806,6 @@ public:
     virtual const char* getArgumentName(unsigned int i) const { return IfcFeatureElementSubtraction::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcRelFillsElement >::ptr HasFillings() const; // INVERSE IfcRelFillsElement::RelatingOpeningElement
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcOpeningElement (IfcEntityInstanceData* e);
@@ -29428,7 +28822,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 10: return Type::IfcIdentifier; } return IfcTask::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 10: return "ActionID"; } return IfcTask::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcOrderAction (IfcEntityInstanceData* e);
@@ -29474,7 +28867,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcOutletTypeEnum; } return IfcFlowTerminalType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcFlowTerminalType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcOutletType (IfcEntityInstanceData* e);
@@ -29496,7 +28888,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 5: return Type::IfcLabel; } return IfcControl::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 5: return "LifeCyclePhase"; } return IfcControl::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPerformanceHistory (IfcEntityInstanceData* e);
@@ -29549,7 +28940,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 5: return Type::IfcIdentifier; } return IfcControl::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 5: return "PermitID"; } return IfcControl::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPermit (IfcEntityInstanceData* e);
@@ -29595,7 +28985,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcPipeFittingTypeEnum; } return IfcFlowFittingType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcFlowFittingType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPipeFittingType (IfcEntityInstanceData* e);
@@ -29645,7 +29034,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcPipeSegmentTypeEnum; } return IfcFlowSegmentType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcFlowSegmentType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPipeSegmentType (IfcEntityInstanceData* e);
@@ -29739,7 +29127,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcPlateTypeEnum; } return IfcBuildingElementType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcBuildingElementType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPlateType (IfcEntityInstanceData* e);
@@ -29770,7 +29157,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcCartesianPoint; } return IfcBoundedCurve::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Points"; } return IfcBoundedCurve::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPolyline (IfcEntityInstanceData* e);
@@ -29840,7 +29226,6 @@ public:
     IfcTemplatedEntityList< IfcRelConnectsPortToElement >::ptr ContainedIn() const; // INVERSE IfcRelConnectsPortToElement::RelatingPort
     IfcTemplatedEntityList< IfcRelConnectsPorts >::ptr ConnectedFrom() const; // INVERSE IfcRelConnectsPorts::RelatedPort
     IfcTemplatedEntityList< IfcRelConnectsPorts >::ptr ConnectedTo() const; // INVERSE IfcRelConnectsPorts::RelatingPort
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPort (IfcEntityInstanceData* e);
@@ -29966,7 +29351,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 5: return Type::IfcIdentifier; case 6: return Type::IfcProcedureTypeEnum; case 7: return Type::IfcLabel; } return IfcProcess::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 5: return "ProcedureID"; case 6: return "ProcedureType"; case 7: return "UserDefinedProcedureType"; } return IfcProcess::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcProcedure (IfcEntityInstanceData* e);
@@ -30043,7 +29427,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 5: return Type::IfcIdentifier; case 6: return Type::IfcProjectOrderTypeEnum; case 7: return Type::IfcLabel; } return IfcControl::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 5: return "ID"; case 6: return "PredefinedType"; case 7: return "Status"; } return IfcControl::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcProjectOrder (IfcEntityInstanceData* e);
@@ -30062,7 +29445,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 5: return Type::IfcRelAssignsToProjectOrder; case 6: return Type::IfcProjectOrderRecordTypeEnum; } return IfcControl::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 5: return "Records"; case 6: return "PredefinedType"; } return IfcControl::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcProjectOrderRecord (IfcEntityInstanceData* e);
@@ -30183,7 +29565,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcFeatureElementAddition::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcFeatureElementAddition::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcProjectionElement (IfcEntityInstanceData* e);
@@ -30235,7 +29616,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcProtectiveDeviceTypeEnum; } return IfcFlowControllerType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcFlowControllerType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcProtectiveDeviceType (IfcEntityInstanceData* e);
@@ -30280,7 +29660,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcPumpTypeEnum; } return IfcFlowMovingDeviceType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcFlowMovingDeviceType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPumpType (IfcEntityInstanceData* e);
@@ -30295,7 +29674,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcDimensionCurveDirectedCallout::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcDimensionCurveDirectedCallout::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRadiusDimension (IfcEntityInstanceData* e);
@@ -30332,7 +29710,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcRailingTypeEnum; } return IfcBuildingElementType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcBuildingElementType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRailingType (IfcEntityInstanceData* e);
@@ -30369,7 +29746,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcRampFlightTypeEnum; } return IfcBuildingElementType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcBuildingElementType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRampFlightType (IfcEntityInstanceData* e);
@@ -30405,7 +29781,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcRelDecomposes::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcRelDecomposes::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRelAggregates (IfcEntityInstanceData* e);
@@ -30424,7 +29799,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 7: return Type::IfcScheduleTimeControl; } return IfcRelAssignsToControl::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 7: return "TimeForTask"; } return IfcRelAssignsToControl::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRelAssignsTasks (IfcEntityInstanceData* e);
@@ -30478,7 +29852,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcSanitaryTerminalTypeEnum; } return IfcFlowTerminalType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcFlowTerminalType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcSanitaryTerminalType (IfcEntityInstanceData* e);
@@ -30566,7 +29939,6 @@ public:
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 5: return "ActualStart"; case 6: return "EarlyStart"; case 7: return "LateStart"; case 8: return "ScheduleStart"; case 9: return "ActualFinish"; case 10: return "EarlyFinish"; case 11: return "LateFinish"; case 12: return "ScheduleFinish"; case 13: return "ScheduleDuration"; case 14: return "ActualDuration"; case 15: return "RemainingTime"; case 16: return "FreeFloat"; case 17: return "TotalFloat"; case 18: return "IsCritical"; case 19: return "StatusTime"; case 20: return "StartFloat"; case 21: return "FinishFloat"; case 22: return "Completion"; } return IfcControl::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcRelAssignsTasks >::ptr ScheduleTimeControlAssigned() const; // INVERSE IfcRelAssignsTasks::TimeForTask
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcScheduleTimeControl (IfcEntityInstanceData* e);
@@ -30585,7 +29957,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 5: return Type::IfcServiceLifeTypeEnum; case 6: return Type::IfcTimeMeasure; } return IfcControl::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 5: return "ServiceLifeType"; case 6: return "ServiceLifeDuration"; } return IfcControl::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcServiceLife (IfcEntityInstanceData* e);
@@ -30816,7 +30187,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcCompoundPlaneAngleMeasure; case 10: return Type::IfcCompoundPlaneAngleMeasure; case 11: return Type::IfcLengthMeasure; case 12: return Type::IfcLabel; case 13: return Type::IfcPostalAddress; } return IfcSpatialStructureElement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "RefLatitude"; case 10: return "RefLongitude"; case 11: return "RefElevation"; case 12: return "LandTitleNumber"; case 13: return "SiteAddress"; } return IfcSpatialStructureElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcSite (IfcEntityInstanceData* e);
@@ -30910,7 +30280,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcSlabTypeEnum; } return IfcBuildingElementType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcBuildingElementType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcSlabType (IfcEntityInstanceData* e);
@@ -31183,7 +30552,6 @@ public:
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcRelCoversSpaces >::ptr HasCoverings() const; // INVERSE IfcRelCoversSpaces::RelatedSpace
     IfcTemplatedEntityList< IfcRelSpaceBoundary >::ptr BoundedBy() const; // INVERSE IfcRelSpaceBoundary::RelatingSpace
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcSpace (IfcEntityInstanceData* e);
@@ -31230,7 +30598,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcSpaceHeaterTypeEnum; } return IfcEnergyConversionDeviceType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcEnergyConversionDeviceType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcSpaceHeaterType (IfcEntityInstanceData* e);
@@ -31263,7 +30630,6 @@ public:
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcRelInteractionRequirements >::ptr HasInteractionReqsFrom() const; // INVERSE IfcRelInteractionRequirements::RelatedSpaceProgram
     IfcTemplatedEntityList< IfcRelInteractionRequirements >::ptr HasInteractionReqsTo() const; // INVERSE IfcRelInteractionRequirements::RelatingSpaceProgram
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcSpaceProgram (IfcEntityInstanceData* e);
@@ -31361,7 +30727,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcSpaceTypeEnum; } return IfcSpatialStructureElementType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcSpatialStructureElementType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcSpaceType (IfcEntityInstanceData* e);
@@ -31404,7 +30769,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcStackTerminalTypeEnum; } return IfcFlowTerminalType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcFlowTerminalType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcStackTerminalType (IfcEntityInstanceData* e);
@@ -31441,7 +30805,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcStairFlightTypeEnum; } return IfcBuildingElementType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcBuildingElementType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcStairFlightType (IfcEntityInstanceData* e);
@@ -31481,7 +30844,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::UNDEFINED; case 10: return Type::IfcStructuralReaction; } return IfcStructuralActivity::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "DestabilizingLoad"; case 10: return "CausedBy"; } return IfcStructuralActivity::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcStructuralAction (IfcEntityInstanceData* e);
@@ -31504,7 +30866,6 @@ public:
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 7: return "AppliedCondition"; } return IfcStructuralItem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcRelConnectsStructuralMember >::ptr ConnectsStructuralMembers() const; // INVERSE IfcRelConnectsStructuralMember::RelatedStructuralConnection
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcStructuralConnection (IfcEntityInstanceData* e);
@@ -31535,7 +30896,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcStructuralConnection::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcStructuralConnection::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcStructuralCurveConnection (IfcEntityInstanceData* e);
@@ -31589,7 +30949,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 7: return Type::IfcStructuralCurveTypeEnum; } return IfcStructuralMember::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 7: return "PredefinedType"; } return IfcStructuralMember::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcStructuralCurveMember (IfcEntityInstanceData* e);
@@ -31623,7 +30982,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcStructuralCurveMember::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcStructuralCurveMember::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcStructuralCurveMemberVarying (IfcEntityInstanceData* e);
@@ -31646,7 +31004,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 11: return Type::IfcProjectedOrTrueLengthEnum; } return IfcStructuralAction::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 11: return "ProjectedOrTrue"; } return IfcStructuralAction::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcStructuralLinearAction (IfcEntityInstanceData* e);
@@ -31665,7 +31022,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 12: return Type::IfcShapeAspect; case 13: return Type::IfcStructuralLoad; } return IfcStructuralLinearAction::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 12: return "VaryingAppliedLoadLocation"; case 13: return "SubsequentAppliedLoads"; } return IfcStructuralLinearAction::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcStructuralLinearActionVarying (IfcEntityInstanceData* e);
@@ -31733,7 +31089,6 @@ public:
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcStructuralResultGroup >::ptr SourceOfResultGroup() const; // INVERSE IfcStructuralResultGroup::ResultForLoadGroup
     IfcTemplatedEntityList< IfcStructuralAnalysisModel >::ptr LoadGroupFor() const; // INVERSE IfcStructuralAnalysisModel::LoadedBy
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcStructuralLoadGroup (IfcEntityInstanceData* e);
@@ -31756,7 +31111,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 11: return Type::IfcProjectedOrTrueLengthEnum; } return IfcStructuralAction::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 11: return "ProjectedOrTrue"; } return IfcStructuralAction::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcStructuralPlanarAction (IfcEntityInstanceData* e);
@@ -31775,7 +31129,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 12: return Type::IfcShapeAspect; case 13: return Type::IfcStructuralLoad; } return IfcStructuralPlanarAction::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 12: return "VaryingAppliedLoadLocation"; case 13: return "SubsequentAppliedLoads"; } return IfcStructuralPlanarAction::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcStructuralPlanarActionVarying (IfcEntityInstanceData* e);
@@ -31834,7 +31187,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcStructuralAction::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcStructuralAction::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcStructuralPointAction (IfcEntityInstanceData* e);
@@ -31861,7 +31213,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcStructuralConnection::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcStructuralConnection::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcStructuralPointConnection (IfcEntityInstanceData* e);
@@ -31918,7 +31269,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcStructuralReaction::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcStructuralReaction::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcStructuralPointReaction (IfcEntityInstanceData* e);
@@ -31948,7 +31298,6 @@ public:
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 5: return "TheoryType"; case 6: return "ResultForLoadGroup"; case 7: return "IsLinear"; } return IfcGroup::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcStructuralAnalysisModel >::ptr ResultGroupFor() const; // INVERSE IfcStructuralAnalysisModel::HasResults
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcStructuralResultGroup (IfcEntityInstanceData* e);
@@ -31974,7 +31323,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcStructuralConnection::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcStructuralConnection::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcStructuralSurfaceConnection (IfcEntityInstanceData* e);
@@ -32020,7 +31368,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcActorSelect; case 10: return Type::IfcText; } return IfcConstructionResource::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "SubContractor"; case 10: return "JobDescription"; } return IfcConstructionResource::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcSubContractResource (IfcEntityInstanceData* e);
@@ -32077,7 +31424,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcSwitchingDeviceTypeEnum; } return IfcFlowControllerType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcFlowControllerType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcSwitchingDeviceType (IfcEntityInstanceData* e);
@@ -32109,7 +31455,6 @@ public:
     virtual const char* getArgumentName(unsigned int i) const { return IfcGroup::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcRelServicesBuildings >::ptr ServicesBuildings() const; // INVERSE IfcRelServicesBuildings::RelatingSystem
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcSystem (IfcEntityInstanceData* e);
@@ -32158,7 +31503,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcTankTypeEnum; } return IfcFlowStorageDeviceType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcFlowStorageDeviceType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcTankType (IfcEntityInstanceData* e);
@@ -32181,7 +31525,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 5: return Type::IfcDateTimeSelect; case 6: return Type::IfcTimeSeriesScheduleTypeEnum; case 7: return Type::IfcTimeSeries; } return IfcControl::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 5: return "ApplicableDates"; case 6: return "TimeSeriesScheduleType"; case 7: return "TimeSeries"; } return IfcControl::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcTimeSeriesSchedule (IfcEntityInstanceData* e);
@@ -32225,7 +31568,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcTransformerTypeEnum; } return IfcEnergyConversionDeviceType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcEnergyConversionDeviceType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcTransformerType (IfcEntityInstanceData* e);
@@ -32369,7 +31711,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcTransportElementTypeEnum; case 9: return Type::IfcMassMeasure; case 10: return Type::IfcCountMeasure; } return IfcElement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "OperationType"; case 9: return "CapacityByWeight"; case 10: return "CapacityByNumber"; } return IfcElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcTransportElement (IfcEntityInstanceData* e);
@@ -32476,7 +31817,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcCurve; case 1: return Type::IfcTrimmingSelect; case 2: return Type::IfcTrimmingSelect; case 3: return Type::UNDEFINED; case 4: return Type::IfcTrimmingPreference; } return IfcBoundedCurve::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "BasisCurve"; case 1: return "Trim1"; case 2: return "Trim2"; case 3: return "SenseAgreement"; case 4: return "MasterRepresentation"; } return IfcBoundedCurve::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcTrimmedCurve (IfcEntityInstanceData* e);
@@ -32522,7 +31862,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcTubeBundleTypeEnum; } return IfcEnergyConversionDeviceType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcEnergyConversionDeviceType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcTubeBundleType (IfcEntityInstanceData* e);
@@ -32567,7 +31906,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcUnitaryEquipmentTypeEnum; } return IfcEnergyConversionDeviceType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcEnergyConversionDeviceType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcUnitaryEquipmentType (IfcEntityInstanceData* e);
@@ -32622,7 +31960,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcValveTypeEnum; } return IfcFlowControllerType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcFlowControllerType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcValveType (IfcEntityInstanceData* e);
@@ -32722,7 +32059,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcElement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcVirtualElement (IfcEntityInstanceData* e);
@@ -32823,7 +32159,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcWallTypeEnum; } return IfcBuildingElementType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcBuildingElementType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcWallType (IfcEntityInstanceData* e);
@@ -32876,7 +32211,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcWasteTerminalTypeEnum; } return IfcFlowTerminalType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcFlowTerminalType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcWasteTerminalType (IfcEntityInstanceData* e);
@@ -32975,7 +32309,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 5: return Type::IfcIdentifier; case 6: return Type::IfcDateTimeSelect; case 7: return Type::IfcPerson; case 8: return Type::IfcLabel; case 9: return Type::IfcTimeMeasure; case 10: return Type::IfcTimeMeasure; case 11: return Type::IfcDateTimeSelect; case 12: return Type::IfcDateTimeSelect; case 13: return Type::IfcWorkControlTypeEnum; case 14: return Type::IfcLabel; } return IfcControl::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 5: return "Identifier"; case 6: return "CreationDate"; case 7: return "Creators"; case 8: return "Purpose"; case 9: return "Duration"; case 10: return "TotalFloat"; case 11: return "StartTime"; case 12: return "FinishTime"; case 13: return "WorkControlType"; case 14: return "UserDefinedControlType"; } return IfcControl::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcWorkControl (IfcEntityInstanceData* e);
@@ -33014,7 +32347,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcWorkControl::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcWorkControl::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcWorkPlan (IfcEntityInstanceData* e);
@@ -33068,7 +32400,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcWorkControl::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcWorkControl::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcWorkSchedule (IfcEntityInstanceData* e);
@@ -33167,7 +32498,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcGroup::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcGroup::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcZone (IfcEntityInstanceData* e);
@@ -33182,7 +32512,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcCompositeCurve::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcCompositeCurve::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     Ifc2DCompositeCurve (IfcEntityInstanceData* e);
@@ -33236,7 +32565,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 5: return Type::IfcIdentifier; } return IfcControl::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 5: return "RequestID"; } return IfcControl::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcActionRequest (IfcEntityInstanceData* e);
@@ -33279,7 +32607,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcAirTerminalBoxTypeEnum; } return IfcFlowControllerType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcFlowControllerType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcAirTerminalBoxType (IfcEntityInstanceData* e);
@@ -33321,7 +32648,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcAirTerminalTypeEnum; } return IfcFlowTerminalType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcFlowTerminalType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcAirTerminalType (IfcEntityInstanceData* e);
@@ -33364,7 +32690,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcAirToAirHeatRecoveryTypeEnum; } return IfcEnergyConversionDeviceType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcEnergyConversionDeviceType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcAirToAirHeatRecoveryType (IfcEntityInstanceData* e);
@@ -33379,7 +32704,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcDimensionCurveDirectedCallout::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcDimensionCurveDirectedCallout::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcAngularDimension (IfcEntityInstanceData* e);
@@ -33447,7 +32771,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 5: return Type::IfcIdentifier; case 6: return Type::IfcCostValue; case 7: return Type::IfcCostValue; case 8: return Type::IfcCostValue; case 9: return Type::IfcActorSelect; case 10: return Type::IfcActorSelect; case 11: return Type::IfcPerson; case 12: return Type::IfcCalendarDate; case 13: return Type::IfcCostValue; } return IfcGroup::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 5: return "AssetID"; case 6: return "OriginalValue"; case 7: return "CurrentValue"; case 8: return "TotalReplacementCost"; case 9: return "Owner"; case 10: return "User"; case 11: return "ResponsiblePerson"; case 12: return "IncorporationDate"; case 13: return "DepreciatedValue"; } return IfcGroup::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcAsset (IfcEntityInstanceData* e);
@@ -33525,7 +32848,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::UNDEFINED; case 1: return Type::IfcCartesianPoint; case 2: return Type::IfcBSplineCurveForm; case 3: return Type::UNDEFINED; case 4: return Type::UNDEFINED; } return IfcBoundedCurve::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Degree"; case 1: return "ControlPointsList"; case 2: return "CurveForm"; case 3: return "ClosedCurve"; case 4: return "SelfIntersect"; } return IfcBoundedCurve::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcBSplineCurve (IfcEntityInstanceData* e);
@@ -33640,7 +32962,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcBeamTypeEnum; } return IfcBuildingElementType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcBuildingElementType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcBeamType (IfcEntityInstanceData* e);
@@ -33655,7 +32976,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcBSplineCurve::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcBSplineCurve::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcBezierCurve (IfcEntityInstanceData* e);
@@ -33701,7 +33021,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcBoilerTypeEnum; } return IfcEnergyConversionDeviceType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcEnergyConversionDeviceType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcBoilerType (IfcEntityInstanceData* e);
@@ -34078,7 +33397,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcElement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcBuildingElement (IfcEntityInstanceData* e);
@@ -34093,7 +33411,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcBuildingElement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcBuildingElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcBuildingElementComponent (IfcEntityInstanceData* e);
@@ -34124,7 +33441,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcBuildingElementComponent::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcBuildingElementComponent::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcBuildingElementPart (IfcEntityInstanceData* e);
@@ -34332,7 +33648,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcElementCompositionEnum; } return IfcBuildingElement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "CompositionType"; } return IfcBuildingElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcBuildingElementProxy (IfcEntityInstanceData* e);
@@ -34383,7 +33698,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcBuildingElementProxyTypeEnum; } return IfcBuildingElementType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcBuildingElementType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcBuildingElementProxyType (IfcEntityInstanceData* e);
@@ -34426,7 +33740,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcCableCarrierFittingTypeEnum; } return IfcFlowFittingType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcFlowFittingType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcCableCarrierFittingType (IfcEntityInstanceData* e);
@@ -34475,7 +33788,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcCableCarrierSegmentTypeEnum; } return IfcFlowSegmentType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcFlowSegmentType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcCableCarrierSegmentType (IfcEntityInstanceData* e);
@@ -34533,7 +33845,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcCableSegmentTypeEnum; } return IfcFlowSegmentType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcFlowSegmentType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcCableSegmentType (IfcEntityInstanceData* e);
@@ -34582,7 +33893,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcChillerTypeEnum; } return IfcEnergyConversionDeviceType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcEnergyConversionDeviceType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcChillerType (IfcEntityInstanceData* e);
@@ -34626,7 +33936,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 1: return Type::IfcPositiveLengthMeasure; } return IfcConic::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 1: return "Radius"; } return IfcConic::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcCircle (IfcEntityInstanceData* e);
@@ -34670,7 +33979,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcCoilTypeEnum; } return IfcEnergyConversionDeviceType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcEnergyConversionDeviceType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcCoilType (IfcEntityInstanceData* e);
@@ -34955,7 +34263,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcBuildingElement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcBuildingElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcColumn (IfcEntityInstanceData* e);
@@ -34999,7 +34306,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcCompressorTypeEnum; } return IfcFlowMovingDeviceType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcFlowMovingDeviceType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcCompressorType (IfcEntityInstanceData* e);
@@ -35043,7 +34349,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcCondenserTypeEnum; } return IfcEnergyConversionDeviceType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcEnergyConversionDeviceType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcCondenserType (IfcEntityInstanceData* e);
@@ -35058,7 +34363,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcGroup::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcGroup::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcCondition (IfcEntityInstanceData* e);
@@ -35077,7 +34381,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 5: return Type::IfcConditionCriterionSelect; case 6: return Type::IfcDateTimeSelect; } return IfcControl::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 5: return "Criterion"; case 6: return "CriterionDateTime"; } return IfcControl::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcConditionCriterion (IfcEntityInstanceData* e);
@@ -35113,7 +34416,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcConstructionResource::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcConstructionResource::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcConstructionEquipmentResource (IfcEntityInstanceData* e);
@@ -35161,7 +34463,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcActorSelect; case 10: return Type::IfcRatioMeasure; } return IfcConstructionResource::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "Suppliers"; case 10: return "UsageRatio"; } return IfcConstructionResource::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcConstructionMaterialResource (IfcEntityInstanceData* e);
@@ -35190,7 +34491,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcConstructionResource::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcConstructionResource::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcConstructionProductResource (IfcEntityInstanceData* e);
@@ -35236,7 +34536,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcCooledBeamTypeEnum; } return IfcEnergyConversionDeviceType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcEnergyConversionDeviceType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcCooledBeamType (IfcEntityInstanceData* e);
@@ -35286,7 +34585,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcCoolingTowerTypeEnum; } return IfcEnergyConversionDeviceType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcEnergyConversionDeviceType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcCoolingTowerType (IfcEntityInstanceData* e);
@@ -35531,7 +34829,6 @@ public:
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcRelCoversSpaces >::ptr CoversSpaces() const; // INVERSE IfcRelCoversSpaces::RelatedCoverings
     IfcTemplatedEntityList< IfcRelCoversBldgElements >::ptr Covers() const; // INVERSE IfcRelCoversBldgElements::RelatedCoverings
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcCovering (IfcEntityInstanceData* e);
@@ -35683,7 +34980,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcBuildingElement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcBuildingElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcCurtainWall (IfcEntityInstanceData* e);
@@ -35734,7 +35030,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcDamperTypeEnum; } return IfcFlowControllerType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcFlowControllerType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcDamperType (IfcEntityInstanceData* e);
@@ -35749,7 +35044,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcDimensionCurveDirectedCallout::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcDimensionCurveDirectedCallout::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcDiameterDimension (IfcEntityInstanceData* e);
@@ -35936,7 +35230,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcElementComponent::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcElementComponent::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcDiscreteAccessory (IfcEntityInstanceData* e);
@@ -36138,7 +35431,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcElementComponentType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcElementComponentType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcDiscreteAccessoryType (IfcEntityInstanceData* e);
@@ -36192,7 +35484,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcDistributionChamberElementTypeEnum; } return IfcDistributionFlowElementType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcDistributionFlowElementType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcDistributionChamberElementType (IfcEntityInstanceData* e);
@@ -36260,7 +35551,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcDistributionElementType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcDistributionElementType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcDistributionControlElementType (IfcEntityInstanceData* e);
@@ -36436,7 +35726,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcElement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcDistributionElement (IfcEntityInstanceData* e);
@@ -36519,7 +35808,6 @@ public:
     virtual const char* getArgumentName(unsigned int i) const { return IfcDistributionElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcRelFlowControlElements >::ptr HasControlElements() const; // INVERSE IfcRelFlowControlElements::RelatingFlowElement
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcDistributionFlowElement (IfcEntityInstanceData* e);
@@ -36620,7 +35908,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 7: return Type::IfcFlowDirectionEnum; } return IfcPort::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 7: return "FlowDirection"; } return IfcPort::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcDistributionPort (IfcEntityInstanceData* e);
@@ -37004,7 +36291,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcPositiveLengthMeasure; case 9: return Type::IfcPositiveLengthMeasure; } return IfcBuildingElement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "OverallHeight"; case 9: return "OverallWidth"; } return IfcBuildingElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcDoor (IfcEntityInstanceData* e);
@@ -37050,7 +36336,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcDuctFittingTypeEnum; } return IfcFlowFittingType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcFlowFittingType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcDuctFittingType (IfcEntityInstanceData* e);
@@ -37096,7 +36381,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcDuctSegmentTypeEnum; } return IfcFlowSegmentType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcFlowSegmentType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcDuctSegmentType (IfcEntityInstanceData* e);
@@ -37139,7 +36423,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcDuctSilencerTypeEnum; } return IfcFlowTreatmentDeviceType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcFlowTreatmentDeviceType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcDuctSilencerType (IfcEntityInstanceData* e);
@@ -37158,7 +36441,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcPositiveLengthMeasure; } return IfcFeatureElementSubtraction::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "FeatureLength"; } return IfcFeatureElementSubtraction::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcEdgeFeature (IfcEntityInstanceData* e);
@@ -37204,7 +36486,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcElectricApplianceTypeEnum; } return IfcFlowTerminalType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcFlowTerminalType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcElectricApplianceType (IfcEntityInstanceData* e);
@@ -37248,7 +36529,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcElectricFlowStorageDeviceTypeEnum; } return IfcFlowStorageDeviceType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcFlowStorageDeviceType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcElectricFlowStorageDeviceType (IfcEntityInstanceData* e);
@@ -37297,7 +36577,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcElectricGeneratorTypeEnum; } return IfcEnergyConversionDeviceType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcEnergyConversionDeviceType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcElectricGeneratorType (IfcEntityInstanceData* e);
@@ -37314,7 +36593,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcElectricHeaterTypeEnum; } return IfcFlowTerminalType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcFlowTerminalType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcElectricHeaterType (IfcEntityInstanceData* e);
@@ -37358,7 +36636,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcElectricMotorTypeEnum; } return IfcEnergyConversionDeviceType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcEnergyConversionDeviceType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcElectricMotorType (IfcEntityInstanceData* e);
@@ -37402,7 +36679,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcElectricTimeControlTypeEnum; } return IfcFlowControllerType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcFlowControllerType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcElectricTimeControlType (IfcEntityInstanceData* e);
@@ -37417,7 +36693,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcSystem::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcSystem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcElectricalCircuit (IfcEntityInstanceData* e);
@@ -37432,7 +36707,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcElement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcElectricalElement (IfcEntityInstanceData* e);
@@ -37455,7 +36729,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcDistributionFlowElement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcDistributionFlowElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcEnergyConversionDevice (IfcEntityInstanceData* e);
@@ -37500,7 +36773,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcFanTypeEnum; } return IfcFlowMovingDeviceType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcFlowMovingDeviceType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcFanType (IfcEntityInstanceData* e);
@@ -37546,7 +36818,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcFilterTypeEnum; } return IfcFlowTreatmentDeviceType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcFlowTreatmentDeviceType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcFilterType (IfcEntityInstanceData* e);
@@ -37596,7 +36867,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcFireSuppressionTerminalTypeEnum; } return IfcFlowTerminalType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcFlowTerminalType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcFireSuppressionTerminalType (IfcEntityInstanceData* e);
@@ -37619,7 +36889,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcDistributionFlowElement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcDistributionFlowElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcFlowController (IfcEntityInstanceData* e);
@@ -37638,7 +36907,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcDistributionFlowElement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcDistributionFlowElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcFlowFitting (IfcEntityInstanceData* e);
@@ -37685,7 +36953,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcFlowInstrumentTypeEnum; } return IfcDistributionControlElementType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcDistributionControlElementType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcFlowInstrumentType (IfcEntityInstanceData* e);
@@ -37704,7 +36971,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcDistributionFlowElement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcDistributionFlowElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcFlowMovingDevice (IfcEntityInstanceData* e);
@@ -37741,7 +37007,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcDistributionFlowElement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcDistributionFlowElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcFlowSegment (IfcEntityInstanceData* e);
@@ -37765,7 +37030,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcDistributionFlowElement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcDistributionFlowElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcFlowStorageDevice (IfcEntityInstanceData* e);
@@ -37790,7 +37054,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcDistributionFlowElement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcDistributionFlowElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcFlowTerminal (IfcEntityInstanceData* e);
@@ -37809,7 +37072,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcDistributionFlowElement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcDistributionFlowElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcFlowTreatmentDevice (IfcEntityInstanceData* e);
@@ -37850,7 +37112,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcFootingTypeEnum; } return IfcBuildingElement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "PredefinedType"; } return IfcBuildingElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcFooting (IfcEntityInstanceData* e);
@@ -38114,7 +37375,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcBuildingElement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcBuildingElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcMember (IfcEntityInstanceData* e);
@@ -38158,7 +37418,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcPileTypeEnum; case 9: return Type::IfcPileConstructionEnum; } return IfcBuildingElement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "PredefinedType"; case 9: return "ConstructionType"; } return IfcBuildingElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPile (IfcEntityInstanceData* e);
@@ -38400,7 +37659,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcBuildingElement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcBuildingElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPlate (IfcEntityInstanceData* e);
@@ -38553,7 +37811,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcRailingTypeEnum; } return IfcBuildingElement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "PredefinedType"; } return IfcBuildingElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRailing (IfcEntityInstanceData* e);
@@ -38702,7 +37959,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcRampTypeEnum; } return IfcBuildingElement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "ShapeType"; } return IfcBuildingElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRamp (IfcEntityInstanceData* e);
@@ -38904,7 +38160,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcBuildingElement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcBuildingElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRampFlight (IfcEntityInstanceData* e);
@@ -38921,7 +38176,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 5: return Type::UNDEFINED; } return IfcBezierCurve::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 5: return "WeightsData"; } return IfcBezierCurve::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRationalBezierCurve (IfcEntityInstanceData* e);
@@ -38947,7 +38201,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcLabel; } return IfcBuildingElementComponent::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "SteelGrade"; } return IfcBuildingElementComponent::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcReinforcingElement (IfcEntityInstanceData* e);
@@ -39005,7 +38258,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcPositiveLengthMeasure; case 10: return Type::IfcPositiveLengthMeasure; case 11: return Type::IfcPositiveLengthMeasure; case 12: return Type::IfcPositiveLengthMeasure; case 13: return Type::IfcAreaMeasure; case 14: return Type::IfcAreaMeasure; case 15: return Type::IfcPositiveLengthMeasure; case 16: return Type::IfcPositiveLengthMeasure; } return IfcReinforcingElement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "MeshLength"; case 10: return "MeshWidth"; case 11: return "LongitudinalBarNominalDiameter"; case 12: return "TransverseBarNominalDiameter"; case 13: return "LongitudinalBarCrossSectionArea"; case 14: return "TransverseBarCrossSectionArea"; case 15: return "LongitudinalBarSpacing"; case 16: return "TransverseBarSpacing"; } return IfcReinforcingElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcReinforcingMesh (IfcEntityInstanceData* e);
@@ -39166,7 +38418,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcRoofTypeEnum; } return IfcBuildingElement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "ShapeType"; } return IfcBuildingElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRoof (IfcEntityInstanceData* e);
@@ -39185,7 +38436,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcPositiveLengthMeasure; } return IfcEdgeFeature::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "Radius"; } return IfcEdgeFeature::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRoundedEdgeFeature (IfcEntityInstanceData* e);
@@ -39250,7 +38500,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcSensorTypeEnum; } return IfcDistributionControlElementType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcDistributionControlElementType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcSensorType (IfcEntityInstanceData* e);
@@ -39532,7 +38781,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcSlabTypeEnum; } return IfcBuildingElement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "PredefinedType"; } return IfcBuildingElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcSlab (IfcEntityInstanceData* e);
@@ -39713,7 +38961,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcStairTypeEnum; } return IfcBuildingElement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "ShapeType"; } return IfcBuildingElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcStair (IfcEntityInstanceData* e);
@@ -39922,7 +39169,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::UNDEFINED; case 9: return Type::UNDEFINED; case 10: return Type::IfcPositiveLengthMeasure; case 11: return Type::IfcPositiveLengthMeasure; } return IfcBuildingElement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "NumberOfRiser"; case 9: return "NumberOfTreads"; case 10: return "RiserHeight"; case 11: return "TreadLength"; } return IfcBuildingElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcStairFlight (IfcEntityInstanceData* e);
@@ -39986,7 +39232,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 5: return Type::IfcAnalysisModelTypeEnum; case 6: return Type::IfcAxis2Placement3D; case 7: return Type::IfcStructuralLoadGroup; case 8: return Type::IfcStructuralResultGroup; } return IfcSystem::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 5: return "PredefinedType"; case 6: return "OrientationOf2DPlane"; case 7: return "LoadedBy"; case 8: return "HasResults"; } return IfcSystem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcStructuralAnalysisModel (IfcEntityInstanceData* e);
@@ -40027,7 +39272,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcTendonTypeEnum; case 10: return Type::IfcPositiveLengthMeasure; case 11: return Type::IfcAreaMeasure; case 12: return Type::IfcForceMeasure; case 13: return Type::IfcPressureMeasure; case 14: return Type::IfcNormalisedRatioMeasure; case 15: return Type::IfcPositiveLengthMeasure; case 16: return Type::IfcPositiveLengthMeasure; } return IfcReinforcingElement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; case 10: return "NominalDiameter"; case 11: return "CrossSectionArea"; case 12: return "TensionForce"; case 13: return "PreStress"; case 14: return "FrictionCoefficient"; case 15: return "AnchorageSlip"; case 16: return "MinCurvatureRadius"; } return IfcReinforcingElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcTendon (IfcEntityInstanceData* e);
@@ -40042,7 +39286,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcReinforcingElement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcReinforcingElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcTendonAnchor (IfcEntityInstanceData* e);
@@ -40081,7 +39324,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcVibrationIsolatorTypeEnum; } return IfcDiscreteAccessoryType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcDiscreteAccessoryType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcVibrationIsolatorType (IfcEntityInstanceData* e);
@@ -40337,7 +39579,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcBuildingElement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcBuildingElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcWall (IfcEntityInstanceData* e);
@@ -40553,7 +39794,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcWall::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcWall::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcWallStandardCase (IfcEntityInstanceData* e);
@@ -40939,7 +40179,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcPositiveLengthMeasure; case 9: return Type::IfcPositiveLengthMeasure; } return IfcBuildingElement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "OverallHeight"; case 9: return "OverallWidth"; } return IfcBuildingElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcWindow (IfcEntityInstanceData* e);
@@ -40987,7 +40226,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcActuatorTypeEnum; } return IfcDistributionControlElementType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcDistributionControlElementType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcActuatorType (IfcEntityInstanceData* e);
@@ -41030,7 +40268,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcAlarmTypeEnum; } return IfcDistributionControlElementType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcDistributionControlElementType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcAlarmType (IfcEntityInstanceData* e);
@@ -41281,7 +40518,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcBuildingElement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcBuildingElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcBeam (IfcEntityInstanceData* e);
@@ -41304,7 +40540,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcPositiveLengthMeasure; case 10: return Type::IfcPositiveLengthMeasure; } return IfcEdgeFeature::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "Width"; case 10: return "Height"; } return IfcEdgeFeature::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcChamferEdgeFeature (IfcEntityInstanceData* e);
@@ -41357,7 +40592,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcControllerTypeEnum; } return IfcDistributionControlElementType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcDistributionControlElementType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcControllerType (IfcEntityInstanceData* e);
@@ -41402,7 +40636,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcDistributionFlowElement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcDistributionFlowElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcDistributionChamberElement (IfcEntityInstanceData* e);
@@ -41499,7 +40732,6 @@ public:
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "ControlElementId"; } return IfcDistributionElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcRelFlowControlElements >::ptr AssignedToFlowElement() const; // INVERSE IfcRelFlowControlElements::RelatedControlElements
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcDistributionControlElement (IfcEntityInstanceData* e);
@@ -41520,7 +40752,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcElectricDistributionPointFunctionEnum; case 9: return Type::IfcLabel; } return IfcFlowController::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "DistributionPointFunction"; case 9: return "UserDefinedFunction"; } return IfcFlowController::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcElectricDistributionPoint (IfcEntityInstanceData* e);
@@ -41576,7 +40807,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcPositiveLengthMeasure; case 10: return Type::IfcAreaMeasure; case 11: return Type::IfcPositiveLengthMeasure; case 12: return Type::IfcReinforcingBarRoleEnum; case 13: return Type::IfcReinforcingBarSurfaceEnum; } return IfcReinforcingElement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "NominalDiameter"; case 10: return "CrossSectionArea"; case 11: return "BarLength"; case 12: return "BarRole"; case 13: return "BarSurface"; } return IfcReinforcingElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcReinforcingBar (IfcEntityInstanceData* e);
@@ -41584,8 +40814,7 @@ public:
     typedef IfcTemplatedEntityList< IfcReinforcingBar > list;
 };
 
-IFC_PARSE_API void InitStringMap();
-IFC_PARSE_API IfcUtil::IfcBaseClass* SchemaEntity(IfcEntityInstanceData* e = 0);
+IFC_PARSE_API IfcUtil::IfcBaseClass* SchemaEntity(IfcEntityInstanceData* e = 0, IfcParse::IfcArena* arena = 0);
 }
 
 #endif
@@ -5754,7 +5754,6 @@ class IFC_PARSE_API IfcAbsorbedDoseMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcAbsorbedDoseMeasure (IfcEntityInstanceData* e);
@@ -5770,7 +5769,6 @@ class IFC_PARSE_API IfcAccelerationMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcAccelerationMeasure (IfcEntityInstanceData* e);
@@ -5789,7 +5787,6 @@ class IFC_PARSE_API IfcAmountOfSubstanceMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcAmountOfSubstanceMeasure (IfcEntityInstanceData* e);
@@ -5805,7 +5802,6 @@ class IFC_PARSE_API IfcAngularVelocityMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcAngularVelocityMeasure (IfcEntityInstanceData* e);
@@ -5817,7 +5813,6 @@ class IFC_PARSE_API IfcArcIndex : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcArcIndex (IfcEntityInstanceData* e);
@@ -5829,7 +5824,6 @@ class IFC_PARSE_API IfcAreaDensityMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcAreaDensityMeasure (IfcEntityInstanceData* e);
@@ -5847,7 +5841,6 @@ class IFC_PARSE_API IfcAreaMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcAreaMeasure (IfcEntityInstanceData* e);
@@ -5859,7 +5852,6 @@ class IFC_PARSE_API IfcBinary : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcBinary (IfcEntityInstanceData* e);
@@ -5875,7 +5867,6 @@ class IFC_PARSE_API IfcBoolean : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcBoolean (IfcEntityInstanceData* e);
@@ -5929,7 +5920,6 @@ class IFC_PARSE_API IfcCardinalPointReference : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcCardinalPointReference (IfcEntityInstanceData* e);
@@ -5951,7 +5941,6 @@ class IFC_PARSE_API IfcComplexNumber : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcComplexNumber (IfcEntityInstanceData* e);
@@ -6010,7 +5999,6 @@ class IFC_PARSE_API IfcCompoundPlaneAngleMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcCompoundPlaneAngleMeasure (IfcEntityInstanceData* e);
@@ -6027,7 +6015,6 @@ class IFC_PARSE_API IfcContextDependentMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcContextDependentMeasure (IfcEntityInstanceData* e);
@@ -6044,7 +6031,6 @@ class IFC_PARSE_API IfcCountMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcCountMeasure (IfcEntityInstanceData* e);
@@ -6062,7 +6048,6 @@ class IFC_PARSE_API IfcCurvatureMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcCurvatureMeasure (IfcEntityInstanceData* e);
@@ -6079,7 +6064,6 @@ class IFC_PARSE_API IfcDate : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcDate (IfcEntityInstanceData* e);
@@ -6108,7 +6092,6 @@ class IFC_PARSE_API IfcDateTime : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcDateTime (IfcEntityInstanceData* e);
@@ -6131,7 +6114,6 @@ class IFC_PARSE_API IfcDayInMonthNumber : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcDayInMonthNumber (IfcEntityInstanceData* e);
@@ -6176,7 +6158,6 @@ class IFC_PARSE_API IfcDayInWeekNumber : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcDayInWeekNumber (IfcEntityInstanceData* e);
@@ -6193,7 +6174,6 @@ class IFC_PARSE_API IfcDescriptiveMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcDescriptiveMeasure (IfcEntityInstanceData* e);
@@ -6211,7 +6191,6 @@ class IFC_PARSE_API IfcDimensionCount : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcDimensionCount (IfcEntityInstanceData* e);
@@ -6227,7 +6206,6 @@ class IFC_PARSE_API IfcDoseEquivalentMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcDoseEquivalentMeasure (IfcEntityInstanceData* e);
@@ -6243,7 +6221,6 @@ class IFC_PARSE_API IfcDuration : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcDuration (IfcEntityInstanceData* e);
@@ -6260,7 +6237,6 @@ class IFC_PARSE_API IfcDynamicViscosityMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcDynamicViscosityMeasure (IfcEntityInstanceData* e);
@@ -6276,7 +6252,6 @@ class IFC_PARSE_API IfcElectricCapacitanceMeasure : public IfcUtil::IfcBaseType
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcElectricCapacitanceMeasure (IfcEntityInstanceData* e);
@@ -6292,7 +6267,6 @@ class IFC_PARSE_API IfcElectricChargeMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcElectricChargeMeasure (IfcEntityInstanceData* e);
@@ -6308,7 +6282,6 @@ class IFC_PARSE_API IfcElectricConductanceMeasure : public IfcUtil::IfcBaseType
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcElectricConductanceMeasure (IfcEntityInstanceData* e);
@@ -6326,7 +6299,6 @@ class IFC_PARSE_API IfcElectricCurrentMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcElectricCurrentMeasure (IfcEntityInstanceData* e);
@@ -6342,7 +6314,6 @@ class IFC_PARSE_API IfcElectricResistanceMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcElectricResistanceMeasure (IfcEntityInstanceData* e);
@@ -6358,7 +6329,6 @@ class IFC_PARSE_API IfcElectricVoltageMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcElectricVoltageMeasure (IfcEntityInstanceData* e);
@@ -6374,7 +6344,6 @@ class IFC_PARSE_API IfcEnergyMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcEnergyMeasure (IfcEntityInstanceData* e);
@@ -6399,7 +6368,6 @@ class IFC_PARSE_API IfcFontStyle : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcFontStyle (IfcEntityInstanceData* e);
@@ -6422,7 +6390,6 @@ class IFC_PARSE_API IfcFontVariant : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcFontVariant (IfcEntityInstanceData* e);
@@ -6456,7 +6423,6 @@ class IFC_PARSE_API IfcFontWeight : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcFontWeight (IfcEntityInstanceData* e);
@@ -6472,7 +6438,6 @@ class IFC_PARSE_API IfcForceMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcForceMeasure (IfcEntityInstanceData* e);
@@ -6488,7 +6453,6 @@ class IFC_PARSE_API IfcFrequencyMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcFrequencyMeasure (IfcEntityInstanceData* e);
@@ -6514,7 +6478,6 @@ class IFC_PARSE_API IfcGloballyUniqueId : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcGloballyUniqueId (IfcEntityInstanceData* e);
@@ -6530,7 +6493,6 @@ class IFC_PARSE_API IfcHeatFluxDensityMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcHeatFluxDensityMeasure (IfcEntityInstanceData* e);
@@ -6544,7 +6506,6 @@ class IFC_PARSE_API IfcHeatingValueMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcHeatingValueMeasure (IfcEntityInstanceData* e);
@@ -6569,7 +6530,6 @@ class IFC_PARSE_API IfcIdentifier : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcIdentifier (IfcEntityInstanceData* e);
@@ -6585,7 +6545,6 @@ class IFC_PARSE_API IfcIlluminanceMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcIlluminanceMeasure (IfcEntityInstanceData* e);
@@ -6601,7 +6560,6 @@ class IFC_PARSE_API IfcInductanceMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcInductanceMeasure (IfcEntityInstanceData* e);
@@ -6619,7 +6577,6 @@ class IFC_PARSE_API IfcInteger : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcInteger (IfcEntityInstanceData* e);
@@ -6637,7 +6594,6 @@ class IFC_PARSE_API IfcIntegerCountRateMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcIntegerCountRateMeasure (IfcEntityInstanceData* e);
@@ -6651,7 +6607,6 @@ class IFC_PARSE_API IfcIonConcentrationMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcIonConcentrationMeasure (IfcEntityInstanceData* e);
@@ -6667,7 +6622,6 @@ class IFC_PARSE_API IfcIsothermalMoistureCapacityMeasure : public IfcUtil::IfcBa
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcIsothermalMoistureCapacityMeasure (IfcEntityInstanceData* e);
@@ -6683,7 +6637,6 @@ class IFC_PARSE_API IfcKinematicViscosityMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcKinematicViscosityMeasure (IfcEntityInstanceData* e);
@@ -6708,7 +6661,6 @@ class IFC_PARSE_API IfcLabel : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcLabel (IfcEntityInstanceData* e);
@@ -6729,7 +6681,6 @@ class IFC_PARSE_API IfcLanguageId : public IfcIdentifier {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcLanguageId (IfcEntityInstanceData* e);
@@ -6747,7 +6698,6 @@ class IFC_PARSE_API IfcLengthMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcLengthMeasure (IfcEntityInstanceData* e);
@@ -6759,7 +6709,6 @@ class IFC_PARSE_API IfcLineIndex : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcLineIndex (IfcEntityInstanceData* e);
@@ -6775,7 +6724,6 @@ class IFC_PARSE_API IfcLinearForceMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcLinearForceMeasure (IfcEntityInstanceData* e);
@@ -6791,7 +6739,6 @@ class IFC_PARSE_API IfcLinearMomentMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcLinearMomentMeasure (IfcEntityInstanceData* e);
@@ -6807,7 +6754,6 @@ class IFC_PARSE_API IfcLinearStiffnessMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcLinearStiffnessMeasure (IfcEntityInstanceData* e);
@@ -6823,7 +6769,6 @@ class IFC_PARSE_API IfcLinearVelocityMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcLinearVelocityMeasure (IfcEntityInstanceData* e);
@@ -6839,7 +6784,6 @@ class IFC_PARSE_API IfcLogical : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcLogical (IfcEntityInstanceData* e);
@@ -6855,7 +6799,6 @@ class IFC_PARSE_API IfcLuminousFluxMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcLuminousFluxMeasure (IfcEntityInstanceData* e);
@@ -6873,7 +6816,6 @@ class IFC_PARSE_API IfcLuminousIntensityDistributionMeasure : public IfcUtil::If
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcLuminousIntensityDistributionMeasure (IfcEntityInstanceData* e);
@@ -6891,7 +6833,6 @@ class IFC_PARSE_API IfcLuminousIntensityMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcLuminousIntensityMeasure (IfcEntityInstanceData* e);
@@ -6907,7 +6848,6 @@ class IFC_PARSE_API IfcMagneticFluxDensityMeasure : public IfcUtil::IfcBaseType
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcMagneticFluxDensityMeasure (IfcEntityInstanceData* e);
@@ -6923,7 +6863,6 @@ class IFC_PARSE_API IfcMagneticFluxMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcMagneticFluxMeasure (IfcEntityInstanceData* e);
@@ -6939,7 +6878,6 @@ class IFC_PARSE_API IfcMassDensityMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcMassDensityMeasure (IfcEntityInstanceData* e);
@@ -6955,7 +6893,6 @@ class IFC_PARSE_API IfcMassFlowRateMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcMassFlowRateMeasure (IfcEntityInstanceData* e);
@@ -6973,7 +6910,6 @@ class IFC_PARSE_API IfcMassMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcMassMeasure (IfcEntityInstanceData* e);
@@ -6991,7 +6927,6 @@ class IFC_PARSE_API IfcMassPerLengthMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcMassPerLengthMeasure (IfcEntityInstanceData* e);
@@ -7007,7 +6942,6 @@ class IFC_PARSE_API IfcModulusOfElasticityMeasure : public IfcUtil::IfcBaseType
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcModulusOfElasticityMeasure (IfcEntityInstanceData* e);
@@ -7023,7 +6957,6 @@ class IFC_PARSE_API IfcModulusOfLinearSubgradeReactionMeasure : public IfcUtil::
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcModulusOfLinearSubgradeReactionMeasure (IfcEntityInstanceData* e);
@@ -7039,7 +6972,6 @@ class IFC_PARSE_API IfcModulusOfRotationalSubgradeReactionMeasure : public IfcUt
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcModulusOfRotationalSubgradeReactionMeasure (IfcEntityInstanceData* e);
@@ -7059,7 +6991,6 @@ class IFC_PARSE_API IfcModulusOfSubgradeReactionMeasure : public IfcUtil::IfcBas
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcModulusOfSubgradeReactionMeasure (IfcEntityInstanceData* e);
@@ -7075,7 +7006,6 @@ class IFC_PARSE_API IfcMoistureDiffusivityMeasure : public IfcUtil::IfcBaseType
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcMoistureDiffusivityMeasure (IfcEntityInstanceData* e);
@@ -7091,7 +7021,6 @@ class IFC_PARSE_API IfcMolecularWeightMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcMolecularWeightMeasure (IfcEntityInstanceData* e);
@@ -7107,7 +7036,6 @@ class IFC_PARSE_API IfcMomentOfInertiaMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcMomentOfInertiaMeasure (IfcEntityInstanceData* e);
@@ -7122,7 +7050,6 @@ class IFC_PARSE_API IfcMonetaryMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcMonetaryMeasure (IfcEntityInstanceData* e);
@@ -7189,7 +7116,6 @@ class IFC_PARSE_API IfcMonthInYearNumber : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcMonthInYearNumber (IfcEntityInstanceData* e);
@@ -7205,7 +7131,6 @@ class IFC_PARSE_API IfcNonNegativeLengthMeasure : public IfcLengthMeasure {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcNonNegativeLengthMeasure (IfcEntityInstanceData* e);
@@ -7222,7 +7147,6 @@ class IFC_PARSE_API IfcNumericMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcNumericMeasure (IfcEntityInstanceData* e);
@@ -7236,7 +7160,6 @@ class IFC_PARSE_API IfcPHMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcPHMeasure (IfcEntityInstanceData* e);
@@ -7254,7 +7177,6 @@ class IFC_PARSE_API IfcParameterValue : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcParameterValue (IfcEntityInstanceData* e);
@@ -7270,7 +7192,6 @@ class IFC_PARSE_API IfcPlanarForceMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcPlanarForceMeasure (IfcEntityInstanceData* e);
@@ -7292,7 +7213,6 @@ class IFC_PARSE_API IfcPlaneAngleMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcPlaneAngleMeasure (IfcEntityInstanceData* e);
@@ -7304,7 +7224,6 @@ class IFC_PARSE_API IfcPositiveInteger : public IfcInteger {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcPositiveInteger (IfcEntityInstanceData* e);
@@ -7321,7 +7240,6 @@ class IFC_PARSE_API IfcPositiveLengthMeasure : public IfcLengthMeasure {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcPositiveLengthMeasure (IfcEntityInstanceData* e);
@@ -7338,7 +7256,6 @@ class IFC_PARSE_API IfcPositivePlaneAngleMeasure : public IfcPlaneAngleMeasure {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcPositivePlaneAngleMeasure (IfcEntityInstanceData* e);
@@ -7354,7 +7271,6 @@ class IFC_PARSE_API IfcPowerMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcPowerMeasure (IfcEntityInstanceData* e);
@@ -7374,7 +7290,6 @@ class IFC_PARSE_API IfcPresentableText : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcPresentableText (IfcEntityInstanceData* e);
@@ -7390,7 +7305,6 @@ class IFC_PARSE_API IfcPressureMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcPressureMeasure (IfcEntityInstanceData* e);
@@ -7402,7 +7316,6 @@ class IFC_PARSE_API IfcPropertySetDefinitionSet : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcPropertySetDefinitionSet (IfcEntityInstanceData* e);
@@ -7418,7 +7331,6 @@ class IFC_PARSE_API IfcRadioActivityMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcRadioActivityMeasure (IfcEntityInstanceData* e);
@@ -7439,7 +7351,6 @@ class IFC_PARSE_API IfcRatioMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcRatioMeasure (IfcEntityInstanceData* e);
@@ -7457,7 +7368,6 @@ class IFC_PARSE_API IfcReal : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcReal (IfcEntityInstanceData* e);
@@ -7473,7 +7383,6 @@ class IFC_PARSE_API IfcRotationalFrequencyMeasure : public IfcUtil::IfcBaseType
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcRotationalFrequencyMeasure (IfcEntityInstanceData* e);
@@ -7490,7 +7399,6 @@ class IFC_PARSE_API IfcRotationalMassMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcRotationalMassMeasure (IfcEntityInstanceData* e);
@@ -7506,7 +7414,6 @@ class IFC_PARSE_API IfcRotationalStiffnessMeasure : public IfcUtil::IfcBaseType
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcRotationalStiffnessMeasure (IfcEntityInstanceData* e);
@@ -7522,7 +7429,6 @@ class IFC_PARSE_API IfcSectionModulusMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcSectionModulusMeasure (IfcEntityInstanceData* e);
@@ -7538,7 +7444,6 @@ class IFC_PARSE_API IfcSectionalAreaIntegralMeasure : public IfcUtil::IfcBaseTyp
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcSectionalAreaIntegralMeasure (IfcEntityInstanceData* e);
@@ -7554,7 +7459,6 @@ class IFC_PARSE_API IfcShearModulusMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcShearModulusMeasure (IfcEntityInstanceData* e);
@@ -7572,7 +7476,6 @@ class IFC_PARSE_API IfcSolidAngleMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcSolidAngleMeasure (IfcEntityInstanceData* e);
@@ -7584,7 +7487,6 @@ class IFC_PARSE_API IfcSoundPowerLevelMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcSoundPowerLevelMeasure (IfcEntityInstanceData* e);
@@ -7600,7 +7502,6 @@ class IFC_PARSE_API IfcSoundPowerMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcSoundPowerMeasure (IfcEntityInstanceData* e);
@@ -7612,7 +7513,6 @@ class IFC_PARSE_API IfcSoundPressureLevelMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcSoundPressureLevelMeasure (IfcEntityInstanceData* e);
@@ -7628,7 +7528,6 @@ class IFC_PARSE_API IfcSoundPressureMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcSoundPressureMeasure (IfcEntityInstanceData* e);
@@ -7644,7 +7543,6 @@ class IFC_PARSE_API IfcSpecificHeatCapacityMeasure : public IfcUtil::IfcBaseType
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcSpecificHeatCapacityMeasure (IfcEntityInstanceData* e);
@@ -7662,7 +7560,6 @@ class IFC_PARSE_API IfcSpecularExponent : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcSpecularExponent (IfcEntityInstanceData* e);
@@ -7682,7 +7579,6 @@ class IFC_PARSE_API IfcSpecularRoughness : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcSpecularRoughness (IfcEntityInstanceData* e);
@@ -7698,7 +7594,6 @@ class IFC_PARSE_API IfcTemperatureGradientMeasure : public IfcUtil::IfcBaseType
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcTemperatureGradientMeasure (IfcEntityInstanceData* e);
@@ -7714,7 +7609,6 @@ class IFC_PARSE_API IfcTemperatureRateOfChangeMeasure : public IfcUtil::IfcBaseT
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcTemperatureRateOfChangeMeasure (IfcEntityInstanceData* e);
@@ -7736,7 +7630,6 @@ class IFC_PARSE_API IfcText : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcText (IfcEntityInstanceData* e);
@@ -7757,7 +7650,6 @@ class IFC_PARSE_API IfcTextAlignment : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcTextAlignment (IfcEntityInstanceData* e);
@@ -7781,7 +7673,6 @@ class IFC_PARSE_API IfcTextDecoration : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcTextDecoration (IfcEntityInstanceData* e);
@@ -7811,7 +7702,6 @@ class IFC_PARSE_API IfcTextFontName : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcTextFontName (IfcEntityInstanceData* e);
@@ -7832,7 +7722,6 @@ class IFC_PARSE_API IfcTextTransformation : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcTextTransformation (IfcEntityInstanceData* e);
@@ -7848,7 +7737,6 @@ class IFC_PARSE_API IfcThermalAdmittanceMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcThermalAdmittanceMeasure (IfcEntityInstanceData* e);
@@ -7864,7 +7752,6 @@ class IFC_PARSE_API IfcThermalConductivityMeasure : public IfcUtil::IfcBaseType
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcThermalConductivityMeasure (IfcEntityInstanceData* e);
@@ -7879,7 +7766,6 @@ class IFC_PARSE_API IfcThermalExpansionCoefficientMeasure : public IfcUtil::IfcB
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcThermalExpansionCoefficientMeasure (IfcEntityInstanceData* e);
@@ -7894,7 +7780,6 @@ class IFC_PARSE_API IfcThermalResistanceMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcThermalResistanceMeasure (IfcEntityInstanceData* e);
@@ -7910,7 +7795,6 @@ class IFC_PARSE_API IfcThermalTransmittanceMeasure : public IfcUtil::IfcBaseType
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcThermalTransmittanceMeasure (IfcEntityInstanceData* e);
@@ -7928,7 +7812,6 @@ class IFC_PARSE_API IfcThermodynamicTemperatureMeasure : public IfcUtil::IfcBase
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcThermodynamicTemperatureMeasure (IfcEntityInstanceData* e);
@@ -7947,7 +7830,6 @@ class IFC_PARSE_API IfcTime : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcTime (IfcEntityInstanceData* e);
@@ -7965,7 +7847,6 @@ class IFC_PARSE_API IfcTimeMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcTimeMeasure (IfcEntityInstanceData* e);
@@ -7980,7 +7861,6 @@ class IFC_PARSE_API IfcTimeStamp : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcTimeStamp (IfcEntityInstanceData* e);
@@ -7996,7 +7876,6 @@ class IFC_PARSE_API IfcTorqueMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcTorqueMeasure (IfcEntityInstanceData* e);
@@ -8014,7 +7893,6 @@ class IFC_PARSE_API IfcURIReference : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcURIReference (IfcEntityInstanceData* e);
@@ -8030,7 +7908,6 @@ class IFC_PARSE_API IfcVaporPermeabilityMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcVaporPermeabilityMeasure (IfcEntityInstanceData* e);
@@ -8048,7 +7925,6 @@ class IFC_PARSE_API IfcVolumeMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcVolumeMeasure (IfcEntityInstanceData* e);
@@ -8064,7 +7940,6 @@ class IFC_PARSE_API IfcVolumetricFlowRateMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcVolumetricFlowRateMeasure (IfcEntityInstanceData* e);
@@ -8080,7 +7955,6 @@ class IFC_PARSE_API IfcWarpingConstantMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcWarpingConstantMeasure (IfcEntityInstanceData* e);
@@ -8096,7 +7970,6 @@ class IFC_PARSE_API IfcWarpingMomentMeasure : public IfcUtil::IfcBaseType {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcWarpingMomentMeasure (IfcEntityInstanceData* e);
@@ -8132,7 +8005,6 @@ class IFC_PARSE_API IfcBoxAlignment : public IfcLabel {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcBoxAlignment (IfcEntityInstanceData* e);
@@ -8148,7 +8020,6 @@ class IFC_PARSE_API IfcNormalisedRatioMeasure : public IfcRatioMeasure {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcNormalisedRatioMeasure (IfcEntityInstanceData* e);
@@ -8165,7 +8036,6 @@ class IFC_PARSE_API IfcPositiveRatioMeasure : public IfcRatioMeasure {
 public:
     virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const;
     virtual Argument* getArgument(unsigned int i) const;
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     explicit IfcPositiveRatioMeasure (IfcEntityInstanceData* e);
@@ -8209,7 +8079,6 @@ public:
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Role"; case 1: return "UserDefinedRole"; case 2: return "Description"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcExternalReferenceRelationship >::ptr HasExternalReference() const; // INVERSE IfcExternalReferenceRelationship::RelatedResourceObjects
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcActorRole (IfcEntityInstanceData* e);
@@ -8248,7 +8117,6 @@ public:
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcPerson >::ptr OfPerson() const; // INVERSE IfcPerson::Addresses
     IfcTemplatedEntityList< IfcOrganization >::ptr OfOrganization() const; // INVERSE IfcOrganization::Addresses
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcAddress (IfcEntityInstanceData* e);
@@ -8277,7 +8145,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcOrganization; case 1: return Type::IfcLabel; case 2: return Type::IfcLabel; case 3: return Type::IfcIdentifier; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "ApplicationDeveloper"; case 1: return "Version"; case 2: return "ApplicationFullName"; case 3: return "ApplicationIdentifier"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcApplication (IfcEntityInstanceData* e);
@@ -8360,7 +8227,6 @@ public:
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Name"; case 1: return "Description"; case 2: return "AppliedValue"; case 3: return "UnitBasis"; case 4: return "ApplicableDate"; case 5: return "FixedUntilDate"; case 6: return "Category"; case 7: return "Condition"; case 8: return "ArithmeticOperator"; case 9: return "Components"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcExternalReferenceRelationship >::ptr HasExternalReference() const; // INVERSE IfcExternalReferenceRelationship::RelatedResourceObjects
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcAppliedValue (IfcEntityInstanceData* e);
@@ -8435,7 +8301,6 @@ public:
     IfcTemplatedEntityList< IfcResourceApprovalRelationship >::ptr ApprovedResources() const; // INVERSE IfcResourceApprovalRelationship::RelatingApproval
     IfcTemplatedEntityList< IfcApprovalRelationship >::ptr IsRelatedWith() const; // INVERSE IfcApprovalRelationship::RelatedApprovals
     IfcTemplatedEntityList< IfcApprovalRelationship >::ptr Relates() const; // INVERSE IfcApprovalRelationship::RelatingApproval
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcApproval (IfcEntityInstanceData* e);
@@ -8469,7 +8334,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcLabel; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Name"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcBoundaryCondition (IfcEntityInstanceData* e);
@@ -8523,7 +8387,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 1: return Type::IfcModulusOfTranslationalSubgradeReactionSelect; case 2: return Type::IfcModulusOfTranslationalSubgradeReactionSelect; case 3: return Type::IfcModulusOfTranslationalSubgradeReactionSelect; case 4: return Type::IfcModulusOfRotationalSubgradeReactionSelect; case 5: return Type::IfcModulusOfRotationalSubgradeReactionSelect; case 6: return Type::IfcModulusOfRotationalSubgradeReactionSelect; } return IfcBoundaryCondition::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 1: return "TranslationalStiffnessByLengthX"; case 2: return "TranslationalStiffnessByLengthY"; case 3: return "TranslationalStiffnessByLengthZ"; case 4: return "RotationalStiffnessByLengthX"; case 5: return "RotationalStiffnessByLengthY"; case 6: return "RotationalStiffnessByLengthZ"; } return IfcBoundaryCondition::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcBoundaryEdgeCondition (IfcEntityInstanceData* e);
@@ -8562,7 +8425,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 1: return Type::IfcModulusOfSubgradeReactionSelect; case 2: return Type::IfcModulusOfSubgradeReactionSelect; case 3: return Type::IfcModulusOfSubgradeReactionSelect; } return IfcBoundaryCondition::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 1: return "TranslationalStiffnessByAreaX"; case 2: return "TranslationalStiffnessByAreaY"; case 3: return "TranslationalStiffnessByAreaZ"; } return IfcBoundaryCondition::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcBoundaryFaceCondition (IfcEntityInstanceData* e);
@@ -8616,7 +8478,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 1: return Type::IfcTranslationalStiffnessSelect; case 2: return Type::IfcTranslationalStiffnessSelect; case 3: return Type::IfcTranslationalStiffnessSelect; case 4: return Type::IfcRotationalStiffnessSelect; case 5: return Type::IfcRotationalStiffnessSelect; case 6: return Type::IfcRotationalStiffnessSelect; } return IfcBoundaryCondition::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 1: return "TranslationalStiffnessX"; case 2: return "TranslationalStiffnessY"; case 3: return "TranslationalStiffnessZ"; case 4: return "RotationalStiffnessX"; case 5: return "RotationalStiffnessY"; case 6: return "RotationalStiffnessZ"; } return IfcBoundaryCondition::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcBoundaryNodeCondition (IfcEntityInstanceData* e);
@@ -8644,7 +8505,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 7: return Type::IfcWarpingStiffnessSelect; } return IfcBoundaryNodeCondition::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 7: return "WarpingStiffness"; } return IfcBoundaryNodeCondition::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcBoundaryNodeConditionWarping (IfcEntityInstanceData* e);
@@ -8672,7 +8532,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcConnectionGeometry (IfcEntityInstanceData* e);
@@ -8710,7 +8569,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcPointOrVertexPoint; case 1: return Type::IfcPointOrVertexPoint; } return IfcConnectionGeometry::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "PointOnRelatingElement"; case 1: return "PointOnRelatedElement"; } return IfcConnectionGeometry::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcConnectionPointGeometry (IfcEntityInstanceData* e);
@@ -8740,7 +8598,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcSurfaceOrFaceSurface; case 1: return Type::IfcSurfaceOrFaceSurface; } return IfcConnectionGeometry::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "SurfaceOnRelatingElement"; case 1: return "SurfaceOnRelatedElement"; } return IfcConnectionGeometry::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcConnectionSurfaceGeometry (IfcEntityInstanceData* e);
@@ -8768,7 +8625,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcSolidOrShell; case 1: return Type::IfcSolidOrShell; } return IfcConnectionGeometry::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "VolumeOnRelatingElement"; case 1: return "VolumeOnRelatedElement"; } return IfcConnectionGeometry::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcConnectionVolumeGeometry (IfcEntityInstanceData* e);
@@ -8830,7 +8686,6 @@ public:
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcExternalReferenceRelationship >::ptr HasExternalReferences() const; // INVERSE IfcExternalReferenceRelationship::RelatedResourceObjects
     IfcTemplatedEntityList< IfcResourceConstraintRelationship >::ptr PropertiesForConstraint() const; // INVERSE IfcResourceConstraintRelationship::RelatingConstraint
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcConstraint (IfcEntityInstanceData* e);
@@ -8896,7 +8751,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcCoordinateReferenceSystemSelect; case 1: return Type::IfcCoordinateReferenceSystem; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "SourceCRS"; case 1: return "TargetCRS"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcCoordinateOperation (IfcEntityInstanceData* e);
@@ -8959,7 +8813,6 @@ public:
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Name"; case 1: return "Description"; case 2: return "GeodeticDatum"; case 3: return "VerticalDatum"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcCoordinateOperation >::ptr HasCoordinateOperation() const; // INVERSE IfcCoordinateOperation::SourceCRS
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcCoordinateReferenceSystem (IfcEntityInstanceData* e);
@@ -9015,7 +8868,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcAppliedValue::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcAppliedValue::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcCostValue (IfcEntityInstanceData* e);
@@ -9046,7 +8898,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcDerivedUnitElement; case 1: return Type::IfcDerivedUnitEnum; case 2: return Type::IfcLabel; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Elements"; case 1: return "UnitType"; case 2: return "UserDefinedType"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcDerivedUnit (IfcEntityInstanceData* e);
@@ -9075,7 +8926,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcNamedUnit; case 1: return Type::UNDEFINED; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Unit"; case 1: return "Exponent"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcDerivedUnitElement (IfcEntityInstanceData* e);
@@ -9127,7 +8977,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::UNDEFINED; case 1: return Type::UNDEFINED; case 2: return Type::UNDEFINED; case 3: return Type::UNDEFINED; case 4: return Type::UNDEFINED; case 5: return Type::UNDEFINED; case 6: return Type::UNDEFINED; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "LengthExponent"; case 1: return "MassExponent"; case 2: return "TimeExponent"; case 3: return "ElectricCurrentExponent"; case 4: return "ThermodynamicTemperatureExponent"; case 5: return "AmountOfSubstanceExponent"; case 6: return "LuminousIntensityExponent"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcDimensionalExponents (IfcEntityInstanceData* e);
@@ -9147,7 +8996,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcExternalInformation (IfcEntityInstanceData* e);
@@ -9196,7 +9044,6 @@ public:
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Location"; case 1: return "Identification"; case 2: return "Name"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcExternalReferenceRelationship >::ptr ExternalReferenceForResources() const; // INVERSE IfcExternalReferenceRelationship::RelatingReference
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcExternalReference (IfcEntityInstanceData* e);
@@ -9218,7 +9065,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcExternalReference::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcExternalReference::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcExternallyDefinedHatchStyle (IfcEntityInstanceData* e);
@@ -9239,7 +9085,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcExternalReference::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcExternalReference::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcExternallyDefinedSurfaceStyle (IfcEntityInstanceData* e);
@@ -9260,7 +9105,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcExternalReference::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcExternalReference::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcExternallyDefinedTextFont (IfcEntityInstanceData* e);
@@ -9312,7 +9156,6 @@ public:
     IfcTemplatedEntityList< IfcGrid >::ptr PartOfV() const; // INVERSE IfcGrid::VAxes
     IfcTemplatedEntityList< IfcGrid >::ptr PartOfU() const; // INVERSE IfcGrid::UAxes
     IfcTemplatedEntityList< IfcVirtualGridIntersection >::ptr HasIntersections() const; // INVERSE IfcVirtualGridIntersection::IntersectingAxes
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcGridAxis (IfcEntityInstanceData* e);
@@ -9335,7 +9178,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcDateTime; case 1: return Type::IfcValue; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "TimeStamp"; case 1: return "ListValues"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcIrregularTimeSeriesValue (IfcEntityInstanceData* e);
@@ -9390,7 +9232,6 @@ public:
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcRelAssociatesLibrary >::ptr LibraryInfoForObjects() const; // INVERSE IfcRelAssociatesLibrary::RelatingLibrary
     IfcTemplatedEntityList< IfcLibraryReference >::ptr HasLibraryReferences() const; // INVERSE IfcLibraryReference::ReferencedLibrary
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcLibraryInformation (IfcEntityInstanceData* e);
@@ -9431,7 +9272,6 @@ public:
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 3: return "Description"; case 4: return "Language"; case 5: return "ReferencedLibrary"; } return IfcExternalReference::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcRelAssociatesLibrary >::ptr LibraryRefForObjects() const; // INVERSE IfcRelAssociatesLibrary::RelatingLibrary
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcLibraryReference (IfcEntityInstanceData* e);
@@ -9471,7 +9311,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcPlaneAngleMeasure; case 1: return Type::IfcPlaneAngleMeasure; case 2: return Type::IfcLuminousIntensityDistributionMeasure; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "MainPlaneAngle"; case 1: return "SecondaryPlaneAngle"; case 2: return "LuminousIntensity"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcLightDistributionData (IfcEntityInstanceData* e);
@@ -9494,7 +9333,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcLightDistributionCurveEnum; case 1: return Type::IfcLightDistributionData; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "LightDistributionCurve"; case 1: return "DistributionData"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcLightIntensityDistribution (IfcEntityInstanceData* e);
@@ -9550,7 +9388,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 2: return Type::IfcLengthMeasure; case 3: return Type::IfcLengthMeasure; case 4: return Type::IfcLengthMeasure; case 5: return Type::IfcReal; case 6: return Type::IfcReal; case 7: return Type::IfcReal; } return IfcCoordinateOperation::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 2: return "Eastings"; case 3: return "Northings"; case 4: return "OrthogonalHeight"; case 5: return "XAxisAbscissa"; case 6: return "XAxisOrdinate"; case 7: return "Scale"; } return IfcCoordinateOperation::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcMapConversion (IfcEntityInstanceData* e);
@@ -9575,7 +9412,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcClassificationSelect; case 1: return Type::IfcMaterial; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "MaterialClassifications"; case 1: return "ClassifiedMaterial"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcMaterialClassificationRelationship (IfcEntityInstanceData* e);
@@ -9616,7 +9452,6 @@ public:
     IfcTemplatedEntityList< IfcRelAssociatesMaterial >::ptr AssociatedTo() const; // INVERSE IfcRelAssociatesMaterial::RelatingMaterial
     IfcTemplatedEntityList< IfcExternalReferenceRelationship >::ptr HasExternalReferences() const; // INVERSE IfcExternalReferenceRelationship::RelatedResourceObjects
     IfcTemplatedEntityList< IfcMaterialProperties >::ptr HasProperties() const; // INVERSE IfcMaterialProperties::Material
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcMaterialDefinition (IfcEntityInstanceData* e);
@@ -9695,7 +9530,6 @@ public:
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Material"; case 1: return "LayerThickness"; case 2: return "IsVentilated"; case 3: return "Name"; case 4: return "Description"; case 5: return "Category"; case 6: return "Priority"; } return IfcMaterialDefinition::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcMaterialLayerSet >::ptr ToMaterialLayerSet() const; // INVERSE IfcMaterialLayerSet::MaterialLayers
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcMaterialLayer (IfcEntityInstanceData* e);
@@ -9757,7 +9591,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcMaterialLayer; case 1: return Type::IfcLabel; case 2: return Type::IfcText; } return IfcMaterialDefinition::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "MaterialLayers"; case 1: return "LayerSetName"; case 2: return "Description"; } return IfcMaterialDefinition::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcMaterialLayerSet (IfcEntityInstanceData* e);
@@ -9820,7 +9653,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 7: return Type::IfcLayerSetDirectionEnum; case 8: return Type::IfcLengthMeasure; } return IfcMaterialLayer::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 7: return "OffsetDirection"; case 8: return "OffsetValues"; } return IfcMaterialLayer::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcMaterialLayerWithOffsets (IfcEntityInstanceData* e);
@@ -9854,7 +9686,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcMaterial; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Materials"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcMaterialList (IfcEntityInstanceData* e);
@@ -9902,7 +9733,6 @@ public:
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Name"; case 1: return "Description"; case 2: return "Material"; case 3: return "Profile"; case 4: return "Priority"; case 5: return "Category"; } return IfcMaterialDefinition::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcMaterialProfileSet >::ptr ToMaterialProfileSet() const; // INVERSE IfcMaterialProfileSet::MaterialProfiles
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcMaterialProfile (IfcEntityInstanceData* e);
@@ -9942,7 +9772,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcLabel; case 1: return Type::IfcText; case 2: return Type::IfcMaterialProfile; case 3: return Type::IfcCompositeProfileDef; } return IfcMaterialDefinition::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Name"; case 1: return "Description"; case 2: return "MaterialProfiles"; case 3: return "CompositeProfile"; } return IfcMaterialDefinition::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcMaterialProfileSet (IfcEntityInstanceData* e);
@@ -9964,7 +9793,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 6: return Type::IfcLengthMeasure; } return IfcMaterialProfile::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 6: return "OffsetValues"; } return IfcMaterialProfile::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcMaterialProfileWithOffsets (IfcEntityInstanceData* e);
@@ -10010,7 +9838,6 @@ public:
     virtual const char* getArgumentName(unsigned int i) const { (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcRelAssociatesMaterial >::ptr AssociatedTo() const; // INVERSE IfcRelAssociatesMaterial::RelatingMaterial
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcMaterialUsageDefinition (IfcEntityInstanceData* e);
@@ -10040,7 +9867,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcValue; case 1: return Type::IfcUnit; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "ValueComponent"; case 1: return "UnitComponent"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcMeasureWithUnit (IfcEntityInstanceData* e);
@@ -10123,7 +9949,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 7: return Type::IfcBenchmarkEnum; case 8: return Type::IfcLabel; case 9: return Type::IfcMetricValueSelect; case 10: return Type::IfcReference; } return IfcConstraint::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 7: return "Benchmark"; case 8: return "ValueSource"; case 9: return "DataValue"; case 10: return "ReferencePath"; } return IfcConstraint::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcMetric (IfcEntityInstanceData* e);
@@ -10145,7 +9970,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcLabel; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Currency"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcMonetaryUnit (IfcEntityInstanceData* e);
@@ -10170,7 +9994,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcDimensionalExponents; case 1: return Type::IfcUnitEnum; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Dimensions"; case 1: return "UnitType"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcNamedUnit (IfcEntityInstanceData* e);
@@ -10197,7 +10020,6 @@ public:
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcProduct >::ptr PlacesObject() const; // INVERSE IfcProduct::ObjectPlacement
     IfcTemplatedEntityList< IfcLocalPlacement >::ptr ReferencedByPlacements() const; // INVERSE IfcLocalPlacement::PlacementRelTo
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcObjectPlacement (IfcEntityInstanceData* e);
@@ -10237,7 +10059,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 7: return Type::IfcConstraint; case 8: return Type::IfcLogicalOperatorEnum; case 9: return Type::IfcObjectiveEnum; case 10: return Type::IfcLabel; } return IfcConstraint::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 7: return "BenchmarkValues"; case 8: return "LogicalAggregator"; case 9: return "ObjectiveQualifier"; case 10: return "UserDefinedQualifier"; } return IfcConstraint::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcObjective (IfcEntityInstanceData* e);
@@ -10286,7 +10107,6 @@ public:
     IfcTemplatedEntityList< IfcOrganizationRelationship >::ptr IsRelatedBy() const; // INVERSE IfcOrganizationRelationship::RelatedOrganizations
     IfcTemplatedEntityList< IfcOrganizationRelationship >::ptr Relates() const; // INVERSE IfcOrganizationRelationship::RelatingOrganization
     IfcTemplatedEntityList< IfcPersonAndOrganization >::ptr Engages() const; // INVERSE IfcPersonAndOrganization::TheOrganization
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcOrganization (IfcEntityInstanceData* e);
@@ -10344,7 +10164,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcPersonAndOrganization; case 1: return Type::IfcApplication; case 2: return Type::IfcStateEnum; case 3: return Type::IfcChangeActionEnum; case 4: return Type::IfcTimeStamp; case 5: return Type::IfcPersonAndOrganization; case 6: return Type::IfcApplication; case 7: return Type::IfcTimeStamp; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "OwningUser"; case 1: return "OwningApplication"; case 2: return "State"; case 3: return "ChangeAction"; case 4: return "LastModifiedDate"; case 5: return "LastModifyingUser"; case 6: return "LastModifyingApplication"; case 7: return "CreationDate"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcOwnerHistory (IfcEntityInstanceData* e);
@@ -10414,7 +10233,6 @@ public:
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Identification"; case 1: return "FamilyName"; case 2: return "GivenName"; case 3: return "MiddleNames"; case 4: return "PrefixTitles"; case 5: return "SuffixTitles"; case 6: return "Roles"; case 7: return "Addresses"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcPersonAndOrganization >::ptr EngagedIn() const; // INVERSE IfcPersonAndOrganization::ThePerson
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPerson (IfcEntityInstanceData* e);
@@ -10444,7 +10262,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcPerson; case 1: return Type::IfcOrganization; case 2: return Type::IfcActorRole; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "ThePerson"; case 1: return "TheOrganization"; case 2: return "Roles"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPersonAndOrganization (IfcEntityInstanceData* e);
@@ -10473,7 +10290,6 @@ public:
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcExternalReferenceRelationship >::ptr HasExternalReferences() const; // INVERSE IfcExternalReferenceRelationship::RelatedResourceObjects
     IfcTemplatedEntityList< IfcPhysicalComplexQuantity >::ptr PartOfComplex() const; // INVERSE IfcPhysicalComplexQuantity::HasQuantities
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPhysicalQuantity (IfcEntityInstanceData* e);
@@ -10501,7 +10317,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 2: return Type::IfcNamedUnit; } return IfcPhysicalQuantity::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 2: return "Unit"; } return IfcPhysicalQuantity::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPhysicalSimpleQuantity (IfcEntityInstanceData* e);
@@ -10559,7 +10374,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 3: return Type::IfcLabel; case 4: return Type::IfcLabel; case 5: return Type::IfcLabel; case 6: return Type::IfcLabel; case 7: return Type::IfcLabel; case 8: return Type::IfcLabel; case 9: return Type::IfcLabel; } return IfcAddress::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 3: return "InternalLocation"; case 4: return "AddressLines"; case 5: return "PostalBox"; case 6: return "Town"; case 7: return "Region"; case 8: return "PostalCode"; case 9: return "Country"; } return IfcAddress::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPostalAddress (IfcEntityInstanceData* e);
@@ -10574,7 +10388,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPresentationItem (IfcEntityInstanceData* e);
@@ -10619,7 +10432,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcLabel; case 1: return Type::IfcText; case 2: return Type::IfcLayeredItem; case 3: return Type::IfcIdentifier; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Name"; case 1: return "Description"; case 2: return "AssignedItems"; case 3: return "Identifier"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPresentationLayerAssignment (IfcEntityInstanceData* e);
@@ -10662,7 +10474,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 4: return Type::IfcLogical; case 5: return Type::IfcLogical; case 6: return Type::IfcLogical; case 7: return Type::IfcPresentationStyle; } return IfcPresentationLayerAssignment::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 4: return "LayerOn"; case 5: return "LayerFrozen"; case 6: return "LayerBlocked"; case 7: return "LayerStyles"; } return IfcPresentationLayerAssignment::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPresentationLayerWithStyle (IfcEntityInstanceData* e);
@@ -10686,7 +10497,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcLabel; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Name"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPresentationStyle (IfcEntityInstanceData* e);
@@ -10708,7 +10518,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcPresentationStyleSelect; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Styles"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPresentationStyleAssignment (IfcEntityInstanceData* e);
@@ -10752,7 +10561,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcLabel; case 1: return Type::IfcText; case 2: return Type::IfcRepresentation; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Name"; case 1: return "Description"; case 2: return "Representations"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcProductRepresentation (IfcEntityInstanceData* e);
@@ -10946,7 +10754,6 @@ public:
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcExternalReferenceRelationship >::ptr HasExternalReference() const; // INVERSE IfcExternalReferenceRelationship::RelatedResourceObjects
     IfcTemplatedEntityList< IfcProfileProperties >::ptr HasProperties() const; // INVERSE IfcProfileProperties::ProfileDefinition
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcProfileDef (IfcEntityInstanceData* e);
@@ -11005,7 +10812,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 4: return Type::IfcIdentifier; case 5: return Type::IfcIdentifier; case 6: return Type::IfcNamedUnit; } return IfcCoordinateReferenceSystem::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 4: return "MapProjection"; case 5: return "MapZone"; case 6: return "MapUnit"; } return IfcCoordinateReferenceSystem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcProjectedCRS (IfcEntityInstanceData* e);
@@ -11021,7 +10827,6 @@ public:
     virtual const char* getArgumentName(unsigned int i) const { (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcExternalReferenceRelationship >::ptr HasExternalReferences() const; // INVERSE IfcExternalReferenceRelationship::RelatedResourceObjects
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPropertyAbstraction (IfcEntityInstanceData* e);
@@ -11092,7 +10897,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcLabel; case 1: return Type::IfcValue; case 2: return Type::IfcUnit; } return IfcPropertyAbstraction::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Name"; case 1: return "EnumerationValues"; case 2: return "Unit"; } return IfcPropertyAbstraction::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPropertyEnumeration (IfcEntityInstanceData* e);
@@ -11121,7 +10925,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 3: return Type::IfcAreaMeasure; case 4: return Type::IfcLabel; } return IfcPhysicalSimpleQuantity::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 3: return "AreaValue"; case 4: return "Formula"; } return IfcPhysicalSimpleQuantity::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcQuantityArea (IfcEntityInstanceData* e);
@@ -11150,7 +10953,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 3: return Type::IfcCountMeasure; case 4: return Type::IfcLabel; } return IfcPhysicalSimpleQuantity::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 3: return "CountValue"; case 4: return "Formula"; } return IfcPhysicalSimpleQuantity::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcQuantityCount (IfcEntityInstanceData* e);
@@ -11179,7 +10981,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 3: return Type::IfcLengthMeasure; case 4: return Type::IfcLabel; } return IfcPhysicalSimpleQuantity::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 3: return "LengthValue"; case 4: return "Formula"; } return IfcPhysicalSimpleQuantity::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcQuantityLength (IfcEntityInstanceData* e);
@@ -11208,7 +11009,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 3: return Type::IfcTimeMeasure; case 4: return Type::IfcLabel; } return IfcPhysicalSimpleQuantity::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 3: return "TimeValue"; case 4: return "Formula"; } return IfcPhysicalSimpleQuantity::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcQuantityTime (IfcEntityInstanceData* e);
@@ -11237,7 +11037,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 3: return Type::IfcVolumeMeasure; case 4: return Type::IfcLabel; } return IfcPhysicalSimpleQuantity::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 3: return "VolumeValue"; case 4: return "Formula"; } return IfcPhysicalSimpleQuantity::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcQuantityVolume (IfcEntityInstanceData* e);
@@ -11266,7 +11065,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 3: return Type::IfcMassMeasure; case 4: return Type::IfcLabel; } return IfcPhysicalSimpleQuantity::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 3: return "WeightValue"; case 4: return "Formula"; } return IfcPhysicalSimpleQuantity::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcQuantityWeight (IfcEntityInstanceData* e);
@@ -11337,7 +11135,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcRecurrenceTypeEnum; case 1: return Type::IfcDayInMonthNumber; case 2: return Type::IfcDayInWeekNumber; case 3: return Type::IfcMonthInYearNumber; case 4: return Type::IfcInteger; case 5: return Type::IfcInteger; case 6: return Type::IfcInteger; case 7: return Type::IfcTimePeriod; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "RecurrenceType"; case 1: return "DayComponent"; case 2: return "WeekdayComponent"; case 3: return "MonthComponent"; case 4: return "Position"; case 5: return "Interval"; case 6: return "Occurrences"; case 7: return "TimePeriods"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRecurrencePattern (IfcEntityInstanceData* e);
@@ -11372,7 +11169,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcIdentifier; case 1: return Type::IfcIdentifier; case 2: return Type::IfcLabel; case 3: return Type::IfcInteger; case 4: return Type::IfcReference; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "TypeIdentifier"; case 1: return "AttributeIdentifier"; case 2: return "InstanceName"; case 3: return "ListPositions"; case 4: return "InnerReference"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcReference (IfcEntityInstanceData* e);
@@ -11452,7 +11248,6 @@ public:
     IfcTemplatedEntityList< IfcRepresentationMap >::ptr RepresentationMap() const; // INVERSE IfcRepresentationMap::MappedRepresentation
     IfcTemplatedEntityList< IfcPresentationLayerAssignment >::ptr LayerAssignments() const; // INVERSE IfcPresentationLayerAssignment::AssignedItems
     IfcTemplatedEntityList< IfcProductRepresentation >::ptr OfProductRepresentation() const; // INVERSE IfcProductRepresentation::Representations
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRepresentation (IfcEntityInstanceData* e);
@@ -11487,7 +11282,6 @@ public:
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "ContextIdentifier"; case 1: return "ContextType"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcRepresentation >::ptr RepresentationsInContext() const; // INVERSE IfcRepresentation::ContextOfItems
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRepresentationContext (IfcEntityInstanceData* e);
@@ -11535,7 +11329,6 @@ public:
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcPresentationLayerAssignment >::ptr LayerAssignment() const; // INVERSE IfcPresentationLayerAssignment::AssignedItems
     IfcTemplatedEntityList< IfcStyledItem >::ptr StyledByItem() const; // INVERSE IfcStyledItem::Item
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRepresentationItem (IfcEntityInstanceData* e);
@@ -11569,7 +11362,6 @@ public:
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcShapeAspect >::ptr HasShapeAspects() const; // INVERSE IfcShapeAspect::PartOfProductDefinitionShape
     IfcTemplatedEntityList< IfcMappedItem >::ptr MapUsage() const; // INVERSE IfcMappedItem::MappingSource
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRepresentationMap (IfcEntityInstanceData* e);
@@ -11596,7 +11388,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcLabel; case 1: return Type::IfcText; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Name"; case 1: return "Description"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcResourceLevelRelationship (IfcEntityInstanceData* e);
@@ -11641,7 +11432,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcGloballyUniqueId; case 1: return Type::IfcOwnerHistory; case 2: return Type::IfcLabel; case 3: return Type::IfcText; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "GlobalId"; case 1: return "OwnerHistory"; case 2: return "Name"; case 3: return "Description"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRoot (IfcEntityInstanceData* e);
@@ -11672,7 +11462,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 2: return Type::IfcSIPrefix; case 3: return Type::IfcSIUnitName; } return IfcNamedUnit::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 2: return "Prefix"; case 3: return "Name"; } return IfcNamedUnit::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcSIUnit (IfcEntityInstanceData* e);
@@ -11705,7 +11494,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcLabel; case 1: return Type::IfcDataOriginEnum; case 2: return Type::IfcLabel; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Name"; case 1: return "DataOrigin"; case 2: return "UserDefinedDataOrigin"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcSchedulingTime (IfcEntityInstanceData* e);
@@ -11781,7 +11569,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcShapeModel; case 1: return Type::IfcLabel; case 2: return Type::IfcText; case 3: return Type::IfcLogical; case 4: return Type::IfcProductRepresentationSelect; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "ShapeRepresentations"; case 1: return "Name"; case 2: return "Description"; case 3: return "ProductDefinitional"; case 4: return "PartOfProductDefinitionShape"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcShapeAspect (IfcEntityInstanceData* e);
@@ -11814,7 +11601,6 @@ public:
     virtual const char* getArgumentName(unsigned int i) const { return IfcRepresentation::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcShapeAspect >::ptr OfShapeAspect() const; // INVERSE IfcShapeAspect::ShapeRepresentations
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcShapeModel (IfcEntityInstanceData* e);
@@ -11963,7 +11749,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcShapeModel::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcShapeModel::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcShapeRepresentation (IfcEntityInstanceData* e);
@@ -11985,7 +11770,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcLabel; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Name"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcStructuralConnectionCondition (IfcEntityInstanceData* e);
@@ -12007,7 +11791,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcLabel; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Name"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcStructuralLoad (IfcEntityInstanceData* e);
@@ -12040,7 +11823,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 1: return Type::IfcStructuralLoadOrResult; case 2: return Type::IfcLengthMeasure; } return IfcStructuralLoad::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 1: return "Values"; case 2: return "Locations"; } return IfcStructuralLoad::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcStructuralLoadConfiguration (IfcEntityInstanceData* e);
@@ -12057,7 +11839,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcStructuralLoad::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcStructuralLoad::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcStructuralLoadOrResult (IfcEntityInstanceData* e);
@@ -12074,7 +11855,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcStructuralLoadOrResult::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcStructuralLoadOrResult::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcStructuralLoadStatic (IfcEntityInstanceData* e);
@@ -12114,7 +11894,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 1: return Type::IfcThermodynamicTemperatureMeasure; case 2: return Type::IfcThermodynamicTemperatureMeasure; case 3: return Type::IfcThermodynamicTemperatureMeasure; } return IfcStructuralLoadStatic::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 1: return "DeltaTConstant"; case 2: return "DeltaTY"; case 3: return "DeltaTZ"; } return IfcStructuralLoadStatic::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcStructuralLoadTemperature (IfcEntityInstanceData* e);
@@ -12133,7 +11912,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcRepresentation::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcRepresentation::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcStyleModel (IfcEntityInstanceData* e);
@@ -12195,7 +11973,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcRepresentationItem; case 1: return Type::IfcStyleAssignmentSelect; case 2: return Type::IfcLabel; } return IfcRepresentationItem::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Item"; case 1: return "Styles"; case 2: return "Name"; } return IfcRepresentationItem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcStyledItem (IfcEntityInstanceData* e);
@@ -12216,7 +11993,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcStyleModel::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcStyleModel::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcStyledRepresentation (IfcEntityInstanceData* e);
@@ -12250,7 +12026,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 1: return Type::IfcLengthMeasure; case 2: return Type::IfcLengthMeasure; case 3: return Type::IfcRatioMeasure; } return IfcStructuralLoadOrResult::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 1: return "SurfaceReinforcement1"; case 2: return "SurfaceReinforcement2"; case 3: return "ShearReinforcement"; } return IfcStructuralLoadOrResult::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcSurfaceReinforcementArea (IfcEntityInstanceData* e);
@@ -12277,7 +12052,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 1: return Type::IfcSurfaceSide; case 2: return Type::IfcSurfaceStyleElementSelect; } return IfcPresentationStyle::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 1: return "Side"; case 2: return "Styles"; } return IfcPresentationStyle::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcSurfaceStyle (IfcEntityInstanceData* e);
@@ -12318,7 +12092,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcColourRgb; case 1: return Type::IfcColourRgb; case 2: return Type::IfcColourRgb; case 3: return Type::IfcColourRgb; } return IfcPresentationItem::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "DiffuseTransmissionColour"; case 1: return "DiffuseReflectionColour"; case 2: return "TransmissionColour"; case 3: return "ReflectanceColour"; } return IfcPresentationItem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcSurfaceStyleLighting (IfcEntityInstanceData* e);
@@ -12347,7 +12120,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcReal; case 1: return Type::IfcReal; } return IfcPresentationItem::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "RefractionIndex"; case 1: return "DispersionFactor"; } return IfcPresentationItem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcSurfaceStyleRefraction (IfcEntityInstanceData* e);
@@ -12375,7 +12147,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcColourRgb; case 1: return Type::IfcNormalisedRatioMeasure; } return IfcPresentationItem::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "SurfaceColour"; case 1: return "Transparency"; } return IfcPresentationItem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcSurfaceStyleShading (IfcEntityInstanceData* e);
@@ -12410,7 +12181,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcSurfaceTexture; } return IfcPresentationItem::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Textures"; } return IfcPresentationItem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcSurfaceStyleWithTextures (IfcEntityInstanceData* e);
@@ -12550,7 +12320,6 @@ public:
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcTextureCoordinate >::ptr IsMappedBy() const; // INVERSE IfcTextureCoordinate::Maps
     IfcTemplatedEntityList< IfcSurfaceStyleWithTextures >::ptr UsedInStyles() const; // INVERSE IfcSurfaceStyleWithTextures::Textures
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcSurfaceTexture (IfcEntityInstanceData* e);
@@ -12594,7 +12363,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcLabel; case 1: return Type::IfcTableRow; case 2: return Type::IfcTableColumn; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Name"; case 1: return "Rows"; case 2: return "Columns"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcTable (IfcEntityInstanceData* e);
@@ -12637,7 +12405,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcIdentifier; case 1: return Type::IfcLabel; case 2: return Type::IfcText; case 3: return Type::IfcUnit; case 4: return Type::IfcReference; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Identifier"; case 1: return "Name"; case 2: return "Description"; case 3: return "Unit"; case 4: return "ReferencePath"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcTableColumn (IfcEntityInstanceData* e);
@@ -12674,7 +12441,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcValue; case 1: return Type::IfcBoolean; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "RowCells"; case 1: return "IsHeading"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcTableRow (IfcEntityInstanceData* e);
@@ -12835,7 +12601,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 3: return Type::IfcTaskDurationEnum; case 4: return Type::IfcDuration; case 5: return Type::IfcDateTime; case 6: return Type::IfcDateTime; case 7: return Type::IfcDateTime; case 8: return Type::IfcDateTime; case 9: return Type::IfcDateTime; case 10: return Type::IfcDateTime; case 11: return Type::IfcDuration; case 12: return Type::IfcDuration; case 13: return Type::IfcBoolean; case 14: return Type::IfcDateTime; case 15: return Type::IfcDuration; case 16: return Type::IfcDateTime; case 17: return Type::IfcDateTime; case 18: return Type::IfcDuration; case 19: return Type::IfcPositiveRatioMeasure; } return IfcSchedulingTime::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 3: return "DurationType"; case 4: return "ScheduleDuration"; case 5: return "ScheduleStart"; case 6: return "ScheduleFinish"; case 7: return "EarlyStart"; case 8: return "EarlyFinish"; case 9: return "LateStart"; case 10: return "LateFinish"; case 11: return "FreeFloat"; case 12: return "TotalFloat"; case 13: return "IsCritical"; case 14: return "StatusTime"; case 15: return "ActualDuration"; case 16: return "ActualStart"; case 17: return "ActualFinish"; case 18: return "RemainingTime"; case 19: return "Completion"; } return IfcSchedulingTime::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcTaskTime (IfcEntityInstanceData* e);
@@ -12854,7 +12619,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 20: return Type::IfcRecurrencePattern; } return IfcTaskTime::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 20: return "Recurrence"; } return IfcTaskTime::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcTaskTimeRecurring (IfcEntityInstanceData* e);
@@ -12907,7 +12671,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 3: return Type::IfcLabel; case 4: return Type::IfcLabel; case 5: return Type::IfcLabel; case 6: return Type::IfcLabel; case 7: return Type::IfcURIReference; case 8: return Type::IfcURIReference; } return IfcAddress::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 3: return "TelephoneNumbers"; case 4: return "FacsimileNumbers"; case 5: return "PagerNumber"; case 6: return "ElectronicMailAddresses"; case 7: return "WWWHomePageURL"; case 8: return "MessagingIDs"; } return IfcAddress::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcTelecomAddress (IfcEntityInstanceData* e);
@@ -12972,7 +12735,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 1: return Type::IfcTextStyleForDefinedFont; case 2: return Type::IfcTextStyleTextModel; case 3: return Type::IfcTextFontSelect; case 4: return Type::IfcBoolean; } return IfcPresentationStyle::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 1: return "TextCharacterAppearance"; case 2: return "TextStyle"; case 3: return "TextFontStyle"; case 4: return "ModelOrDraughting"; } return IfcPresentationStyle::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcTextStyle (IfcEntityInstanceData* e);
@@ -13011,7 +12773,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcColour; case 1: return Type::IfcColour; } return IfcPresentationItem::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Colour"; case 1: return "BackgroundColour"; } return IfcPresentationItem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcTextStyleForDefinedFont (IfcEntityInstanceData* e);
@@ -13074,7 +12835,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcSizeSelect; case 1: return Type::IfcTextAlignment; case 2: return Type::IfcTextDecoration; case 3: return Type::IfcSizeSelect; case 4: return Type::IfcSizeSelect; case 5: return Type::IfcTextTransformation; case 6: return Type::IfcSizeSelect; } return IfcPresentationItem::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "TextIndent"; case 1: return "TextAlign"; case 2: return "TextDecoration"; case 3: return "LetterSpacing"; case 4: return "WordSpacing"; case 5: return "TextTransform"; case 6: return "LineHeight"; } return IfcPresentationItem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcTextStyleTextModel (IfcEntityInstanceData* e);
@@ -13101,7 +12861,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcSurfaceTexture; } return IfcPresentationItem::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Maps"; } return IfcPresentationItem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcTextureCoordinate (IfcEntityInstanceData* e);
@@ -13153,7 +12912,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 1: return Type::IfcLabel; case 2: return Type::IfcReal; } return IfcTextureCoordinate::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 1: return "Mode"; case 2: return "Parameter"; } return IfcTextureCoordinate::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcTextureCoordinateGenerator (IfcEntityInstanceData* e);
@@ -13225,7 +12983,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 1: return Type::IfcTextureVertex; case 2: return Type::IfcFace; } return IfcTextureCoordinate::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 1: return "Vertices"; case 2: return "MappedTo"; } return IfcTextureCoordinate::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcTextureMap (IfcEntityInstanceData* e);
@@ -13269,7 +13026,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcParameterValue; } return IfcPresentationItem::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Coordinates"; } return IfcPresentationItem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcTextureVertex (IfcEntityInstanceData* e);
@@ -13286,7 +13042,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcParameterValue; } return IfcPresentationItem::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "TexCoordsList"; } return IfcPresentationItem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcTextureVertexList (IfcEntityInstanceData* e);
@@ -13312,7 +13067,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcTime; case 1: return Type::IfcTime; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "StartTime"; case 1: return "EndTime"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcTimePeriod (IfcEntityInstanceData* e);
@@ -13362,7 +13116,6 @@ public:
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Name"; case 1: return "Description"; case 2: return "StartTime"; case 3: return "EndTime"; case 4: return "TimeSeriesDataType"; case 5: return "DataOrigin"; case 6: return "UserDefinedDataOrigin"; case 7: return "Unit"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcExternalReferenceRelationship >::ptr HasExternalReference() const; // INVERSE IfcExternalReferenceRelationship::RelatedResourceObjects
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcTimeSeries (IfcEntityInstanceData* e);
@@ -13388,7 +13141,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcValue; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "ListValues"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcTimeSeriesValue (IfcEntityInstanceData* e);
@@ -13407,7 +13159,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcRepresentationItem::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcRepresentationItem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcTopologicalRepresentationItem (IfcEntityInstanceData* e);
@@ -13455,7 +13206,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcShapeModel::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcShapeModel::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcTopologyRepresentation (IfcEntityInstanceData* e);
@@ -13477,7 +13227,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcUnit; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Units"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcUnitAssignment (IfcEntityInstanceData* e);
@@ -13501,7 +13250,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcTopologicalRepresentationItem::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcTopologicalRepresentationItem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcVertex (IfcEntityInstanceData* e);
@@ -13527,7 +13275,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcPoint; } return IfcVertex::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "VertexGeometry"; } return IfcVertex::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcVertexPoint (IfcEntityInstanceData* e);
@@ -13606,7 +13353,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcGridAxis; case 1: return Type::IfcLengthMeasure; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "IntersectingAxes"; case 1: return "OffsetDistances"; } (void)i; throw IfcParse::IfcAttributeOutOfRangeException("Argument index out of range"); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcVirtualGridIntersection (IfcEntityInstanceData* e);
@@ -13647,7 +13393,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 3: return Type::IfcRecurrencePattern; case 4: return Type::IfcDate; case 5: return Type::IfcDate; } return IfcSchedulingTime::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 3: return "RecurrencePattern"; case 4: return "Start"; case 5: return "Finish"; } return IfcSchedulingTime::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcWorkTime (IfcEntityInstanceData* e);
@@ -13674,7 +13419,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 2: return Type::IfcApproval; case 3: return Type::IfcApproval; } return IfcResourceLevelRelationship::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 2: return "RelatingApproval"; case 3: return "RelatedApprovals"; } return IfcResourceLevelRelationship::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcApprovalRelationship (IfcEntityInstanceData* e);
@@ -13709,7 +13453,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 2: return Type::IfcCurve; } return IfcProfileDef::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 2: return "OuterCurve"; } return IfcProfileDef::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcArbitraryClosedProfileDef (IfcEntityInstanceData* e);
@@ -13741,7 +13484,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 2: return Type::IfcBoundedCurve; } return IfcProfileDef::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 2: return "Curve"; } return IfcProfileDef::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcArbitraryOpenProfileDef (IfcEntityInstanceData* e);
@@ -13777,7 +13519,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 3: return Type::IfcCurve; } return IfcArbitraryClosedProfileDef::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 3: return "InnerCurves"; } return IfcArbitraryClosedProfileDef::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcArbitraryProfileDefWithVoids (IfcEntityInstanceData* e);
@@ -13806,7 +13547,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 5: return Type::IfcIdentifier; case 6: return Type::IfcBinary; } return IfcSurfaceTexture::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 5: return "RasterFormat"; case 6: return "RasterCode"; } return IfcSurfaceTexture::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcBlobTexture (IfcEntityInstanceData* e);
@@ -13852,7 +13592,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 3: return Type::IfcPositiveLengthMeasure; } return IfcArbitraryOpenProfileDef::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 3: return "Thickness"; } return IfcArbitraryOpenProfileDef::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcCenterLineProfileDef (IfcEntityInstanceData* e);
@@ -13943,7 +13682,6 @@ public:
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcRelAssociatesClassification >::ptr ClassificationForObjects() const; // INVERSE IfcRelAssociatesClassification::RelatingClassification
     IfcTemplatedEntityList< IfcClassificationReference >::ptr HasReferences() const; // INVERSE IfcClassificationReference::ReferencedSource
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcClassification (IfcEntityInstanceData* e);
@@ -13996,7 +13734,6 @@ public:
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcRelAssociatesClassification >::ptr ClassificationRefForObjects() const; // INVERSE IfcRelAssociatesClassification::RelatingClassification
     IfcTemplatedEntityList< IfcClassificationReference >::ptr HasReferences() const; // INVERSE IfcClassificationReference::ReferencedSource
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcClassificationReference (IfcEntityInstanceData* e);
@@ -14013,7 +13750,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcNormalisedRatioMeasure; } return IfcPresentationItem::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "ColourList"; } return IfcPresentationItem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcColourRgbList (IfcEntityInstanceData* e);
@@ -14040,7 +13776,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcLabel; } return IfcPresentationItem::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Name"; } return IfcPresentationItem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcColourSpecification (IfcEntityInstanceData* e);
@@ -14098,7 +13833,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 2: return Type::IfcProfileDef; case 3: return Type::IfcLabel; } return IfcProfileDef::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 2: return "Profiles"; case 3: return "Label"; } return IfcProfileDef::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcCompositeProfileDef (IfcEntityInstanceData* e);
@@ -14124,7 +13858,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcFace; } return IfcTopologicalRepresentationItem::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "CfsFaces"; } return IfcTopologicalRepresentationItem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcConnectedFaceSet (IfcEntityInstanceData* e);
@@ -14159,7 +13892,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcCurveOrEdgeCurve; case 1: return Type::IfcCurveOrEdgeCurve; } return IfcConnectionGeometry::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "CurveOnRelatingElement"; case 1: return "CurveOnRelatedElement"; } return IfcConnectionGeometry::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcConnectionCurveGeometry (IfcEntityInstanceData* e);
@@ -14207,7 +13939,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 2: return Type::IfcLengthMeasure; case 3: return Type::IfcLengthMeasure; case 4: return Type::IfcLengthMeasure; } return IfcConnectionPointGeometry::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 2: return "EccentricityInX"; case 3: return "EccentricityInY"; case 4: return "EccentricityInZ"; } return IfcConnectionPointGeometry::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcConnectionPointEccentricity (IfcEntityInstanceData* e);
@@ -14232,7 +13963,6 @@ public:
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 2: return "Name"; } return IfcNamedUnit::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcExternalReferenceRelationship >::ptr HasExternalReference() const; // INVERSE IfcExternalReferenceRelationship::RelatedResourceObjects
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcContextDependentUnit (IfcEntityInstanceData* e);
@@ -14300,7 +14030,6 @@ public:
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 2: return "Name"; case 3: return "ConversionFactor"; } return IfcNamedUnit::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcExternalReferenceRelationship >::ptr HasExternalReference() const; // INVERSE IfcExternalReferenceRelationship::RelatedResourceObjects
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcConversionBasedUnit (IfcEntityInstanceData* e);
@@ -14335,7 +14064,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 4: return Type::IfcReal; } return IfcConversionBasedUnit::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 4: return "ConversionOffset"; } return IfcConversionBasedUnit::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcConversionBasedUnitWithOffset (IfcEntityInstanceData* e);
@@ -14381,7 +14109,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 2: return Type::IfcMonetaryUnit; case 3: return Type::IfcMonetaryUnit; case 4: return Type::IfcPositiveRatioMeasure; case 5: return Type::IfcDateTime; case 6: return Type::IfcLibraryInformation; } return IfcResourceLevelRelationship::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 2: return "RelatingMonetaryUnit"; case 3: return "RelatedMonetaryUnit"; case 4: return "ExchangeRate"; case 5: return "RateDateTime"; case 6: return "RateSource"; } return IfcResourceLevelRelationship::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcCurrencyRelationship (IfcEntityInstanceData* e);
@@ -14431,7 +14158,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 1: return Type::IfcCurveFontOrScaledCurveFontSelect; case 2: return Type::IfcSizeSelect; case 3: return Type::IfcColour; case 4: return Type::IfcBoolean; } return IfcPresentationStyle::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 1: return "CurveFont"; case 2: return "CurveWidth"; case 3: return "CurveColour"; case 4: return "ModelOrDraughting"; } return IfcPresentationStyle::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcCurveStyle (IfcEntityInstanceData* e);
@@ -14458,7 +14184,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcLabel; case 1: return Type::IfcCurveStyleFontPattern; } return IfcPresentationItem::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Name"; case 1: return "PatternList"; } return IfcPresentationItem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcCurveStyleFont (IfcEntityInstanceData* e);
@@ -14494,7 +14219,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcLabel; case 1: return Type::IfcCurveStyleFontSelect; case 2: return Type::IfcPositiveRatioMeasure; } return IfcPresentationItem::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Name"; case 1: return "CurveFont"; case 2: return "CurveFontScaling"; } return IfcPresentationItem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcCurveStyleFontAndScaling (IfcEntityInstanceData* e);
@@ -14523,7 +14247,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcLengthMeasure; case 1: return Type::IfcPositiveLengthMeasure; } return IfcPresentationItem::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "VisibleSegmentLength"; case 1: return "InvisibleSegmentLength"; } return IfcPresentationItem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcCurveStyleFontPattern (IfcEntityInstanceData* e);
@@ -14632,7 +14355,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 2: return Type::IfcProfileDef; case 3: return Type::IfcCartesianTransformationOperator2D; case 4: return Type::IfcLabel; } return IfcProfileDef::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 2: return "ParentProfile"; case 3: return "Operator"; case 4: return "Label"; } return IfcProfileDef::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcDerivedProfileDef (IfcEntityInstanceData* e);
@@ -14747,7 +14469,6 @@ public:
     IfcTemplatedEntityList< IfcDocumentReference >::ptr HasDocumentReferences() const; // INVERSE IfcDocumentReference::ReferencedDocument
     IfcTemplatedEntityList< IfcDocumentInformationRelationship >::ptr IsPointedTo() const; // INVERSE IfcDocumentInformationRelationship::RelatedDocuments
     IfcTemplatedEntityList< IfcDocumentInformationRelationship >::ptr IsPointer() const; // INVERSE IfcDocumentInformationRelationship::RelatingDocument
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcDocumentInformation (IfcEntityInstanceData* e);
@@ -14780,7 +14501,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 2: return Type::IfcDocumentInformation; case 3: return Type::IfcDocumentInformation; case 4: return Type::IfcLabel; } return IfcResourceLevelRelationship::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 2: return "RelatingDocument"; case 3: return "RelatedDocuments"; case 4: return "RelationshipType"; } return IfcResourceLevelRelationship::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcDocumentInformationRelationship (IfcEntityInstanceData* e);
@@ -14818,7 +14538,6 @@ public:
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 3: return "Description"; case 4: return "ReferencedDocument"; } return IfcExternalReference::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcRelAssociatesDocument >::ptr DocumentRefForObjects() const; // INVERSE IfcRelAssociatesDocument::RelatingDocument
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcDocumentReference (IfcEntityInstanceData* e);
@@ -14887,7 +14606,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcVertex; case 1: return Type::IfcVertex; } return IfcTopologicalRepresentationItem::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "EdgeStart"; case 1: return "EdgeEnd"; } return IfcTopologicalRepresentationItem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcEdge (IfcEntityInstanceData* e);
@@ -14940,7 +14658,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 2: return Type::IfcCurve; case 3: return Type::IfcBoolean; } return IfcEdge::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 2: return "EdgeGeometry"; case 3: return "SameSense"; } return IfcEdge::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcEdgeCurve (IfcEntityInstanceData* e);
@@ -14999,7 +14716,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 3: return Type::IfcDateTime; case 4: return Type::IfcDateTime; case 5: return Type::IfcDateTime; case 6: return Type::IfcDateTime; } return IfcSchedulingTime::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 3: return "ActualDate"; case 4: return "EarlyDate"; case 5: return "LateDate"; case 6: return "ScheduleDate"; } return IfcSchedulingTime::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcEventTime (IfcEntityInstanceData* e);
@@ -15024,7 +14740,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcIdentifier; case 1: return Type::IfcText; case 2: return Type::IfcProperty; } return IfcPropertyAbstraction::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Name"; case 1: return "Description"; case 2: return "Properties"; } return IfcPropertyAbstraction::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcExtendedProperties (IfcEntityInstanceData* e);
@@ -15053,7 +14768,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 2: return Type::IfcExternalReference; case 3: return Type::IfcResourceObjectSelect; } return IfcResourceLevelRelationship::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 2: return "RelatingReference"; case 3: return "RelatedResourceObjects"; } return IfcResourceLevelRelationship::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcExternalReferenceRelationship (IfcEntityInstanceData* e);
@@ -15115,7 +14829,6 @@ public:
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Bounds"; } return IfcTopologicalRepresentationItem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcTextureMap >::ptr HasTextureMaps() const; // INVERSE IfcTextureMap::MappedTo
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcFace (IfcEntityInstanceData* e);
@@ -15140,7 +14853,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcLoop; case 1: return Type::IfcBoolean; } return IfcTopologicalRepresentationItem::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Bound"; case 1: return "Orientation"; } return IfcTopologicalRepresentationItem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcFaceBound (IfcEntityInstanceData* e);
@@ -15159,7 +14871,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcFaceBound::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcFaceBound::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcFaceOuterBound (IfcEntityInstanceData* e);
@@ -15215,7 +14926,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 1: return Type::IfcSurface; case 2: return Type::IfcBoolean; } return IfcFace::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 1: return "FaceSurface"; case 2: return "SameSense"; } return IfcFace::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcFaceSurface (IfcEntityInstanceData* e);
@@ -15266,7 +14976,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 1: return Type::IfcForceMeasure; case 2: return Type::IfcForceMeasure; case 3: return Type::IfcForceMeasure; case 4: return Type::IfcForceMeasure; case 5: return Type::IfcForceMeasure; case 6: return Type::IfcForceMeasure; } return IfcStructuralConnectionCondition::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 1: return "TensionFailureX"; case 2: return "TensionFailureY"; case 3: return "TensionFailureZ"; case 4: return "CompressionFailureX"; case 5: return "CompressionFailureY"; case 6: return "CompressionFailureZ"; } return IfcStructuralConnectionCondition::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcFailureConnectionCondition (IfcEntityInstanceData* e);
@@ -15321,7 +15030,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 1: return Type::IfcFillStyleSelect; case 2: return Type::IfcBoolean; } return IfcPresentationStyle::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 1: return "FillStyles"; case 2: return "ModelorDraughting"; } return IfcPresentationStyle::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcFillAreaStyle (IfcEntityInstanceData* e);
@@ -15402,7 +15110,6 @@ public:
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcGeometricRepresentationSubContext >::ptr HasSubContexts() const; // INVERSE IfcGeometricRepresentationSubContext::ParentContext
     IfcTemplatedEntityList< IfcCoordinateOperation >::ptr HasCoordinateOperation() const; // INVERSE IfcCoordinateOperation::SourceCRS
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcGeometricRepresentationContext (IfcEntityInstanceData* e);
@@ -15435,7 +15142,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcRepresentationItem::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcRepresentationItem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcGeometricRepresentationItem (IfcEntityInstanceData* e);
@@ -15488,7 +15194,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 6: return Type::IfcGeometricRepresentationContext; case 7: return Type::IfcPositiveRatioMeasure; case 8: return Type::IfcGeometricProjectionEnum; case 9: return Type::IfcLabel; } return IfcGeometricRepresentationContext::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 6: return "ParentContext"; case 7: return "TargetScale"; case 8: return "TargetView"; case 9: return "UserDefinedTargetView"; } return IfcGeometricRepresentationContext::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcGeometricRepresentationSubContext (IfcEntityInstanceData* e);
@@ -15512,7 +15217,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcGeometricSetSelect; } return IfcGeometricRepresentationItem::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Elements"; } return IfcGeometricRepresentationItem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcGeometricSet (IfcEntityInstanceData* e);
@@ -15581,7 +15285,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcVirtualGridIntersection; case 1: return Type::IfcGridPlacementDirectionSelect; } return IfcObjectPlacement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "PlacementLocation"; case 1: return "PlacementRefDirection"; } return IfcObjectPlacement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcGridPlacement (IfcEntityInstanceData* e);
@@ -15616,7 +15319,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcSurface; case 1: return Type::IfcBoolean; } return IfcGeometricRepresentationItem::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "BaseSurface"; case 1: return "AgreementFlag"; } return IfcGeometricRepresentationItem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcHalfSpaceSolid (IfcEntityInstanceData* e);
@@ -15668,7 +15370,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 5: return Type::IfcURIReference; } return IfcSurfaceTexture::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 5: return "URLReference"; } return IfcSurfaceTexture::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcImageTexture (IfcEntityInstanceData* e);
@@ -15693,7 +15394,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcTessellatedFaceSet; case 1: return Type::IfcNormalisedRatioMeasure; case 2: return Type::IfcColourRgbList; case 3: return Type::IfcPositiveInteger; } return IfcPresentationItem::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "MappedTo"; case 1: return "Opacity"; case 2: return "Colours"; case 3: return "ColourIndex"; } return IfcPresentationItem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcIndexedColourMap (IfcEntityInstanceData* e);
@@ -15712,7 +15412,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 1: return Type::IfcTessellatedFaceSet; case 2: return Type::IfcTextureVertexList; } return IfcTextureCoordinate::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 1: return "MappedTo"; case 2: return "TexCoords"; } return IfcTextureCoordinate::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcIndexedTextureMap (IfcEntityInstanceData* e);
@@ -15731,7 +15430,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 3: return Type::IfcPositiveInteger; } return IfcIndexedTextureMap::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 3: return "TexCoordIndex"; } return IfcIndexedTextureMap::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcIndexedTriangleTextureMap (IfcEntityInstanceData* e);
@@ -15753,7 +15451,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcIrregularTimeSeriesValue; } return IfcTimeSeries::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "Values"; } return IfcTimeSeries::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcIrregularTimeSeries (IfcEntityInstanceData* e);
@@ -15812,7 +15509,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 3: return Type::IfcTimeOrRatioSelect; case 4: return Type::IfcTaskDurationEnum; } return IfcSchedulingTime::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 3: return "LagValue"; case 4: return "DurationType"; } return IfcSchedulingTime::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcLagTime (IfcEntityInstanceData* e);
@@ -15852,7 +15548,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcLabel; case 1: return Type::IfcColourRgb; case 2: return Type::IfcNormalisedRatioMeasure; case 3: return Type::IfcNormalisedRatioMeasure; } return IfcGeometricRepresentationItem::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Name"; case 1: return "LightColour"; case 2: return "AmbientIntensity"; case 3: return "Intensity"; } return IfcGeometricRepresentationItem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcLightSource (IfcEntityInstanceData* e);
@@ -15873,7 +15568,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcLightSource::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcLightSource::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcLightSourceAmbient (IfcEntityInstanceData* e);
@@ -15900,7 +15594,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 4: return Type::IfcDirection; } return IfcLightSource::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 4: return "Orientation"; } return IfcLightSource::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcLightSourceDirectional (IfcEntityInstanceData* e);
@@ -15941,7 +15634,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 4: return Type::IfcAxis2Placement3D; case 5: return Type::IfcColourRgb; case 6: return Type::IfcThermodynamicTemperatureMeasure; case 7: return Type::IfcLuminousFluxMeasure; case 8: return Type::IfcLightEmissionSourceEnum; case 9: return Type::IfcLightDistributionDataSourceSelect; } return IfcLightSource::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 4: return "Position"; case 5: return "ColourAppearance"; case 6: return "ColourTemperature"; case 7: return "LuminousFlux"; case 8: return "LightEmissionSource"; case 9: return "LightDistributionDataSource"; } return IfcLightSource::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcLightSourceGoniometric (IfcEntityInstanceData* e);
@@ -15987,7 +15679,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 4: return Type::IfcCartesianPoint; case 5: return Type::IfcPositiveLengthMeasure; case 6: return Type::IfcReal; case 7: return Type::IfcReal; case 8: return Type::IfcReal; } return IfcLightSource::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 4: return "Position"; case 5: return "Radius"; case 6: return "ConstantAttenuation"; case 7: return "DistanceAttenuation"; case 8: return "QuadricAttenuation"; } return IfcLightSource::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcLightSourcePositional (IfcEntityInstanceData* e);
@@ -16033,7 +15724,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcDirection; case 10: return Type::IfcReal; case 11: return Type::IfcPositivePlaneAngleMeasure; case 12: return Type::IfcPositivePlaneAngleMeasure; } return IfcLightSourcePositional::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "Orientation"; case 10: return "ConcentrationExponent"; case 11: return "SpreadAngle"; case 12: return "BeamWidthAngle"; } return IfcLightSourcePositional::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcLightSourceSpot (IfcEntityInstanceData* e);
@@ -16107,7 +15797,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcObjectPlacement; case 1: return Type::IfcAxis2Placement; } return IfcObjectPlacement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "PlacementRelTo"; case 1: return "RelativePlacement"; } return IfcObjectPlacement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcLocalPlacement (IfcEntityInstanceData* e);
@@ -16147,7 +15836,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcTopologicalRepresentationItem::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcTopologicalRepresentationItem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcLoop (IfcEntityInstanceData* e);
@@ -16186,7 +15874,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcRepresentationMap; case 1: return Type::IfcCartesianTransformationOperator; } return IfcRepresentationItem::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "MappingSource"; case 1: return "MappingTarget"; } return IfcRepresentationItem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcMappedItem (IfcEntityInstanceData* e);
@@ -16253,7 +15940,6 @@ public:
     IfcTemplatedEntityList< IfcMaterialDefinitionRepresentation >::ptr HasRepresentation() const; // INVERSE IfcMaterialDefinitionRepresentation::RepresentedMaterial
     IfcTemplatedEntityList< IfcMaterialRelationship >::ptr IsRelatedWith() const; // INVERSE IfcMaterialRelationship::RelatedMaterials
     IfcTemplatedEntityList< IfcMaterialRelationship >::ptr RelatesTo() const; // INVERSE IfcMaterialRelationship::RelatingMaterial
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcMaterial (IfcEntityInstanceData* e);
@@ -16296,7 +15982,6 @@ public:
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Name"; case 1: return "Description"; case 2: return "Material"; case 3: return "Fraction"; case 4: return "Category"; } return IfcMaterialDefinition::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcMaterialConstituentSet >::ptr ToMaterialConstituentSet() const; // INVERSE IfcMaterialConstituentSet::MaterialConstituents
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcMaterialConstituent (IfcEntityInstanceData* e);
@@ -16339,7 +16024,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcLabel; case 1: return Type::IfcText; case 2: return Type::IfcMaterialConstituent; } return IfcMaterialDefinition::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Name"; case 1: return "Description"; case 2: return "MaterialConstituents"; } return IfcMaterialDefinition::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcMaterialConstituentSet (IfcEntityInstanceData* e);
@@ -16386,7 +16070,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 3: return Type::IfcMaterial; } return IfcProductRepresentation::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 3: return "RepresentedMaterial"; } return IfcProductRepresentation::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcMaterialDefinitionRepresentation (IfcEntityInstanceData* e);
@@ -16529,7 +16212,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcMaterialLayerSet; case 1: return Type::IfcLayerSetDirectionEnum; case 2: return Type::IfcDirectionSenseEnum; case 3: return Type::IfcLengthMeasure; case 4: return Type::IfcPositiveLengthMeasure; } return IfcMaterialUsageDefinition::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "ForLayerSet"; case 1: return "LayerSetDirection"; case 2: return "DirectionSense"; case 3: return "OffsetFromReferenceLine"; case 4: return "ReferenceExtent"; } return IfcMaterialUsageDefinition::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcMaterialLayerSetUsage (IfcEntityInstanceData* e);
@@ -16568,7 +16250,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcMaterialProfileSet; case 1: return Type::IfcCardinalPointReference; case 2: return Type::IfcPositiveLengthMeasure; } return IfcMaterialUsageDefinition::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "ForProfileSet"; case 1: return "CardinalPoint"; case 2: return "ReferenceExtent"; } return IfcMaterialUsageDefinition::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcMaterialProfileSetUsage (IfcEntityInstanceData* e);
@@ -16615,7 +16296,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 3: return Type::IfcMaterialProfileSet; case 4: return Type::IfcCardinalPointReference; } return IfcMaterialProfileSetUsage::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 3: return "ForProfileEndSet"; case 4: return "CardinalEndPoint"; } return IfcMaterialProfileSetUsage::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcMaterialProfileSetUsageTapering (IfcEntityInstanceData* e);
@@ -16656,7 +16336,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 3: return Type::IfcMaterialDefinition; } return IfcExtendedProperties::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 3: return "Material"; } return IfcExtendedProperties::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcMaterialProperties (IfcEntityInstanceData* e);
@@ -16684,7 +16363,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 2: return Type::IfcMaterial; case 3: return Type::IfcMaterial; case 4: return Type::IfcLabel; } return IfcResourceLevelRelationship::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 2: return "RelatingMaterial"; case 3: return "RelatedMaterials"; case 4: return "Expression"; } return IfcResourceLevelRelationship::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcMaterialRelationship (IfcEntityInstanceData* e);
@@ -16725,7 +16403,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcDerivedProfileDef::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcDerivedProfileDef::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcMirroredProfileDef (IfcEntityInstanceData* e);
@@ -16796,7 +16473,6 @@ public:
     IfcTemplatedEntityList< IfcRelAggregates >::ptr IsDecomposedBy() const; // INVERSE IfcRelAggregates::RelatingObject
     IfcTemplatedEntityList< IfcRelAggregates >::ptr Decomposes() const; // INVERSE IfcRelAggregates::RelatedObjects
     IfcTemplatedEntityList< IfcRelAssociates >::ptr HasAssociations() const; // INVERSE IfcRelAssociates::RelatedObjects
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcObjectDefinition (IfcEntityInstanceData* e);
@@ -16869,7 +16545,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcConnectedFaceSet::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcConnectedFaceSet::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcOpenShell (IfcEntityInstanceData* e);
@@ -16895,7 +16570,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 2: return Type::IfcOrganization; case 3: return Type::IfcOrganization; } return IfcResourceLevelRelationship::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 2: return "RelatingOrganization"; case 3: return "RelatedOrganizations"; } return IfcResourceLevelRelationship::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcOrganizationRelationship (IfcEntityInstanceData* e);
@@ -16922,7 +16596,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 2: return Type::IfcEdge; case 3: return Type::IfcBoolean; } return IfcEdge::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 2: return "EdgeElement"; case 3: return "Orientation"; } return IfcEdge::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcOrientedEdge (IfcEntityInstanceData* e);
@@ -16983,7 +16656,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 2: return Type::IfcAxis2Placement2D; } return IfcProfileDef::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 2: return "Position"; } return IfcProfileDef::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcParameterizedProfileDef (IfcEntityInstanceData* e);
@@ -17014,7 +16686,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcOrientedEdge; } return IfcTopologicalRepresentationItem::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "EdgeList"; } return IfcTopologicalRepresentationItem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPath (IfcEntityInstanceData* e);
@@ -17053,7 +16724,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 2: return Type::IfcPhysicalQuantity; case 3: return Type::IfcLabel; case 4: return Type::IfcLabel; case 5: return Type::IfcLabel; } return IfcPhysicalQuantity::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 2: return "HasQuantities"; case 3: return "Discrimination"; case 4: return "Quality"; case 5: return "Usage"; } return IfcPhysicalQuantity::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPhysicalComplexQuantity (IfcEntityInstanceData* e);
@@ -17099,7 +16769,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 5: return Type::IfcInteger; case 6: return Type::IfcInteger; case 7: return Type::IfcInteger; case 8: return Type::IfcBinary; } return IfcSurfaceTexture::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 5: return "Width"; case 6: return "Height"; case 7: return "ColourComponents"; case 8: return "Pixel"; } return IfcSurfaceTexture::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPixelTexture (IfcEntityInstanceData* e);
@@ -17125,7 +16794,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcCartesianPoint; } return IfcGeometricRepresentationItem::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Location"; } return IfcGeometricRepresentationItem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPlacement (IfcEntityInstanceData* e);
@@ -17150,7 +16818,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcLengthMeasure; case 1: return Type::IfcLengthMeasure; } return IfcGeometricRepresentationItem::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "SizeInX"; case 1: return "SizeInY"; } return IfcGeometricRepresentationItem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPlanarExtent (IfcEntityInstanceData* e);
@@ -17169,7 +16836,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcGeometricRepresentationItem::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcGeometricRepresentationItem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPoint (IfcEntityInstanceData* e);
@@ -17198,7 +16864,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcCurve; case 1: return Type::IfcParameterValue; } return IfcPoint::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "BasisCurve"; case 1: return "PointParameter"; } return IfcPoint::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPointOnCurve (IfcEntityInstanceData* e);
@@ -17230,7 +16895,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcSurface; case 1: return Type::IfcParameterValue; case 2: return Type::IfcParameterValue; } return IfcPoint::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "BasisSurface"; case 1: return "PointParameterU"; case 2: return "PointParameterV"; } return IfcPoint::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPointOnSurface (IfcEntityInstanceData* e);
@@ -17286,7 +16950,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcCartesianPoint; } return IfcLoop::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Polygon"; } return IfcLoop::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPolyLoop (IfcEntityInstanceData* e);
@@ -17364,7 +17027,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 2: return Type::IfcAxis2Placement3D; case 3: return Type::IfcBoundedCurve; } return IfcHalfSpaceSolid::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 2: return "Position"; case 3: return "PolygonalBoundary"; } return IfcHalfSpaceSolid::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPolygonalBoundedHalfSpace (IfcEntityInstanceData* e);
@@ -17388,7 +17050,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcLabel; } return IfcPresentationItem::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Name"; } return IfcPresentationItem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPreDefinedItem (IfcEntityInstanceData* e);
@@ -17403,7 +17064,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcPropertyAbstraction::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcPropertyAbstraction::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPreDefinedProperties (IfcEntityInstanceData* e);
@@ -17428,7 +17088,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcPreDefinedItem::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcPreDefinedItem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPreDefinedTextFont (IfcEntityInstanceData* e);
@@ -17456,7 +17115,6 @@ public:
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcProduct >::ptr ShapeOfProduct() const; // INVERSE IfcProduct::Representation
     IfcTemplatedEntityList< IfcShapeAspect >::ptr HasShapeAspects() const; // INVERSE IfcShapeAspect::PartOfProductDefinitionShape
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcProductDefinitionShape (IfcEntityInstanceData* e);
@@ -17484,7 +17142,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 3: return Type::IfcProfileDef; } return IfcExtendedProperties::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 3: return "ProfileDefinition"; } return IfcExtendedProperties::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcProfileProperties (IfcEntityInstanceData* e);
@@ -17515,7 +17172,6 @@ public:
     IfcTemplatedEntityList< IfcComplexProperty >::ptr PartOfComplex() const; // INVERSE IfcComplexProperty::HasProperties
     IfcTemplatedEntityList< IfcResourceConstraintRelationship >::ptr HasConstraints() const; // INVERSE IfcResourceConstraintRelationship::RelatedResourceObjects
     IfcTemplatedEntityList< IfcResourceApprovalRelationship >::ptr HasApprovals() const; // INVERSE IfcResourceApprovalRelationship::RelatedResourceObjects
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcProperty (IfcEntityInstanceData* e);
@@ -17581,7 +17237,6 @@ public:
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcRelDeclares >::ptr HasContext() const; // INVERSE IfcRelDeclares::RelatedDefinitions
     IfcTemplatedEntityList< IfcRelAssociates >::ptr HasAssociations() const; // INVERSE IfcRelAssociates::RelatedObjects
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPropertyDefinition (IfcEntityInstanceData* e);
@@ -17614,7 +17269,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 2: return Type::IfcProperty; case 3: return Type::IfcProperty; case 4: return Type::IfcText; } return IfcResourceLevelRelationship::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 2: return "DependingProperty"; case 3: return "DependantProperty"; case 4: return "Expression"; } return IfcResourceLevelRelationship::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPropertyDependencyRelationship (IfcEntityInstanceData* e);
@@ -17673,7 +17327,6 @@ public:
     IfcTemplatedEntityList< IfcTypeObject >::ptr DefinesType() const; // INVERSE IfcTypeObject::HasPropertySets
     IfcTemplatedEntityList< IfcRelDefinesByTemplate >::ptr IsDefinedBy() const; // INVERSE IfcRelDefinesByTemplate::RelatedPropertySets
     IfcTemplatedEntityList< IfcRelDefinesByProperties >::ptr DefinesOccurrence() const; // INVERSE IfcRelDefinesByProperties::RelatingPropertyDefinition
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPropertySetDefinition (IfcEntityInstanceData* e);
@@ -17712,7 +17365,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcPropertyDefinition::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcPropertyDefinition::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPropertyTemplateDefinition (IfcEntityInstanceData* e);
@@ -17727,7 +17379,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcPropertySetDefinition::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcPropertySetDefinition::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcQuantitySet (IfcEntityInstanceData* e);
@@ -17781,7 +17432,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 3: return Type::IfcPositiveLengthMeasure; case 4: return Type::IfcPositiveLengthMeasure; } return IfcParameterizedProfileDef::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 3: return "XDim"; case 4: return "YDim"; } return IfcParameterizedProfileDef::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRectangleProfileDef (IfcEntityInstanceData* e);
@@ -17806,7 +17456,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcTimeMeasure; case 9: return Type::IfcTimeSeriesValue; } return IfcTimeSeries::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "TimeStep"; case 9: return "Values"; } return IfcTimeSeries::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRegularTimeSeries (IfcEntityInstanceData* e);
@@ -17851,7 +17500,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcAreaMeasure; case 1: return Type::IfcLabel; case 2: return Type::IfcReinforcingBarSurfaceEnum; case 3: return Type::IfcLengthMeasure; case 4: return Type::IfcPositiveLengthMeasure; case 5: return Type::IfcCountMeasure; } return IfcPreDefinedProperties::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "TotalCrossSectionArea"; case 1: return "SteelGrade"; case 2: return "BarSurface"; case 3: return "EffectiveDepth"; case 4: return "NominalBarDiameter"; case 5: return "BarCount"; } return IfcPreDefinedProperties::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcReinforcementBarProperties (IfcEntityInstanceData* e);
@@ -17873,7 +17521,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcRoot::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcRoot::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRelationship (IfcEntityInstanceData* e);
@@ -17899,7 +17546,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 2: return Type::IfcResourceObjectSelect; case 3: return Type::IfcApproval; } return IfcResourceLevelRelationship::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 2: return "RelatedResourceObjects"; case 3: return "RelatingApproval"; } return IfcResourceLevelRelationship::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcResourceApprovalRelationship (IfcEntityInstanceData* e);
@@ -17939,7 +17585,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 2: return Type::IfcConstraint; case 3: return Type::IfcResourceObjectSelect; } return IfcResourceLevelRelationship::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 2: return "RelatingConstraint"; case 3: return "RelatedResourceObjects"; } return IfcResourceLevelRelationship::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcResourceConstraintRelationship (IfcEntityInstanceData* e);
@@ -18030,7 +17675,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 3: return Type::IfcDuration; case 4: return Type::IfcPositiveRatioMeasure; case 5: return Type::IfcDateTime; case 6: return Type::IfcDateTime; case 7: return Type::IfcLabel; case 8: return Type::IfcDuration; case 9: return Type::IfcBoolean; case 10: return Type::IfcDateTime; case 11: return Type::IfcDuration; case 12: return Type::IfcPositiveRatioMeasure; case 13: return Type::IfcDateTime; case 14: return Type::IfcDateTime; case 15: return Type::IfcDuration; case 16: return Type::IfcPositiveRatioMeasure; case 17: return Type::IfcPositiveRatioMeasure; } return IfcSchedulingTime::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 3: return "ScheduleWork"; case 4: return "ScheduleUsage"; case 5: return "ScheduleStart"; case 6: return "ScheduleFinish"; case 7: return "ScheduleContour"; case 8: return "LevelingDelay"; case 9: return "IsOverAllocated"; case 10: return "StatusTime"; case 11: return "ActualWork"; case 12: return "ActualUsage"; case 13: return "ActualStart"; case 14: return "ActualFinish"; case 15: return "RemainingWork"; case 16: return "RemainingUsage"; case 17: return "Completion"; } return IfcSchedulingTime::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcResourceTime (IfcEntityInstanceData* e);
@@ -18084,7 +17728,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 5: return Type::IfcPositiveLengthMeasure; } return IfcRectangleProfileDef::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 5: return "RoundingRadius"; } return IfcRectangleProfileDef::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRoundedRectangleProfileDef (IfcEntityInstanceData* e);
@@ -18114,7 +17757,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcSectionTypeEnum; case 1: return Type::IfcProfileDef; case 2: return Type::IfcProfileDef; } return IfcPreDefinedProperties::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "SectionType"; case 1: return "StartProfile"; case 2: return "EndProfile"; } return IfcPreDefinedProperties::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcSectionProperties (IfcEntityInstanceData* e);
@@ -18155,7 +17797,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcLengthMeasure; case 1: return Type::IfcLengthMeasure; case 2: return Type::IfcLengthMeasure; case 3: return Type::IfcReinforcingBarRoleEnum; case 4: return Type::IfcSectionProperties; case 5: return Type::IfcReinforcementBarProperties; } return IfcPreDefinedProperties::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "LongitudinalStartPosition"; case 1: return "LongitudinalEndPosition"; case 2: return "TransversePosition"; case 3: return "ReinforcementRole"; case 4: return "SectionDefinition"; case 5: return "CrossSectionReinforcementDefinitions"; } return IfcPreDefinedProperties::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcSectionReinforcementProperties (IfcEntityInstanceData* e);
@@ -18231,7 +17872,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcCompositeCurve; case 1: return Type::IfcProfileDef; case 2: return Type::IfcAxis2Placement3D; } return IfcGeometricRepresentationItem::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "SpineCurve"; case 1: return "CrossSections"; case 2: return "CrossSectionPositions"; } return IfcGeometricRepresentationItem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcSectionedSpine (IfcEntityInstanceData* e);
@@ -18259,7 +17899,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcShell; } return IfcGeometricRepresentationItem::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "SbsmBoundary"; } return IfcGeometricRepresentationItem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcShellBasedSurfaceModel (IfcEntityInstanceData* e);
@@ -18276,7 +17915,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcProperty::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcProperty::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcSimpleProperty (IfcEntityInstanceData* e);
@@ -18314,7 +17952,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 1: return Type::IfcLengthMeasure; case 2: return Type::IfcLengthMeasure; case 3: return Type::IfcLengthMeasure; } return IfcStructuralConnectionCondition::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 1: return "SlippageX"; case 2: return "SlippageY"; case 3: return "SlippageZ"; } return IfcStructuralConnectionCondition::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcSlippageConnectionCondition (IfcEntityInstanceData* e);
@@ -18333,7 +17970,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcGeometricRepresentationItem::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcGeometricRepresentationItem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcSolidModel (IfcEntityInstanceData* e);
@@ -18382,7 +18018,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 1: return Type::IfcLinearForceMeasure; case 2: return Type::IfcLinearForceMeasure; case 3: return Type::IfcLinearForceMeasure; case 4: return Type::IfcLinearMomentMeasure; case 5: return Type::IfcLinearMomentMeasure; case 6: return Type::IfcLinearMomentMeasure; } return IfcStructuralLoadStatic::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 1: return "LinearForceX"; case 2: return "LinearForceY"; case 3: return "LinearForceZ"; case 4: return "LinearMomentX"; case 5: return "LinearMomentY"; case 6: return "LinearMomentZ"; } return IfcStructuralLoadStatic::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcStructuralLoadLinearForce (IfcEntityInstanceData* e);
@@ -18416,7 +18051,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 1: return Type::IfcPlanarForceMeasure; case 2: return Type::IfcPlanarForceMeasure; case 3: return Type::IfcPlanarForceMeasure; } return IfcStructuralLoadStatic::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 1: return "PlanarForceX"; case 2: return "PlanarForceY"; case 3: return "PlanarForceZ"; } return IfcStructuralLoadStatic::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcStructuralLoadPlanarForce (IfcEntityInstanceData* e);
@@ -18465,7 +18099,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 1: return Type::IfcLengthMeasure; case 2: return Type::IfcLengthMeasure; case 3: return Type::IfcLengthMeasure; case 4: return Type::IfcPlaneAngleMeasure; case 5: return Type::IfcPlaneAngleMeasure; case 6: return Type::IfcPlaneAngleMeasure; } return IfcStructuralLoadStatic::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 1: return "DisplacementX"; case 2: return "DisplacementY"; case 3: return "DisplacementZ"; case 4: return "RotationalDisplacementRX"; case 5: return "RotationalDisplacementRY"; case 6: return "RotationalDisplacementRZ"; } return IfcStructuralLoadStatic::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcStructuralLoadSingleDisplacement (IfcEntityInstanceData* e);
@@ -18487,7 +18120,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 7: return Type::IfcCurvatureMeasure; } return IfcStructuralLoadSingleDisplacement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 7: return "Distortion"; } return IfcStructuralLoadSingleDisplacement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcStructuralLoadSingleDisplacementDistortion (IfcEntityInstanceData* e);
@@ -18537,7 +18169,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 1: return Type::IfcForceMeasure; case 2: return Type::IfcForceMeasure; case 3: return Type::IfcForceMeasure; case 4: return Type::IfcTorqueMeasure; case 5: return Type::IfcTorqueMeasure; case 6: return Type::IfcTorqueMeasure; } return IfcStructuralLoadStatic::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 1: return "ForceX"; case 2: return "ForceY"; case 3: return "ForceZ"; case 4: return "MomentX"; case 5: return "MomentY"; case 6: return "MomentZ"; } return IfcStructuralLoadStatic::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcStructuralLoadSingleForce (IfcEntityInstanceData* e);
@@ -18564,7 +18195,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 7: return Type::IfcWarpingMomentMeasure; } return IfcStructuralLoadSingleForce::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 7: return "WarpingMoment"; } return IfcStructuralLoadSingleForce::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcStructuralLoadSingleForceWarping (IfcEntityInstanceData* e);
@@ -18591,7 +18221,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 2: return Type::IfcEdge; } return IfcEdge::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 2: return "ParentEdge"; } return IfcEdge::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcSubedge (IfcEntityInstanceData* e);
@@ -18615,7 +18244,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcGeometricRepresentationItem::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcGeometricRepresentationItem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcSurface (IfcEntityInstanceData* e);
@@ -18717,7 +18345,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 2: return Type::IfcColourOrFactor; case 3: return Type::IfcColourOrFactor; case 4: return Type::IfcColourOrFactor; case 5: return Type::IfcColourOrFactor; case 6: return Type::IfcColourOrFactor; case 7: return Type::IfcSpecularHighlightSelect; case 8: return Type::IfcReflectanceMethodEnum; } return IfcSurfaceStyleShading::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 2: return "DiffuseColour"; case 3: return "TransmissionColour"; case 4: return "DiffuseTransmissionColour"; case 5: return "ReflectionColour"; case 6: return "SpecularColour"; case 7: return "SpecularHighlight"; case 8: return "ReflectanceMethod"; } return IfcSurfaceStyleShading::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcSurfaceStyleRendering (IfcEntityInstanceData* e);
@@ -18757,7 +18384,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcProfileDef; case 1: return Type::IfcAxis2Placement3D; } return IfcSolidModel::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "SweptArea"; case 1: return "Position"; } return IfcSolidModel::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcSweptAreaSolid (IfcEntityInstanceData* e);
@@ -18849,7 +18475,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcCurve; case 1: return Type::IfcPositiveLengthMeasure; case 2: return Type::IfcPositiveLengthMeasure; case 3: return Type::IfcParameterValue; case 4: return Type::IfcParameterValue; } return IfcSolidModel::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Directrix"; case 1: return "Radius"; case 2: return "InnerRadius"; case 3: return "StartParam"; case 4: return "EndParam"; } return IfcSolidModel::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcSweptDiskSolid (IfcEntityInstanceData* e);
@@ -18878,7 +18503,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 5: return Type::IfcPositiveLengthMeasure; } return IfcSweptDiskSolid::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 5: return "FilletRadius"; } return IfcSweptDiskSolid::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcSweptDiskSolidPolygonal (IfcEntityInstanceData* e);
@@ -18905,7 +18529,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcProfileDef; case 1: return Type::IfcAxis2Placement3D; } return IfcSurface::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "SweptCurve"; case 1: return "Position"; } return IfcSurface::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcSweptSurface (IfcEntityInstanceData* e);
@@ -18984,7 +18607,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 3: return Type::IfcPositiveLengthMeasure; case 4: return Type::IfcPositiveLengthMeasure; case 5: return Type::IfcPositiveLengthMeasure; case 6: return Type::IfcPositiveLengthMeasure; case 7: return Type::IfcNonNegativeLengthMeasure; case 8: return Type::IfcNonNegativeLengthMeasure; case 9: return Type::IfcNonNegativeLengthMeasure; case 10: return Type::IfcPlaneAngleMeasure; case 11: return Type::IfcPlaneAngleMeasure; } return IfcParameterizedProfileDef::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 3: return "Depth"; case 4: return "FlangeWidth"; case 5: return "WebThickness"; case 6: return "FlangeThickness"; case 7: return "FilletRadius"; case 8: return "FlangeEdgeRadius"; case 9: return "WebEdgeRadius"; case 10: return "WebSlope"; case 11: return "FlangeSlope"; } return IfcParameterizedProfileDef::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcTShapeProfileDef (IfcEntityInstanceData* e);
@@ -18999,7 +18621,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcGeometricRepresentationItem::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcGeometricRepresentationItem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcTessellatedItem (IfcEntityInstanceData* e);
@@ -19033,7 +18654,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcPresentableText; case 1: return Type::IfcAxis2Placement; case 2: return Type::IfcTextPath; } return IfcGeometricRepresentationItem::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Literal"; case 1: return "Placement"; case 2: return "Path"; } return IfcGeometricRepresentationItem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcTextLiteral (IfcEntityInstanceData* e);
@@ -19062,7 +18682,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 3: return Type::IfcPlanarExtent; case 4: return Type::IfcBoxAlignment; } return IfcTextLiteral::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 3: return "Extent"; case 4: return "BoxAlignment"; } return IfcTextLiteral::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcTextLiteralWithExtent (IfcEntityInstanceData* e);
@@ -19165,7 +18784,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 1: return Type::IfcTextFontName; case 2: return Type::IfcFontStyle; case 3: return Type::IfcFontVariant; case 4: return Type::IfcFontWeight; case 5: return Type::IfcSizeSelect; } return IfcPreDefinedTextFont::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 1: return "FontFamily"; case 2: return "FontStyle"; case 3: return "FontVariant"; case 4: return "FontWeight"; case 5: return "FontSize"; } return IfcPreDefinedTextFont::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcTextStyleFontModel (IfcEntityInstanceData* e);
@@ -19229,7 +18847,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 3: return Type::IfcPositiveLengthMeasure; case 4: return Type::IfcPositiveLengthMeasure; case 5: return Type::IfcPositiveLengthMeasure; case 6: return Type::IfcLengthMeasure; } return IfcParameterizedProfileDef::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 3: return "BottomXDim"; case 4: return "TopXDim"; case 5: return "YDim"; case 6: return "TopXOffset"; } return IfcParameterizedProfileDef::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcTrapeziumProfileDef (IfcEntityInstanceData* e);
@@ -19293,7 +18910,6 @@ public:
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 4: return "ApplicableOccurrence"; case 5: return "HasPropertySets"; } return IfcObjectDefinition::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcRelDefinesByType >::ptr Types() const; // INVERSE IfcRelDefinesByType::RelatingType
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcTypeObject (IfcEntityInstanceData* e);
@@ -19353,7 +18969,6 @@ public:
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 6: return "Identification"; case 7: return "LongDescription"; case 8: return "ProcessType"; } return IfcTypeObject::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcRelAssignsToProcess >::ptr OperatesOn() const; // INVERSE IfcRelAssignsToProcess::RelatingProcess
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcTypeProcess (IfcEntityInstanceData* e);
@@ -19444,7 +19059,6 @@ public:
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 6: return "RepresentationMaps"; case 7: return "Tag"; } return IfcTypeObject::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcRelAssignsToProduct >::ptr ReferencedBy() const; // INVERSE IfcRelAssignsToProduct::RelatingProduct
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcTypeProduct (IfcEntityInstanceData* e);
@@ -19488,7 +19102,6 @@ public:
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 6: return "Identification"; case 7: return "LongDescription"; case 8: return "ResourceType"; } return IfcTypeObject::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcRelAssignsToResource >::ptr ResourceOf() const; // INVERSE IfcRelAssignsToResource::RelatingResource
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcTypeResource (IfcEntityInstanceData* e);
@@ -19557,7 +19170,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 3: return Type::IfcPositiveLengthMeasure; case 4: return Type::IfcPositiveLengthMeasure; case 5: return Type::IfcPositiveLengthMeasure; case 6: return Type::IfcPositiveLengthMeasure; case 7: return Type::IfcNonNegativeLengthMeasure; case 8: return Type::IfcNonNegativeLengthMeasure; case 9: return Type::IfcPlaneAngleMeasure; } return IfcParameterizedProfileDef::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 3: return "Depth"; case 4: return "FlangeWidth"; case 5: return "WebThickness"; case 6: return "FlangeThickness"; case 7: return "FilletRadius"; case 8: return "EdgeRadius"; case 9: return "FlangeSlope"; } return IfcParameterizedProfileDef::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcUShapeProfileDef (IfcEntityInstanceData* e);
@@ -19584,7 +19196,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcDirection; case 1: return Type::IfcLengthMeasure; } return IfcGeometricRepresentationItem::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Orientation"; case 1: return "Magnitude"; } return IfcGeometricRepresentationItem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcVector (IfcEntityInstanceData* e);
@@ -19613,7 +19224,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcVertex; } return IfcLoop::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "LoopVertex"; } return IfcLoop::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcVertexLoop (IfcEntityInstanceData* e);
@@ -19657,7 +19267,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcWindowStyleConstructionEnum; case 9: return Type::IfcWindowStyleOperationEnum; case 10: return Type::IfcBoolean; case 11: return Type::IfcBoolean; } return IfcTypeProduct::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "ConstructionType"; case 9: return "OperationType"; case 10: return "ParameterTakesPrecedence"; case 11: return "Sizeable"; } return IfcTypeProduct::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcWindowStyle (IfcEntityInstanceData* e);
@@ -19718,7 +19327,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 3: return Type::IfcPositiveLengthMeasure; case 4: return Type::IfcPositiveLengthMeasure; case 5: return Type::IfcPositiveLengthMeasure; case 6: return Type::IfcPositiveLengthMeasure; case 7: return Type::IfcNonNegativeLengthMeasure; case 8: return Type::IfcNonNegativeLengthMeasure; } return IfcParameterizedProfileDef::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 3: return "Depth"; case 4: return "FlangeWidth"; case 5: return "WebThickness"; case 6: return "FlangeThickness"; case 7: return "FilletRadius"; case 8: return "EdgeRadius"; } return IfcParameterizedProfileDef::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcZShapeProfileDef (IfcEntityInstanceData* e);
@@ -19745,7 +19353,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcFaceSurface::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcFaceSurface::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcAdvancedFace (IfcEntityInstanceData* e);
@@ -19791,7 +19398,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcCurve; case 1: return Type::IfcCurve; } return IfcGeometricRepresentationItem::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "OuterBoundary"; case 1: return "InnerBoundaries"; } return IfcGeometricRepresentationItem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcAnnotationFillArea (IfcEntityInstanceData* e);
@@ -19883,7 +19489,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 3: return Type::IfcPositiveLengthMeasure; case 4: return Type::IfcPositiveLengthMeasure; case 5: return Type::IfcPositiveLengthMeasure; case 6: return Type::IfcPositiveLengthMeasure; case 7: return Type::IfcNonNegativeLengthMeasure; case 8: return Type::IfcPositiveLengthMeasure; case 9: return Type::IfcPositiveLengthMeasure; case 10: return Type::IfcNonNegativeLengthMeasure; case 11: return Type::IfcNonNegativeLengthMeasure; case 12: return Type::IfcPlaneAngleMeasure; case 13: return Type::IfcNonNegativeLengthMeasure; case 14: return Type::IfcPlaneAngleMeasure; } return IfcParameterizedProfileDef::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 3: return "BottomFlangeWidth"; case 4: return "OverallDepth"; case 5: return "WebThickness"; case 6: return "BottomFlangeThickness"; case 7: return "BottomFlangeFilletRadius"; case 8: return "TopFlangeWidth"; case 9: return "TopFlangeThickness"; case 10: return "TopFlangeFilletRadius"; case 11: return "BottomFlangeEdgeRadius"; case 12: return "BottomFlangeSlope"; case 13: return "TopFlangeEdgeRadius"; case 14: return "TopFlangeSlope"; } return IfcParameterizedProfileDef::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcAsymmetricIShapeProfileDef (IfcEntityInstanceData* e);
@@ -19911,7 +19516,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 1: return Type::IfcDirection; } return IfcPlacement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 1: return "Axis"; } return IfcPlacement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcAxis1Placement (IfcEntityInstanceData* e);
@@ -19941,7 +19545,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 1: return Type::IfcDirection; } return IfcPlacement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 1: return "RefDirection"; } return IfcPlacement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcAxis2Placement2D (IfcEntityInstanceData* e);
@@ -19978,7 +19581,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 1: return Type::IfcDirection; case 2: return Type::IfcDirection; } return IfcPlacement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 1: return "Axis"; case 2: return "RefDirection"; } return IfcPlacement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcAxis2Placement3D (IfcEntityInstanceData* e);
@@ -20027,7 +19629,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcBooleanOperator; case 1: return Type::IfcBooleanOperand; case 2: return Type::IfcBooleanOperand; } return IfcGeometricRepresentationItem::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Operator"; case 1: return "FirstOperand"; case 2: return "SecondOperand"; } return IfcGeometricRepresentationItem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcBooleanResult (IfcEntityInstanceData* e);
@@ -20053,7 +19654,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcSurface::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcSurface::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcBoundedSurface (IfcEntityInstanceData* e);
@@ -20101,7 +19701,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcCartesianPoint; case 1: return Type::IfcPositiveLengthMeasure; case 2: return Type::IfcPositiveLengthMeasure; case 3: return Type::IfcPositiveLengthMeasure; } return IfcGeometricRepresentationItem::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Corner"; case 1: return "XDim"; case 2: return "YDim"; case 3: return "ZDim"; } return IfcGeometricRepresentationItem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcBoundingBox (IfcEntityInstanceData* e);
@@ -20148,7 +19747,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 2: return Type::IfcBoundingBox; } return IfcHalfSpaceSolid::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 2: return "Enclosure"; } return IfcHalfSpaceSolid::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcBoxedHalfSpace (IfcEntityInstanceData* e);
@@ -20201,7 +19799,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 3: return Type::IfcPositiveLengthMeasure; case 4: return Type::IfcPositiveLengthMeasure; case 5: return Type::IfcPositiveLengthMeasure; case 6: return Type::IfcPositiveLengthMeasure; case 7: return Type::IfcNonNegativeLengthMeasure; } return IfcParameterizedProfileDef::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 3: return "Depth"; case 4: return "Width"; case 5: return "WallThickness"; case 6: return "Girth"; case 7: return "InternalFilletRadius"; } return IfcParameterizedProfileDef::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcCShapeProfileDef (IfcEntityInstanceData* e);
@@ -20225,7 +19822,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcLengthMeasure; } return IfcPoint::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Coordinates"; } return IfcPoint::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcCartesianPoint (IfcEntityInstanceData* e);
@@ -20240,7 +19836,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcGeometricRepresentationItem::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcGeometricRepresentationItem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcCartesianPointList (IfcEntityInstanceData* e);
@@ -20257,7 +19852,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcLengthMeasure; } return IfcCartesianPointList::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "CoordList"; } return IfcCartesianPointList::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcCartesianPointList2D (IfcEntityInstanceData* e);
@@ -20274,7 +19868,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcLengthMeasure; } return IfcCartesianPointList::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "CoordList"; } return IfcCartesianPointList::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcCartesianPointList3D (IfcEntityInstanceData* e);
@@ -20336,7 +19929,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcDirection; case 1: return Type::IfcDirection; case 2: return Type::IfcCartesianPoint; case 3: return Type::IfcReal; } return IfcGeometricRepresentationItem::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Axis1"; case 1: return "Axis2"; case 2: return "LocalOrigin"; case 3: return "Scale"; } return IfcGeometricRepresentationItem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcCartesianTransformationOperator (IfcEntityInstanceData* e);
@@ -20355,7 +19947,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcCartesianTransformationOperator::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcCartesianTransformationOperator::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcCartesianTransformationOperator2D (IfcEntityInstanceData* e);
@@ -20384,7 +19975,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 4: return Type::IfcReal; } return IfcCartesianTransformationOperator2D::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 4: return "Scale2"; } return IfcCartesianTransformationOperator2D::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcCartesianTransformationOperator2DnonUniform (IfcEntityInstanceData* e);
@@ -20408,7 +19998,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 4: return Type::IfcDirection; } return IfcCartesianTransformationOperator::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 4: return "Axis3"; } return IfcCartesianTransformationOperator::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcCartesianTransformationOperator3D (IfcEntityInstanceData* e);
@@ -20443,7 +20032,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 5: return Type::IfcReal; case 6: return Type::IfcReal; } return IfcCartesianTransformationOperator3D::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 5: return "Scale2"; case 6: return "Scale3"; } return IfcCartesianTransformationOperator3D::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcCartesianTransformationOperator3DnonUniform (IfcEntityInstanceData* e);
@@ -20472,7 +20060,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 3: return Type::IfcPositiveLengthMeasure; } return IfcParameterizedProfileDef::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 3: return "Radius"; } return IfcParameterizedProfileDef::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcCircleProfileDef (IfcEntityInstanceData* e);
@@ -20535,7 +20122,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcConnectedFaceSet::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcConnectedFaceSet::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcClosedShell (IfcEntityInstanceData* e);
@@ -20572,7 +20158,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 1: return Type::IfcNormalisedRatioMeasure; case 2: return Type::IfcNormalisedRatioMeasure; case 3: return Type::IfcNormalisedRatioMeasure; } return IfcColourSpecification::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 1: return "Red"; case 2: return "Green"; case 3: return "Blue"; } return IfcColourSpecification::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcColourRgb (IfcEntityInstanceData* e);
@@ -20598,7 +20183,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 2: return Type::IfcIdentifier; case 3: return Type::IfcProperty; } return IfcProperty::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 2: return "UsageName"; case 3: return "HasProperties"; } return IfcProperty::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcComplexProperty (IfcEntityInstanceData* e);
@@ -20631,7 +20215,6 @@ public:
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Transition"; case 1: return "SameSense"; case 2: return "ParentCurve"; } return IfcGeometricRepresentationItem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcCompositeCurve >::ptr UsingCurves() const; // INVERSE IfcCompositeCurve::Segments
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcCompositeCurveSegment (IfcEntityInstanceData* e);
@@ -20668,7 +20251,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcAppliedValue; case 10: return Type::IfcPhysicalQuantity; } return IfcTypeResource::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "BaseCosts"; case 10: return "BaseQuantity"; } return IfcTypeResource::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcConstructionResourceType (IfcEntityInstanceData* e);
@@ -20726,7 +20308,6 @@ public:
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcRelDefinesByProperties >::ptr IsDefinedBy() const; // INVERSE IfcRelDefinesByProperties::RelatedObjects
     IfcTemplatedEntityList< IfcRelDeclares >::ptr Declares() const; // INVERSE IfcRelDeclares::RelatingContext
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcContext (IfcEntityInstanceData* e);
@@ -20753,7 +20334,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 11: return Type::IfcCrewResourceTypeEnum; } return IfcConstructionResourceType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 11: return "PredefinedType"; } return IfcConstructionResourceType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcCrewResourceType (IfcEntityInstanceData* e);
@@ -20775,7 +20355,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcAxis2Placement3D; } return IfcGeometricRepresentationItem::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Position"; } return IfcGeometricRepresentationItem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcCsgPrimitive3D (IfcEntityInstanceData* e);
@@ -20833,7 +20412,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcCsgSelect; } return IfcSolidModel::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "TreeRootExpression"; } return IfcSolidModel::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcCsgSolid (IfcEntityInstanceData* e);
@@ -20857,7 +20435,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcGeometricRepresentationItem::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcGeometricRepresentationItem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcCurve (IfcEntityInstanceData* e);
@@ -20893,7 +20470,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcPlane; case 1: return Type::IfcCurve; case 2: return Type::IfcCurve; } return IfcBoundedSurface::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "BasisSurface"; case 1: return "OuterBoundary"; case 2: return "InnerBoundaries"; } return IfcBoundedSurface::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcCurveBoundedPlane (IfcEntityInstanceData* e);
@@ -20936,7 +20512,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcSurface; case 1: return Type::IfcBoundaryCurve; case 2: return Type::IfcBoolean; } return IfcBoundedSurface::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "BasisSurface"; case 1: return "Boundaries"; case 2: return "ImplicitOuter"; } return IfcBoundedSurface::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcCurveBoundedSurface (IfcEntityInstanceData* e);
@@ -20960,7 +20535,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcReal; } return IfcGeometricRepresentationItem::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "DirectionRatios"; } return IfcGeometricRepresentationItem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcDirection (IfcEntityInstanceData* e);
@@ -21012,7 +20586,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcDoorStyleOperationEnum; case 9: return Type::IfcDoorStyleConstructionEnum; case 10: return Type::IfcBoolean; case 11: return Type::IfcBoolean; } return IfcTypeProduct::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "OperationType"; case 9: return "ConstructionType"; case 10: return "ParameterTakesPrecedence"; case 11: return "Sizeable"; } return IfcTypeProduct::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcDoorStyle (IfcEntityInstanceData* e);
@@ -21040,7 +20613,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcOrientedEdge; } return IfcLoop::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "EdgeList"; } return IfcLoop::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcEdgeLoop (IfcEntityInstanceData* e);
@@ -21141,7 +20713,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 4: return Type::IfcLabel; case 5: return Type::IfcPhysicalQuantity; } return IfcQuantitySet::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 4: return "MethodOfMeasurement"; case 5: return "Quantities"; } return IfcQuantitySet::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcElementQuantity (IfcEntityInstanceData* e);
@@ -21182,7 +20753,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcLabel; } return IfcTypeProduct::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "ElementType"; } return IfcTypeProduct::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcElementType (IfcEntityInstanceData* e);
@@ -21204,7 +20774,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcAxis2Placement3D; } return IfcSurface::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Position"; } return IfcSurface::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcElementarySurface (IfcEntityInstanceData* e);
@@ -21240,7 +20809,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 3: return Type::IfcPositiveLengthMeasure; case 4: return Type::IfcPositiveLengthMeasure; } return IfcParameterizedProfileDef::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 3: return "SemiAxis1"; case 4: return "SemiAxis2"; } return IfcParameterizedProfileDef::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcEllipseProfileDef (IfcEntityInstanceData* e);
@@ -21275,7 +20843,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcEventTypeEnum; case 10: return Type::IfcEventTriggerTypeEnum; case 11: return Type::IfcLabel; } return IfcTypeProcess::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; case 10: return "EventTriggerType"; case 11: return "UserDefinedEventTriggerType"; } return IfcTypeProcess::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcEventType (IfcEntityInstanceData* e);
@@ -21364,7 +20931,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 2: return Type::IfcDirection; case 3: return Type::IfcPositiveLengthMeasure; } return IfcSweptAreaSolid::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 2: return "ExtrudedDirection"; case 3: return "Depth"; } return IfcSweptAreaSolid::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcExtrudedAreaSolid (IfcEntityInstanceData* e);
@@ -21479,7 +21045,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 4: return Type::IfcProfileDef; } return IfcExtrudedAreaSolid::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 4: return "EndSweptArea"; } return IfcExtrudedAreaSolid::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcExtrudedAreaSolidTapered (IfcEntityInstanceData* e);
@@ -21508,7 +21073,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcConnectedFaceSet; } return IfcGeometricRepresentationItem::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "FbsmFaces"; } return IfcGeometricRepresentationItem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcFaceBasedSurfaceModel (IfcEntityInstanceData* e);
@@ -21596,7 +21160,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcCurveStyle; case 1: return Type::IfcHatchLineDistanceSelect; case 2: return Type::IfcCartesianPoint; case 3: return Type::IfcCartesianPoint; case 4: return Type::IfcPlaneAngleMeasure; } return IfcGeometricRepresentationItem::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "HatchLineAppearance"; case 1: return "StartOfNextHatchLine"; case 2: return "PointOfReferenceHatchLine"; case 3: return "PatternStart"; case 4: return "HatchLineAngle"; } return IfcGeometricRepresentationItem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcFillAreaStyleHatching (IfcEntityInstanceData* e);
@@ -21624,7 +21187,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcVector; case 1: return Type::IfcStyledItem; case 2: return Type::IfcPositiveRatioMeasure; } return IfcGeometricRepresentationItem::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "TilingPattern"; case 1: return "Tiles"; case 2: return "TilingScale"; } return IfcGeometricRepresentationItem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcFillAreaStyleTiles (IfcEntityInstanceData* e);
@@ -21712,7 +21274,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 2: return Type::IfcCurve; case 3: return Type::IfcParameterValue; case 4: return Type::IfcParameterValue; case 5: return Type::IfcDirection; } return IfcSweptAreaSolid::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 2: return "Directrix"; case 3: return "StartParam"; case 4: return "EndParam"; case 5: return "FixedReference"; } return IfcSweptAreaSolid::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcFixedReferenceSweptAreaSolid (IfcEntityInstanceData* e);
@@ -21754,7 +21315,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcElementType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcElementType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcFurnishingElementType (IfcEntityInstanceData* e);
@@ -21812,7 +21372,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcAssemblyPlaceEnum; case 10: return Type::IfcFurnitureTypeEnum; } return IfcFurnishingElementType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "AssemblyPlace"; case 10: return "PredefinedType"; } return IfcFurnishingElementType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcFurnitureType (IfcEntityInstanceData* e);
@@ -21890,7 +21449,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcGeographicElementTypeEnum; } return IfcElementType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcElementType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcGeographicElementType (IfcEntityInstanceData* e);
@@ -21911,7 +21469,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcGeometricSet::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcGeometricSet::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcGeometricCurveSet (IfcEntityInstanceData* e);
@@ -22013,7 +21570,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 3: return Type::IfcPositiveLengthMeasure; case 4: return Type::IfcPositiveLengthMeasure; case 5: return Type::IfcPositiveLengthMeasure; case 6: return Type::IfcPositiveLengthMeasure; case 7: return Type::IfcNonNegativeLengthMeasure; case 8: return Type::IfcNonNegativeLengthMeasure; case 9: return Type::IfcPlaneAngleMeasure; } return IfcParameterizedProfileDef::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 3: return "OverallWidth"; case 4: return "OverallDepth"; case 5: return "WebThickness"; case 6: return "FlangeThickness"; case 7: return "FilletRadius"; case 8: return "FlangeEdgeRadius"; case 9: return "FlangeSlope"; } return IfcParameterizedProfileDef::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcIShapeProfileDef (IfcEntityInstanceData* e);
@@ -22031,7 +21587,6 @@ public:
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "CoordIndex"; } return IfcTessellatedItem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcPolygonalFaceSet >::ptr ToFaceSet() const; // INVERSE IfcPolygonalFaceSet::Faces
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcIndexedPolygonalFace (IfcEntityInstanceData* e);
@@ -22048,7 +21603,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 1: return Type::IfcPositiveInteger; } return IfcIndexedPolygonalFace::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 1: return "InnerCoordIndices"; } return IfcIndexedPolygonalFace::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcIndexedPolygonalFaceWithVoids (IfcEntityInstanceData* e);
@@ -22139,7 +21693,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 3: return Type::IfcPositiveLengthMeasure; case 4: return Type::IfcPositiveLengthMeasure; case 5: return Type::IfcPositiveLengthMeasure; case 6: return Type::IfcNonNegativeLengthMeasure; case 7: return Type::IfcNonNegativeLengthMeasure; case 8: return Type::IfcPlaneAngleMeasure; } return IfcParameterizedProfileDef::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 3: return "Depth"; case 4: return "Width"; case 5: return "Thickness"; case 6: return "FilletRadius"; case 7: return "EdgeRadius"; case 8: return "LegSlope"; } return IfcParameterizedProfileDef::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcLShapeProfileDef (IfcEntityInstanceData* e);
@@ -22167,7 +21720,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 11: return Type::IfcLaborResourceTypeEnum; } return IfcConstructionResourceType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 11: return "PredefinedType"; } return IfcConstructionResourceType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcLaborResourceType (IfcEntityInstanceData* e);
@@ -22200,7 +21752,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcCartesianPoint; case 1: return Type::IfcVector; } return IfcCurve::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Pnt"; case 1: return "Dir"; } return IfcCurve::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcLine (IfcEntityInstanceData* e);
@@ -22280,7 +21831,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcClosedShell; } return IfcSolidModel::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Outer"; } return IfcSolidModel::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcManifoldSolidBrep (IfcEntityInstanceData* e);
@@ -22385,7 +21935,6 @@ public:
     IfcTemplatedEntityList< IfcRelDefinesByObject >::ptr Declares() const; // INVERSE IfcRelDefinesByObject::RelatingObject
     IfcTemplatedEntityList< IfcRelDefinesByType >::ptr IsTypedBy() const; // INVERSE IfcRelDefinesByType::RelatedObjects
     IfcTemplatedEntityList< IfcRelDefinesByProperties >::ptr IsDefinedBy() const; // INVERSE IfcRelDefinesByProperties::RelatedObjects
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcObject (IfcEntityInstanceData* e);
@@ -22419,7 +21968,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcCurve; case 1: return Type::IfcLengthMeasure; case 2: return Type::IfcLogical; } return IfcCurve::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "BasisCurve"; case 1: return "Distance"; case 2: return "SelfIntersect"; } return IfcCurve::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcOffsetCurve2D (IfcEntityInstanceData* e);
@@ -22460,7 +22008,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcCurve; case 1: return Type::IfcLengthMeasure; case 2: return Type::IfcLogical; case 3: return Type::IfcDirection; } return IfcCurve::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "BasisCurve"; case 1: return "Distance"; case 2: return "SelfIntersect"; case 3: return "RefDirection"; } return IfcCurve::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcOffsetCurve3D (IfcEntityInstanceData* e);
@@ -22485,7 +22032,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcSurface; case 1: return Type::IfcCurve; } return IfcCurve::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "BasisSurface"; case 1: return "ReferenceCurve"; } return IfcCurve::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPcurve (IfcEntityInstanceData* e);
@@ -22509,7 +22055,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 2: return Type::IfcAxis2Placement; } return IfcPlanarExtent::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 2: return "Placement"; } return IfcPlanarExtent::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPlanarBox (IfcEntityInstanceData* e);
@@ -22559,7 +22104,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcElementarySurface::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcElementarySurface::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPlane (IfcEntityInstanceData* e);
@@ -22578,7 +22122,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcPreDefinedItem::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcPreDefinedItem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPreDefinedColour (IfcEntityInstanceData* e);
@@ -22599,7 +22142,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcPreDefinedItem::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcPreDefinedItem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPreDefinedCurveFont (IfcEntityInstanceData* e);
@@ -22633,7 +22175,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcPropertySetDefinition::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcPropertySetDefinition::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPreDefinedPropertySet (IfcEntityInstanceData* e);
@@ -22664,7 +22205,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcProcedureTypeEnum; } return IfcTypeProcess::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcTypeProcess::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcProcedureType (IfcEntityInstanceData* e);
@@ -22736,7 +22276,6 @@ public:
     IfcTemplatedEntityList< IfcRelSequence >::ptr IsPredecessorTo() const; // INVERSE IfcRelSequence::RelatingProcess
     IfcTemplatedEntityList< IfcRelSequence >::ptr IsSuccessorFrom() const; // INVERSE IfcRelSequence::RelatedProcess
     IfcTemplatedEntityList< IfcRelAssignsToProcess >::ptr OperatesOn() const; // INVERSE IfcRelAssignsToProcess::RelatingProcess
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcProcess (IfcEntityInstanceData* e);
@@ -22852,7 +22391,6 @@ public:
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 5: return "ObjectPlacement"; case 6: return "Representation"; } return IfcObject::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcRelAssignsToProduct >::ptr ReferencedBy() const; // INVERSE IfcRelAssignsToProduct::RelatingProduct
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcProduct (IfcEntityInstanceData* e);
@@ -22910,7 +22448,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcContext::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcContext::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcProject (IfcEntityInstanceData* e);
@@ -22948,7 +22485,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcContext::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcContext::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcProjectLibrary (IfcEntityInstanceData* e);
@@ -23088,7 +22624,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 2: return Type::IfcValue; case 3: return Type::IfcValue; case 4: return Type::IfcUnit; case 5: return Type::IfcValue; } return IfcSimpleProperty::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 2: return "UpperBoundValue"; case 3: return "LowerBoundValue"; case 4: return "Unit"; case 5: return "SetPointValue"; } return IfcSimpleProperty::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPropertyBoundedValue (IfcEntityInstanceData* e);
@@ -23191,7 +22726,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 2: return Type::IfcValue; case 3: return Type::IfcPropertyEnumeration; } return IfcSimpleProperty::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 2: return "EnumerationValues"; case 3: return "EnumerationReference"; } return IfcSimpleProperty::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPropertyEnumeratedValue (IfcEntityInstanceData* e);
@@ -23282,7 +22816,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 2: return Type::IfcValue; case 3: return Type::IfcUnit; } return IfcSimpleProperty::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 2: return "ListValues"; case 3: return "Unit"; } return IfcSimpleProperty::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPropertyListValue (IfcEntityInstanceData* e);
@@ -23323,7 +22856,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 2: return Type::IfcText; case 3: return Type::IfcObjectReferenceSelect; } return IfcSimpleProperty::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 2: return "UsageName"; case 3: return "PropertyReference"; } return IfcSimpleProperty::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPropertyReferenceValue (IfcEntityInstanceData* e);
@@ -23393,7 +22925,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 4: return Type::IfcProperty; } return IfcPropertySetDefinition::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 4: return "HasProperties"; } return IfcPropertySetDefinition::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPropertySet (IfcEntityInstanceData* e);
@@ -23462,7 +22993,6 @@ public:
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 4: return "TemplateType"; case 5: return "ApplicableEntity"; case 6: return "HasPropertyTemplates"; } return IfcPropertyTemplateDefinition::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcRelDefinesByTemplate >::ptr Defines() const; // INVERSE IfcRelDefinesByTemplate::RelatingTemplate
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPropertySetTemplate (IfcEntityInstanceData* e);
@@ -23534,7 +23064,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 2: return Type::IfcValue; case 3: return Type::IfcUnit; } return IfcSimpleProperty::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 2: return "NominalValue"; case 3: return "Unit"; } return IfcSimpleProperty::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPropertySingleValue (IfcEntityInstanceData* e);
@@ -23730,7 +23259,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 2: return Type::IfcValue; case 3: return Type::IfcValue; case 4: return Type::IfcText; case 5: return Type::IfcUnit; case 6: return Type::IfcUnit; case 7: return Type::IfcCurveInterpolationEnum; } return IfcSimpleProperty::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 2: return "DefiningValues"; case 3: return "DefinedValues"; case 4: return "Expression"; case 5: return "DefiningUnit"; case 6: return "DefinedUnit"; case 7: return "CurveInterpolation"; } return IfcSimpleProperty::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPropertyTableValue (IfcEntityInstanceData* e);
@@ -23770,7 +23298,6 @@ public:
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcComplexPropertyTemplate >::ptr PartOfComplexTemplate() const; // INVERSE IfcComplexPropertyTemplate::HasPropertyTemplates
     IfcTemplatedEntityList< IfcPropertySetTemplate >::ptr PartOfPsetTemplate() const; // INVERSE IfcPropertySetTemplate::HasPropertyTemplates
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPropertyTemplate (IfcEntityInstanceData* e);
@@ -23808,7 +23335,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 7: return Type::IfcObjectTypeEnum; case 8: return Type::IfcLabel; } return IfcProduct::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 7: return "ProxyType"; case 8: return "Tag"; } return IfcProduct::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcProxy (IfcEntityInstanceData* e);
@@ -23855,7 +23381,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 5: return Type::IfcPositiveLengthMeasure; case 6: return Type::IfcNonNegativeLengthMeasure; case 7: return Type::IfcNonNegativeLengthMeasure; } return IfcRectangleProfileDef::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 5: return "WallThickness"; case 6: return "InnerFilletRadius"; case 7: return "OuterFilletRadius"; } return IfcRectangleProfileDef::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRectangleHollowProfileDef (IfcEntityInstanceData* e);
@@ -23966,7 +23491,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 1: return Type::IfcPositiveLengthMeasure; case 2: return Type::IfcPositiveLengthMeasure; case 3: return Type::IfcPositiveLengthMeasure; } return IfcCsgPrimitive3D::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 1: return "XLength"; case 2: return "YLength"; case 3: return "Height"; } return IfcCsgPrimitive3D::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRectangularPyramid (IfcEntityInstanceData* e);
@@ -24016,7 +23540,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcSurface; case 1: return Type::IfcParameterValue; case 2: return Type::IfcParameterValue; case 3: return Type::IfcParameterValue; case 4: return Type::IfcParameterValue; case 5: return Type::IfcBoolean; case 6: return Type::IfcBoolean; } return IfcBoundedSurface::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "BasisSurface"; case 1: return "U1"; case 2: return "V1"; case 3: return "U2"; case 4: return "V2"; case 5: return "Usense"; case 6: return "Vsense"; } return IfcBoundedSurface::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRectangularTrimmedSurface (IfcEntityInstanceData* e);
@@ -24064,7 +23587,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 4: return Type::IfcLabel; case 5: return Type::IfcSectionReinforcementProperties; } return IfcPreDefinedPropertySet::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 4: return "DefinitionType"; case 5: return "ReinforcementSectionDefinitions"; } return IfcPreDefinedPropertySet::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcReinforcementDefinitionProperties (IfcEntityInstanceData* e);
@@ -24098,7 +23620,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 4: return Type::IfcObjectDefinition; case 5: return Type::IfcObjectTypeEnum; } return IfcRelationship::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 4: return "RelatedObjects"; case 5: return "RelatedObjectsType"; } return IfcRelationship::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRelAssigns (IfcEntityInstanceData* e);
@@ -24129,7 +23650,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 6: return Type::IfcActor; case 7: return Type::IfcActorRole; } return IfcRelAssigns::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 6: return "RelatingActor"; case 7: return "ActingRole"; } return IfcRelAssigns::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRelAssignsToActor (IfcEntityInstanceData* e);
@@ -24151,7 +23671,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 6: return Type::IfcControl; } return IfcRelAssigns::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 6: return "RelatingControl"; } return IfcRelAssigns::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRelAssignsToControl (IfcEntityInstanceData* e);
@@ -24181,7 +23700,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 6: return Type::IfcGroup; } return IfcRelAssigns::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 6: return "RelatingGroup"; } return IfcRelAssigns::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRelAssignsToGroup (IfcEntityInstanceData* e);
@@ -24207,7 +23725,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 7: return Type::IfcRatioMeasure; } return IfcRelAssignsToGroup::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 7: return "Factor"; } return IfcRelAssignsToGroup::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRelAssignsToGroupByFactor (IfcEntityInstanceData* e);
@@ -24253,7 +23770,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 6: return Type::IfcProcessSelect; case 7: return Type::IfcMeasureWithUnit; } return IfcRelAssigns::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 6: return "RelatingProcess"; case 7: return "QuantityInProcess"; } return IfcRelAssigns::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRelAssignsToProcess (IfcEntityInstanceData* e);
@@ -24280,7 +23796,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 6: return Type::IfcProductSelect; } return IfcRelAssigns::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 6: return "RelatingProduct"; } return IfcRelAssigns::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRelAssignsToProduct (IfcEntityInstanceData* e);
@@ -24305,7 +23820,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 6: return Type::IfcResourceSelect; } return IfcRelAssigns::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 6: return "RelatingResource"; } return IfcRelAssigns::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRelAssignsToResource (IfcEntityInstanceData* e);
@@ -24365,7 +23879,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 4: return Type::IfcDefinitionSelect; } return IfcRelationship::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 4: return "RelatedObjects"; } return IfcRelationship::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRelAssociates (IfcEntityInstanceData* e);
@@ -24385,7 +23898,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 5: return Type::IfcApproval; } return IfcRelAssociates::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 5: return "RelatingApproval"; } return IfcRelAssociates::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRelAssociatesApproval (IfcEntityInstanceData* e);
@@ -24432,7 +23944,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 5: return Type::IfcClassificationSelect; } return IfcRelAssociates::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 5: return "RelatingClassification"; } return IfcRelAssociates::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRelAssociatesClassification (IfcEntityInstanceData* e);
@@ -24457,7 +23968,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 5: return Type::IfcLabel; case 6: return Type::IfcConstraint; } return IfcRelAssociates::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 5: return "Intent"; case 6: return "RelatingConstraint"; } return IfcRelAssociates::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRelAssociatesConstraint (IfcEntityInstanceData* e);
@@ -24481,7 +23991,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 5: return Type::IfcDocumentSelect; } return IfcRelAssociates::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 5: return "RelatingDocument"; } return IfcRelAssociates::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRelAssociatesDocument (IfcEntityInstanceData* e);
@@ -24505,7 +24014,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 5: return Type::IfcLibrarySelect; } return IfcRelAssociates::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 5: return "RelatingLibrary"; } return IfcRelAssociates::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRelAssociatesLibrary (IfcEntityInstanceData* e);
@@ -24616,7 +24124,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 5: return Type::IfcMaterialSelect; } return IfcRelAssociates::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 5: return "RelatingMaterial"; } return IfcRelAssociates::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRelAssociatesMaterial (IfcEntityInstanceData* e);
@@ -24633,7 +24140,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcRelationship::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcRelationship::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRelConnects (IfcEntityInstanceData* e);
@@ -24680,7 +24186,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 4: return Type::IfcConnectionGeometry; case 5: return Type::IfcElement; case 6: return Type::IfcElement; } return IfcRelConnects::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 4: return "ConnectionGeometry"; case 5: return "RelatingElement"; case 6: return "RelatedElement"; } return IfcRelConnects::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRelConnectsElements (IfcEntityInstanceData* e);
@@ -24738,7 +24243,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 7: return Type::IfcInteger; case 8: return Type::IfcInteger; case 9: return Type::IfcConnectionTypeEnum; case 10: return Type::IfcConnectionTypeEnum; } return IfcRelConnectsElements::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 7: return "RelatingPriorities"; case 8: return "RelatedPriorities"; case 9: return "RelatedConnectionType"; case 10: return "RelatingConnectionType"; } return IfcRelConnectsElements::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRelConnectsPathElements (IfcEntityInstanceData* e);
@@ -24785,7 +24289,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 4: return Type::IfcPort; case 5: return Type::IfcDistributionElement; } return IfcRelConnects::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 4: return "RelatingPort"; case 5: return "RelatedElement"; } return IfcRelConnects::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRelConnectsPortToElement (IfcEntityInstanceData* e);
@@ -24823,7 +24326,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 4: return Type::IfcPort; case 5: return Type::IfcPort; case 6: return Type::IfcElement; } return IfcRelConnects::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 4: return "RelatingPort"; case 5: return "RelatedPort"; case 6: return "RealizingElement"; } return IfcRelConnects::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRelConnectsPorts (IfcEntityInstanceData* e);
@@ -24846,7 +24348,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 4: return Type::IfcStructuralActivityAssignmentSelect; case 5: return Type::IfcStructuralActivity; } return IfcRelConnects::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 4: return "RelatingElement"; case 5: return "RelatedStructuralActivity"; } return IfcRelConnects::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRelConnectsStructuralActivity (IfcEntityInstanceData* e);
@@ -24910,7 +24411,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 4: return Type::IfcStructuralMember; case 5: return Type::IfcStructuralConnection; case 6: return Type::IfcBoundaryCondition; case 7: return Type::IfcStructuralConnectionCondition; case 8: return Type::IfcLengthMeasure; case 9: return Type::IfcAxis2Placement3D; } return IfcRelConnects::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 4: return "RelatingStructuralMember"; case 5: return "RelatedStructuralConnection"; case 6: return "AppliedCondition"; case 7: return "AdditionalConditions"; case 8: return "SupportedLength"; case 9: return "ConditionCoordinateSystem"; } return IfcRelConnects::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRelConnectsStructuralMember (IfcEntityInstanceData* e);
@@ -24944,7 +24444,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 10: return Type::IfcConnectionGeometry; } return IfcRelConnectsStructuralMember::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 10: return "ConnectionConstraint"; } return IfcRelConnectsStructuralMember::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRelConnectsWithEccentricity (IfcEntityInstanceData* e);
@@ -24989,7 +24488,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 7: return Type::IfcElement; case 8: return Type::IfcLabel; } return IfcRelConnectsElements::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 7: return "RealizingElements"; case 8: return "ConnectionType"; } return IfcRelConnectsElements::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRelConnectsWithRealizingElements (IfcEntityInstanceData* e);
@@ -25073,7 +24571,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 4: return Type::IfcProduct; case 5: return Type::IfcSpatialElement; } return IfcRelConnects::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 4: return "RelatedElements"; case 5: return "RelatingStructure"; } return IfcRelConnects::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRelContainedInSpatialStructure (IfcEntityInstanceData* e);
@@ -25111,7 +24608,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 4: return Type::IfcElement; case 5: return Type::IfcCovering; } return IfcRelConnects::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 4: return "RelatingBuildingElement"; case 5: return "RelatedCoverings"; } return IfcRelConnects::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRelCoversBldgElements (IfcEntityInstanceData* e);
@@ -25159,7 +24655,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 4: return Type::IfcSpace; case 5: return Type::IfcCovering; } return IfcRelConnects::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 4: return "RelatingSpace"; case 5: return "RelatedCoverings"; } return IfcRelConnects::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRelCoversSpaces (IfcEntityInstanceData* e);
@@ -25190,7 +24685,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 4: return Type::IfcContext; case 5: return Type::IfcDefinitionSelect; } return IfcRelationship::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 4: return "RelatingContext"; case 5: return "RelatedDefinitions"; } return IfcRelationship::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRelDeclares (IfcEntityInstanceData* e);
@@ -25234,7 +24728,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcRelationship::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcRelationship::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRelDecomposes (IfcEntityInstanceData* e);
@@ -25275,7 +24768,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcRelationship::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcRelationship::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRelDefines (IfcEntityInstanceData* e);
@@ -25310,7 +24802,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 4: return Type::IfcObject; case 5: return Type::IfcObject; } return IfcRelDefines::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 4: return "RelatedObjects"; case 5: return "RelatingObject"; } return IfcRelDefines::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRelDefinesByObject (IfcEntityInstanceData* e);
@@ -25345,7 +24836,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 4: return Type::IfcObjectDefinition; case 5: return Type::IfcPropertySetDefinitionSelect; } return IfcRelDefines::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 4: return "RelatedObjects"; case 5: return "RelatingPropertyDefinition"; } return IfcRelDefines::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRelDefinesByProperties (IfcEntityInstanceData* e);
@@ -25377,7 +24867,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 4: return Type::IfcPropertySetDefinition; case 5: return Type::IfcPropertySetTemplate; } return IfcRelDefines::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 4: return "RelatedPropertySets"; case 5: return "RelatingTemplate"; } return IfcRelDefines::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRelDefinesByTemplate (IfcEntityInstanceData* e);
@@ -25467,7 +24956,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 4: return Type::IfcObject; case 5: return Type::IfcTypeObject; } return IfcRelDefines::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 4: return "RelatedObjects"; case 5: return "RelatingType"; } return IfcRelDefines::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRelDefinesByType (IfcEntityInstanceData* e);
@@ -25498,7 +24986,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 4: return Type::IfcOpeningElement; case 5: return Type::IfcElement; } return IfcRelConnects::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 4: return "RelatingOpeningElement"; case 5: return "RelatedBuildingElement"; } return IfcRelConnects::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRelFillsElement (IfcEntityInstanceData* e);
@@ -25525,7 +25012,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 4: return Type::IfcDistributionControlElement; case 5: return Type::IfcDistributionFlowElement; } return IfcRelConnects::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 4: return "RelatedControlElements"; case 5: return "RelatingFlowElement"; } return IfcRelConnects::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRelFlowControlElements (IfcEntityInstanceData* e);
@@ -25605,7 +25091,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 4: return Type::IfcElement; case 5: return Type::IfcElement; case 6: return Type::IfcConnectionGeometry; case 7: return Type::IfcIdentifier; case 8: return Type::UNDEFINED; } return IfcRelConnects::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 4: return "RelatingElement"; case 5: return "RelatedElement"; case 6: return "InterferenceGeometry"; case 7: return "InterferenceType"; case 8: return "ImpliedOrder"; } return IfcRelConnects::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRelInterferesElements (IfcEntityInstanceData* e);
@@ -25654,7 +25139,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 4: return Type::IfcObjectDefinition; case 5: return Type::IfcObjectDefinition; } return IfcRelDecomposes::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 4: return "RelatingObject"; case 5: return "RelatedObjects"; } return IfcRelDecomposes::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRelNests (IfcEntityInstanceData* e);
@@ -25706,7 +25190,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 4: return Type::IfcElement; case 5: return Type::IfcFeatureElementAddition; } return IfcRelDecomposes::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 4: return "RelatingElement"; case 5: return "RelatedFeatureElement"; } return IfcRelDecomposes::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRelProjectsElement (IfcEntityInstanceData* e);
@@ -25778,7 +25261,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 4: return Type::IfcProduct; case 5: return Type::IfcSpatialElement; } return IfcRelConnects::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 4: return "RelatedElements"; case 5: return "RelatingStructure"; } return IfcRelConnects::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRelReferencedInSpatialStructure (IfcEntityInstanceData* e);
@@ -25877,7 +25359,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 4: return Type::IfcProcess; case 5: return Type::IfcProcess; case 6: return Type::IfcLagTime; case 7: return Type::IfcSequenceEnum; case 8: return Type::IfcLabel; } return IfcRelConnects::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 4: return "RelatingProcess"; case 5: return "RelatedProcess"; case 6: return "TimeLag"; case 7: return "SequenceType"; case 8: return "UserDefinedSequenceType"; } return IfcRelConnects::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRelSequence (IfcEntityInstanceData* e);
@@ -25922,7 +25403,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 4: return Type::IfcSystem; case 5: return Type::IfcSpatialElement; } return IfcRelConnects::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 4: return "RelatingSystem"; case 5: return "RelatedBuildings"; } return IfcRelConnects::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRelServicesBuildings (IfcEntityInstanceData* e);
@@ -26121,7 +25601,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 4: return Type::IfcSpaceBoundarySelect; case 5: return Type::IfcElement; case 6: return Type::IfcConnectionGeometry; case 7: return Type::IfcPhysicalOrVirtualEnum; case 8: return Type::IfcInternalOrExternalEnum; } return IfcRelConnects::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 4: return "RelatingSpace"; case 5: return "RelatedBuildingElement"; case 6: return "ConnectionGeometry"; case 7: return "PhysicalOrVirtualBoundary"; case 8: return "InternalOrExternalBoundary"; } return IfcRelConnects::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRelSpaceBoundary (IfcEntityInstanceData* e);
@@ -26188,7 +25667,6 @@ public:
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "ParentBoundary"; } return IfcRelSpaceBoundary::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcRelSpaceBoundary1stLevel >::ptr InnerBoundaries() const; // INVERSE IfcRelSpaceBoundary1stLevel::ParentBoundary
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRelSpaceBoundary1stLevel (IfcEntityInstanceData* e);
@@ -26240,7 +25718,6 @@ public:
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 10: return "CorrespondingBoundary"; } return IfcRelSpaceBoundary1stLevel::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcRelSpaceBoundary2ndLevel >::ptr Corresponds() const; // INVERSE IfcRelSpaceBoundary2ndLevel::CorrespondingBoundary
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRelSpaceBoundary2ndLevel (IfcEntityInstanceData* e);
@@ -26265,7 +25742,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 4: return Type::IfcElement; case 5: return Type::IfcFeatureElementSubtraction; } return IfcRelDecomposes::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 4: return "RelatingBuildingElement"; case 5: return "RelatedOpeningElement"; } return IfcRelDecomposes::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRelVoidsElement (IfcEntityInstanceData* e);
@@ -26304,7 +25780,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 3: return Type::IfcParameterValue; } return IfcCompositeCurveSegment::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 3: return "ParamLength"; } return IfcCompositeCurveSegment::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcReparametrisedCompositeCurveSegment (IfcEntityInstanceData* e);
@@ -26347,7 +25822,6 @@ public:
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 5: return "Identification"; case 6: return "LongDescription"; } return IfcObject::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcRelAssignsToResource >::ptr ResourceOf() const; // INVERSE IfcRelAssignsToResource::RelatingResource
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcResource (IfcEntityInstanceData* e);
@@ -26443,7 +25917,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 2: return Type::IfcAxis1Placement; case 3: return Type::IfcPlaneAngleMeasure; } return IfcSweptAreaSolid::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 2: return "Axis"; case 3: return "Angle"; } return IfcSweptAreaSolid::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRevolvedAreaSolid (IfcEntityInstanceData* e);
@@ -26517,7 +25990,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 4: return Type::IfcProfileDef; } return IfcRevolvedAreaSolid::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 4: return "EndSweptArea"; } return IfcRevolvedAreaSolid::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRevolvedAreaSolidTapered (IfcEntityInstanceData* e);
@@ -26602,7 +26074,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 1: return Type::IfcPositiveLengthMeasure; case 2: return Type::IfcPositiveLengthMeasure; } return IfcCsgPrimitive3D::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 1: return "Height"; case 2: return "BottomRadius"; } return IfcCsgPrimitive3D::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRightCircularCone (IfcEntityInstanceData* e);
@@ -26703,7 +26174,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 1: return Type::IfcPositiveLengthMeasure; case 2: return Type::IfcPositiveLengthMeasure; } return IfcCsgPrimitive3D::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 1: return "Height"; case 2: return "Radius"; } return IfcCsgPrimitive3D::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRightCircularCylinder (IfcEntityInstanceData* e);
@@ -26825,7 +26295,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 4: return Type::IfcSimplePropertyTemplateTypeEnum; case 5: return Type::IfcLabel; case 6: return Type::IfcLabel; case 7: return Type::IfcPropertyEnumeration; case 8: return Type::IfcUnit; case 9: return Type::IfcUnit; case 10: return Type::IfcLabel; case 11: return Type::IfcStateEnum; } return IfcPropertyTemplate::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 4: return "TemplateType"; case 5: return "PrimaryMeasureType"; case 6: return "SecondaryMeasureType"; case 7: return "Enumerators"; case 8: return "PrimaryUnit"; case 9: return "SecondaryUnit"; case 10: return "Expression"; case 11: return "AccessState"; } return IfcPropertyTemplate::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcSimplePropertyTemplate (IfcEntityInstanceData* e);
@@ -26880,7 +26349,6 @@ public:
     IfcTemplatedEntityList< IfcRelContainedInSpatialStructure >::ptr ContainsElements() const; // INVERSE IfcRelContainedInSpatialStructure::RelatingStructure
     IfcTemplatedEntityList< IfcRelServicesBuildings >::ptr ServicedBySystems() const; // INVERSE IfcRelServicesBuildings::RelatedBuildings
     IfcTemplatedEntityList< IfcRelReferencedInSpatialStructure >::ptr ReferencesElements() const; // INVERSE IfcRelReferencedInSpatialStructure::RelatingStructure
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcSpatialElement (IfcEntityInstanceData* e);
@@ -26930,7 +26398,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcLabel; } return IfcTypeProduct::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "ElementType"; } return IfcTypeProduct::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcSpatialElementType (IfcEntityInstanceData* e);
@@ -27026,7 +26493,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcElementCompositionEnum; } return IfcSpatialElement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "CompositionType"; } return IfcSpatialElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcSpatialStructureElement (IfcEntityInstanceData* e);
@@ -27074,7 +26540,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcSpatialElementType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcSpatialElementType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcSpatialStructureElementType (IfcEntityInstanceData* e);
@@ -27142,7 +26607,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcSpatialZoneTypeEnum; } return IfcSpatialElement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "PredefinedType"; } return IfcSpatialElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcSpatialZone (IfcEntityInstanceData* e);
@@ -27193,7 +26657,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcSpatialZoneTypeEnum; case 10: return Type::IfcLabel; } return IfcSpatialElementType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; case 10: return "LongName"; } return IfcSpatialElementType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcSpatialZoneType (IfcEntityInstanceData* e);
@@ -27260,7 +26723,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 1: return Type::IfcPositiveLengthMeasure; } return IfcCsgPrimitive3D::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 1: return "Radius"; } return IfcCsgPrimitive3D::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcSphere (IfcEntityInstanceData* e);
@@ -27277,7 +26739,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 1: return Type::IfcPositiveLengthMeasure; } return IfcElementarySurface::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 1: return "Radius"; } return IfcElementarySurface::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcSphericalSurface (IfcEntityInstanceData* e);
@@ -27409,7 +26870,6 @@ public:
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 7: return "AppliedLoad"; case 8: return "GlobalOrLocal"; } return IfcProduct::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcRelConnectsStructuralActivity >::ptr AssignedToStructuralItem() const; // INVERSE IfcRelConnectsStructuralActivity::RelatedStructuralActivity
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcStructuralActivity (IfcEntityInstanceData* e);
@@ -27511,7 +26971,6 @@ public:
     virtual const char* getArgumentName(unsigned int i) const { return IfcProduct::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcRelConnectsStructuralActivity >::ptr AssignedStructuralActivity() const; // INVERSE IfcRelConnectsStructuralActivity::RelatingElement
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcStructuralItem (IfcEntityInstanceData* e);
@@ -27530,7 +26989,6 @@ public:
     virtual const char* getArgumentName(unsigned int i) const { return IfcStructuralItem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcRelConnectsStructuralMember >::ptr ConnectedBy() const; // INVERSE IfcRelConnectsStructuralMember::RelatingStructuralMember
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcStructuralMember (IfcEntityInstanceData* e);
@@ -27564,7 +27022,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcStructuralActivity::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcStructuralActivity::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcStructuralReaction (IfcEntityInstanceData* e);
@@ -27606,7 +27063,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 7: return Type::IfcStructuralSurfaceMemberTypeEnum; case 8: return Type::IfcPositiveLengthMeasure; } return IfcStructuralMember::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 7: return "PredefinedType"; case 8: return "Thickness"; } return IfcStructuralMember::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcStructuralSurfaceMember (IfcEntityInstanceData* e);
@@ -27638,7 +27094,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcStructuralSurfaceMember::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcStructuralSurfaceMember::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcStructuralSurfaceMemberVarying (IfcEntityInstanceData* e);
@@ -27677,7 +27132,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcStructuralSurfaceActivityTypeEnum; } return IfcStructuralReaction::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcStructuralReaction::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcStructuralSurfaceReaction (IfcEntityInstanceData* e);
@@ -27705,7 +27159,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 11: return Type::IfcSubContractResourceTypeEnum; } return IfcConstructionResourceType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 11: return "PredefinedType"; } return IfcConstructionResourceType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcSubContractResourceType (IfcEntityInstanceData* e);
@@ -27726,7 +27179,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcCurve; case 1: return Type::IfcPcurve; case 2: return Type::IfcPreferredSurfaceCurveRepresentation; } return IfcCurve::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Curve3D"; case 1: return "AssociatedGeometry"; case 2: return "MasterRepresentation"; } return IfcCurve::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcSurfaceCurve (IfcEntityInstanceData* e);
@@ -27822,7 +27274,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 2: return Type::IfcCurve; case 3: return Type::IfcParameterValue; case 4: return Type::IfcParameterValue; case 5: return Type::IfcSurface; } return IfcSweptAreaSolid::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 2: return "Directrix"; case 3: return "StartParam"; case 4: return "EndParam"; case 5: return "ReferenceSurface"; } return IfcSweptAreaSolid::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcSurfaceCurveSweptAreaSolid (IfcEntityInstanceData* e);
@@ -27855,7 +27306,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 2: return Type::IfcDirection; case 3: return Type::IfcLengthMeasure; } return IfcSweptSurface::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 2: return "ExtrudedDirection"; case 3: return "Depth"; } return IfcSweptSurface::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcSurfaceOfLinearExtrusion (IfcEntityInstanceData* e);
@@ -27889,7 +27339,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 2: return Type::IfcAxis1Placement; } return IfcSweptSurface::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 2: return "AxisPosition"; } return IfcSweptSurface::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcSurfaceOfRevolution (IfcEntityInstanceData* e);
@@ -27937,7 +27386,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcSystemFurnitureElementTypeEnum; } return IfcFurnishingElementType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcFurnishingElementType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcSystemFurnitureElementType (IfcEntityInstanceData* e);
@@ -28245,7 +27693,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 7: return Type::IfcLabel; case 8: return Type::IfcLabel; case 9: return Type::IfcBoolean; case 10: return Type::IfcInteger; case 11: return Type::IfcTaskTime; case 12: return Type::IfcTaskTypeEnum; } return IfcProcess::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 7: return "Status"; case 8: return "WorkMethod"; case 9: return "IsMilestone"; case 10: return "Priority"; case 11: return "TaskTime"; case 12: return "PredefinedType"; } return IfcProcess::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcTask (IfcEntityInstanceData* e);
@@ -28308,7 +27755,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcTaskTypeEnum; case 10: return Type::IfcLabel; } return IfcTypeProcess::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; case 10: return "WorkMethod"; } return IfcTypeProcess::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcTaskType (IfcEntityInstanceData* e);
@@ -28327,7 +27773,6 @@ public:
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcIndexedColourMap >::ptr HasColours() const; // INVERSE IfcIndexedColourMap::MappedTo
     IfcTemplatedEntityList< IfcIndexedTextureMap >::ptr HasTextures() const; // INVERSE IfcIndexedTextureMap::MappedTo
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcTessellatedFaceSet (IfcEntityInstanceData* e);
@@ -28346,7 +27791,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 1: return Type::IfcPositiveLengthMeasure; case 2: return Type::IfcPositiveLengthMeasure; } return IfcElementarySurface::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 1: return "MajorRadius"; case 2: return "MinorRadius"; } return IfcElementarySurface::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcToroidalSurface (IfcEntityInstanceData* e);
@@ -28426,7 +27870,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcTransportElementTypeEnum; } return IfcElementType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcElementType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcTransportElementType (IfcEntityInstanceData* e);
@@ -28455,7 +27898,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 1: return Type::IfcParameterValue; case 2: return Type::IfcBoolean; case 3: return Type::IfcPositiveInteger; case 4: return Type::IfcPositiveInteger; } return IfcTessellatedFaceSet::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 1: return "Normals"; case 2: return "Closed"; case 3: return "CoordIndex"; case 4: return "PnIndex"; } return IfcTessellatedFaceSet::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcTriangulatedFaceSet (IfcEntityInstanceData* e);
@@ -28635,7 +28077,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 4: return Type::IfcPositiveLengthMeasure; case 5: return Type::IfcNonNegativeLengthMeasure; case 6: return Type::IfcNonNegativeLengthMeasure; case 7: return Type::IfcNonNegativeLengthMeasure; case 8: return Type::IfcNormalisedRatioMeasure; case 9: return Type::IfcNormalisedRatioMeasure; case 10: return Type::IfcNormalisedRatioMeasure; case 11: return Type::IfcNormalisedRatioMeasure; case 12: return Type::IfcShapeAspect; case 13: return Type::IfcLengthMeasure; case 14: return Type::IfcLengthMeasure; case 15: return Type::IfcLengthMeasure; } return IfcPreDefinedPropertySet::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 4: return "LiningDepth"; case 5: return "LiningThickness"; case 6: return "TransomThickness"; case 7: return "MullionThickness"; case 8: return "FirstTransomOffset"; case 9: return "SecondTransomOffset"; case 10: return "FirstMullionOffset"; case 11: return "SecondMullionOffset"; case 12: return "ShapeAspectStyle"; case 13: return "LiningOffset"; case 14: return "LiningToPanelOffsetX"; case 15: return "LiningToPanelOffsetY"; } return IfcPreDefinedPropertySet::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcWindowLiningProperties (IfcEntityInstanceData* e);
@@ -28717,7 +28158,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 4: return Type::IfcWindowPanelOperationEnum; case 5: return Type::IfcWindowPanelPositionEnum; case 6: return Type::IfcPositiveLengthMeasure; case 7: return Type::IfcPositiveLengthMeasure; case 8: return Type::IfcShapeAspect; } return IfcPreDefinedPropertySet::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 4: return "OperationType"; case 5: return "PanelPosition"; case 6: return "FrameDepth"; case 7: return "FrameThickness"; case 8: return "ShapeAspectStyle"; } return IfcPreDefinedPropertySet::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcWindowPanelProperties (IfcEntityInstanceData* e);
@@ -28750,7 +28190,6 @@ public:
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 5: return "TheActor"; } return IfcObject::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcRelAssignsToActor >::ptr IsActingUpon() const; // INVERSE IfcRelAssignsToActor::RelatingActor
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcActor (IfcEntityInstanceData* e);
@@ -28797,7 +28236,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcManifoldSolidBrep::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcManifoldSolidBrep::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcAdvancedBrep (IfcEntityInstanceData* e);
@@ -28834,7 +28272,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 1: return Type::IfcClosedShell; } return IfcAdvancedBrep::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 1: return "Voids"; } return IfcAdvancedBrep::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcAdvancedBrepWithVoids (IfcEntityInstanceData* e);
@@ -29022,7 +28459,6 @@ public:
     virtual const char* getArgumentName(unsigned int i) const { return IfcProduct::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcRelContainedInSpatialStructure >::ptr ContainedInStructure() const; // INVERSE IfcRelContainedInSpatialStructure::RelatedElements
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcAnnotation (IfcEntityInstanceData* e);
@@ -29126,7 +28562,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcInteger; case 1: return Type::IfcInteger; case 2: return Type::IfcCartesianPoint; case 3: return Type::IfcBSplineSurfaceForm; case 4: return Type::IfcLogical; case 5: return Type::IfcLogical; case 6: return Type::IfcLogical; } return IfcBoundedSurface::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "UDegree"; case 1: return "VDegree"; case 2: return "ControlPointsList"; case 3: return "SurfaceForm"; case 4: return "UClosed"; case 5: return "VClosed"; case 6: return "SelfIntersect"; } return IfcBoundedSurface::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcBSplineSurface (IfcEntityInstanceData* e);
@@ -29162,7 +28597,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 7: return Type::IfcInteger; case 8: return Type::IfcInteger; case 9: return Type::IfcParameterValue; case 10: return Type::IfcParameterValue; case 11: return Type::IfcKnotType; } return IfcBSplineSurface::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 7: return "UMultiplicities"; case 8: return "VMultiplicities"; case 9: return "UKnots"; case 10: return "VKnots"; case 11: return "KnotSpec"; } return IfcBSplineSurface::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcBSplineSurfaceWithKnots (IfcEntityInstanceData* e);
@@ -29282,7 +28716,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 1: return Type::IfcPositiveLengthMeasure; case 2: return Type::IfcPositiveLengthMeasure; case 3: return Type::IfcPositiveLengthMeasure; } return IfcCsgPrimitive3D::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 1: return "XLength"; case 2: return "YLength"; case 3: return "ZLength"; } return IfcCsgPrimitive3D::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcBlock (IfcEntityInstanceData* e);
@@ -29303,7 +28736,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcBooleanResult::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcBooleanResult::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcBooleanClippingResult (IfcEntityInstanceData* e);
@@ -29327,7 +28759,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcCurve::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcCurve::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcBoundedCurve (IfcEntityInstanceData* e);
@@ -29531,7 +28962,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcLengthMeasure; case 10: return Type::IfcLengthMeasure; case 11: return Type::IfcPostalAddress; } return IfcSpatialStructureElement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "ElevationOfRefHeight"; case 10: return "ElevationOfTerrain"; case 11: return "BuildingAddress"; } return IfcSpatialStructureElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcBuilding (IfcEntityInstanceData* e);
@@ -29574,7 +29004,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcElementType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcElementType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcBuildingElementType (IfcEntityInstanceData* e);
@@ -29770,7 +29199,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcLengthMeasure; } return IfcSpatialStructureElement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "Elevation"; } return IfcSpatialStructureElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcBuildingStorey (IfcEntityInstanceData* e);
@@ -29812,7 +29240,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcChimneyTypeEnum; } return IfcBuildingElementType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcBuildingElementType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcChimneyType (IfcEntityInstanceData* e);
@@ -29847,7 +29274,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 4: return Type::IfcPositiveLengthMeasure; } return IfcCircleProfileDef::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 4: return "WallThickness"; } return IfcCircleProfileDef::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcCircleHollowProfileDef (IfcEntityInstanceData* e);
@@ -29862,7 +29288,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcElementType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcElementType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcCivilElementType (IfcEntityInstanceData* e);
@@ -29977,7 +29402,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcColumnTypeEnum; } return IfcBuildingElementType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcBuildingElementType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcColumnType (IfcEntityInstanceData* e);
@@ -30012,7 +29436,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 4: return Type::IfcLabel; case 5: return Type::IfcComplexPropertyTemplateTypeEnum; case 6: return Type::IfcPropertyTemplate; } return IfcPropertyTemplate::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 4: return "UsageName"; case 5: return "TemplateType"; case 6: return "HasPropertyTemplates"; } return IfcPropertyTemplate::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcComplexPropertyTemplate (IfcEntityInstanceData* e);
@@ -30098,7 +29521,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcCompositeCurveSegment; case 1: return Type::IfcLogical; } return IfcBoundedCurve::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Segments"; case 1: return "SelfIntersect"; } return IfcBoundedCurve::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcCompositeCurve (IfcEntityInstanceData* e);
@@ -30123,7 +29545,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcCompositeCurve::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcCompositeCurve::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcCompositeCurveOnSurface (IfcEntityInstanceData* e);
@@ -30145,7 +29566,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcAxis2Placement; } return IfcCurve::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Position"; } return IfcCurve::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcConic (IfcEntityInstanceData* e);
@@ -30175,7 +29595,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 11: return Type::IfcConstructionEquipmentResourceTypeEnum; } return IfcConstructionResourceType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 11: return "PredefinedType"; } return IfcConstructionResourceType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcConstructionEquipmentResourceType (IfcEntityInstanceData* e);
@@ -30205,7 +29624,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 11: return Type::IfcConstructionMaterialResourceTypeEnum; } return IfcConstructionResourceType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 11: return "PredefinedType"; } return IfcConstructionResourceType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcConstructionMaterialResourceType (IfcEntityInstanceData* e);
@@ -30235,7 +29653,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 11: return Type::IfcConstructionProductResourceTypeEnum; } return IfcConstructionResourceType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 11: return "PredefinedType"; } return IfcConstructionResourceType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcConstructionProductResourceType (IfcEntityInstanceData* e);
@@ -30333,7 +29750,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 7: return Type::IfcResourceTime; case 8: return Type::IfcAppliedValue; case 9: return Type::IfcPhysicalQuantity; } return IfcResource::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 7: return "Usage"; case 8: return "BaseCosts"; case 9: return "BaseQuantity"; } return IfcResource::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcConstructionResource (IfcEntityInstanceData* e);
@@ -30366,7 +29782,6 @@ public:
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 5: return "Identification"; } return IfcObject::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcRelAssignsToControl >::ptr Controls() const; // INVERSE IfcRelAssignsToControl::RelatingControl
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcControl (IfcEntityInstanceData* e);
@@ -30441,7 +29856,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 6: return Type::IfcCostItemTypeEnum; case 7: return Type::IfcCostValue; case 8: return Type::IfcPhysicalQuantity; } return IfcControl::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 6: return "PredefinedType"; case 7: return "CostValues"; case 8: return "CostQuantities"; } return IfcControl::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcCostItem (IfcEntityInstanceData* e);
@@ -30510,7 +29924,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 6: return Type::IfcCostScheduleTypeEnum; case 7: return Type::IfcLabel; case 8: return Type::IfcDateTime; case 9: return Type::IfcDateTime; } return IfcControl::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 6: return "PredefinedType"; case 7: return "Status"; case 8: return "SubmittedOn"; case 9: return "UpdateDate"; } return IfcControl::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcCostSchedule (IfcEntityInstanceData* e);
@@ -30606,7 +30019,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcCoveringTypeEnum; } return IfcBuildingElementType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcBuildingElementType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcCoveringType (IfcEntityInstanceData* e);
@@ -30636,7 +30048,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 10: return Type::IfcCrewResourceTypeEnum; } return IfcConstructionResource::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 10: return "PredefinedType"; } return IfcConstructionResource::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcCrewResource (IfcEntityInstanceData* e);
@@ -30674,7 +30085,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcCurtainWallTypeEnum; } return IfcBuildingElementType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcBuildingElementType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcCurtainWallType (IfcEntityInstanceData* e);
@@ -30745,7 +30155,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 1: return Type::IfcPositiveLengthMeasure; } return IfcElementarySurface::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 1: return "Radius"; } return IfcElementarySurface::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcCylindricalSurface (IfcEntityInstanceData* e);
@@ -30787,7 +30196,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcElementType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcElementType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcDistributionElementType (IfcEntityInstanceData* e);
@@ -30866,7 +30274,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcDistributionElementType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcDistributionElementType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcDistributionFlowElementType (IfcEntityInstanceData* e);
@@ -31046,7 +30453,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 4: return Type::IfcPositiveLengthMeasure; case 5: return Type::IfcNonNegativeLengthMeasure; case 6: return Type::IfcPositiveLengthMeasure; case 7: return Type::IfcNonNegativeLengthMeasure; case 8: return Type::IfcNonNegativeLengthMeasure; case 9: return Type::IfcLengthMeasure; case 10: return Type::IfcLengthMeasure; case 11: return Type::IfcLengthMeasure; case 12: return Type::IfcPositiveLengthMeasure; case 13: return Type::IfcPositiveLengthMeasure; case 14: return Type::IfcShapeAspect; case 15: return Type::IfcLengthMeasure; case 16: return Type::IfcLengthMeasure; } return IfcPreDefinedPropertySet::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 4: return "LiningDepth"; case 5: return "LiningThickness"; case 6: return "ThresholdDepth"; case 7: return "ThresholdThickness"; case 8: return "TransomThickness"; case 9: return "TransomOffset"; case 10: return "LiningOffset"; case 11: return "ThresholdOffset"; case 12: return "CasingThickness"; case 13: return "CasingDepth"; case 14: return "ShapeAspectStyle"; case 15: return "LiningToPanelOffsetX"; case 16: return "LiningToPanelOffsetY"; } return IfcPreDefinedPropertySet::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcDoorLiningProperties (IfcEntityInstanceData* e);
@@ -31128,7 +30534,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 4: return Type::IfcPositiveLengthMeasure; case 5: return Type::IfcDoorPanelOperationEnum; case 6: return Type::IfcNormalisedRatioMeasure; case 7: return Type::IfcDoorPanelPositionEnum; case 8: return Type::IfcShapeAspect; } return IfcPreDefinedPropertySet::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 4: return "PanelDepth"; case 5: return "PanelOperation"; case 6: return "PanelWidth"; case 7: return "PanelPosition"; case 8: return "ShapeAspectStyle"; } return IfcPreDefinedPropertySet::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcDoorPanelProperties (IfcEntityInstanceData* e);
@@ -31284,7 +30689,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcDoorTypeEnum; case 10: return Type::IfcDoorTypeOperationEnum; case 11: return Type::IfcBoolean; case 12: return Type::IfcLabel; } return IfcBuildingElementType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; case 10: return "OperationType"; case 11: return "ParameterTakesPrecedence"; case 12: return "UserDefinedOperationType"; } return IfcBuildingElementType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcDoorType (IfcEntityInstanceData* e);
@@ -31370,7 +30774,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcPreDefinedColour::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcPreDefinedColour::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcDraughtingPreDefinedColour (IfcEntityInstanceData* e);
@@ -31397,7 +30800,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcPreDefinedCurveFont::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcPreDefinedCurveFont::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcDraughtingPreDefinedCurveFont (IfcEntityInstanceData* e);
@@ -31481,7 +30883,6 @@ public:
     IfcTemplatedEntityList< IfcRelConnectsElements >::ptr ConnectedFrom() const; // INVERSE IfcRelConnectsElements::RelatedElement
     IfcTemplatedEntityList< IfcRelContainedInSpatialStructure >::ptr ContainedInStructure() const; // INVERSE IfcRelContainedInSpatialStructure::RelatedElements
     IfcTemplatedEntityList< IfcRelCoversBldgElements >::ptr HasCoverings() const; // INVERSE IfcRelCoversBldgElements::RelatingBuildingElement
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcElement (IfcEntityInstanceData* e);
@@ -31601,7 +31002,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcAssemblyPlaceEnum; case 9: return Type::IfcElementAssemblyTypeEnum; } return IfcElement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "AssemblyPlace"; case 9: return "PredefinedType"; } return IfcElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcElementAssembly (IfcEntityInstanceData* e);
@@ -31640,7 +31040,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcElementAssemblyTypeEnum; } return IfcElementType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcElementType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcElementAssemblyType (IfcEntityInstanceData* e);
@@ -31731,7 +31130,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcElement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcElementComponent (IfcEntityInstanceData* e);
@@ -31754,7 +31152,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcElementType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcElementType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcElementComponentType (IfcEntityInstanceData* e);
@@ -31801,7 +31198,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 1: return Type::IfcPositiveLengthMeasure; case 2: return Type::IfcPositiveLengthMeasure; } return IfcConic::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 1: return "SemiAxis1"; case 2: return "SemiAxis2"; } return IfcConic::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcEllipse (IfcEntityInstanceData* e);
@@ -31840,7 +31236,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcDistributionFlowElementType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcDistributionFlowElementType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcEnergyConversionDeviceType (IfcEntityInstanceData* e);
@@ -31882,7 +31277,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcEngineTypeEnum; } return IfcEnergyConversionDeviceType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcEnergyConversionDeviceType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcEngineType (IfcEntityInstanceData* e);
@@ -31925,7 +31319,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcEvaporativeCoolerTypeEnum; } return IfcEnergyConversionDeviceType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcEnergyConversionDeviceType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcEvaporativeCoolerType (IfcEntityInstanceData* e);
@@ -31968,7 +31361,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcEvaporatorTypeEnum; } return IfcEnergyConversionDeviceType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcEnergyConversionDeviceType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcEvaporatorType (IfcEntityInstanceData* e);
@@ -32083,7 +31475,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 7: return Type::IfcEventTypeEnum; case 8: return Type::IfcEventTriggerTypeEnum; case 9: return Type::IfcLabel; case 10: return Type::IfcEventTime; } return IfcProcess::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 7: return "PredefinedType"; case 8: return "EventTriggerType"; case 9: return "UserDefinedEventTriggerType"; case 10: return "EventOccurenceTime"; } return IfcProcess::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcEvent (IfcEntityInstanceData* e);
@@ -32102,7 +31493,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcSpatialElement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcSpatialElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcExternalSpatialStructureElement (IfcEntityInstanceData* e);
@@ -32140,7 +31530,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcManifoldSolidBrep::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcManifoldSolidBrep::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcFacetedBrep (IfcEntityInstanceData* e);
@@ -32181,7 +31570,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 1: return Type::IfcClosedShell; } return IfcFacetedBrep::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 1: return "Voids"; } return IfcFacetedBrep::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcFacetedBrepWithVoids (IfcEntityInstanceData* e);
@@ -32208,7 +31596,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcFastenerTypeEnum; } return IfcElementComponent::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "PredefinedType"; } return IfcElementComponent::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcFastener (IfcEntityInstanceData* e);
@@ -32248,7 +31635,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcFastenerTypeEnum; } return IfcElementComponentType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcElementComponentType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcFastenerType (IfcEntityInstanceData* e);
@@ -32356,7 +31742,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcElement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcFeatureElement (IfcEntityInstanceData* e);
@@ -32426,7 +31811,6 @@ public:
     virtual const char* getArgumentName(unsigned int i) const { return IfcFeatureElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcRelProjectsElement >::ptr ProjectsElements() const; // INVERSE IfcRelProjectsElement::RelatedFeatureElement
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcFeatureElementAddition (IfcEntityInstanceData* e);
@@ -32491,7 +31875,6 @@ public:
     virtual const char* getArgumentName(unsigned int i) const { return IfcFeatureElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcRelVoidsElement >::ptr VoidsElements() const; // INVERSE IfcRelVoidsElement::RelatedOpeningElement
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcFeatureElementSubtraction (IfcEntityInstanceData* e);
@@ -32529,7 +31912,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcDistributionFlowElementType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcDistributionFlowElementType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcFlowControllerType (IfcEntityInstanceData* e);
@@ -32568,7 +31950,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcDistributionFlowElementType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcDistributionFlowElementType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcFlowFittingType (IfcEntityInstanceData* e);
@@ -32617,7 +31998,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcFlowMeterTypeEnum; } return IfcFlowControllerType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcFlowControllerType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcFlowMeterType (IfcEntityInstanceData* e);
@@ -32654,7 +32034,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcDistributionFlowElementType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcDistributionFlowElementType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcFlowMovingDeviceType (IfcEntityInstanceData* e);
@@ -32700,7 +32079,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcDistributionFlowElementType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcDistributionFlowElementType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcFlowSegmentType (IfcEntityInstanceData* e);
@@ -32721,7 +32099,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcDistributionFlowElementType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcDistributionFlowElementType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcFlowStorageDeviceType (IfcEntityInstanceData* e);
@@ -32742,7 +32119,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcDistributionFlowElementType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcDistributionFlowElementType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcFlowTerminalType (IfcEntityInstanceData* e);
@@ -32765,7 +32141,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcDistributionFlowElementType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcDistributionFlowElementType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcFlowTreatmentDeviceType (IfcEntityInstanceData* e);
@@ -32791,7 +32166,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcFootingTypeEnum; } return IfcBuildingElementType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcBuildingElementType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcFootingType (IfcEntityInstanceData* e);
@@ -32909,7 +32283,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcElement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcFurnishingElement (IfcEntityInstanceData* e);
@@ -32958,7 +32331,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcFurnitureTypeEnum; } return IfcFurnishingElement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "PredefinedType"; } return IfcFurnishingElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcFurniture (IfcEntityInstanceData* e);
@@ -33117,7 +32489,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcGeographicElementTypeEnum; } return IfcElement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "PredefinedType"; } return IfcElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcGeographicElement (IfcEntityInstanceData* e);
@@ -33243,7 +32614,6 @@ public:
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 7: return "UAxes"; case 8: return "VAxes"; case 9: return "WAxes"; case 10: return "PredefinedType"; } return IfcProduct::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcRelContainedInSpatialStructure >::ptr ContainedInStructure() const; // INVERSE IfcRelContainedInSpatialStructure::RelatedElements
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcGrid (IfcEntityInstanceData* e);
@@ -33288,7 +32658,6 @@ public:
     virtual const char* getArgumentName(unsigned int i) const { return IfcObject::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcRelAssignsToGroup >::ptr IsGroupedBy() const; // INVERSE IfcRelAssignsToGroup::RelatingGroup
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcGroup (IfcEntityInstanceData* e);
@@ -33334,7 +32703,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcHeatExchangerTypeEnum; } return IfcEnergyConversionDeviceType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcEnergyConversionDeviceType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcHeatExchangerType (IfcEntityInstanceData* e);
@@ -33377,7 +32745,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcHumidifierTypeEnum; } return IfcEnergyConversionDeviceType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcEnergyConversionDeviceType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcHumidifierType (IfcEntityInstanceData* e);
@@ -33402,7 +32769,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcCartesianPointList; case 1: return Type::IfcSegmentIndexSelect; case 2: return Type::IfcBoolean; } return IfcBoundedCurve::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Points"; case 1: return "Segments"; case 2: return "SelfIntersect"; } return IfcBoundedCurve::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcIndexedPolyCurve (IfcEntityInstanceData* e);
@@ -33451,7 +32817,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcInterceptorTypeEnum; } return IfcFlowTreatmentDeviceType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcFlowTreatmentDeviceType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcInterceptorType (IfcEntityInstanceData* e);
@@ -33466,7 +32831,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcSurfaceCurve::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcSurfaceCurve::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcIntersectionCurve (IfcEntityInstanceData* e);
@@ -33525,7 +32889,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 5: return Type::IfcInventoryTypeEnum; case 6: return Type::IfcActorSelect; case 7: return Type::IfcPerson; case 8: return Type::IfcDate; case 9: return Type::IfcCostValue; case 10: return Type::IfcCostValue; } return IfcGroup::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 5: return "PredefinedType"; case 6: return "Jurisdiction"; case 7: return "ResponsiblePersons"; case 8: return "LastUpdateDate"; case 9: return "CurrentValue"; case 10: return "OriginalValue"; } return IfcGroup::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcInventory (IfcEntityInstanceData* e);
@@ -33569,7 +32932,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcJunctionBoxTypeEnum; } return IfcFlowFittingType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcFlowFittingType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcJunctionBoxType (IfcEntityInstanceData* e);
@@ -33613,7 +32975,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 10: return Type::IfcLaborResourceTypeEnum; } return IfcConstructionResource::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 10: return "PredefinedType"; } return IfcConstructionResource::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcLaborResource (IfcEntityInstanceData* e);
@@ -33659,7 +33020,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcLampTypeEnum; } return IfcFlowTerminalType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcFlowTerminalType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcLampType (IfcEntityInstanceData* e);
@@ -33707,7 +33067,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcLightFixtureTypeEnum; } return IfcFlowTerminalType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcFlowTerminalType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcLightFixtureType (IfcEntityInstanceData* e);
@@ -33763,7 +33122,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcPositiveLengthMeasure; case 9: return Type::IfcPositiveLengthMeasure; case 10: return Type::IfcMechanicalFastenerTypeEnum; } return IfcElementComponent::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "NominalDiameter"; case 9: return "NominalLength"; case 10: return "PredefinedType"; } return IfcElementComponent::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcMechanicalFastener (IfcEntityInstanceData* e);
@@ -33825,7 +33183,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcMechanicalFastenerTypeEnum; case 10: return Type::IfcPositiveLengthMeasure; case 11: return Type::IfcPositiveLengthMeasure; } return IfcElementComponentType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; case 10: return "NominalDiameter"; case 11: return "NominalLength"; } return IfcElementComponentType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcMechanicalFastenerType (IfcEntityInstanceData* e);
@@ -33867,7 +33224,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcMedicalDeviceTypeEnum; } return IfcFlowTerminalType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcFlowTerminalType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcMedicalDeviceType (IfcEntityInstanceData* e);
@@ -33985,7 +33341,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcMemberTypeEnum; } return IfcBuildingElementType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcBuildingElementType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcMemberType (IfcEntityInstanceData* e);
@@ -34029,7 +33384,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcMotorConnectionTypeEnum; } return IfcEnergyConversionDeviceType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcEnergyConversionDeviceType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcMotorConnectionType (IfcEntityInstanceData* e);
@@ -34057,7 +33411,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 6: return Type::IfcOccupantTypeEnum; } return IfcActor::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 6: return "PredefinedType"; } return IfcActor::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcOccupant (IfcEntityInstanceData* e);
@@ -34281,7 +33634,6 @@ public:
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "PredefinedType"; } return IfcFeatureElementSubtraction::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcRelFillsElement >::ptr HasFillings() const; // INVERSE IfcRelFillsElement::RelatingOpeningElement
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcOpeningElement (IfcEntityInstanceData* e);
@@ -34388,7 +33740,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcOpeningElement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcOpeningElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcOpeningStandardCase (IfcEntityInstanceData* e);
@@ -34434,7 +33785,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcOutletTypeEnum; } return IfcFlowTerminalType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcFlowTerminalType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcOutletType (IfcEntityInstanceData* e);
@@ -34463,7 +33813,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 6: return Type::IfcLabel; case 7: return Type::IfcPerformanceHistoryTypeEnum; } return IfcControl::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 6: return "LifeCyclePhase"; case 7: return "PredefinedType"; } return IfcControl::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPerformanceHistory (IfcEntityInstanceData* e);
@@ -34529,7 +33878,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 4: return Type::IfcPermeableCoveringOperationEnum; case 5: return Type::IfcWindowPanelPositionEnum; case 6: return Type::IfcPositiveLengthMeasure; case 7: return Type::IfcPositiveLengthMeasure; case 8: return Type::IfcShapeAspect; } return IfcPreDefinedPropertySet::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 4: return "OperationType"; case 5: return "PanelPosition"; case 6: return "FrameDepth"; case 7: return "FrameThickness"; case 8: return "ShapeAspectStyle"; } return IfcPreDefinedPropertySet::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPermeableCoveringProperties (IfcEntityInstanceData* e);
@@ -34601,7 +33949,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 6: return Type::IfcPermitTypeEnum; case 7: return Type::IfcLabel; case 8: return Type::IfcText; } return IfcControl::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 6: return "PredefinedType"; case 7: return "Status"; case 8: return "LongDescription"; } return IfcControl::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPermit (IfcEntityInstanceData* e);
@@ -34625,7 +33972,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcPileTypeEnum; } return IfcBuildingElementType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcBuildingElementType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPileType (IfcEntityInstanceData* e);
@@ -34671,7 +34017,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcPipeFittingTypeEnum; } return IfcFlowFittingType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcFlowFittingType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPipeFittingType (IfcEntityInstanceData* e);
@@ -34721,7 +34066,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcPipeSegmentTypeEnum; } return IfcFlowSegmentType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcFlowSegmentType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPipeSegmentType (IfcEntityInstanceData* e);
@@ -34815,7 +34159,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcPlateTypeEnum; } return IfcBuildingElementType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcBuildingElementType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPlateType (IfcEntityInstanceData* e);
@@ -34840,7 +34183,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 1: return Type::IfcBoolean; case 2: return Type::IfcIndexedPolygonalFace; case 3: return Type::IfcPositiveInteger; } return IfcTessellatedFaceSet::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 1: return "Closed"; case 2: return "Faces"; case 3: return "PnIndex"; } return IfcTessellatedFaceSet::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPolygonalFaceSet (IfcEntityInstanceData* e);
@@ -34871,7 +34213,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcCartesianPoint; } return IfcBoundedCurve::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Points"; } return IfcBoundedCurve::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPolyline (IfcEntityInstanceData* e);
@@ -34941,7 +34282,6 @@ public:
     IfcTemplatedEntityList< IfcRelConnectsPortToElement >::ptr ContainedIn() const; // INVERSE IfcRelConnectsPortToElement::RelatingPort
     IfcTemplatedEntityList< IfcRelConnectsPorts >::ptr ConnectedFrom() const; // INVERSE IfcRelConnectsPorts::RelatedPort
     IfcTemplatedEntityList< IfcRelConnectsPorts >::ptr ConnectedTo() const; // INVERSE IfcRelConnectsPorts::RelatingPort
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPort (IfcEntityInstanceData* e);
@@ -35065,7 +34405,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 7: return Type::IfcProcedureTypeEnum; } return IfcProcess::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 7: return "PredefinedType"; } return IfcProcess::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcProcedure (IfcEntityInstanceData* e);
@@ -35147,7 +34486,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 6: return Type::IfcProjectOrderTypeEnum; case 7: return Type::IfcLabel; case 8: return Type::IfcText; } return IfcControl::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 6: return "PredefinedType"; case 7: return "Status"; case 8: return "LongDescription"; } return IfcControl::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcProjectOrder (IfcEntityInstanceData* e);
@@ -35275,7 +34613,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcProjectionElementTypeEnum; } return IfcFeatureElementAddition::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "PredefinedType"; } return IfcFeatureElementAddition::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcProjectionElement (IfcEntityInstanceData* e);
@@ -35327,7 +34664,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcProtectiveDeviceTypeEnum; } return IfcFlowControllerType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcFlowControllerType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcProtectiveDeviceType (IfcEntityInstanceData* e);
@@ -35372,7 +34708,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcPumpTypeEnum; } return IfcFlowMovingDeviceType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcFlowMovingDeviceType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPumpType (IfcEntityInstanceData* e);
@@ -35409,7 +34744,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcRailingTypeEnum; } return IfcBuildingElementType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcBuildingElementType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRailingType (IfcEntityInstanceData* e);
@@ -35446,7 +34780,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcRampFlightTypeEnum; } return IfcBuildingElementType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcBuildingElementType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRampFlightType (IfcEntityInstanceData* e);
@@ -35496,7 +34829,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcRampTypeEnum; } return IfcBuildingElementType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcBuildingElementType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRampType (IfcEntityInstanceData* e);
@@ -35526,7 +34858,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 12: return Type::IfcReal; } return IfcBSplineSurfaceWithKnots::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 12: return "WeightsData"; } return IfcBSplineSurfaceWithKnots::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRationalBSplineSurfaceWithKnots (IfcEntityInstanceData* e);
@@ -35552,7 +34883,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcLabel; } return IfcElementComponent::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "SteelGrade"; } return IfcElementComponent::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcReinforcingElement (IfcEntityInstanceData* e);
@@ -35569,7 +34899,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcElementComponentType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcElementComponentType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcReinforcingElementType (IfcEntityInstanceData* e);
@@ -35644,7 +34973,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcPositiveLengthMeasure; case 10: return Type::IfcPositiveLengthMeasure; case 11: return Type::IfcPositiveLengthMeasure; case 12: return Type::IfcPositiveLengthMeasure; case 13: return Type::IfcAreaMeasure; case 14: return Type::IfcAreaMeasure; case 15: return Type::IfcPositiveLengthMeasure; case 16: return Type::IfcPositiveLengthMeasure; case 17: return Type::IfcReinforcingMeshTypeEnum; } return IfcReinforcingElement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "MeshLength"; case 10: return "MeshWidth"; case 11: return "LongitudinalBarNominalDiameter"; case 12: return "TransverseBarNominalDiameter"; case 13: return "LongitudinalBarCrossSectionArea"; case 14: return "TransverseBarCrossSectionArea"; case 15: return "LongitudinalBarSpacing"; case 16: return "TransverseBarSpacing"; case 17: return "PredefinedType"; } return IfcReinforcingElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcReinforcingMesh (IfcEntityInstanceData* e);
@@ -35720,7 +35048,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcReinforcingMeshTypeEnum; case 10: return Type::IfcPositiveLengthMeasure; case 11: return Type::IfcPositiveLengthMeasure; case 12: return Type::IfcPositiveLengthMeasure; case 13: return Type::IfcPositiveLengthMeasure; case 14: return Type::IfcAreaMeasure; case 15: return Type::IfcAreaMeasure; case 16: return Type::IfcPositiveLengthMeasure; case 17: return Type::IfcPositiveLengthMeasure; case 18: return Type::IfcLabel; case 19: return Type::IfcBendingParameterSelect; } return IfcReinforcingElementType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; case 10: return "MeshLength"; case 11: return "MeshWidth"; case 12: return "LongitudinalBarNominalDiameter"; case 13: return "TransverseBarNominalDiameter"; case 14: return "LongitudinalBarCrossSectionArea"; case 15: return "TransverseBarCrossSectionArea"; case 16: return "LongitudinalBarSpacing"; case 17: return "TransverseBarSpacing"; case 18: return "BendingShapeCode"; case 19: return "BendingParameters"; } return IfcReinforcingElementType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcReinforcingMeshType (IfcEntityInstanceData* e);
@@ -35766,7 +35093,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 4: return Type::IfcObjectDefinition; case 5: return Type::IfcObjectDefinition; } return IfcRelDecomposes::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 4: return "RelatingObject"; case 5: return "RelatedObjects"; } return IfcRelDecomposes::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRelAggregates (IfcEntityInstanceData* e);
@@ -35815,7 +35141,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcRoofTypeEnum; } return IfcBuildingElementType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcBuildingElementType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRoofType (IfcEntityInstanceData* e);
@@ -35869,7 +35194,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcSanitaryTerminalTypeEnum; } return IfcFlowTerminalType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcFlowTerminalType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcSanitaryTerminalType (IfcEntityInstanceData* e);
@@ -35884,7 +35208,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcSurfaceCurve::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcSurfaceCurve::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcSeamCurve (IfcEntityInstanceData* e);
@@ -35922,7 +35245,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcShadingDeviceTypeEnum; } return IfcBuildingElementType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcBuildingElementType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcShadingDeviceType (IfcEntityInstanceData* e);
@@ -36153,7 +35475,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcCompoundPlaneAngleMeasure; case 10: return Type::IfcCompoundPlaneAngleMeasure; case 11: return Type::IfcLengthMeasure; case 12: return Type::IfcLabel; case 13: return Type::IfcPostalAddress; } return IfcSpatialStructureElement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "RefLatitude"; case 10: return "RefLongitude"; case 11: return "RefElevation"; case 12: return "LandTitleNumber"; case 13: return "SiteAddress"; } return IfcSpatialStructureElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcSite (IfcEntityInstanceData* e);
@@ -36247,7 +35568,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcSlabTypeEnum; } return IfcBuildingElementType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcBuildingElementType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcSlabType (IfcEntityInstanceData* e);
@@ -36289,7 +35609,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcSolarDeviceTypeEnum; } return IfcEnergyConversionDeviceType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcEnergyConversionDeviceType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcSolarDeviceType (IfcEntityInstanceData* e);
@@ -36569,7 +35888,6 @@ public:
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcRelCoversSpaces >::ptr HasCoverings() const; // INVERSE IfcRelCoversSpaces::RelatingSpace
     IfcTemplatedEntityList< IfcRelSpaceBoundary >::ptr BoundedBy() const; // INVERSE IfcRelSpaceBoundary::RelatingSpace
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcSpace (IfcEntityInstanceData* e);
@@ -36616,7 +35934,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcSpaceHeaterTypeEnum; } return IfcFlowTerminalType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcFlowTerminalType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcSpaceHeaterType (IfcEntityInstanceData* e);
@@ -36718,7 +36035,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcSpaceTypeEnum; case 10: return Type::IfcLabel; } return IfcSpatialStructureElementType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; case 10: return "LongName"; } return IfcSpatialStructureElementType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcSpaceType (IfcEntityInstanceData* e);
@@ -36761,7 +36077,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcStackTerminalTypeEnum; } return IfcFlowTerminalType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcFlowTerminalType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcStackTerminalType (IfcEntityInstanceData* e);
@@ -36798,7 +36113,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcStairFlightTypeEnum; } return IfcBuildingElementType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcBuildingElementType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcStairFlightType (IfcEntityInstanceData* e);
@@ -36848,7 +36162,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcStairTypeEnum; } return IfcBuildingElementType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcBuildingElementType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcStairType (IfcEntityInstanceData* e);
@@ -36886,7 +36199,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcBoolean; } return IfcStructuralActivity::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "DestabilizingLoad"; } return IfcStructuralActivity::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcStructuralAction (IfcEntityInstanceData* e);
@@ -36909,7 +36221,6 @@ public:
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 7: return "AppliedCondition"; } return IfcStructuralItem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcRelConnectsStructuralMember >::ptr ConnectsStructuralMembers() const; // INVERSE IfcRelConnectsStructuralMember::RelatedStructuralConnection
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcStructuralConnection (IfcEntityInstanceData* e);
@@ -36987,7 +36298,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 10: return Type::IfcProjectedOrTrueLengthEnum; case 11: return Type::IfcStructuralCurveActivityTypeEnum; } return IfcStructuralAction::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 10: return "ProjectedOrTrue"; case 11: return "PredefinedType"; } return IfcStructuralAction::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcStructuralCurveAction (IfcEntityInstanceData* e);
@@ -37023,7 +36333,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcDirection; } return IfcStructuralConnection::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "Axis"; } return IfcStructuralConnection::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcStructuralCurveConnection (IfcEntityInstanceData* e);
@@ -37082,7 +36391,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 7: return Type::IfcStructuralCurveMemberTypeEnum; case 8: return Type::IfcDirection; } return IfcStructuralMember::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 7: return "PredefinedType"; case 8: return "Axis"; } return IfcStructuralMember::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcStructuralCurveMember (IfcEntityInstanceData* e);
@@ -37116,7 +36424,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcStructuralCurveMember::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcStructuralCurveMember::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcStructuralCurveMemberVarying (IfcEntityInstanceData* e);
@@ -37183,7 +36490,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcStructuralCurveActivityTypeEnum; } return IfcStructuralReaction::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcStructuralReaction::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcStructuralCurveReaction (IfcEntityInstanceData* e);
@@ -37204,7 +36510,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcStructuralCurveAction::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcStructuralCurveAction::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcStructuralLinearAction (IfcEntityInstanceData* e);
@@ -37272,7 +36577,6 @@ public:
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcStructuralResultGroup >::ptr SourceOfResultGroup() const; // INVERSE IfcStructuralResultGroup::ResultForLoadGroup
     IfcTemplatedEntityList< IfcStructuralAnalysisModel >::ptr LoadGroupFor() const; // INVERSE IfcStructuralAnalysisModel::LoadedBy
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcStructuralLoadGroup (IfcEntityInstanceData* e);
@@ -37331,7 +36635,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcStructuralAction::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcStructuralAction::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcStructuralPointAction (IfcEntityInstanceData* e);
@@ -37363,7 +36666,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcAxis2Placement3D; } return IfcStructuralConnection::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "ConditionCoordinateSystem"; } return IfcStructuralConnection::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcStructuralPointConnection (IfcEntityInstanceData* e);
@@ -37420,7 +36722,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcStructuralReaction::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcStructuralReaction::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcStructuralPointReaction (IfcEntityInstanceData* e);
@@ -37450,7 +36751,6 @@ public:
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 5: return "TheoryType"; case 6: return "ResultForLoadGroup"; case 7: return "IsLinear"; } return IfcGroup::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcStructuralAnalysisModel >::ptr ResultGroupFor() const; // INVERSE IfcStructuralAnalysisModel::HasResults
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcStructuralResultGroup (IfcEntityInstanceData* e);
@@ -37524,7 +36824,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 10: return Type::IfcProjectedOrTrueLengthEnum; case 11: return Type::IfcStructuralSurfaceActivityTypeEnum; } return IfcStructuralAction::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 10: return "ProjectedOrTrue"; case 11: return "PredefinedType"; } return IfcStructuralAction::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcStructuralSurfaceAction (IfcEntityInstanceData* e);
@@ -37550,7 +36849,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcStructuralConnection::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcStructuralConnection::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcStructuralSurfaceConnection (IfcEntityInstanceData* e);
@@ -37594,7 +36892,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 10: return Type::IfcSubContractResourceTypeEnum; } return IfcConstructionResource::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 10: return "PredefinedType"; } return IfcConstructionResource::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcSubContractResource (IfcEntityInstanceData* e);
@@ -37645,7 +36942,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcSurfaceFeatureTypeEnum; } return IfcFeatureElement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "PredefinedType"; } return IfcFeatureElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcSurfaceFeature (IfcEntityInstanceData* e);
@@ -37702,7 +36998,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcSwitchingDeviceTypeEnum; } return IfcFlowControllerType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcFlowControllerType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcSwitchingDeviceType (IfcEntityInstanceData* e);
@@ -37734,7 +37029,6 @@ public:
     virtual const char* getArgumentName(unsigned int i) const { return IfcGroup::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcRelServicesBuildings >::ptr ServicesBuildings() const; // INVERSE IfcRelServicesBuildings::RelatingSystem
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcSystem (IfcEntityInstanceData* e);
@@ -37776,7 +37070,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcSystemFurnitureElementTypeEnum; } return IfcFurnishingElement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "PredefinedType"; } return IfcFurnishingElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcSystemFurnitureElement (IfcEntityInstanceData* e);
@@ -37825,7 +37118,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcTankTypeEnum; } return IfcFlowStorageDeviceType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcFlowStorageDeviceType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcTankType (IfcEntityInstanceData* e);
@@ -37872,7 +37164,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcTendonTypeEnum; case 10: return Type::IfcPositiveLengthMeasure; case 11: return Type::IfcAreaMeasure; case 12: return Type::IfcForceMeasure; case 13: return Type::IfcPressureMeasure; case 14: return Type::IfcNormalisedRatioMeasure; case 15: return Type::IfcPositiveLengthMeasure; case 16: return Type::IfcPositiveLengthMeasure; } return IfcReinforcingElement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; case 10: return "NominalDiameter"; case 11: return "CrossSectionArea"; case 12: return "TensionForce"; case 13: return "PreStress"; case 14: return "FrictionCoefficient"; case 15: return "AnchorageSlip"; case 16: return "MinCurvatureRadius"; } return IfcReinforcingElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcTendon (IfcEntityInstanceData* e);
@@ -37891,7 +37182,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcTendonAnchorTypeEnum; } return IfcReinforcingElement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcReinforcingElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcTendonAnchor (IfcEntityInstanceData* e);
@@ -37908,7 +37198,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcTendonAnchorTypeEnum; } return IfcReinforcingElementType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcReinforcingElementType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcTendonAnchorType (IfcEntityInstanceData* e);
@@ -37937,7 +37226,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcTendonTypeEnum; case 10: return Type::IfcPositiveLengthMeasure; case 11: return Type::IfcAreaMeasure; case 12: return Type::IfcPositiveLengthMeasure; } return IfcReinforcingElementType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; case 10: return "NominalDiameter"; case 11: return "CrossSectionArea"; case 12: return "SheathDiameter"; } return IfcReinforcingElementType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcTendonType (IfcEntityInstanceData* e);
@@ -37981,7 +37269,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcTransformerTypeEnum; } return IfcEnergyConversionDeviceType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcEnergyConversionDeviceType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcTransformerType (IfcEntityInstanceData* e);
@@ -38118,7 +37405,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcTransportElementTypeEnum; } return IfcElement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "PredefinedType"; } return IfcElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcTransportElement (IfcEntityInstanceData* e);
@@ -38225,7 +37511,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcCurve; case 1: return Type::IfcTrimmingSelect; case 2: return Type::IfcTrimmingSelect; case 3: return Type::IfcBoolean; case 4: return Type::IfcTrimmingPreference; } return IfcBoundedCurve::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "BasisCurve"; case 1: return "Trim1"; case 2: return "Trim2"; case 3: return "SenseAgreement"; case 4: return "MasterRepresentation"; } return IfcBoundedCurve::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcTrimmedCurve (IfcEntityInstanceData* e);
@@ -38271,7 +37556,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcTubeBundleTypeEnum; } return IfcEnergyConversionDeviceType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcEnergyConversionDeviceType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcTubeBundleType (IfcEntityInstanceData* e);
@@ -38316,7 +37600,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcUnitaryEquipmentTypeEnum; } return IfcEnergyConversionDeviceType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcEnergyConversionDeviceType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcUnitaryEquipmentType (IfcEntityInstanceData* e);
@@ -38371,7 +37654,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcValveTypeEnum; } return IfcFlowControllerType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcFlowControllerType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcValveType (IfcEntityInstanceData* e);
@@ -38423,7 +37705,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcVibrationIsolatorTypeEnum; } return IfcElementComponent::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "PredefinedType"; } return IfcElementComponent::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcVibrationIsolator (IfcEntityInstanceData* e);
@@ -38462,7 +37743,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcVibrationIsolatorTypeEnum; } return IfcElementComponentType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcElementComponentType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcVibrationIsolatorType (IfcEntityInstanceData* e);
@@ -38562,7 +37842,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcElement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcVirtualElement (IfcEntityInstanceData* e);
@@ -38613,7 +37892,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcVoidingFeatureTypeEnum; } return IfcFeatureElementSubtraction::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "PredefinedType"; } return IfcFeatureElementSubtraction::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcVoidingFeature (IfcEntityInstanceData* e);
@@ -38714,7 +37992,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcWallTypeEnum; } return IfcBuildingElementType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcBuildingElementType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcWallType (IfcEntityInstanceData* e);
@@ -38767,7 +38044,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcWasteTerminalTypeEnum; } return IfcFlowTerminalType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcFlowTerminalType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcWasteTerminalType (IfcEntityInstanceData* e);
@@ -38916,7 +38192,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcWindowTypeEnum; case 10: return Type::IfcWindowTypePartitioningEnum; case 11: return Type::IfcBoolean; case 12: return Type::IfcLabel; } return IfcBuildingElementType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; case 10: return "PartitioningType"; case 11: return "ParameterTakesPrecedence"; case 12: return "UserDefinedPartitioningType"; } return IfcBuildingElementType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcWindowType (IfcEntityInstanceData* e);
@@ -38965,7 +38240,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 6: return Type::IfcWorkTime; case 7: return Type::IfcWorkTime; case 8: return Type::IfcWorkCalendarTypeEnum; } return IfcControl::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 6: return "WorkingTimes"; case 7: return "ExceptionTimes"; case 8: return "PredefinedType"; } return IfcControl::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcWorkCalendar (IfcEntityInstanceData* e);
@@ -39054,7 +38328,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 6: return Type::IfcDateTime; case 7: return Type::IfcPerson; case 8: return Type::IfcLabel; case 9: return Type::IfcDuration; case 10: return Type::IfcDuration; case 11: return Type::IfcDateTime; case 12: return Type::IfcDateTime; } return IfcControl::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 6: return "CreationDate"; case 7: return "Creators"; case 8: return "Purpose"; case 9: return "Duration"; case 10: return "TotalFloat"; case 11: return "StartTime"; case 12: return "FinishTime"; } return IfcControl::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcWorkControl (IfcEntityInstanceData* e);
@@ -39099,7 +38372,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 13: return Type::IfcWorkPlanTypeEnum; } return IfcWorkControl::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 13: return "PredefinedType"; } return IfcWorkControl::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcWorkPlan (IfcEntityInstanceData* e);
@@ -39159,7 +38431,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 13: return Type::IfcWorkScheduleTypeEnum; } return IfcWorkControl::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 13: return "PredefinedType"; } return IfcWorkControl::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcWorkSchedule (IfcEntityInstanceData* e);
@@ -39267,7 +38538,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 5: return Type::IfcLabel; } return IfcSystem::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 5: return "LongName"; } return IfcSystem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcZone (IfcEntityInstanceData* e);
@@ -39344,7 +38614,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 6: return Type::IfcActionRequestTypeEnum; case 7: return Type::IfcLabel; case 8: return Type::IfcText; } return IfcControl::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 6: return "PredefinedType"; case 7: return "Status"; case 8: return "LongDescription"; } return IfcControl::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcActionRequest (IfcEntityInstanceData* e);
@@ -39387,7 +38656,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcAirTerminalBoxTypeEnum; } return IfcFlowControllerType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcFlowControllerType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcAirTerminalBoxType (IfcEntityInstanceData* e);
@@ -39429,7 +38697,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcAirTerminalTypeEnum; } return IfcFlowTerminalType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcFlowTerminalType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcAirTerminalType (IfcEntityInstanceData* e);
@@ -39472,7 +38739,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcAirToAirHeatRecoveryTypeEnum; } return IfcEnergyConversionDeviceType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcEnergyConversionDeviceType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcAirToAirHeatRecoveryType (IfcEntityInstanceData* e);
@@ -39560,7 +38826,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 5: return Type::IfcIdentifier; case 6: return Type::IfcCostValue; case 7: return Type::IfcCostValue; case 8: return Type::IfcCostValue; case 9: return Type::IfcActorSelect; case 10: return Type::IfcActorSelect; case 11: return Type::IfcPerson; case 12: return Type::IfcDate; case 13: return Type::IfcCostValue; } return IfcGroup::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 5: return "Identification"; case 6: return "OriginalValue"; case 7: return "CurrentValue"; case 8: return "TotalReplacementCost"; case 9: return "Owner"; case 10: return "User"; case 11: return "ResponsiblePerson"; case 12: return "IncorporationDate"; case 13: return "DepreciatedValue"; } return IfcGroup::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcAsset (IfcEntityInstanceData* e);
@@ -39619,7 +38884,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcAudioVisualApplianceTypeEnum; } return IfcFlowTerminalType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcFlowTerminalType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcAudioVisualApplianceType (IfcEntityInstanceData* e);
@@ -39697,7 +38961,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 0: return Type::IfcInteger; case 1: return Type::IfcCartesianPoint; case 2: return Type::IfcBSplineCurveForm; case 3: return Type::IfcLogical; case 4: return Type::IfcLogical; } return IfcBoundedCurve::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 0: return "Degree"; case 1: return "ControlPointsList"; case 2: return "CurveForm"; case 3: return "ClosedCurve"; case 4: return "SelfIntersect"; } return IfcBoundedCurve::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcBSplineCurve (IfcEntityInstanceData* e);
@@ -39737,7 +39000,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 5: return Type::IfcInteger; case 6: return Type::IfcParameterValue; case 7: return Type::IfcKnotType; } return IfcBSplineCurve::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 5: return "KnotMultiplicities"; case 6: return "Knots"; case 7: return "KnotSpec"; } return IfcBSplineCurve::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcBSplineCurveWithKnots (IfcEntityInstanceData* e);
@@ -39852,7 +39114,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcBeamTypeEnum; } return IfcBuildingElementType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcBuildingElementType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcBeamType (IfcEntityInstanceData* e);
@@ -39898,7 +39159,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcBoilerTypeEnum; } return IfcEnergyConversionDeviceType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcEnergyConversionDeviceType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcBoilerType (IfcEntityInstanceData* e);
@@ -39919,7 +39179,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcCompositeCurveOnSurface::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcCompositeCurveOnSurface::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcBoundaryCurve (IfcEntityInstanceData* e);
@@ -40296,7 +39555,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcElement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcBuildingElement (IfcEntityInstanceData* e);
@@ -40332,7 +39590,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcBuildingElementPartTypeEnum; } return IfcElementComponent::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "PredefinedType"; } return IfcElementComponent::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcBuildingElementPart (IfcEntityInstanceData* e);
@@ -40353,7 +39610,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcBuildingElementPartTypeEnum; } return IfcElementComponentType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcElementComponentType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcBuildingElementPartType (IfcEntityInstanceData* e);
@@ -40561,7 +39817,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcBuildingElementProxyTypeEnum; } return IfcBuildingElement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "PredefinedType"; } return IfcBuildingElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcBuildingElementProxy (IfcEntityInstanceData* e);
@@ -40612,7 +39867,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcBuildingElementProxyTypeEnum; } return IfcBuildingElementType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcBuildingElementType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcBuildingElementProxyType (IfcEntityInstanceData* e);
@@ -40671,7 +39925,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 5: return Type::IfcBuildingSystemTypeEnum; case 6: return Type::IfcLabel; } return IfcSystem::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 5: return "PredefinedType"; case 6: return "LongName"; } return IfcSystem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcBuildingSystem (IfcEntityInstanceData* e);
@@ -40714,7 +39967,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcBurnerTypeEnum; } return IfcEnergyConversionDeviceType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcEnergyConversionDeviceType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcBurnerType (IfcEntityInstanceData* e);
@@ -40757,7 +40009,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcCableCarrierFittingTypeEnum; } return IfcFlowFittingType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcFlowFittingType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcCableCarrierFittingType (IfcEntityInstanceData* e);
@@ -40806,7 +40057,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcCableCarrierSegmentTypeEnum; } return IfcFlowSegmentType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcFlowSegmentType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcCableCarrierSegmentType (IfcEntityInstanceData* e);
@@ -40851,7 +40101,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcCableFittingTypeEnum; } return IfcFlowFittingType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcFlowFittingType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcCableFittingType (IfcEntityInstanceData* e);
@@ -40909,7 +40158,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcCableSegmentTypeEnum; } return IfcFlowSegmentType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcFlowSegmentType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcCableSegmentType (IfcEntityInstanceData* e);
@@ -40958,7 +40206,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcChillerTypeEnum; } return IfcEnergyConversionDeviceType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcEnergyConversionDeviceType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcChillerType (IfcEntityInstanceData* e);
@@ -41019,7 +40266,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcChimneyTypeEnum; } return IfcBuildingElement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "PredefinedType"; } return IfcBuildingElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcChimney (IfcEntityInstanceData* e);
@@ -41063,7 +40309,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 1: return Type::IfcPositiveLengthMeasure; } return IfcConic::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 1: return "Radius"; } return IfcConic::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcCircle (IfcEntityInstanceData* e);
@@ -41078,7 +40323,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcElement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcCivilElement (IfcEntityInstanceData* e);
@@ -41122,7 +40366,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcCoilTypeEnum; } return IfcEnergyConversionDeviceType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcEnergyConversionDeviceType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcCoilType (IfcEntityInstanceData* e);
@@ -41415,7 +40658,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcColumnTypeEnum; } return IfcBuildingElement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "PredefinedType"; } return IfcBuildingElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcColumn (IfcEntityInstanceData* e);
@@ -41674,7 +40916,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcColumn::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcColumn::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcColumnStandardCase (IfcEntityInstanceData* e);
@@ -41723,7 +40964,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcCommunicationsApplianceTypeEnum; } return IfcFlowTerminalType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcFlowTerminalType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcCommunicationsApplianceType (IfcEntityInstanceData* e);
@@ -41767,7 +41007,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcCompressorTypeEnum; } return IfcFlowMovingDeviceType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcFlowMovingDeviceType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcCompressorType (IfcEntityInstanceData* e);
@@ -41811,7 +41050,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcCondenserTypeEnum; } return IfcEnergyConversionDeviceType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcEnergyConversionDeviceType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcCondenserType (IfcEntityInstanceData* e);
@@ -41853,7 +41091,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 10: return Type::IfcConstructionEquipmentResourceTypeEnum; } return IfcConstructionResource::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 10: return "PredefinedType"; } return IfcConstructionResource::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcConstructionEquipmentResource (IfcEntityInstanceData* e);
@@ -41899,7 +41136,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 10: return Type::IfcConstructionMaterialResourceTypeEnum; } return IfcConstructionResource::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 10: return "PredefinedType"; } return IfcConstructionResource::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcConstructionMaterialResource (IfcEntityInstanceData* e);
@@ -41934,7 +41170,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 10: return Type::IfcConstructionProductResourceTypeEnum; } return IfcConstructionResource::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 10: return "PredefinedType"; } return IfcConstructionResource::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcConstructionProductResource (IfcEntityInstanceData* e);
@@ -41980,7 +41215,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcCooledBeamTypeEnum; } return IfcEnergyConversionDeviceType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcEnergyConversionDeviceType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcCooledBeamType (IfcEntityInstanceData* e);
@@ -42030,7 +41264,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcCoolingTowerTypeEnum; } return IfcEnergyConversionDeviceType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcEnergyConversionDeviceType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcCoolingTowerType (IfcEntityInstanceData* e);
@@ -42275,7 +41508,6 @@ public:
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcRelCoversSpaces >::ptr CoversSpaces() const; // INVERSE IfcRelCoversSpaces::RelatedCoverings
     IfcTemplatedEntityList< IfcRelCoversBldgElements >::ptr CoversElements() const; // INVERSE IfcRelCoversBldgElements::RelatedCoverings
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcCovering (IfcEntityInstanceData* e);
@@ -42435,7 +41667,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcCurtainWallTypeEnum; } return IfcBuildingElement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "PredefinedType"; } return IfcBuildingElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcCurtainWall (IfcEntityInstanceData* e);
@@ -42486,7 +41717,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcDamperTypeEnum; } return IfcFlowControllerType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcFlowControllerType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcDamperType (IfcEntityInstanceData* e);
@@ -42678,7 +41908,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcDiscreteAccessoryTypeEnum; } return IfcElementComponent::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "PredefinedType"; } return IfcElementComponent::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcDiscreteAccessory (IfcEntityInstanceData* e);
@@ -42883,7 +42112,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcDiscreteAccessoryTypeEnum; } return IfcElementComponentType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcElementComponentType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcDiscreteAccessoryType (IfcEntityInstanceData* e);
@@ -42937,7 +42165,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcDistributionChamberElementTypeEnum; } return IfcDistributionFlowElementType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcDistributionFlowElementType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcDistributionChamberElementType (IfcEntityInstanceData* e);
@@ -43005,7 +42232,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcDistributionElementType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcDistributionElementType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcDistributionControlElementType (IfcEntityInstanceData* e);
@@ -43182,7 +42408,6 @@ public:
     virtual const char* getArgumentName(unsigned int i) const { return IfcElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcRelConnectsPortToElement >::ptr HasPorts() const; // INVERSE IfcRelConnectsPortToElement::RelatedElement
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcDistributionElement (IfcEntityInstanceData* e);
@@ -43265,7 +42490,6 @@ public:
     virtual const char* getArgumentName(unsigned int i) const { return IfcDistributionElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcRelFlowControlElements >::ptr HasControlElements() const; // INVERSE IfcRelFlowControlElements::RelatingFlowElement
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcDistributionFlowElement (IfcEntityInstanceData* e);
@@ -43375,7 +42599,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 7: return Type::IfcFlowDirectionEnum; case 8: return Type::IfcDistributionPortTypeEnum; case 9: return Type::IfcDistributionSystemEnum; } return IfcPort::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 7: return "FlowDirection"; case 8: return "PredefinedType"; case 9: return "SystemType"; } return IfcPort::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcDistributionPort (IfcEntityInstanceData* e);
@@ -43441,7 +42664,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 5: return Type::IfcLabel; case 6: return Type::IfcDistributionSystemEnum; } return IfcSystem::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 5: return "LongName"; case 6: return "PredefinedType"; } return IfcSystem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcDistributionSystem (IfcEntityInstanceData* e);
@@ -43846,7 +43068,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcPositiveLengthMeasure; case 9: return Type::IfcPositiveLengthMeasure; case 10: return Type::IfcDoorTypeEnum; case 11: return Type::IfcDoorTypeOperationEnum; case 12: return Type::IfcLabel; } return IfcBuildingElement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "OverallHeight"; case 9: return "OverallWidth"; case 10: return "PredefinedType"; case 11: return "OperationType"; case 12: return "UserDefinedOperationType"; } return IfcBuildingElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcDoor (IfcEntityInstanceData* e);
@@ -43964,7 +43185,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcDoor::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcDoor::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcDoorStandardCase (IfcEntityInstanceData* e);
@@ -44010,7 +43230,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcDuctFittingTypeEnum; } return IfcFlowFittingType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcFlowFittingType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcDuctFittingType (IfcEntityInstanceData* e);
@@ -44056,7 +43275,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcDuctSegmentTypeEnum; } return IfcFlowSegmentType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcFlowSegmentType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcDuctSegmentType (IfcEntityInstanceData* e);
@@ -44099,7 +43317,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcDuctSilencerTypeEnum; } return IfcFlowTreatmentDeviceType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcFlowTreatmentDeviceType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcDuctSilencerType (IfcEntityInstanceData* e);
@@ -44145,7 +43362,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcElectricApplianceTypeEnum; } return IfcFlowTerminalType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcFlowTerminalType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcElectricApplianceType (IfcEntityInstanceData* e);
@@ -44189,7 +43405,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcElectricDistributionBoardTypeEnum; } return IfcFlowControllerType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcFlowControllerType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcElectricDistributionBoardType (IfcEntityInstanceData* e);
@@ -44233,7 +43448,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcElectricFlowStorageDeviceTypeEnum; } return IfcFlowStorageDeviceType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcFlowStorageDeviceType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcElectricFlowStorageDeviceType (IfcEntityInstanceData* e);
@@ -44282,7 +43496,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcElectricGeneratorTypeEnum; } return IfcEnergyConversionDeviceType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcEnergyConversionDeviceType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcElectricGeneratorType (IfcEntityInstanceData* e);
@@ -44326,7 +43539,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcElectricMotorTypeEnum; } return IfcEnergyConversionDeviceType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcEnergyConversionDeviceType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcElectricMotorType (IfcEntityInstanceData* e);
@@ -44370,7 +43582,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcElectricTimeControlTypeEnum; } return IfcFlowControllerType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcFlowControllerType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcElectricTimeControlType (IfcEntityInstanceData* e);
@@ -44393,7 +43604,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcDistributionFlowElement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcDistributionFlowElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcEnergyConversionDevice (IfcEntityInstanceData* e);
@@ -44452,7 +43662,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcEngineTypeEnum; } return IfcEnergyConversionDevice::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "PredefinedType"; } return IfcEnergyConversionDevice::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcEngine (IfcEntityInstanceData* e);
@@ -44514,7 +43723,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcEvaporativeCoolerTypeEnum; } return IfcEnergyConversionDevice::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "PredefinedType"; } return IfcEnergyConversionDevice::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcEvaporativeCooler (IfcEntityInstanceData* e);
@@ -44596,7 +43804,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcEvaporatorTypeEnum; } return IfcEnergyConversionDevice::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "PredefinedType"; } return IfcEnergyConversionDevice::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcEvaporator (IfcEntityInstanceData* e);
@@ -44631,7 +43838,6 @@ public:
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "PredefinedType"; } return IfcExternalSpatialStructureElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcRelSpaceBoundary >::ptr BoundedBy() const; // INVERSE IfcRelSpaceBoundary::RelatingSpace
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcExternalSpatialElement (IfcEntityInstanceData* e);
@@ -44676,7 +43882,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcFanTypeEnum; } return IfcFlowMovingDeviceType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcFlowMovingDeviceType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcFanType (IfcEntityInstanceData* e);
@@ -44722,7 +43927,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcFilterTypeEnum; } return IfcFlowTreatmentDeviceType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcFlowTreatmentDeviceType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcFilterType (IfcEntityInstanceData* e);
@@ -44772,7 +43976,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcFireSuppressionTerminalTypeEnum; } return IfcFlowTerminalType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcFlowTerminalType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcFireSuppressionTerminalType (IfcEntityInstanceData* e);
@@ -44795,7 +43998,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcDistributionFlowElement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcDistributionFlowElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcFlowController (IfcEntityInstanceData* e);
@@ -44814,7 +44016,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcDistributionFlowElement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcDistributionFlowElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcFlowFitting (IfcEntityInstanceData* e);
@@ -44861,7 +44062,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcFlowInstrumentTypeEnum; } return IfcDistributionControlElementType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcDistributionControlElementType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcFlowInstrumentType (IfcEntityInstanceData* e);
@@ -44959,7 +44159,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcFlowMeterTypeEnum; } return IfcFlowController::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "PredefinedType"; } return IfcFlowController::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcFlowMeter (IfcEntityInstanceData* e);
@@ -44978,7 +44177,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcDistributionFlowElement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcDistributionFlowElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcFlowMovingDevice (IfcEntityInstanceData* e);
@@ -45015,7 +44213,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcDistributionFlowElement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcDistributionFlowElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcFlowSegment (IfcEntityInstanceData* e);
@@ -45039,7 +44236,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcDistributionFlowElement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcDistributionFlowElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcFlowStorageDevice (IfcEntityInstanceData* e);
@@ -45064,7 +44260,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcDistributionFlowElement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcDistributionFlowElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcFlowTerminal (IfcEntityInstanceData* e);
@@ -45083,7 +44278,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcDistributionFlowElement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcDistributionFlowElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcFlowTreatmentDevice (IfcEntityInstanceData* e);
@@ -45126,7 +44320,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcFootingTypeEnum; } return IfcBuildingElement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "PredefinedType"; } return IfcBuildingElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcFooting (IfcEntityInstanceData* e);
@@ -45194,7 +44387,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcHeatExchangerTypeEnum; } return IfcEnergyConversionDevice::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "PredefinedType"; } return IfcEnergyConversionDevice::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcHeatExchanger (IfcEntityInstanceData* e);
@@ -45255,7 +44447,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcHumidifierTypeEnum; } return IfcEnergyConversionDevice::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "PredefinedType"; } return IfcEnergyConversionDevice::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcHumidifier (IfcEntityInstanceData* e);
@@ -45330,7 +44521,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcInterceptorTypeEnum; } return IfcFlowTreatmentDevice::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "PredefinedType"; } return IfcFlowTreatmentDevice::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcInterceptor (IfcEntityInstanceData* e);
@@ -45414,7 +44604,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcJunctionBoxTypeEnum; } return IfcFlowFitting::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "PredefinedType"; } return IfcFlowFitting::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcJunctionBox (IfcEntityInstanceData* e);
@@ -45479,7 +44668,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcLampTypeEnum; } return IfcFlowTerminal::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "PredefinedType"; } return IfcFlowTerminal::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcLamp (IfcEntityInstanceData* e);
@@ -45563,7 +44751,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcLightFixtureTypeEnum; } return IfcFlowTerminal::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "PredefinedType"; } return IfcFlowTerminal::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcLightFixture (IfcEntityInstanceData* e);
@@ -45625,7 +44812,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcMedicalDeviceTypeEnum; } return IfcFlowTerminal::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "PredefinedType"; } return IfcFlowTerminal::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcMedicalDevice (IfcEntityInstanceData* e);
@@ -45897,7 +45083,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcMemberTypeEnum; } return IfcBuildingElement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "PredefinedType"; } return IfcBuildingElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcMember (IfcEntityInstanceData* e);
@@ -46150,7 +45335,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcMember::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcMember::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcMemberStandardCase (IfcEntityInstanceData* e);
@@ -46209,7 +45393,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcMotorConnectionTypeEnum; } return IfcEnergyConversionDevice::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "PredefinedType"; } return IfcEnergyConversionDevice::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcMotorConnection (IfcEntityInstanceData* e);
@@ -46228,7 +45411,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcBoundaryCurve::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcBoundaryCurve::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcOuterBoundaryCurve (IfcEntityInstanceData* e);
@@ -46312,7 +45494,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcOutletTypeEnum; } return IfcFlowTerminal::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "PredefinedType"; } return IfcFlowTerminal::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcOutlet (IfcEntityInstanceData* e);
@@ -46358,7 +45539,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcPileTypeEnum; case 9: return Type::IfcPileConstructionEnum; } return IfcBuildingElement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "PredefinedType"; case 9: return "ConstructionType"; } return IfcBuildingElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPile (IfcEntityInstanceData* e);
@@ -46461,7 +45641,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcPipeFittingTypeEnum; } return IfcFlowFitting::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "PredefinedType"; } return IfcFlowFitting::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPipeFitting (IfcEntityInstanceData* e);
@@ -46539,7 +45718,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcPipeSegmentTypeEnum; } return IfcFlowSegment::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "PredefinedType"; } return IfcFlowSegment::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPipeSegment (IfcEntityInstanceData* e);
@@ -46789,7 +45967,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcPlateTypeEnum; } return IfcBuildingElement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "PredefinedType"; } return IfcBuildingElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPlate (IfcEntityInstanceData* e);
@@ -46956,7 +46133,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcPlate::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcPlate::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPlateStandardCase (IfcEntityInstanceData* e);
@@ -47050,7 +46226,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcProtectiveDeviceTypeEnum; } return IfcFlowController::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "PredefinedType"; } return IfcFlowController::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcProtectiveDevice (IfcEntityInstanceData* e);
@@ -47107,7 +46282,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcProtectiveDeviceTrippingUnitTypeEnum; } return IfcDistributionControlElementType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcDistributionControlElementType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcProtectiveDeviceTrippingUnitType (IfcEntityInstanceData* e);
@@ -47174,7 +46348,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcPumpTypeEnum; } return IfcFlowMovingDevice::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "PredefinedType"; } return IfcFlowMovingDevice::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcPump (IfcEntityInstanceData* e);
@@ -47327,7 +46500,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcRailingTypeEnum; } return IfcBuildingElement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "PredefinedType"; } return IfcBuildingElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRailing (IfcEntityInstanceData* e);
@@ -47483,7 +46655,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcRampTypeEnum; } return IfcBuildingElement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "PredefinedType"; } return IfcBuildingElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRamp (IfcEntityInstanceData* e);
@@ -47693,7 +46864,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcRampFlightTypeEnum; } return IfcBuildingElement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "PredefinedType"; } return IfcBuildingElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRampFlight (IfcEntityInstanceData* e);
@@ -47746,7 +46916,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcReal; } return IfcBSplineCurveWithKnots::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "WeightsData"; } return IfcBSplineCurveWithKnots::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRationalBSplineCurveWithKnots (IfcEntityInstanceData* e);
@@ -47809,7 +46978,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcPositiveLengthMeasure; case 10: return Type::IfcAreaMeasure; case 11: return Type::IfcPositiveLengthMeasure; case 12: return Type::IfcReinforcingBarTypeEnum; case 13: return Type::IfcReinforcingBarSurfaceEnum; } return IfcReinforcingElement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "NominalDiameter"; case 10: return "CrossSectionArea"; case 11: return "BarLength"; case 12: return "PredefinedType"; case 13: return "BarSurface"; } return IfcReinforcingElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcReinforcingBar (IfcEntityInstanceData* e);
@@ -47870,7 +47038,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcReinforcingBarTypeEnum; case 10: return Type::IfcPositiveLengthMeasure; case 11: return Type::IfcAreaMeasure; case 12: return Type::IfcPositiveLengthMeasure; case 13: return Type::IfcReinforcingBarSurfaceEnum; case 14: return Type::IfcLabel; case 15: return Type::IfcBendingParameterSelect; } return IfcReinforcingElementType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; case 10: return "NominalDiameter"; case 11: return "CrossSectionArea"; case 12: return "BarLength"; case 13: return "BarSurface"; case 14: return "BendingShapeCode"; case 15: return "BendingParameters"; } return IfcReinforcingElementType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcReinforcingBarType (IfcEntityInstanceData* e);
@@ -48036,7 +47203,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcRoofTypeEnum; } return IfcBuildingElement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "PredefinedType"; } return IfcBuildingElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcRoof (IfcEntityInstanceData* e);
@@ -48180,7 +47346,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcSanitaryTerminalTypeEnum; } return IfcFlowTerminal::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "PredefinedType"; } return IfcFlowTerminal::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcSanitaryTerminal (IfcEntityInstanceData* e);
@@ -48245,7 +47410,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcSensorTypeEnum; } return IfcDistributionControlElementType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcDistributionControlElementType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcSensorType (IfcEntityInstanceData* e);
@@ -48279,7 +47443,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcShadingDeviceTypeEnum; } return IfcBuildingElement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "PredefinedType"; } return IfcBuildingElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcShadingDevice (IfcEntityInstanceData* e);
@@ -48561,7 +47724,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcSlabTypeEnum; } return IfcBuildingElement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "PredefinedType"; } return IfcBuildingElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcSlab (IfcEntityInstanceData* e);
@@ -48658,7 +47820,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcSlab::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcSlab::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcSlabElementedCase (IfcEntityInstanceData* e);
@@ -48831,7 +47992,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcSlab::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcSlab::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcSlabStandardCase (IfcEntityInstanceData* e);
@@ -48896,7 +48056,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcSolarDeviceTypeEnum; } return IfcEnergyConversionDevice::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "PredefinedType"; } return IfcEnergyConversionDevice::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcSolarDevice (IfcEntityInstanceData* e);
@@ -48976,7 +48135,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcSpaceHeaterTypeEnum; } return IfcFlowTerminal::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "PredefinedType"; } return IfcFlowTerminal::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcSpaceHeater (IfcEntityInstanceData* e);
@@ -49044,7 +48202,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcStackTerminalTypeEnum; } return IfcFlowTerminal::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "PredefinedType"; } return IfcFlowTerminal::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcStackTerminal (IfcEntityInstanceData* e);
@@ -49230,7 +48387,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcStairTypeEnum; } return IfcBuildingElement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "PredefinedType"; } return IfcBuildingElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcStair (IfcEntityInstanceData* e);
@@ -49444,7 +48600,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcInteger; case 9: return Type::IfcInteger; case 10: return Type::IfcPositiveLengthMeasure; case 11: return Type::IfcPositiveLengthMeasure; case 12: return Type::IfcStairFlightTypeEnum; } return IfcBuildingElement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "NumberOfRisers"; case 9: return "NumberOfTreads"; case 10: return "RiserHeight"; case 11: return "TreadLength"; case 12: return "PredefinedType"; } return IfcBuildingElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcStairFlight (IfcEntityInstanceData* e);
@@ -49517,7 +48672,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 5: return Type::IfcAnalysisModelTypeEnum; case 6: return Type::IfcAxis2Placement3D; case 7: return Type::IfcStructuralLoadGroup; case 8: return Type::IfcStructuralResultGroup; case 9: return Type::IfcObjectPlacement; } return IfcSystem::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 5: return "PredefinedType"; case 6: return "OrientationOf2DPlane"; case 7: return "LoadedBy"; case 8: return "HasResults"; case 9: return "SharedPlacement"; } return IfcSystem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcStructuralAnalysisModel (IfcEntityInstanceData* e);
@@ -49543,7 +48697,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 10: return Type::IfcRatioMeasure; } return IfcStructuralLoadGroup::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 10: return "SelfWeightCoefficients"; } return IfcStructuralLoadGroup::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcStructuralLoadCase (IfcEntityInstanceData* e);
@@ -49564,7 +48717,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcStructuralSurfaceAction::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcStructuralSurfaceAction::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcStructuralPlanarAction (IfcEntityInstanceData* e);
@@ -49670,7 +48822,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcSwitchingDeviceTypeEnum; } return IfcFlowController::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "PredefinedType"; } return IfcFlowController::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcSwitchingDevice (IfcEntityInstanceData* e);
@@ -49748,7 +48899,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcTankTypeEnum; } return IfcFlowStorageDevice::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "PredefinedType"; } return IfcFlowStorageDevice::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcTank (IfcEntityInstanceData* e);
@@ -49808,7 +48958,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcTransformerTypeEnum; } return IfcEnergyConversionDevice::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "PredefinedType"; } return IfcEnergyConversionDevice::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcTransformer (IfcEntityInstanceData* e);
@@ -49873,7 +49022,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcTubeBundleTypeEnum; } return IfcEnergyConversionDevice::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "PredefinedType"; } return IfcEnergyConversionDevice::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcTubeBundle (IfcEntityInstanceData* e);
@@ -49916,7 +49064,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcUnitaryControlElementTypeEnum; } return IfcDistributionControlElementType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcDistributionControlElementType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcUnitaryControlElementType (IfcEntityInstanceData* e);
@@ -50006,7 +49153,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcUnitaryEquipmentTypeEnum; } return IfcEnergyConversionDevice::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "PredefinedType"; } return IfcEnergyConversionDevice::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcUnitaryEquipment (IfcEntityInstanceData* e);
@@ -50210,7 +49356,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcValveTypeEnum; } return IfcFlowController::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "PredefinedType"; } return IfcFlowController::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcValve (IfcEntityInstanceData* e);
@@ -50474,7 +49619,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcWallTypeEnum; } return IfcBuildingElement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "PredefinedType"; } return IfcBuildingElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcWall (IfcEntityInstanceData* e);
@@ -50586,7 +49730,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcWall::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcWall::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcWallElementedCase (IfcEntityInstanceData* e);
@@ -50802,7 +49945,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcWall::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcWall::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcWallStandardCase (IfcEntityInstanceData* e);
@@ -50924,7 +50066,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcWasteTerminalTypeEnum; } return IfcFlowTerminal::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "PredefinedType"; } return IfcFlowTerminal::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcWasteTerminal (IfcEntityInstanceData* e);
@@ -51331,7 +50472,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcPositiveLengthMeasure; case 9: return Type::IfcPositiveLengthMeasure; case 10: return Type::IfcWindowTypeEnum; case 11: return Type::IfcWindowTypePartitioningEnum; case 12: return Type::IfcLabel; } return IfcBuildingElement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "OverallHeight"; case 9: return "OverallWidth"; case 10: return "PredefinedType"; case 11: return "PartitioningType"; case 12: return "UserDefinedPartitioningType"; } return IfcBuildingElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcWindow (IfcEntityInstanceData* e);
@@ -51459,7 +50599,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcWindow::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcWindow::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcWindowStandardCase (IfcEntityInstanceData* e);
@@ -51507,7 +50646,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcActuatorTypeEnum; } return IfcDistributionControlElementType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcDistributionControlElementType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcActuatorType (IfcEntityInstanceData* e);
@@ -51582,7 +50720,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcAirTerminalTypeEnum; } return IfcFlowTerminal::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "PredefinedType"; } return IfcFlowTerminal::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcAirTerminal (IfcEntityInstanceData* e);
@@ -51642,7 +50779,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcAirTerminalBoxTypeEnum; } return IfcFlowController::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "PredefinedType"; } return IfcFlowController::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcAirTerminalBox (IfcEntityInstanceData* e);
@@ -51705,7 +50841,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcAirToAirHeatRecoveryTypeEnum; } return IfcEnergyConversionDevice::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "PredefinedType"; } return IfcEnergyConversionDevice::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcAirToAirHeatRecovery (IfcEntityInstanceData* e);
@@ -51748,7 +50883,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcAlarmTypeEnum; } return IfcDistributionControlElementType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcDistributionControlElementType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcAlarmType (IfcEntityInstanceData* e);
@@ -51944,7 +51078,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcAudioVisualApplianceTypeEnum; } return IfcFlowTerminal::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "PredefinedType"; } return IfcFlowTerminal::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcAudioVisualAppliance (IfcEntityInstanceData* e);
@@ -52203,7 +51336,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcBeamTypeEnum; } return IfcBuildingElement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "PredefinedType"; } return IfcBuildingElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcBeam (IfcEntityInstanceData* e);
@@ -52468,7 +51600,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcBeam::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcBeam::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcBeamStandardCase (IfcEntityInstanceData* e);
@@ -52555,7 +51686,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcBoilerTypeEnum; } return IfcEnergyConversionDevice::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "PredefinedType"; } return IfcEnergyConversionDevice::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcBoiler (IfcEntityInstanceData* e);
@@ -52614,7 +51744,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcBurnerTypeEnum; } return IfcEnergyConversionDevice::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "PredefinedType"; } return IfcEnergyConversionDevice::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcBurner (IfcEntityInstanceData* e);
@@ -52694,7 +51823,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcCableCarrierFittingTypeEnum; } return IfcFlowFitting::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "PredefinedType"; } return IfcFlowFitting::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcCableCarrierFitting (IfcEntityInstanceData* e);
@@ -52772,7 +51900,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcCableCarrierSegmentTypeEnum; } return IfcFlowSegment::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "PredefinedType"; } return IfcFlowSegment::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcCableCarrierSegment (IfcEntityInstanceData* e);
@@ -52865,7 +51992,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcCableFittingTypeEnum; } return IfcFlowFitting::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "PredefinedType"; } return IfcFlowFitting::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcCableFitting (IfcEntityInstanceData* e);
@@ -52971,7 +52097,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcCableSegmentTypeEnum; } return IfcFlowSegment::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "PredefinedType"; } return IfcFlowSegment::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcCableSegment (IfcEntityInstanceData* e);
@@ -53058,7 +52183,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcChillerTypeEnum; } return IfcEnergyConversionDevice::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "PredefinedType"; } return IfcEnergyConversionDevice::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcChiller (IfcEntityInstanceData* e);
@@ -53142,7 +52266,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcCoilTypeEnum; } return IfcEnergyConversionDevice::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "PredefinedType"; } return IfcEnergyConversionDevice::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcCoil (IfcEntityInstanceData* e);
@@ -53262,7 +52385,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcCommunicationsApplianceTypeEnum; } return IfcFlowTerminal::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "PredefinedType"; } return IfcFlowTerminal::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcCommunicationsAppliance (IfcEntityInstanceData* e);
@@ -53326,7 +52448,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcCompressorTypeEnum; } return IfcFlowMovingDevice::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "PredefinedType"; } return IfcFlowMovingDevice::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcCompressor (IfcEntityInstanceData* e);
@@ -53410,7 +52531,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcCondenserTypeEnum; } return IfcEnergyConversionDevice::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "PredefinedType"; } return IfcEnergyConversionDevice::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcCondenser (IfcEntityInstanceData* e);
@@ -53463,7 +52583,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 9: return Type::IfcControllerTypeEnum; } return IfcDistributionControlElementType::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 9: return "PredefinedType"; } return IfcDistributionControlElementType::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcControllerType (IfcEntityInstanceData* e);
@@ -53530,7 +52649,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcCooledBeamTypeEnum; } return IfcEnergyConversionDevice::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "PredefinedType"; } return IfcEnergyConversionDevice::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcCooledBeam (IfcEntityInstanceData* e);
@@ -53605,7 +52723,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcCoolingTowerTypeEnum; } return IfcEnergyConversionDevice::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "PredefinedType"; } return IfcEnergyConversionDevice::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcCoolingTower (IfcEntityInstanceData* e);
@@ -53694,7 +52811,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcDamperTypeEnum; } return IfcFlowController::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "PredefinedType"; } return IfcFlowController::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcDamper (IfcEntityInstanceData* e);
@@ -53743,7 +52859,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcDistributionChamberElementTypeEnum; } return IfcDistributionFlowElement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "PredefinedType"; } return IfcDistributionFlowElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcDistributionChamberElement (IfcEntityInstanceData* e);
@@ -53758,7 +52873,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { return IfcDistributionSystem::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { return IfcDistributionSystem::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcDistributionCircuit (IfcEntityInstanceData* e);
@@ -53851,7 +52965,6 @@ public:
     virtual const char* getArgumentName(unsigned int i) const { return IfcDistributionElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
     IfcTemplatedEntityList< IfcRelFlowControlElements >::ptr AssignedToFlowElement() const; // INVERSE IfcRelFlowControlElements::RelatedControlElements
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcDistributionControlElement (IfcEntityInstanceData* e);
@@ -53944,7 +53057,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcDuctFittingTypeEnum; } return IfcFlowFitting::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "PredefinedType"; } return IfcFlowFitting::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcDuctFitting (IfcEntityInstanceData* e);
@@ -54011,7 +53123,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcDuctSegmentTypeEnum; } return IfcFlowSegment::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "PredefinedType"; } return IfcFlowSegment::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcDuctSegment (IfcEntityInstanceData* e);
@@ -54071,7 +53182,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcDuctSilencerTypeEnum; } return IfcFlowTreatmentDevice::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "PredefinedType"; } return IfcFlowTreatmentDevice::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcDuctSilencer (IfcEntityInstanceData* e);
@@ -54187,7 +53297,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcElectricApplianceTypeEnum; } return IfcFlowTerminal::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "PredefinedType"; } return IfcFlowTerminal::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcElectricAppliance (IfcEntityInstanceData* e);
@@ -54262,7 +53371,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcElectricDistributionBoardTypeEnum; } return IfcFlowController::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "PredefinedType"; } return IfcFlowController::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcElectricDistributionBoard (IfcEntityInstanceData* e);
@@ -54321,7 +53429,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcElectricFlowStorageDeviceTypeEnum; } return IfcFlowStorageDevice::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "PredefinedType"; } return IfcFlowStorageDevice::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcElectricFlowStorageDevice (IfcEntityInstanceData* e);
@@ -54386,7 +53493,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcElectricGeneratorTypeEnum; } return IfcEnergyConversionDevice::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "PredefinedType"; } return IfcEnergyConversionDevice::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcElectricGenerator (IfcEntityInstanceData* e);
@@ -54445,7 +53551,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcElectricMotorTypeEnum; } return IfcEnergyConversionDevice::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "PredefinedType"; } return IfcEnergyConversionDevice::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcElectricMotor (IfcEntityInstanceData* e);
@@ -54504,7 +53609,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcElectricTimeControlTypeEnum; } return IfcFlowController::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "PredefinedType"; } return IfcFlowController::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcElectricTimeControl (IfcEntityInstanceData* e);
@@ -54576,7 +53680,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcFanTypeEnum; } return IfcFlowMovingDevice::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "PredefinedType"; } return IfcFlowMovingDevice::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcFan (IfcEntityInstanceData* e);
@@ -54681,7 +53784,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcFilterTypeEnum; } return IfcFlowTreatmentDevice::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "PredefinedType"; } return IfcFlowTreatmentDevice::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcFilter (IfcEntityInstanceData* e);
@@ -54765,7 +53867,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcFireSuppressionTerminalTypeEnum; } return IfcFlowTerminal::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "PredefinedType"; } return IfcFlowTerminal::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcFireSuppressionTerminal (IfcEntityInstanceData* e);
@@ -54835,7 +53936,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcFlowInstrumentTypeEnum; } return IfcDistributionControlElement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "PredefinedType"; } return IfcDistributionControlElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcFlowInstrument (IfcEntityInstanceData* e);
@@ -54905,7 +54005,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcProtectiveDeviceTrippingUnitTypeEnum; } return IfcDistributionControlElement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "PredefinedType"; } return IfcDistributionControlElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcProtectiveDeviceTrippingUnit (IfcEntityInstanceData* e);
@@ -55057,7 +54156,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcSensorTypeEnum; } return IfcDistributionControlElement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "PredefinedType"; } return IfcDistributionControlElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcSensor (IfcEntityInstanceData* e);
@@ -55130,7 +54228,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcUnitaryControlElementTypeEnum; } return IfcDistributionControlElement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "PredefinedType"; } return IfcDistributionControlElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcUnitaryControlElement (IfcEntityInstanceData* e);
@@ -55210,7 +54307,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcActuatorTypeEnum; } return IfcDistributionControlElement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "PredefinedType"; } return IfcDistributionControlElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcActuator (IfcEntityInstanceData* e);
@@ -55270,7 +54366,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcAlarmTypeEnum; } return IfcDistributionControlElement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "PredefinedType"; } return IfcDistributionControlElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcAlarm (IfcEntityInstanceData* e);
@@ -55394,7 +54489,6 @@ public:
     virtual Type::Enum getArgumentEntity(unsigned int i) const { switch (i) {case 8: return Type::IfcControllerTypeEnum; } return IfcDistributionControlElement::getArgumentEntity(i); }
     virtual const char* getArgumentName(unsigned int i) const { switch (i) {case 8: return "PredefinedType"; } return IfcDistributionControlElement::getArgumentName(i); }
     virtual Argument* getArgument(unsigned int i) const { return entity->getArgument(i); }
-    bool is(Type::Enum v) const;
     Type::Enum type() const;
     static Type::Enum Class();
     IfcController (IfcEntityInstanceData* e);
@@ -55402,8 +54496,7 @@ public:
     typedef IfcTemplatedEntityList< IfcController > list;
 };
 
-IFC_PARSE_API void InitStringMap();
-IFC_PARSE_API IfcUtil::IfcBaseClass* SchemaEntity(IfcEntityInstanceData* e = 0);
+IFC_PARSE_API IfcUtil::IfcBaseClass* SchemaEntity(IfcEntityInstanceData* e = 0, IfcParse::IfcArena* arena = 0);
 }
 
 #endif
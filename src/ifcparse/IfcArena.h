@@ -0,0 +1,142 @@
+/********************************************************************************
+ *                                                                              *
+ * This file is part of IfcOpenShell.                                           *
+ *                                                                              *
+ * IfcOpenShell is free software: you can redistribute it and/or modify         *
+ * it under the terms of the Lesser GNU General Public License as published by  *
+ * the Free Software Foundation, either version 3.0 of the License, or          *
+ * (at your option) any later version.                                          *
+ *                                                                              *
+ * IfcOpenShell is distributed in the hope that it will be useful,              *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of               *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                 *
+ * Lesser GNU General Public License for more details.                          *
+ *                                                                              *
+ * You should have received a copy of the Lesser GNU General Public License     *
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.         *
+ *                                                                              *
+ ********************************************************************************/
+
+#ifndef IFCARENA_H
+#define IFCARENA_H
+
+#include <map>
+#include <new>
+#include <vector>
+#include <cstddef>
+
+#include "ifc_parse_api.h"
+#include "../ifcparse/IfcPerThread.h"
+
+namespace IfcParse {
+
+	/// A bump allocator that hands out memory from large contiguous blocks.
+	/// Memory is not returned to the arena individually, instead all blocks
+	/// are released at once when the arena is destroyed. Objects allocated
+	/// from the arena are not destructed, hence they should not own memory
+	/// outside of the arena, unless it is registered by means of own().
+	/// Threads other than the one that created the arena allocate from an
+	/// arena of their own, which is released along with this arena, so that
+	/// allocations can be made concurrently.
+	class IFC_PARSE_API IfcArena {
+	private:
+		typedef std::map<const char*, const char*> block_map_t;
+		block_map_t blocks;
+		char* ptr;
+		char* end;
+		size_t next_block_size;
+		typedef std::map<void*, void(*)(void*)> owned_map_t;
+		owned_map_t owned;
+		per_thread_instances<IfcArena> locals;
+
+		template <typename T>
+		static void delete_object(void* p) {
+			delete static_cast<T*>(p);
+		}
+
+		static IfcArena* create_local();
+		/// Returns the arena to be used by the calling thread
+		IfcArena* local();
+
+		IfcArena(const IfcArena&); //N/A
+		IfcArena& operator =(const IfcArena&); //N/A
+	public:
+		IfcArena();
+		~IfcArena();
+		/// Returns a pointer to size bytes, aligned to eight bytes
+		void* allocate(size_t size);
+		/// Returns whether the pointer points into one of the blocks
+		bool owns(const void* p) const;
+		/// Deletes the heap-allocated object along with the arena
+		template <typename T>
+		void own(T* t) {
+			if (!locals.is_creator()) {
+				local()->own(t);
+				return;
+			}
+			owned[(void*) t] = &delete_object<T>;
+		}
+		/// Relinquishes ownership of an object registered by means of own(),
+		/// so that it can be deleted before the arena is. Returns false if
+		/// the object is not owned by this arena.
+		bool disown(void* t);
+		/// Takes over the blocks and owned objects of another arena, which
+		/// is left empty. Used to combine arenas filled on separate threads.
+		/// Should not be called while other threads allocate from either arena.
+		void splice(IfcArena& other);
+	};
+
+	/// Standard library compatible allocator that allocates from an
+	/// IfcArena, or from the free store if no arena is specified.
+	template <typename T>
+	class arena_allocator {
+	public:
+		typedef T value_type;
+		typedef T* pointer;
+		typedef const T* const_pointer;
+		typedef T& reference;
+		typedef const T& const_reference;
+		typedef size_t size_type;
+		typedef ptrdiff_t difference_type;
+
+		template <typename U>
+		struct rebind {
+			typedef arena_allocator<U> other;
+		};
+
+		IfcArena* arena;
+
+		arena_allocator(IfcArena* a = 0) : arena(a) {}
+
+		template <typename U>
+		arena_allocator(const arena_allocator<U>& other) : arena(other.arena) {}
+
+		pointer allocate(size_type n, const void* = 0) {
+			const size_t size = n * sizeof(T);
+			return static_cast<pointer>(arena ? arena->allocate(size) : ::operator new(size));
+		}
+
+		void deallocate(pointer p, size_type) {
+			if (!arena) {
+				::operator delete(p);
+			}
+		}
+
+		size_type max_size() const { return size_t(-1) / sizeof(T); }
+
+		void construct(pointer p, const T& t) { new ((void*) p) T(t); }
+		void destroy(pointer p) { p->~T(); }
+
+		pointer address(reference r) const { return &r; }
+		const_pointer address(const_reference r) const { return &r; }
+	};
+
+	template <typename T, typename U>
+	bool operator ==(const arena_allocator<T>& a, const arena_allocator<U>& b) { return a.arena == b.arena; }
+
+	template <typename T, typename U>
+	bool operator !=(const arena_allocator<T>& a, const arena_allocator<U>& b) { return a.arena != b.arena; }
+
+}
+
+#endif
@@ -38,8 +38,9 @@ namespace IfcUtil {
 	public:
 		virtual ~IfcBaseClass() {}
 		IfcEntityInstanceData* entity;
-		virtual bool is(IfcSchema::Type::Enum v) const = 0;
 		virtual IfcSchema::Type::Enum type() const = 0;
+		/// Returns whether the instance is of type v or one of its subtypes
+		bool is(IfcSchema::Type::Enum v) const { return IfcSchema::Type::IsSubtypeOf(type(), v); }
 
 		virtual unsigned int getArgumentCount() const = 0;
 		virtual IfcUtil::ArgumentType getArgumentType(unsigned int i) const = 0;
@@ -47,6 +48,15 @@ namespace IfcUtil {
 		virtual Argument* getArgument(unsigned int i) const = 0;
 		virtual const char* getArgumentName(unsigned int i) const = 0;
 
+		static void* operator new(size_t size) { return ::operator new(size); }
+		static void operator delete(void* p) { ::operator delete(p); }
+		/// Allocates the instance from the arena, which is not to be null. Instances
+		/// allocated from an arena are released along with the arena and should
+		/// not be deleted.
+		static void* operator new(size_t size, IfcParse::IfcArena* arena) { return arena->allocate(size); }
+		/// Only called when the constructor throws, the memory is released along with the arena
+		static void operator delete(void*, IfcParse::IfcArena*) {}
+
 		template <class T>
 		T* as() {
 			return is(T::Class())
@@ -0,0 +1,748 @@
+/********************************************************************************
+ *                                                                              *
+ * This file is part of IfcOpenShell.                                           *
+ *                                                                              *
+ * IfcOpenShell is free software: you can redistribute it and/or modify         *
+ * it under the terms of the Lesser GNU General Public License as published by  *
+ * the Free Software Foundation, either version 3.0 of the License, or          *
+ * (at your option) any later version.                                          *
+ *                                                                              *
+ * IfcOpenShell is distributed in the hope that it will be useful,              *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of               *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                 *
+ * Lesser GNU General Public License for more details.                          *
+ *                                                                              *
+ * You should have received a copy of the Lesser GNU General Public License     *
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.         *
+ *                                                                              *
+ ********************************************************************************/
+
+/********************************************************************************
+ *                                                                              *
+ * The binary form of a file written by IfcFile::writeBinary() consists of:     *
+ *                                                                              *
+ *  - a magic number, a version and the schema identifier                       *
+ *  - the fields of the header                                                  *
+ *  - the table of strings                                                      *
+ *  - the type and name of every instance, ordered by name                      *
+ *  - the attributes of every instance, in the same order                       *
+ *                                                                              *
+ * Counts, integers and instance names are written as variable length integers, *
+ * of which the names as the difference with the previous name. Every attribute *
+ * is preceded by its IfcUtil::ArgumentType. Instance references are written as *
+ * the name of the instance, or zero followed by the type and attributes of an  *
+ * inline instance, e.g. IFCLABEL('x'). Real numbers are written in the native  *
+ * binary representation, so the file is only to be read on a platform of the   *
+ * same endianness.                                                             *
+ *                                                                              *
+ ********************************************************************************/
+
+#include <cstring>
+#include <algorithm>
+#include <iterator>
+
+#include <boost/unordered_map.hpp>
+
+#include "../ifcparse/IfcFile.h"
+#include "../ifcparse/IfcWrite.h"
+#include "../ifcparse/IfcException.h"
+#include "../ifcparse/IfcLogger.h"
+
+#ifdef USE_IFC4
+#include "../ifcparse/Ifc4-latebound.h"
+#else
+#include "../ifcparse/Ifc2x3-latebound.h"
+#endif
+
+using namespace IfcParse;
+
+namespace {
+	const char binary_magic[8] = { 'I', 'F', 'C', 'B', 'I', 'N', '\r', '\n' };
+	const unsigned int binary_version = 1;
+
+	/// The strings written to a binary file, by their index in the table
+	class binary_string_table {
+	private:
+		boost::unordered_map<std::string, unsigned int> index_;
+		std::vector<const std::string*> strings_;
+	public:
+		unsigned int index(const std::string& s) {
+			std::pair<boost::unordered_map<std::string, unsigned int>::iterator, bool> inserted =
+				index_.insert(std::make_pair(s, (unsigned int) strings_.size()));
+			if (inserted.second) {
+				strings_.push_back(&inserted.first->first);
+			}
+			return inserted.first->second;
+		}
+
+		const std::vector<const std::string*>& strings() const {
+			return strings_;
+		}
+	};
+
+	class binary_writer {
+	private:
+		std::string& data_;
+		binary_string_table& strings_;
+
+		binary_writer(const binary_writer&); //N/A
+		binary_writer& operator =(const binary_writer&); //N/A
+
+		void write_instance(IfcUtil::IfcBaseClass* instance) {
+			const unsigned int id = instance->entity->id();
+			write_unsigned(id);
+			if (id == 0) {
+				// An inline instance, e.g. IFCLABEL('x'), which is not part
+				// of the file by itself
+				write_unsigned(instance->type());
+				write_attributes(*instance->entity);
+			}
+		}
+
+		template <typename It>
+		void write_instances(It begin, It end) {
+			write_unsigned(std::distance(begin, end));
+			for (It it = begin; it != end; ++it) {
+				write_instance(*it);
+			}
+		}
+
+		void write_bits(const boost::dynamic_bitset<>& bits) {
+			write_unsigned(bits.size());
+			for (size_t i = 0; i < bits.size(); i += 8) {
+				unsigned char byte = 0;
+				for (size_t j = i; j < i + 8 && j < bits.size(); ++j) {
+					byte |= (unsigned char) (bits[j] << (j - i));
+				}
+				data_.push_back((char) byte);
+			}
+		}
+
+		template <typename T>
+		void write_vector(const std::vector<T>& values, void (binary_writer::*write)(T)) {
+			write_unsigned(values.size());
+			for (typename std::vector<T>::const_iterator it = values.begin(); it != values.end(); ++it) {
+				(this->*write)(*it);
+			}
+		}
+
+		void write_argument(Argument* argument) {
+			const IfcUtil::ArgumentType type = argument->type();
+			data_.push_back((char) type);
+
+			switch (type) {
+			case IfcUtil::Argument_NULL:
+			case IfcUtil::Argument_DERIVED:
+			case IfcUtil::Argument_EMPTY_AGGREGATE:
+			case IfcUtil::Argument_AGGREGATE_OF_EMPTY_AGGREGATE:
+				break;
+			case IfcUtil::Argument_INT:
+				write_int(*argument);
+				break;
+			case IfcUtil::Argument_BOOL:
+				data_.push_back((bool) *argument ? 1 : 0);
+				break;
+			case IfcUtil::Argument_DOUBLE:
+				write_double(*argument);
+				break;
+			case IfcUtil::Argument_STRING:
+				write_string(*argument);
+				break;
+			case IfcUtil::Argument_BINARY:
+				write_bits(*argument);
+				break;
+			case IfcUtil::Argument_ENUMERATION: {
+				// The literal without the leading and trailing '.'
+				const std::string literal = argument->toString();
+				write_string(literal.substr(1, literal.size() - 2));
+				break; }
+			case IfcUtil::Argument_ENTITY_INSTANCE:
+				write_instance(*argument);
+				break;
+			case IfcUtil::Argument_AGGREGATE_OF_INT:
+				write_vector<int>(*argument, &binary_writer::write_int);
+				break;
+			case IfcUtil::Argument_AGGREGATE_OF_DOUBLE: {
+				const std::vector<double> values = *argument;
+				write_unsigned(values.size());
+				if (!values.empty()) {
+					data_.append((const char*) &values.front(), values.size() * sizeof(double));
+				}
+				break; }
+			case IfcUtil::Argument_AGGREGATE_OF_STRING:
+				write_vector<std::string>(*argument, &binary_writer::write_string);
+				break;
+			case IfcUtil::Argument_AGGREGATE_OF_BINARY: {
+				const std::vector< boost::dynamic_bitset<> > values = *argument;
+				write_unsigned(values.size());
+				for (std::vector< boost::dynamic_bitset<> >::const_iterator it = values.begin(); it != values.end(); ++it) {
+					write_bits(*it);
+				}
+				break; }
+			case IfcUtil::Argument_AGGREGATE_OF_ENTITY_INSTANCE: {
+				IfcEntityList::ptr instances = *argument;
+				write_instances(instances->begin(), instances->end());
+				break; }
+			case IfcUtil::Argument_AGGREGATE_OF_AGGREGATE_OF_INT: {
+				const std::vector< std::vector<int> > values = *argument;
+				write_unsigned(values.size());
+				for (std::vector< std::vector<int> >::const_iterator it = values.begin(); it != values.end(); ++it) {
+					write_vector<int>(*it, &binary_writer::write_int);
+				}
+				break; }
+			case IfcUtil::Argument_AGGREGATE_OF_AGGREGATE_OF_DOUBLE: {
+				const std::vector< std::vector<double> > values = *argument;
+				write_unsigned(values.size());
+				for (std::vector< std::vector<double> >::const_iterator it = values.begin(); it != values.end(); ++it) {
+					write_vector<double>(*it, &binary_writer::write_double);
+				}
+				break; }
+			case IfcUtil::Argument_AGGREGATE_OF_AGGREGATE_OF_ENTITY_INSTANCE: {
+				IfcEntityListList::ptr instances = *argument;
+				write_unsigned(instances->size());
+				for (IfcEntityListList::outer_it it = instances->begin(); it != instances->end(); ++it) {
+					write_instances(it->begin(), it->end());
+				}
+				break; }
+			default:
+				throw IfcException("Unknown attribute encountered: '" + argument->toString() + "'");
+			}
+		}
+	public:
+		binary_writer(std::string& data, binary_string_table& strings)
+			: data_(data), strings_(strings)
+		{}
+
+		void write_unsigned(boost::uint64_t v) {
+			while (v >= 0x80) {
+				data_.push_back((char) (v | 0x80));
+				v >>= 7;
+			}
+			data_.push_back((char) v);
+		}
+
+		void write_int(int v) {
+			// Zigzag encoded, so that small negative numbers are short as well
+			write_unsigned(v < 0 ? ((boost::uint64_t) ~(boost::int64_t) v << 1) | 1 : (boost::uint64_t) v << 1);
+		}
+
+		void write_double(double v) {
+			data_.append((const char*) &v, sizeof(double));
+		}
+
+		void write_string(std::string s) {
+			write_unsigned(strings_.index(s));
+		}
+
+		//
+		// Writes the attributes of an instance. An attribute that cannot be
+		// read, e.g. because it refers to an instance that does not exist, is
+		// written as null.
+		//
+		void write_attributes(const IfcEntityInstanceData& data) {
+			const unsigned int count = data.getArgumentCount();
+			write_unsigned(count);
+			for (unsigned int i = 0; i < count; ++i) {
+				const size_t size = data_.size();
+				try {
+					write_argument(data.getArgument(i));
+				} catch (const IfcException& e) {
+					Logger::Message(Logger::LOG_ERROR, e.what(), const_cast<IfcEntityInstanceData*>(&data));
+					data_.resize(size);
+					data_.push_back((char) IfcUtil::Argument_NULL);
+				}
+			}
+		}
+
+		void write_string_table() {
+			write_unsigned(strings_.strings().size());
+			for (std::vector<const std::string*>::const_iterator it = strings_.strings().begin(); it != strings_.strings().end(); ++it) {
+				write_unsigned((*it)->size());
+				data_.append(**it);
+			}
+		}
+	};
+
+	class binary_reader {
+	private:
+		const char* ptr_;
+		const char* end_;
+		std::vector<std::string> strings_;
+
+		void require(size_t n) const {
+			if ((size_t) (end_ - ptr_) < n) {
+				throw IfcException("Unexpected end of binary file");
+			}
+		}
+	public:
+		binary_reader(const char* begin, const char* end)
+			: ptr_(begin), end_(end)
+		{}
+
+		bool read_magic() {
+			require(sizeof(binary_magic));
+			ptr_ += sizeof(binary_magic);
+			return std::memcmp(ptr_ - sizeof(binary_magic), binary_magic, sizeof(binary_magic)) == 0;
+		}
+
+		unsigned char read_byte() {
+			require(1);
+			return (unsigned char) *ptr_++;
+		}
+
+		boost::uint64_t read_unsigned() {
+			boost::uint64_t v = 0;
+			for (unsigned shift = 0; shift < 64; shift += 7) {
+				const unsigned char c = read_byte();
+				v |= (boost::uint64_t) (c & 0x7f) << shift;
+				if (!(c & 0x80)) {
+					return v;
+				}
+			}
+			throw IfcException("Invalid integer in binary file");
+		}
+
+		/// Reads a number of elements, which is checked against the remaining
+		/// size of the file, so that a corrupt file does not result in an
+		/// excessive allocation
+		size_t read_count() {
+			const boost::uint64_t n = read_unsigned();
+			if (n > (boost::uint64_t) (end_ - ptr_)) {
+				throw IfcException("Invalid number of elements in binary file");
+			}
+			return (size_t) n;
+		}
+
+		int read_int() {
+			const boost::uint64_t v = read_unsigned();
+			return (int) ((v & 1) ? ~(boost::int64_t) (v >> 1) : (boost::int64_t) (v >> 1));
+		}
+
+		double read_double() {
+			require(sizeof(double));
+			double v;
+			std::memcpy(&v, ptr_, sizeof(double));
+			ptr_ += sizeof(double);
+			return v;
+		}
+
+		void read_doubles(std::vector<double>& values) {
+			const size_t n = read_count();
+			require(n * sizeof(double));
+			values.resize(n);
+			if (n) {
+				std::memcpy(&values.front(), ptr_, n * sizeof(double));
+			}
+			ptr_ += n * sizeof(double);
+		}
+
+		const std::string& read_string() {
+			const boost::uint64_t i = read_unsigned();
+			if (i >= strings_.size()) {
+				throw IfcException("Invalid string in binary file");
+			}
+			return strings_[(size_t) i];
+		}
+
+		std::vector<std::string> read_strings() {
+			std::vector<std::string> values(read_count());
+			for (std::vector<std::string>::iterator it = values.begin(); it != values.end(); ++it) {
+				*it = read_string();
+			}
+			return values;
+		}
+
+		boost::dynamic_bitset<> read_bits() {
+			const size_t n = read_count();
+			require((n + 7) / 8);
+			boost::dynamic_bitset<> bits(n);
+			for (size_t i = 0; i < n; ++i) {
+				bits[i] = ((unsigned char) ptr_[i / 8] >> (i % 8)) & 1;
+			}
+			ptr_ += (n + 7) / 8;
+			return bits;
+		}
+
+		void read_string_table() {
+			strings_.resize(read_count());
+			for (std::vector<std::string>::iterator it = strings_.begin(); it != strings_.end(); ++it) {
+				const size_t n = read_count();
+				it->assign(ptr_, n);
+				ptr_ += n;
+			}
+		}
+
+		bool at_end() const {
+			return ptr_ == end_;
+		}
+	};
+
+	//
+	// Creates the instances and their attributes from the binary file. The
+	// attributes are stored in IfcWriteArguments, which are owned by the arena
+	// of the file like the attributes that are set on instances read from a
+	// file. The references and GlobalIds are collected like when scanning the
+	// file, so that the indices of the file are built in the same way.
+	//
+	class binary_instance_reader {
+	private:
+		binary_reader& reader_;
+		IfcFile* file_;
+		IfcArena& arena_;
+		const std::vector<unsigned int>& ids_;
+		scan_result& result_;
+		unsigned int current_id_;
+		boost::unordered_map<std::pair<IfcSchema::Type::Enum, std::string>, std::pair<const char*, int> > enumerations_;
+
+		binary_instance_reader(const binary_instance_reader&); //N/A
+		binary_instance_reader& operator =(const binary_instance_reader&); //N/A
+
+		IfcUtil::IfcBaseClass* read_instance(unsigned int attribute) {
+			const unsigned int id = (unsigned int) reader_.read_unsigned();
+			if (id == 0) {
+				const boost::uint64_t type = reader_.read_unsigned();
+				if (type >= IfcSchema::Type::UNDEFINED) {
+					throw IfcException("Invalid type in binary file");
+				}
+				IfcEntityInstanceData* data = new (&arena_) IfcEntityInstanceData(&arena_, (IfcSchema::Type::Enum) type, file_, 0);
+				// References within inline instances are recorded without the
+				// attribute index, like when scanning a file
+				read_attributes(*data, (unsigned int) reference_row::unknown_attribute);
+				return IfcSchema::SchemaEntity(data, &arena_);
+			}
+
+			std::vector<unsigned int>::const_iterator it = std::lower_bound(ids_.begin(), ids_.end(), id);
+			if (it == ids_.end() || *it != id) {
+				throw IfcException("Instance #" + boost::lexical_cast<std::string>(id) + " not found");
+			}
+
+			scanned_reference reference;
+			reference.referenced = id;
+			reference.referencing = current_id_;
+			reference.attribute = (unsigned char) (std::min)(attribute, (unsigned int) reference_row::unknown_attribute);
+			result_.references.push_back(reference);
+
+			return result_.instances[it - ids_.begin()];
+		}
+
+		IfcEntityList::ptr read_instances(unsigned int attribute) {
+			IfcEntityList::ptr instances(new IfcEntityList);
+			const size_t n = reader_.read_count();
+			instances->reserve((unsigned) n);
+			for (size_t i = 0; i < n; ++i) {
+				instances->push(read_instance(attribute));
+			}
+			return instances;
+		}
+
+		void read_argument(IfcWrite::IfcWriteArgument* argument, IfcUtil::ArgumentType type, IfcSchema::Type::Enum entity_type, unsigned int index, unsigned int attribute) {
+			switch (type) {
+			case IfcUtil::Argument_NULL:
+				argument->set(boost::blank());
+				break;
+			case IfcUtil::Argument_DERIVED:
+				argument->set(IfcWrite::IfcWriteArgument::Derived());
+				break;
+			case IfcUtil::Argument_INT:
+				argument->set(reader_.read_int());
+				break;
+			case IfcUtil::Argument_BOOL:
+				argument->set(reader_.read_byte() != 0);
+				break;
+			case IfcUtil::Argument_DOUBLE:
+				argument->set(reader_.read_double());
+				break;
+			case IfcUtil::Argument_STRING:
+				argument->set(reader_.read_string());
+				break;
+			case IfcUtil::Argument_BINARY:
+				argument->set(reader_.read_bits());
+				break;
+			case IfcUtil::Argument_ENUMERATION: {
+				const std::string& literal = reader_.read_string();
+				const IfcSchema::Type::Enum enumeration = IfcSchema::Type::GetAttributeEntity(entity_type, (unsigned char) index);
+				std::pair<const char*, int>& value = enumerations_[std::make_pair(enumeration, literal)];
+				if (!value.first) {
+					value = IfcSchema::Type::GetEnumerationIndex(enumeration, literal);
+				}
+				argument->set(IfcWrite::IfcWriteArgument::EnumerationReference(value.second, value.first));
+				break; }
+			case IfcUtil::Argument_ENTITY_INSTANCE:
+				argument->set(read_instance(attribute));
+				break;
+			case IfcUtil::Argument_EMPTY_AGGREGATE:
+			case IfcUtil::Argument_AGGREGATE_OF_EMPTY_AGGREGATE: {
+				// Stored as an empty aggregate of the type of the attribute, like
+				// IfcEntityInstanceData::setArgument() does. The aggregates of
+				// the header entities are lists of strings.
+				const IfcUtil::ArgumentType attribute_type = entity_type == IfcSchema::Type::UNDEFINED
+					? IfcUtil::Argument_AGGREGATE_OF_STRING
+					: IfcSchema::Type::GetAttributeType(entity_type, (unsigned char) index);
+				switch (attribute_type) {
+				case IfcUtil::Argument_AGGREGATE_OF_INT: argument->set(std::vector<int>()); break;
+				case IfcUtil::Argument_AGGREGATE_OF_DOUBLE: argument->set(std::vector<double>()); break;
+				case IfcUtil::Argument_AGGREGATE_OF_STRING: argument->set(std::vector<std::string>()); break;
+				case IfcUtil::Argument_AGGREGATE_OF_BINARY: argument->set(std::vector< boost::dynamic_bitset<> >()); break;
+				case IfcUtil::Argument_AGGREGATE_OF_ENTITY_INSTANCE: argument->set(IfcEntityList::ptr(new IfcEntityList)); break;
+				case IfcUtil::Argument_AGGREGATE_OF_AGGREGATE_OF_INT: argument->set(std::vector< std::vector<int> >()); break;
+				case IfcUtil::Argument_AGGREGATE_OF_AGGREGATE_OF_DOUBLE: argument->set(std::vector< std::vector<double> >()); break;
+				case IfcUtil::Argument_AGGREGATE_OF_AGGREGATE_OF_ENTITY_INSTANCE: argument->set(IfcEntityListList::ptr(new IfcEntityListList)); break;
+				default:
+					if (type == IfcUtil::Argument_EMPTY_AGGREGATE) {
+						argument->set(IfcWrite::IfcWriteArgument::empty_aggregate_t());
+					} else {
+						argument->set(IfcWrite::IfcWriteArgument::empty_aggregate_of_aggregate_t());
+					}
+				}
+				break; }
+			case IfcUtil::Argument_AGGREGATE_OF_INT: {
+				std::vector<int> values(reader_.read_count());
+				for (std::vector<int>::iterator it = values.begin(); it != values.end(); ++it) {
+					*it = reader_.read_int();
+				}
+				argument->set(values);
+				break; }
+			case IfcUtil::Argument_AGGREGATE_OF_DOUBLE: {
+				std::vector<double> values;
+				reader_.read_doubles(values);
+				argument->set(values);
+				break; }
+			case IfcUtil::Argument_AGGREGATE_OF_STRING:
+				argument->set(reader_.read_strings());
+				break;
+			case IfcUtil::Argument_AGGREGATE_OF_BINARY: {
+				std::vector< boost::dynamic_bitset<> > values(reader_.read_count());
+				for (std::vector< boost::dynamic_bitset<> >::iterator it = values.begin(); it != values.end(); ++it) {
+					*it = reader_.read_bits();
+				}
+				argument->set(values);
+				break; }
+			case IfcUtil::Argument_AGGREGATE_OF_ENTITY_INSTANCE:
+				argument->set(read_instances(attribute));
+				break;
+			case IfcUtil::Argument_AGGREGATE_OF_AGGREGATE_OF_INT: {
+				std::vector< std::vector<int> > values(reader_.read_count());
+				for (std::vector< std::vector<int> >::iterator it = values.begin(); it != values.end(); ++it) {
+					it->resize(reader_.read_count());
+					for (std::vector<int>::iterator jt = it->begin(); jt != it->end(); ++jt) {
+						*jt = reader_.read_int();
+					}
+				}
+				argument->set(values);
+				break; }
+			case IfcUtil::Argument_AGGREGATE_OF_AGGREGATE_OF_DOUBLE: {
+				std::vector< std::vector<double> > values(reader_.read_count());
+				for (std::vector< std::vector<double> >::iterator it = values.begin(); it != values.end(); ++it) {
+					it->resize(reader_.read_count());
+					for (std::vector<double>::iterator jt = it->begin(); jt != it->end(); ++jt) {
+						*jt = reader_.read_double();
+					}
+				}
+				argument->set(values);
+				break; }
+			case IfcUtil::Argument_AGGREGATE_OF_AGGREGATE_OF_ENTITY_INSTANCE: {
+				IfcEntityListList::ptr values(new IfcEntityListList);
+				const size_t n = reader_.read_count();
+				for (size_t i = 0; i < n; ++i) {
+					values->push(read_instances(attribute));
+				}
+				argument->set(values);
+				break; }
+			default:
+				throw IfcException("Invalid attribute in binary file");
+			}
+		}
+	public:
+		binary_instance_reader(binary_reader& reader, IfcFile* file, IfcArena& arena, const std::vector<unsigned int>& ids, scan_result& result)
+			: reader_(reader), file_(file), arena_(arena), ids_(ids), result_(result), current_id_(0)
+		{}
+
+		//
+		// Reads the attributes of an instance. The attribute index recorded for
+		// the references is the index of the attribute, unless specified.
+		//
+		void read_attributes(IfcEntityInstanceData& data, boost::optional<unsigned int> attribute = boost::none) {
+			if (data.id()) {
+				current_id_ = data.id();
+			}
+			const size_t count = reader_.read_count();
+			data.attributes().reserve(count);
+			for (size_t i = 0; i < count; ++i) {
+				IfcWrite::IfcWriteArgument* argument = new IfcWrite::IfcWriteArgument;
+				arena_.own(argument);
+				read_argument(argument, (IfcUtil::ArgumentType) reader_.read_byte(), data.type(), (unsigned int) i, attribute.get_value_or((unsigned int) i));
+				data.attributes().push_back(argument);
+			}
+		}
+
+		/// Reads the attributes of a header entity
+		void read_header_attributes(IfcEntityInstanceData& data) {
+			const size_t count = reader_.read_count();
+			for (size_t i = 0; i < count; ++i) {
+				IfcWrite::IfcWriteArgument argument;
+				read_argument(&argument, (IfcUtil::ArgumentType) reader_.read_byte(), IfcSchema::Type::UNDEFINED, (unsigned int) i, (unsigned int) reference_row::unknown_attribute);
+				data.setArgument((unsigned int) i, &argument);
+			}
+		}
+	};
+
+	void copy_header_attributes(const IfcParse::HeaderEntity& from, IfcParse::HeaderEntity& to) {
+		for (unsigned int i = 0; i < from.getArgumentCount(); ++i) {
+			to.setArgument(i, from.getArgument(i));
+		}
+	}
+}
+
+//
+// The instances are written to buffers first, so that the table of strings,
+// which is filled while writing the attributes, can be written before them.
+//
+void IfcFile::writeBinary(std::ostream& os) const {
+	typedef std::vector<std::pair<unsigned int, IfcUtil::IfcBaseClass*> > vector_t;
+	vector_t sorted;
+	sorted.reserve(byid.size());
+	for (entity_by_id_t::const_iterator it = byid.begin(); it != byid.end(); ++it) {
+		if (!IfcSchema::Type::IsSimple(it->second->type())) {
+			sorted.push_back(*it);
+		}
+	}
+	std::sort(sorted.begin(), sorted.end());
+
+	binary_string_table strings;
+	std::string header, instances, attributes;
+	binary_writer header_writer(header, strings), instance_writer(instances, strings), attribute_writer(attributes, strings);
+
+	const IfcEntityInstanceData* header_entities[] = { &_header.file_description(), &_header.file_name(), &_header.file_schema() };
+	for (size_t i = 0; i < sizeof(header_entities) / sizeof(header_entities[0]); ++i) {
+		header_writer.write_attributes(*header_entities[i]);
+	}
+
+	instance_writer.write_unsigned(sorted.size());
+	unsigned int previous_id = 0;
+	for (vector_t::const_iterator it = sorted.begin(); it != sorted.end(); ++it) {
+		instance_writer.write_unsigned(it->second->type());
+		instance_writer.write_unsigned(it->first - previous_id);
+		previous_id = it->first;
+		attribute_writer.write_attributes(*it->second->entity);
+	}
+
+	std::string preamble;
+	binary_writer preamble_writer(preamble, strings);
+	preamble_writer.write_unsigned(binary_version);
+	preamble_writer.write_unsigned(std::strlen(IfcSchema::Identifier));
+	preamble.append(IfcSchema::Identifier);
+	preamble_writer.write_string_table();
+
+	os.write(binary_magic, sizeof(binary_magic));
+	os << preamble << header << instances << attributes;
+	os.write(binary_magic, sizeof(binary_magic));
+}
+
+//
+// All instances are created before their attributes are read, so that the
+// attributes can refer to instances that are read later on. The indices of
+// the file are only populated after the file is read successfully.
+//
+bool IfcFile::InitBinary(std::istream& f) {
+	std::vector<char> data;
+	f.seekg(0, std::ios_base::end);
+	const std::streamoff size = f.tellg();
+	f.seekg(0, std::ios_base::beg);
+	if (size > 0) {
+		data.resize((size_t) size);
+		f.read(&data.front(), size);
+	} else {
+		f.clear();
+		data.assign(std::istreambuf_iterator<char>(f), std::istreambuf_iterator<char>());
+	}
+	if (!f && !f.eof()) {
+		Logger::Message(Logger::LOG_ERROR, "Failed to read binary file");
+		return false;
+	}
+
+	std::vector<scan_result> results(1);
+	scan_result& result = results.front();
+	IfcSpfHeader header;
+
+	try {
+		if (data.empty()) {
+			throw IfcException("Empty binary file");
+		}
+		binary_reader reader(&data.front(), &data.front() + data.size());
+		if (!reader.read_magic() || reader.read_unsigned() != binary_version) {
+			throw IfcException("Not a binary file of this version");
+		}
+
+		const size_t schema_length = reader.read_count();
+		std::string schema;
+		for (size_t i = 0; i < schema_length; ++i) {
+			schema.push_back((char) reader.read_byte());
+		}
+		if (schema != IfcSchema::Identifier) {
+			throw IfcException("File schema encountered (" + schema + ") different from expected " + std::string(IfcSchema::Identifier) + ".");
+		}
+
+		reader.read_string_table();
+
+		std::vector<unsigned int> ids;
+		binary_instance_reader instance_reader(reader, this, arena_, ids, result);
+
+		// The header is only replaced once the file has been read entirely
+		instance_reader.read_header_attributes(header.file_description());
+		instance_reader.read_header_attributes(header.file_name());
+		instance_reader.read_header_attributes(header.file_schema());
+
+		const size_t num_instances = reader.read_count();
+		ids.reserve(num_instances);
+		result.instances.reserve(num_instances);
+		unsigned int id = 0;
+		for (size_t i = 0; i < num_instances; ++i) {
+			const boost::uint64_t type = reader.read_unsigned();
+			const boost::uint64_t increment = reader.read_unsigned();
+			if (type >= IfcSchema::Type::UNDEFINED || increment == 0 || id + increment > 0xffffffffULL) {
+				throw IfcException("Invalid instance in binary file");
+			}
+			id += (unsigned int) increment;
+			IfcEntityInstanceData* data = new (&arena_) IfcEntityInstanceData(&arena_, (IfcSchema::Type::Enum) type, this, id);
+			ids.push_back(id);
+			result.instances.push_back(IfcSchema::SchemaEntity(data, &arena_));
+		}
+
+		for (std::vector<IfcUtil::IfcBaseClass*>::const_iterator it = result.instances.begin(); it != result.instances.end(); ++it) {
+			instance_reader.read_attributes(*(*it)->entity);
+			if ((*it)->is(IfcSchema::Type::IfcRoot)) {
+				boost::optional<std::string> guid;
+				Argument* global_id = (*it)->entity->attributes().empty() ? 0 : (*it)->entity->attributes().front();
+				if (global_id && global_id->type() == IfcUtil::Argument_STRING) {
+					guid = (std::string) *global_id;
+				}
+				result.guids.push_back(std::make_pair((IfcSchema::IfcRoot*) *it, guid));
+			}
+		}
+
+		if (!reader.read_magic() || !reader.at_end()) {
+			throw IfcException("Invalid end of binary file");
+		}
+	} catch (const IfcException& e) {
+		Logger::Message(Logger::LOG_ERROR, e.what());
+		return false;
+	}
+
+	copy_header_attributes(header.file_description(), _header.file_description());
+	copy_header_attributes(header.file_name(), _header.file_name());
+	copy_header_attributes(header.file_schema(), _header.file_schema());
+
+	byid.reserve(byid.size() + result.instances.size());
+	byguid.reserve(byguid.size() + result.guids.size());
+	merge(result);
+	build_reference_index(results);
+
+	if (!eager_supertype_index_) {
+		create_supertype_lists();
+	}
+
+	parsing_complete_ = true;
+	index_guids(result);
+
+	return true;
+}
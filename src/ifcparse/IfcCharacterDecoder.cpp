@@ -97,10 +97,11 @@ void IfcCharacterDecoder::addChar(std::stringstream& s,const UChar32& ch) {
 IfcCharacterDecoder::IfcCharacterDecoder(IfcParse::IfcSpfStream* f) {
   file = f;
 #ifdef HAVE_ICU
-  if (destination) ucnv_close(destination);
-  if (compatibility_converter) ucnv_close(compatibility_converter);
   destination = 0;
+  converter = 0;
   compatibility_converter = 0;
+  previous_codepage = -1;
+  status = U_ZERO_ERROR;
 
   if (mode == DEFAULT) {
     destination = ucnv_open(0, &status);
@@ -120,10 +121,6 @@ IfcCharacterDecoder::~IfcCharacterDecoder() {
   if ( destination ) ucnv_close(destination);
   if ( converter ) ucnv_close(converter);
   if ( compatibility_converter ) ucnv_close(compatibility_converter);
-  destination = 0;
-  converter = 0;
-  compatibility_converter = 0;
-  ucnv_flushCache();
 #endif
 }
 IfcCharacterDecoder::operator std::string() {
@@ -144,6 +141,7 @@ IfcCharacterDecoder::operator std::string() {
 				if ( converter ) ucnv_close(converter);
 				char encoder[11] = {'i','s','o','-','8','8','5','9','-', static_cast<char>(codepage + 0x30) };
 				converter = ucnv_open(encoder, &status);
+				previous_codepage = codepage;
 			}
 			const char characters[2] = { static_cast<char>(current_char + 0x80) };
 			const char* char_array = &characters[0];
@@ -240,7 +238,13 @@ void IfcCharacterDecoder::dryRun() {
 	unsigned int parse_state = 0;
 	char current_char;
 	unsigned int hex_count = 0;
-	while ((current_char = file->Peek()) != 0) {
+	for (;;) {
+		// Outside of escape sequences only apostrophes and backslashes
+		// need to be inspected, the characters in between are skipped.
+		if ( ! parse_state ) {
+			file->SkipTo("'\\");
+		}
+		if ( file->eof || (current_char = file->Peek()) == 0 ) break;
 		if ( EXPECTS_CHARACTER(parse_state) ) {
 			parse_state = 0;
 		} else if ( current_char == '\'' && ! parse_state ) {
@@ -298,14 +302,6 @@ void IfcCharacterDecoder::dryRun() {
 		file->Inc();
 	}
 }
-#ifdef HAVE_ICU
-UConverter* IfcCharacterDecoder::destination = 0;
-UConverter* IfcCharacterDecoder::converter = 0;
-UConverter* IfcCharacterDecoder::compatibility_converter = 0;
-int IfcCharacterDecoder::previous_codepage = -1;
-UErrorCode IfcCharacterDecoder::status = U_ZERO_ERROR;
-#endif
-
 #ifdef HAVE_ICU
 IfcCharacterDecoder::ConversionMode IfcCharacterDecoder::mode = IfcCharacterDecoder::UTF8;
 
@@ -320,7 +316,8 @@ char IfcCharacterDecoder::substitution_character = '_';
 
 IfcCharacterEncoder::IfcCharacterEncoder(const std::string& input) {
 #ifdef HAVE_ICU
-	if ( !converter) converter = ucnv_open("utf-8", &status);
+	status = U_ZERO_ERROR;
+	converter = ucnv_open("utf-8", &status);
 #endif
 	str = input;
 }
@@ -328,7 +325,6 @@ IfcCharacterEncoder::IfcCharacterEncoder(const std::string& input) {
 IfcCharacterEncoder::~IfcCharacterEncoder() {
 #ifdef HAVE_ICU
 	if ( converter) ucnv_close(converter);
-	converter = 0;
 #endif
 }
 
@@ -386,8 +382,3 @@ IfcCharacterEncoder::operator std::string() {
 	return oss.str();
 }
 
-
-#ifdef HAVE_ICU
-UErrorCode IfcCharacterEncoder::status = U_ZERO_ERROR;
-UConverter* IfcCharacterEncoder::converter = 0;
-#endif
@@ -44,11 +44,13 @@ namespace IfcParse {
 	private:
 		IfcParse::IfcSpfStream* file;
 #ifdef HAVE_ICU
-		static UConverter* destination;
-		static UConverter* converter;
-		static UConverter* compatibility_converter;
-		static int previous_codepage;
-		static UErrorCode status;
+		// The converters are not shared between decoders, so that
+		// decoders can be used concurrently on separate threads.
+		UConverter* destination;
+		UConverter* converter;
+		UConverter* compatibility_converter;
+		int previous_codepage;
+		UErrorCode status;
 #endif
 		void addChar(std::stringstream& s,const UChar32& ch);
 	public:
@@ -79,8 +81,8 @@ namespace IfcWrite {
 	private:
 		std::string str;
 #ifdef HAVE_ICU
-		static UErrorCode status;
-		static UConverter* converter;
+		UErrorCode status;
+		UConverter* converter;
 #endif
 	public:
 		IfcCharacterEncoder(const std::string& input);
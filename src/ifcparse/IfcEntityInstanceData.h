@@ -21,7 +21,9 @@
 #define IFCENTITYINSTANCEDATA_H
 
 #include "../ifcparse/ArgumentType.h"
+#include "../ifcparse/IfcArena.h"
 
+#include <boost/atomic.hpp>
 #include <boost/shared_ptr.hpp>
 
 #include <vector>
@@ -30,6 +32,11 @@ class Argument;
 class IfcEntityList;
 namespace IfcParse {
 	class IfcFile;
+
+	/// The arguments of an entity instance or aggregate. For instances read
+	/// from a file, both the arguments and the vector storage are allocated
+	/// from the arena of the file.
+	typedef std::vector<Argument*, arena_allocator<Argument*> > argument_vector;
 }
 
 class IFC_PARSE_API IfcEntityInstanceData {
@@ -39,26 +46,42 @@ public:
 protected:
 	unsigned id_;
 	IfcSchema::Type::Enum type_;
-	mutable std::vector<Argument*> attributes_;
+	mutable IfcParse::argument_vector attributes_;
+
+	enum load_state { NOT_LOADED, LOADING, LOADED };
 
 	// To reduce memory footprint, these two could potentially be combined,
-	// e.g. initialized_ <-> offset_in_file_ == 0, but it would imply that
+	// e.g. load_state_ <-> offset_in_file_ == 0, but it would imply that
 	// instances cannot be located at the beginning of the file. Officially
 	// there should be a header anyways.
-	mutable bool initialized_;
-	unsigned offset_in_file_;
+	// The state is atomic, so that an instance that is accessed from multiple
+	// threads is read from file exactly once.
+	mutable boost::atomic<unsigned char> load_state_;
+	size_t offset_in_file_;
 
 public:
-	IfcEntityInstanceData(IfcSchema::Type::Enum type, IfcParse::IfcFile* file_, unsigned id = 0, unsigned offset_in_file = 0)
-		: file(file_), id_(id), type_(type), initialized_(false), offset_in_file_(offset_in_file)
+	/// Returns whether the attributes have been read from file
+	bool loaded() const {
+		return load_state_.load(boost::memory_order_acquire) == LOADED;
+	}
+
+	IfcEntityInstanceData(IfcSchema::Type::Enum type, IfcParse::IfcFile* file_, unsigned id = 0, size_t offset_in_file = 0, IfcParse::IfcArena* arena = 0)
+		: file(file_), id_(id), type_(type), attributes_(IfcParse::arena_allocator<Argument*>(arena)), load_state_(NOT_LOADED), offset_in_file_(offset_in_file)
 	{}
 
 	IfcEntityInstanceData(IfcSchema::Type::Enum type)
-		: file(0), id_(0), type_(type), initialized_(true)
+		: file(0), id_(0), type_(type), load_state_(LOADED)
+	{}
+
+	/// Creates the instance data of an instance in a file of which the
+	/// attributes are not read from the file, but are to be added directly
+	/// to attributes(), e.g. when the file is read from its binary form.
+	IfcEntityInstanceData(IfcParse::IfcArena* arena, IfcSchema::Type::Enum type, IfcParse::IfcFile* file_, unsigned id)
+		: file(file_), id_(id), type_(type), attributes_(IfcParse::arena_allocator<Argument*>(arena)), load_state_(LOADED), offset_in_file_(0)
 	{}
 
 	/*
-	IfcEntityInstanceData(IfcParse::IfcFile* file = 0, unsigned id = 0, IfcSchema::Type::Enum type = IfcSchema::Type::UNDEFINED, unsigned offset_in_file = 0, size_t n)
+	IfcEntityInstanceData(IfcParse::IfcFile* file = 0, unsigned id = 0, IfcSchema::Type::Enum type = IfcSchema::Type::UNDEFINED, size_t offset_in_file = 0, size_t n)
 	: file_(file), id_(0), type_(type), initialized_(false)
 	{
 	attributes_.reserve(n);
@@ -69,8 +92,22 @@ public:
 	{}
 	*/
 
+	/// Reads the attributes from file, unless already loaded. When called
+	/// concurrently, one thread reads the attributes and the others wait.
 	void load() const;
 
+	static void* operator new(size_t size) { return ::operator new(size); }
+	static void operator delete(void* p) { ::operator delete(p); }
+	/// Allocates the instance data from the arena, which is not to be null. Instance
+	/// data allocated from an arena is released along with the arena and should
+	/// not be deleted.
+	static void* operator new(size_t size, IfcParse::IfcArena* arena) { return arena->allocate(size); }
+	/// Only called when the constructor throws, the memory is released along with the arena
+	static void operator delete(void*, IfcParse::IfcArena*) {}
+
+	/// Returns the arena the attributes are allocated from, if any.
+	IfcParse::IfcArena* arena() const { return attributes_.get_allocator().arena; }
+
 	IfcEntityInstanceData(const IfcEntityInstanceData& e);
 
 	~IfcEntityInstanceData();
@@ -83,7 +120,7 @@ public:
 	void setArgument(unsigned int i, Argument* a, IfcUtil::ArgumentType attr_type = IfcUtil::Argument_UNKNOWN);
 
 	unsigned int getArgumentCount() const {
-		if (!initialized_) {
+		if (!loaded()) {
 			load();
 		}
 		return (unsigned int)attributes_.size();
@@ -96,10 +133,13 @@ public:
 	std::string toString(bool upper = false) const;
 
 	unsigned int id() const { return id_; }
-	unsigned int offset_in_file() const { return offset_in_file_; }
+	size_t offset_in_file() const { return offset_in_file_; }
+	/// Relocates the instance, when the file it is read from is replaced by
+	/// another version in which the instance is located elsewhere
+	void offset_in_file(size_t offset) { offset_in_file_ = offset; }
 
 	// NB: const ommitted for lazy loading
-	std::vector<Argument*>& attributes() const { return attributes_; }
+	IfcParse::argument_vector& attributes() const { return attributes_; }
 
 	unsigned set_id(boost::optional<unsigned> i = boost::none);
 };
@@ -50,6 +50,8 @@ public:
 		return r;
 	}
 	void remove(IfcUtil::IfcBaseClass*);
+	/// Removes all of the instances in a single pass over the list
+	void remove(const std::set<IfcUtil::IfcBaseClass*>& instances);
 	IfcEntityList::ptr filtered(const std::set<IfcSchema::Type::Enum>& entities);
 	IfcEntityList::ptr unique();
 };
@@ -57,7 +57,7 @@ namespace IfcParse {
 	class IFC_PARSE_API IfcInvalidTokenException : public IfcException {
 	public:
 		IfcInvalidTokenException(
-			int token_start,
+			size_t token_start,
 			const std::string& token_string,
 			const std::string& expected_type
 		)
@@ -68,7 +68,7 @@ namespace IfcParse {
 			)
 		{}
 		IfcInvalidTokenException(
-			int token_start,
+			size_t token_start,
 			char c
 		)
 			: IfcException(
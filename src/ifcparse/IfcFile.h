@@ -22,7 +22,10 @@
 
 #include <map>
 #include <set>
+#include <boost/cstdint.hpp>
+#include <boost/functional/hash.hpp>
 #include <boost/unordered_map.hpp>
+#include <boost/thread/mutex.hpp>
 
 #include "ifc_parse_api.h"
 
@@ -31,68 +34,247 @@
 
 namespace IfcParse {
 
+/// The instances referencing an instance, along with the index of the
+/// attribute of the referencing instance through which it refers to it.
+struct reference_row {
+	/// Recorded for references of which the attribute is not known, e.g.
+	/// references from within inline entity instances
+	static const unsigned char unknown_attribute = 0xff;
+
+	std::vector<unsigned int> instances;
+	std::vector<unsigned char> attributes;
+
+	bool empty() const { return instances.empty(); }
+	size_t size() const { return instances.size(); }
+
+	void clear() {
+		instances.clear();
+		attributes.clear();
+	}
+
+	void push_back(unsigned int instance, unsigned int attribute) {
+		instances.push_back(instance);
+		attributes.push_back(attribute < unknown_attribute ? (unsigned char) attribute : unknown_attribute);
+	}
+
+	/// Removes a single reference by the instance, preferably one through
+	/// the attribute. Returns false if the instance is not found.
+	bool erase(unsigned int instance, unsigned int attribute);
+
+	/// Removes all references by the instance
+	void erase_all(unsigned int instance);
+
+	/// Removes all references by any of the instances, in a single pass
+	void erase_all(const std::set<unsigned int>& instances);
+};
+
+/// A reference encountered while scanning
+struct scanned_reference {
+	unsigned int referenced;
+	unsigned int referencing;
+	unsigned char attribute;
+};
+
+/// The entity instances and references encountered while scanning
+/// a part of the file, in the order in which they were read.
+struct scan_result {
+	std::vector<IfcUtil::IfcBaseClass*> instances;
+	std::vector<scanned_reference> references;
+	std::vector< std::pair<Logger::Severity, std::string> > messages;
+	/// The IfcRoot instances along with their GlobalId when it could be read
+	/// directly from the first attribute token without loading the instance
+	std::vector< std::pair<IfcSchema::IfcRoot*, boost::optional<std::string> > > guids;
+};
+
+/// The names of the entity instances that differ between two versions
+/// of a file, as determined by IfcFile::update()
+struct change_set {
+	std::vector<unsigned int> added;
+	std::vector<unsigned int> modified;
+	std::vector<unsigned int> removed;
+};
+
+class IfcSpfStreamReader;
+
 /// This class provides several static convenience functions and variables
 /// and provide access to the entities in an IFC file
+///
+/// Once a file is read, multiple threads can concurrently look up instances
+/// by name, type, GlobalId and reference and read their attributes. Each
+/// thread reads from file using its own lexer. Modifying the file while it is
+/// being read from other threads is not supported.
 class IFC_PARSE_API IfcFile {
 public:
-	typedef std::map<IfcSchema::Type::Enum, IfcEntityList::ptr> entities_by_type_t;
+	/// Indexed by IfcSchema::Type::Enum, types without instances hold a null list
+	typedef std::vector<IfcEntityList::ptr> entities_by_type_t;
 	typedef boost::unordered_map<unsigned int, IfcUtil::IfcBaseClass*> entity_by_id_t;
-	typedef std::map<std::string, IfcSchema::IfcRoot*> entity_by_guid_t;
-	typedef std::map<unsigned int, std::vector<unsigned int> > entities_by_ref_t;
-	typedef std::map<unsigned int, IfcEntityList::ptr> ref_map_t;
+	typedef std::map<unsigned int, reference_row> entities_by_ref_t;
+	typedef boost::unordered_map<unsigned int, IfcEntityList::ptr> ref_map_t;
 	typedef entity_by_id_t::const_iterator const_iterator;
 
-	class type_iterator : private entities_by_type_t::const_iterator {
+	/// Iterates over the types for which the file contains instances
+	class type_iterator {
+	private:
+		const entities_by_type_t* types_;
+		entities_by_type_t::size_type index_;
+		IfcSchema::Type::Enum value_;
+
+		void skip_empty() {
+			while (index_ < types_->size() && !(*types_)[index_]) {
+				++index_;
+			}
+			value_ = (IfcSchema::Type::Enum) index_;
+		}
 	public:
-		type_iterator() : entities_by_type_t::const_iterator() {};
+		type_iterator() : types_(0), index_(0), value_(IfcSchema::Type::UNDEFINED) {};
 
-		type_iterator(const entities_by_type_t::const_iterator& it)
-			: entities_by_type_t::const_iterator(it)
-		{};
+		type_iterator(const entities_by_type_t& types, entities_by_type_t::size_type index)
+			: types_(&types)
+			, index_(index)
+		{
+			skip_empty();
+		};
 
-		entities_by_type_t::key_type const * operator->() const {
-			return &entities_by_type_t::const_iterator::operator->()->first;
+		IfcSchema::Type::Enum const * operator->() const {
+			return &value_;
 		}
 
-		entities_by_type_t::key_type const & operator*() const {
-			return entities_by_type_t::const_iterator::operator*().first;
+		IfcSchema::Type::Enum const & operator*() const {
+			return value_;
 		}
 
 		type_iterator& operator++() { 
-			entities_by_type_t::const_iterator::operator++(); return *this; 
+			++index_; skip_empty(); return *this; 
+		}
+
+		bool operator==(const type_iterator& other) const {
+			return index_ == other.index_;
 		}
 
 		bool operator!=(const type_iterator& other) const {
-			const entities_by_type_t::const_iterator& self_ = *this;
-			const entities_by_type_t::const_iterator& other_ = other;
-			return self_ != other_;
+			return index_ != other.index_;
 		}
 	};
 
+	/// A GlobalId packed into 128 bits, the 22 characters of the
+	/// base64 encoding each contribute 6 bits, except for the first
+	/// which contributes 2.
+	struct packed_guid {
+		boost::uint64_t high, low;
+
+		bool operator==(const packed_guid& other) const {
+			return high == other.high && low == other.low;
+		}
+
+		friend std::size_t hash_value(const packed_guid& g) {
+			std::size_t seed = 0;
+			boost::hash_combine(seed, g.high);
+			boost::hash_combine(seed, g.low);
+			return seed;
+		}
+	};
+
+	typedef boost::unordered_map<packed_guid, IfcSchema::IfcRoot*> entity_by_guid_t;
+	/// For GlobalIds that do not conform to the base64 encoding
+	typedef std::map<std::string, IfcSchema::IfcRoot*> entity_by_unpacked_guid_t;
+
 private:
 	typedef std::map<IfcUtil::IfcBaseClass*, IfcUtil::IfcBaseClass*> entity_entity_map_t;
 
+	friend class IfcSpfStreamReader;
+
 	bool parsing_complete_;
 
+	/// The entity instances read from the file, along with their attributes,
+	/// are allocated from the arena and released at once when the file is
+	/// destroyed.
+	IfcArena arena_;
+
 	entity_by_id_t byid;
 	entities_by_type_t bytype;
 	entities_by_type_t bytype_excl;
-	entities_by_ref_t byref;
+
+	/// Whether the lists including subtypes are built while parsing
+	bool eager_supertype_index_;
+	/// Whether the list in bytype is populated. Otherwise the list is empty,
+	/// but the type or one of its subtypes has instances, which are added to
+	/// the list on the first request.
+	std::vector<bool> bytype_complete;
+
+	/// The instances referencing an instance, in compressed sparse row form:
+	/// the names of the instances referencing instance byref_ids[i] are stored
+	/// in byref_values[byref_offsets[i]] up to byref_values[byref_offsets[i+1]],
+	/// the attribute indices through which they refer to it at the same
+	/// positions in byref_attributes. This table is built once after scanning
+	/// the file, rows that are modified afterwards are copied to byref_modified,
+	/// which takes precedence.
+	std::vector<unsigned int> byref_ids;
+	std::vector<unsigned int> byref_offsets;
+	std::vector<unsigned int> byref_values;
+	std::vector<unsigned char> byref_attributes;
+	entities_by_ref_t byref_modified;
+
 	ref_map_t by_ref_cached_;
+	/// Guards the lists that are assembled on demand, i.e. by_ref_cached_ and
+	/// the incomplete lists in bytype
+	boost::mutex index_mutex_;
 	entity_by_guid_t byguid;
+	entity_by_unpacked_guid_t byguid_unpacked;
 	entity_entity_map_t entity_file_map;
 
 	unsigned int MaxId;
 
 	IfcSpfHeader _header;
 
+	/// Previous versions of the file, retained after update() for as long as
+	/// the file exists because instances loaded from them still read from them
+	std::vector< std::pair<IfcParse::IfcSpfLexer*, IfcParse::IfcSpfStream*> > previous_versions_;
+
 	void setDefaultHeaderValues();
 
+	/// Reads the header and returns whether the file schema is supported
+	bool read_header();
+	/// Adds the instances with a GlobalId from a scan to the GlobalId map
+	void index_guids(const IfcParse::scan_result& result);
+	/// Creates empty lists for the supertypes of the types that have instances,
+	/// which are populated when requested, see eager_supertype_index_
+	void create_supertype_lists();
+	/// Reads the index written by writeIndex(), returns false when it does not
+	/// exist or does not match the file, in which case the file is unchanged
+	bool read_index(const std::string& index_fn);
+	/// Scans the data section of the file and builds the indices from it
+	void scan_file(unsigned num_threads);
+
+	void scan(IfcParse::IfcSpfLexer* lexer, bool report_progress, IfcParse::scan_result& result, IfcParse::IfcArena& arena);
+	/// Scans the range [begin, end) of the stream into a new arena. Both the
+	/// arena and the lexer are created on the calling thread.
+	void scan_part(size_t begin, size_t end, IfcParse::scan_result& result, IfcParse::IfcArena*& arena);
+	void merge(const IfcParse::scan_result& result);
+	void build_reference_index(const std::vector<IfcParse::scan_result>& results);
+
+	/// Returns the names of the instances referencing the instance and the
+	/// corresponding attribute indices, or false when the instance is not
+	/// referenced.
+	bool references_to(unsigned int id, const unsigned int*& begin, const unsigned int*& end, const unsigned char*& attributes) const;
+	/// Returns a row of the reference table that can be modified and removes
+	/// the cached list of instances referencing the instance
+	reference_row& modifiable_references_to(unsigned int id);
+
+	/// Returns the instance previously indexed by the GlobalId, if any
+	IfcSchema::IfcRoot* index_guid(const std::string& guid, IfcSchema::IfcRoot* instance);
+	IfcSchema::IfcRoot* find_guid(const std::string& guid) const;
+	void erase_guid(const std::string& guid);
+
 public:
 	IfcParse::IfcSpfLexer* tokens;
 	IfcParse::IfcSpfStream* stream;
 	
-	IfcFile();
+	/// When eager_supertype_index is false, only the lists of instances by
+	/// their exact type are built while parsing and the lists that include
+	/// subtypes are assembled on the first call to entitiesByType(). In that
+	/// case the instances in these lists are grouped by type rather than
+	/// ordered as in the file.
+	IfcFile(bool eager_supertype_index = true);
 	~IfcFile();
 	
 	/// Returns the first entity in the file, this probably is the entity
@@ -149,7 +331,9 @@ public:
 	IfcEntityList::ptr traverse(IfcUtil::IfcBaseClass* instance, int max_level=-1);
 
 	/// Marks entity as modified so that potential cache for it is invalidated.
-	/// @todo Currently the whole cache is invalidated. Implement more fine-grained invalidation.
+	/// The cached lists of referencing instances are already invalidated for
+	/// only the instances of which the references change, see
+	/// modifiable_references_to().
 	void mark_entity_as_modified(int id);
 
 #ifdef USE_MMAP
@@ -157,9 +341,56 @@ public:
 #else
 	bool Init(const std::string& fn);
 #endif
-	bool Init(std::istream& fn, int len);
-	bool Init(void* data, int len);
-	bool Init(IfcParse::IfcSpfStream* f);
+	bool Init(std::istream& fn, size_t len);
+	bool Init(void* data, size_t len);
+	/// Parses the file. When num_threads is larger than one, the data section
+	/// is split at instance boundaries and the parts are scanned concurrently.
+	/// A value of zero uses the number of hardware threads. The resulting
+	/// indices are identical to those of a single-threaded scan.
+	bool Init(IfcParse::IfcSpfStream* f, unsigned num_threads=1);
+	/// Parses the file using the index written by writeIndex(), so that only
+	/// the header is read and the instances are located without scanning the
+	/// file. When the index does not exist or does not match the file, e.g.
+	/// because the file was modified after the index was written, the file is
+	/// scanned as by Init(f, num_threads) and, if write_index is true, the
+	/// index is written anew.
+	bool Init(IfcParse::IfcSpfStream* f, const std::string& index_fn, bool write_index=true, unsigned num_threads=1);
+
+	/// Writes an index of the instances, references and GlobalIds in the file
+	/// to index_fn, from which the file can be read again without scanning it.
+	/// The index is keyed by the size, modification time and a hash of parts
+	/// of the contents of the file. It describes the instances in memory, so
+	/// it is only to be written for a file that has not been modified after it
+	/// was read, other than by update(). Returns false when instances have been
+	/// added to the file or when the index cannot be written.
+	bool writeIndex(const std::string& index_fn);
+
+	/// Reads a file written by writeBinary(). All instances are created with
+	/// their attributes, which are stored as IfcWrite::IfcWriteArgument, so
+	/// that no text needs to be parsed. Returns false when the binary file is
+	/// invalid or written for a different schema.
+	bool InitBinary(std::istream& f);
+
+	/// Writes the header and the entity instances in a compact binary form,
+	/// for caching a file, e.g. between the stages of a pipeline, rather than
+	/// for exchange. Instance names and integers are stored as variable
+	/// length integers, real numbers in their native binary representation
+	/// and strings once in a table of strings. All instances are loaded in
+	/// order to be written.
+	void writeBinary(std::ostream& os) const;
+
+	/// Replaces the file by a new version of it, e.g. a subsequent export of
+	/// the same model. The data sections are compared per entity instance
+	/// record, only the records that are added or of which the contents differ
+	/// are parsed and only for these and the removed records the indices are
+	/// updated. The instances of unchanged records are retained, including the
+	/// attributes read from them. Modified records result in new instances,
+	/// the previous instances of modified and removed records should no longer
+	/// be used. Added and modified instances are appended to the lists by type.
+	/// The file is expected not to have been modified since it was read. Takes
+	/// ownership of the stream. Returns false, leaving the file unchanged, when
+	/// the stream cannot be read or is of a different schema.
+	bool update(IfcParse::IfcSpfStream* f, change_set& changes);
 
 	IfcEntityList::ptr getInverse(int instance_id, IfcSchema::Type::Enum type, int attribute_index);
 
@@ -178,11 +409,12 @@ public:
 	std::pair<IfcSchema::IfcNamedUnit*, double> getUnit(IfcSchema::IfcUnitEnum::IfcUnitEnum);
 
 	void load(const IfcEntityInstanceData&);
-	void load(unsigned entity_instance_name, std::vector<Argument*>& attributes);
+	void load(unsigned entity_instance_name, std::vector<Argument*>& attributes, IfcArena* arena);
+	Argument* load_aggregate(unsigned entity_instance_name, IfcArena* arena);
 
-	void register_inverse(unsigned, Token);
-	void register_inverse(unsigned, IfcUtil::IfcBaseClass*);
-	void unregister_inverse(unsigned, IfcUtil::IfcBaseClass*);
+	void register_inverse(unsigned, Token, unsigned attribute_index);
+	void register_inverse(unsigned, IfcUtil::IfcBaseClass*, unsigned attribute_index);
+	void unregister_inverse(unsigned, IfcUtil::IfcBaseClass*, unsigned attribute_index);
 };
 
 }
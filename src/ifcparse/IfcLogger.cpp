@@ -22,6 +22,8 @@
 
 #include <boost/algorithm/string/replace.hpp>
 #include <boost/optional.hpp>
+#include <boost/thread/recursive_mutex.hpp>
+#include <boost/thread/tss.hpp>
 
 #include <boost/property_tree/ptree.hpp>
 #include <boost/property_tree/json_parser.hpp>
@@ -31,6 +33,18 @@
 #include <algorithm>
 
 namespace {
+
+	// Messages can be logged from several threads at once, for example by the
+	// threads of the geometry iterator. The mutex is recursive, because
+	// formatting the instance of a message may cause it to be loaded, which
+	// in turn may log messages.
+	boost::recursive_mutex log_mutex;
+	boost::thread_specific_ptr< boost::optional<IfcSchema::IfcProduct*> > current_product_of_thread;
+
+	boost::optional<IfcSchema::IfcProduct*> current_product() {
+		boost::optional<IfcSchema::IfcProduct*>* product = current_product_of_thread.get();
+		return product ? *product : boost::none;
+	}
 	
 	template <typename T>
 	struct severity_strings {
@@ -89,7 +103,10 @@ namespace {
 }
 
 void Logger::SetProduct(boost::optional<IfcSchema::IfcProduct*> product) {
-	current_product = product;
+	if (!current_product_of_thread.get()) {
+		current_product_of_thread.reset(new boost::optional<IfcSchema::IfcProduct*>);
+	}
+	*current_product_of_thread = product;
 }
 
 void Logger::SetOutput(std::ostream* l1, std::ostream* l2) {
@@ -112,6 +129,7 @@ void Logger::SetOutput(std::wostream* l1, std::wostream* l2) {
 
 template <typename T>
 void Logger::log(T& log2, Logger::Severity type, const std::string& message, IfcEntityInstanceData* entity) {
+	const boost::optional<IfcSchema::IfcProduct*> current_product = ::current_product();
 	log2 << "[" << severity_strings<typename T::char_type>::value[type] << "] ";
 	if (current_product) {
 		log2 << "{" << (*current_product)->GlobalId().c_str() << "} ";
@@ -124,6 +142,8 @@ void Logger::log(T& log2, Logger::Severity type, const std::string& message, Ifc
 
 void Logger::Message(Logger::Severity type, const std::string& message, IfcEntityInstanceData* entity) {
 	if ((log2 || wlog2) && type >= verbosity) {
+		boost::recursive_mutex::scoped_lock lock(log_mutex);
+		const boost::optional<IfcSchema::IfcProduct*> current_product = ::current_product();
 		if (format == FMT_PLAIN) {
             if (log2) {
                 plain_text_message(*log2, current_product, type, message, entity);
@@ -155,6 +175,7 @@ void status(T& log1, const std::string& message, bool new_line) {
 }
 
 void Logger::Status(const std::string& message, bool new_line) {
+	boost::recursive_mutex::scoped_lock lock(log_mutex);
 	if (log1) {
 		status(*log1, message, new_line);
 	} else if (wlog1) {
@@ -167,6 +188,7 @@ void Logger::ProgressBar(int progress) {
 }
 
 std::string Logger::GetLog() {
+	boost::recursive_mutex::scoped_lock lock(log_mutex);
 	return log_stream.str();
 }
 
@@ -183,4 +205,3 @@ std::wostream* Logger::wlog2 = 0;
 std::stringstream Logger::log_stream;
 Logger::Severity Logger::verbosity = Logger::LOG_NOTICE;
 Logger::Format Logger::format = Logger::FMT_PLAIN;
-boost::optional<IfcSchema::IfcProduct*> Logger::current_product;
@@ -55,11 +55,12 @@ private:
 
 	static Severity verbosity;
 	static Format format;
-	static boost::optional<IfcSchema::IfcProduct*> current_product;
 
 	template <typename T>
 	static void log(T& log2, Logger::Severity type, const std::string& message, IfcEntityInstanceData* entity);
 public:
+	/// Sets the product that is being processed by the calling thread, which
+	/// is included in the messages logged by this thread
 	static void SetProduct(boost::optional<IfcSchema::IfcProduct*> product);
 
 	/// Determines to what stream respectively progress and errors are logged
@@ -23,7 +23,13 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <ctime>
+#include <cstring>
+#include <cfloat>
+#include <climits>
+#include <fstream>
 #include <boost/circular_buffer.hpp>
+#include <boost/thread.hpp>
+#include <boost/bind.hpp>
 
 #include <boost/algorithm/string.hpp>
 #include <boost/math/special_functions/fpclassify.hpp>
@@ -47,6 +53,34 @@
 #include <boost/filesystem/path.hpp>
 #endif
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define HAVE_SSE2
+#include <emmintrin.h>
+#endif
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+#if defined(_MSC_VER) && defined(HAVE_SSE2)
+#include <intrin.h>
+#endif
+
+// Double precision products and quotients are rounded once, rather than
+// being evaluated in extended precision as on the x87 FPU
+#if (defined(FLT_EVAL_METHOD) && FLT_EVAL_METHOD == 0) || defined(_M_X64) || defined(_M_ARM64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define HAVE_EXACT_DOUBLE_ARITHMETIC
+#endif
+
+#include <sys/types.h>
+#include <sys/stat.h>
+
+#ifdef HAVE_POSIX_MMAP
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#endif
+
 #define PERMISSIVE_FLOAT
 
 using namespace IfcParse;
@@ -115,13 +149,23 @@ IfcSpfStream::IfcSpfStream(const std::string& fn)
 #endif
 	: stream(0)
 	, buffer(0)
+	, owns_buffer(true)
+#ifdef HAVE_POSIX_MMAP
+	, mapped(false)
+#endif
 	, valid(false)
 	, eof(false)
+	, modification_time(0)
 {
 #ifdef _MSC_VER
 	std::wstring fn_ws = IfcUtil::path::from_utf8(fn);
 	const wchar_t* fn_wide = fn_ws.c_str();
 
+	struct _stat64 st;
+	if (_wstat64(fn_wide, &st) == 0) {
+		modification_time = (std::time_t) st.st_mtime;
+	}
+
 #ifdef USE_MMAP
 	if (mmap) {
 		mfs = boost::iostreams::mapped_file_source(boost::filesystem::wpath(fn_wide));
@@ -134,10 +178,20 @@ IfcSpfStream::IfcSpfStream(const std::string& fn)
 
 #else
 
+	struct stat st;
+	if (stat(fn.c_str(), &st) == 0) {
+		modification_time = st.st_mtime;
+	}
+
 #ifdef USE_MMAP
 	if (mmap) {
 		mfs = boost::iostreams::mapped_file_source(fn);
 	} else {
+#endif
+#ifdef HAVE_POSIX_MMAP
+		if (map(fn)) {
+			return;
+		}
 #endif
 		stream = fopen(fn.c_str(), "rb");
 #ifdef USE_MMAP	
@@ -155,7 +209,7 @@ IfcSpfStream::IfcSpfStream(const std::string& fn)
 		valid = true;
 		buffer = mfs.data();
 		ptr = 0;
-		len = mfs.size();
+		len = size = mfs.size();
 	} else {
 #endif
 		if (stream == NULL) {
@@ -163,11 +217,18 @@ IfcSpfStream::IfcSpfStream(const std::string& fn)
 		}
 
 		valid = true;
-		fseek(stream, 0, SEEK_END);
-		size = (unsigned int)ftell(stream);
+		// Use the 64-bit variants of fseek() and ftell() as files
+		// larger than 2GB are not uncommon for infrastructure models.
+#ifdef _MSC_VER
+		_fseeki64(stream, 0, SEEK_END);
+		size = (size_t)_ftelli64(stream);
+#else
+		fseeko(stream, 0, SEEK_END);
+		size = (size_t)ftello(stream);
+#endif
 		rewind(stream);
 		char* buffer_rw = new char[size];
-		len = (unsigned int)fread(buffer_rw, 1, size, stream);
+		len = fread(buffer_rw, 1, size, stream);
 		buffer = buffer_rw;
 		eof = len == 0;
 		ptr = 0;
@@ -177,23 +238,63 @@ IfcSpfStream::IfcSpfStream(const std::string& fn)
 #endif
 }
 
-IfcSpfStream::IfcSpfStream(std::istream& f, int l)
+#ifdef HAVE_POSIX_MMAP
+//
+// Maps the file into memory, returns false if the file cannot be mapped
+// in which case it is read into a buffer instead
+//
+bool IfcSpfStream::map(const std::string& fn) {
+	const int fd = open(fn.c_str(), O_RDONLY);
+	if (fd == -1) {
+		return false;
+	}
+	struct stat st;
+	void* data = MAP_FAILED;
+	// Empty files cannot be mapped
+	if (fstat(fd, &st) == 0 && st.st_size > 0) {
+		data = ::mmap(0, (size_t) st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	}
+	// The mapping remains valid after the file descriptor is closed
+	close(fd);
+	if (data == MAP_FAILED) {
+		return false;
+	}
+	valid = true;
+	mapped = true;
+	buffer = (const char*) data;
+	ptr = 0;
+	len = size = (size_t) st.st_size;
+	return true;
+}
+#endif
+
+IfcSpfStream::IfcSpfStream(std::istream& f, size_t l)
 	: stream(0)
 	, buffer(0)
+	, owns_buffer(true)
+#ifdef HAVE_POSIX_MMAP
+	, mapped(false)
+#endif
+	, modification_time(0)
 {
 	eof = false;
 	size = l;
 	char* buffer_rw = new char[size];
 	f.read(buffer_rw,size);
 	buffer = buffer_rw;
-	valid = f.gcount() == size;
+	valid = (size_t) f.gcount() == size;
 	ptr = 0;
 	len = l;	
 }
 
-IfcSpfStream::IfcSpfStream(void* data, int l)
+IfcSpfStream::IfcSpfStream(void* data, size_t l)
 	: stream(0)
 	, buffer(0)
+	, owns_buffer(true)
+#ifdef HAVE_POSIX_MMAP
+	, mapped(false)
+#endif
+	, modification_time(0)
 {
 	eof = false;
 	size = l;
@@ -203,12 +304,36 @@ IfcSpfStream::IfcSpfStream(void* data, int l)
 	len = l;
 }
 
+IfcSpfStream::IfcSpfStream(const IfcSpfStream& other, size_t begin, size_t end)
+	: stream(0)
+	, buffer(other.buffer)
+	, ptr(begin)
+	, len(end)
+	, owns_buffer(false)
+#ifdef HAVE_POSIX_MMAP
+	, mapped(false)
+#endif
+	, valid(other.valid)
+	, eof(begin >= end)
+	, size(end)
+	, modification_time(other.modification_time)
+{}
+
 IfcSpfStream::~IfcSpfStream()
 {
 	Close();
 }
 
 void IfcSpfStream::Close() {
+	if (!owns_buffer) {
+		return;
+	}
+#ifdef HAVE_POSIX_MMAP
+	if (mapped) {
+		munmap(const_cast<char*>(buffer), size);
+		return;
+	}
+#endif
 #ifdef USE_MMAP
 	if (mfs.is_open()) {
 		mfs.close();
@@ -221,7 +346,7 @@ void IfcSpfStream::Close() {
 //
 // Seeks an arbitrary position in the file
 //
-void IfcSpfStream::Seek(unsigned int o) {
+void IfcSpfStream::Seek(size_t o) {
 	ptr = o;
 	if (ptr >= len) throw IfcException("Reading outside of file limits");
 	eof = false;
@@ -237,17 +362,166 @@ char IfcSpfStream::Peek() {
 //
 // Returns the character at specified offset
 //
-char IfcSpfStream::Read(unsigned int o) {
+char IfcSpfStream::Read(size_t o) {
 	return buffer[o];
 }
 
+//
+// Returns a pointer to the character at specified offset
+//
+const char* IfcSpfStream::Data(size_t o) {
+	return buffer + o;
+}
+
 //
 // Returns the cursor position
 //
-unsigned int IfcSpfStream::Tell() {
+size_t IfcSpfStream::Tell() {
 	return ptr;
 }
 
+namespace {
+#ifdef HAVE_SSE2
+	inline unsigned int count_trailing_zeros(unsigned int mask) {
+#ifdef _MSC_VER
+		unsigned long index;
+		_BitScanForward(&index, mask);
+		return (unsigned int) index;
+#else
+		return (unsigned int) __builtin_ctz(mask);
+#endif
+	}
+#endif
+
+	// The maximum number of characters compared in parallel, which is plenty for
+	// the delimiters of the lexer
+	static const size_t max_characters = 8;
+
+	const char* find_first_of_scalar(const char* begin, const char* end, const char* characters, size_t num_characters) {
+		for (; begin != end; ++begin) {
+			for (size_t i = 0; i < num_characters; ++i) {
+				if (*begin == characters[i]) {
+					return begin;
+				}
+			}
+		}
+		return end;
+	}
+
+#ifdef HAVE_SSE2
+	const char* find_first_of_sse2(const char* begin, const char* end, const char* characters, size_t num_characters) {
+		__m128i packed_characters[max_characters];
+		for (size_t i = 0; i < num_characters; ++i) {
+			packed_characters[i] = _mm_set1_epi8(characters[i]);
+		}
+		while (end - begin >= 16) {
+			const __m128i block = _mm_loadu_si128((const __m128i*) begin);
+			__m128i equal = _mm_cmpeq_epi8(block, packed_characters[0]);
+			for (size_t i = 1; i < num_characters; ++i) {
+				equal = _mm_or_si128(equal, _mm_cmpeq_epi8(block, packed_characters[i]));
+			}
+			const unsigned int mask = (unsigned int) _mm_movemask_epi8(equal);
+			if (mask) {
+				return begin + count_trailing_zeros(mask);
+			}
+			begin += 16;
+		}
+		return find_first_of_scalar(begin, end, characters, num_characters);
+	}
+#endif
+
+#ifdef __AVX2__
+	const char* find_first_of_avx2(const char* begin, const char* end, const char* characters, size_t num_characters) {
+		__m256i wide_characters[max_characters];
+		for (size_t i = 0; i < num_characters; ++i) {
+			wide_characters[i] = _mm256_set1_epi8(characters[i]);
+		}
+		while (end - begin >= 32) {
+			const __m256i block = _mm256_loadu_si256((const __m256i*) begin);
+			__m256i equal = _mm256_cmpeq_epi8(block, wide_characters[0]);
+			for (size_t i = 1; i < num_characters; ++i) {
+				equal = _mm256_or_si256(equal, _mm256_cmpeq_epi8(block, wide_characters[i]));
+			}
+			const unsigned int mask = (unsigned int) _mm256_movemask_epi8(equal);
+			if (mask) {
+				return begin + count_trailing_zeros(mask);
+			}
+			begin += 32;
+		}
+		return find_first_of_sse2(begin, end, characters, num_characters);
+	}
+#endif
+}
+
+IfcSpfStream::instruction_set IfcSpfStream::SupportedInstructionSet() {
+#if defined(__AVX2__)
+	return INSTRUCTIONS_AVX2;
+#elif defined(HAVE_SSE2)
+	return INSTRUCTIONS_SSE2;
+#else
+	return INSTRUCTIONS_SCALAR;
+#endif
+}
+
+//
+// Returns a pointer to the first character in the range [begin, end) that occurs
+// in the null-terminated string of characters, or end if there is none. Blocks of
+// 32 (AVX2) or 16 (SSE2) bytes are compared to every character at once, only the
+// remainder is compared byte by byte. Instruction sets the library has not been
+// compiled for fall back to the next narrower one.
+//
+const char* IfcSpfStream::FindFirstOf(const char* begin, const char* end, const char* characters, instruction_set instructions) {
+	const size_t num_characters = strlen(characters);
+	if (num_characters == 0 || num_characters > max_characters) {
+		return std::find_first_of(begin, end, characters, characters + num_characters);
+	}
+#ifdef __AVX2__
+	if (instructions == INSTRUCTIONS_AVX2) {
+		return find_first_of_avx2(begin, end, characters, num_characters);
+	}
+#endif
+#ifdef HAVE_SSE2
+	if (instructions != INSTRUCTIONS_SCALAR) {
+		return find_first_of_sse2(begin, end, characters, num_characters);
+	}
+#endif
+	(void) instructions;
+	return find_first_of_scalar(begin, end, characters, num_characters);
+}
+
+//
+// Moves the cursor forward to the first of the specified characters
+//
+void IfcSpfStream::SkipTo(const char* characters) {
+	if (eof) {
+		return;
+	}
+	ptr = FindFirstOf(buffer + ptr, buffer + len, characters, SupportedInstructionSet()) - buffer;
+	if (ptr == len) {
+		eof = true;
+	}
+}
+
+//
+// Hints the operating system on how the mapped pages will be accessed so
+// that read-ahead is increased while scanning and disabled afterwards
+//
+void IfcSpfStream::Advise(access_pattern pattern) {
+#ifdef HAVE_POSIX_MMAP
+	const int advice = pattern == ACCESS_SEQUENTIAL ? MADV_SEQUENTIAL : MADV_RANDOM;
+	if (mapped) {
+		madvise(const_cast<char*>(buffer), size, advice);
+	}
+#ifdef USE_MMAP
+	else if (mfs.is_open()) {
+		madvise(const_cast<char*>(buffer), size, advice);
+	}
+#endif
+#else
+	(void) pattern;
+#endif
+}
+
 //
 // Increments cursor and reads new chunk if necessary
 //
@@ -262,13 +536,45 @@ void IfcSpfStream::Inc() {
 }
 
 IfcSpfLexer::IfcSpfLexer(IfcParse::IfcSpfStream *s, IfcParse::IfcFile* f) {
+	// Lexers are not necessarily created by IfcFile::Init(), so make sure
+	// the locale for number parsing is available.
+	init_locale();
+	parent = 0;
 	file = f;
 	stream = s;
 	decoder = new IfcCharacterDecoder(s);
 }
 
+//
+// Creates a copy of the lexer for use on another thread, with
+// a stream of its own that shares the buffer of the parent
+//
+IfcSpfLexer::IfcSpfLexer(IfcSpfLexer* p) {
+	parent = p;
+	file = p->file;
+	stream = new IfcSpfStream(*p->stream, 0, p->stream->size);
+	decoder = new IfcCharacterDecoder(stream);
+}
+
 IfcSpfLexer::~IfcSpfLexer() {
 	delete decoder;
+	if (parent) {
+		delete stream;
+	}
+}
+
+IfcSpfLexer* IfcSpfLexer::copy(IfcSpfLexer* lexer) {
+	return new IfcSpfLexer(lexer);
+}
+
+IfcSpfLexer* IfcSpfLexer::local() {
+	if (parent) {
+		return parent->local();
+	}
+	if (copies.is_creator()) {
+		return this;
+	}
+	return copies.get(boost::bind(&IfcSpfLexer::copy, this));
 }
 
 unsigned int IfcSpfLexer::skipWhitespace() {
@@ -293,16 +599,18 @@ unsigned int IfcSpfLexer::skipComment() {
 		stream->Seek(stream->Tell() - 1);
 		return 0;
 	}
-	unsigned int n = 2;
-	char p = 0;
+	const size_t start = stream->Tell() - 1;
+	stream->Inc();
 	while ( !stream->eof ) {
-		c = stream->Peek();
+		stream->SkipTo("*");
+		if ( stream->eof ) break;
 		stream->Inc();
-		++ n;
-		if (c == '/' && p == '*') break;
-		p = c;
+		if ( !stream->eof && stream->Peek() == '/' ) {
+			stream->Inc();
+			break;
+		}
 	}
-	return n;
+	return (unsigned int) (stream->Tell() - start);
 }
 
 //
@@ -315,7 +623,7 @@ Token IfcSpfLexer::Next() {
 	while (skipWhitespace() || skipComment()) {}
 	
 	if ( stream->eof ) return NoneTokenPtr();
-	unsigned int pos = stream->Tell();
+	size_t pos = stream->Tell();
 
 	char c = stream->Peek();
 	
@@ -335,8 +643,10 @@ Token IfcSpfLexer::Next() {
 		stream->Inc();
 		len ++;
 
-		// If a string is encountered defer processing to the IfcCharacterDecoder
+		// If a string is encountered defer processing to the IfcCharacterDecoder,
+		// otherwise skip ahead to the next character that may end the token
 		if ( c == '\'' ) decoder->dryRun();
+		else stream->SkipTo("()=,;/'");
 	}
 	if ( len ) return GeneralTokenPtr(this, pos, stream->Tell());
 	else return NoneTokenPtr();
@@ -346,9 +656,9 @@ Token IfcSpfLexer::Next() {
 // Reads a std::string from the file at specified offset
 // Omits whitespace and comments
 //
-void IfcSpfLexer::TokenString(unsigned int offset, std::string &buffer) {
+void IfcSpfLexer::TokenString(size_t offset, std::string &buffer) {
 	const bool was_eof = stream->eof;
-	unsigned int old_offset = stream->Tell();
+	size_t old_offset = stream->Tell();
 	stream->Seek(offset);
 	buffer.clear();
 	while ( ! stream->eof ) {
@@ -367,9 +677,9 @@ void IfcSpfLexer::TokenString(unsigned int offset, std::string &buffer) {
 }
 
 //Note: according to STEP standard, there may be newlines in tokens
-inline void RemoveTokenSeparators(IfcSpfStream* stream, unsigned start, unsigned end, std::string &oDestination) {
+inline void RemoveTokenSeparators(IfcSpfStream* stream, size_t start, size_t end, std::string &oDestination) {
 	oDestination.clear();
-	for (unsigned i = start; i < end; i++) {
+	for (size_t i = start; i < end; i++) {
 		char c = stream->Read(i);
 		if (c == ' ' || c == '\r' || c == '\n' || c == '\t')
 			continue;
@@ -410,36 +720,196 @@ bool ParseBool(const char *pStart, bool &val) {
 	return true;
 }
 
-Token IfcParse::OperatorTokenPtr(IfcSpfLexer* lexer, unsigned start, unsigned end) {
+namespace {
+	// The powers of ten that are represented exactly by a double
+	const double exact_powers_of_ten[] = {
+		1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+		1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+	};
+
+	inline bool is_digit(char c) {
+		return c >= '0' && c <= '9';
+	}
+
+	//
+	// Parses the integer or real number in [begin, end) directly from the
+	// buffer of the stream. Reals of at most 15 significant digits, or more
+	// as long as the significand is below 2^53, and a decimal exponent of at
+	// most 22 are computed as a single, correctly rounded, multiplication or
+	// division of two exact doubles. Returns false for any other number and
+	// for tokens that contain separators or are not numbers, which are then
+	// parsed from a copy of the token by strtol() and strtod_l().
+	//
+	bool ParseNumber(const char* begin, const char* end, Token& token) {
+		const char* p = begin;
+		const bool negative = *p == '-';
+		if (*p == '-' || *p == '+') {
+			++p;
+		}
+		if (p == end || !is_digit(*p)) {
+			return false;
+		}
+
+		boost::uint64_t significand = 0;
+		int num_digits = 0, exponent = 0;
+		bool is_real = false;
+
+		for (; p != end && is_digit(*p); ++p) {
+			if (significand == 0 && *p == '0') {
+				continue;
+			} else if (num_digits == 19) {
+				return false;
+			}
+			significand = significand * 10 + (*p - '0');
+			++num_digits;
+		}
+		if (p != end && *p == '.') {
+			is_real = true;
+			for (++p; p != end && is_digit(*p); ++p) {
+				if (significand == 0 && *p == '0') {
+					--exponent;
+					continue;
+				} else if (num_digits == 19) {
+					return false;
+				}
+				significand = significand * 10 + (*p - '0');
+				++num_digits;
+				--exponent;
+			}
+		}
+		if (p != end && (*p == 'E' || *p == 'e')) {
+			is_real = true;
+			++p;
+			const bool negative_exponent = p != end && *p == '-';
+			if (p != end && (*p == '-' || *p == '+')) {
+				++p;
+			}
+			if (p == end || !is_digit(*p)) {
+				return false;
+			}
+			int e = 0;
+			for (; p != end && is_digit(*p); ++p) {
+				if (e > 10000) {
+					return false;
+				}
+				e = e * 10 + (*p - '0');
+			}
+			exponent += negative_exponent ? -e : e;
+		}
+		if (p != end) {
+			return false;
+		}
+
+		if (!is_real) {
+			if (significand > (boost::uint64_t) INT_MAX + (negative ? 1 : 0)) {
+				return false;
+			}
+			token.type = Token_INT;
+			token.value_int = negative ? (int) (0 - significand) : (int) significand;
+			return true;
+		}
+
+#ifdef HAVE_EXACT_DOUBLE_ARITHMETIC
+		if (significand > (boost::uint64_t(1) << 53)) {
+			return false;
+		}
+		double value = (double) significand;
+		if (significand != 0) {
+			if (exponent < -22 || exponent > 22) {
+				return false;
+			} else if (exponent < 0) {
+				value /= exact_powers_of_ten[-exponent];
+			} else {
+				value *= exact_powers_of_ten[exponent];
+			}
+		}
+		token.type = Token_FLOAT;
+		token.value_double = negative ? -value : value;
+		return true;
+#else
+		return false;
+#endif
+	}
+
+	// Parses the digits of an instance name in [begin, end)
+	bool ParseIdentifier(const char* begin, const char* end, int& val) {
+		if (begin == end) {
+			return false;
+		}
+		unsigned int v = 0;
+		for (const char* p = begin; p != end; ++p) {
+			if (!is_digit(*p) || v > (unsigned int) (INT_MAX - 9) / 10) {
+				return false;
+			}
+			v = v * 10 + (*p - '0');
+		}
+		val = (int) v;
+		return true;
+	}
+
+	// Whether the keyword is parsed as a real number by strtod_l()
+	bool IsNumericKeyword(const char* begin, const char* end) {
+		const boost::iterator_range<const char*> keyword(begin, end);
+		return boost::iequals(keyword, "inf") || boost::iequals(keyword, "nan") || boost::iequals(keyword, "infinity");
+	}
+}
+
+Token IfcParse::OperatorTokenPtr(IfcSpfLexer* lexer, size_t start, size_t end) {
 	char first = lexer->stream->Read(start);
 	Token token(lexer, start, end, Token_OPERATOR);
 	token.value_char = first;
 	return token;
 }
 
-Token IfcParse::GeneralTokenPtr(IfcSpfLexer* lexer, unsigned start, unsigned end) {
+//
+// Most tokens are classified, and numbers parsed, directly from the buffer
+// of the stream. Only tokens that contain separators, enumerations and the
+// numbers that ParseNumber() does not handle exactly are copied first.
+//
+Token IfcParse::GeneralTokenPtr(IfcSpfLexer* lexer, size_t start, size_t end) {
 	Token token(lexer, start, end, Token_NONE);
 
+	const char* begin = lexer->stream->Data(start);
+	const char* const token_end = begin + (end - start);
+	const char first = *begin;
+	if (first == '#') {
+		token.type = Token_IDENTIFIER;
+		if (ParseIdentifier(begin + 1, token_end, token.value_int)) {
+			return token;
+		}
+	} else if (first == '\'') {
+		token.type = Token_STRING;
+		return token;
+	} else if (first == '"') {
+		token.type = Token_BINARY;
+		return token;
+	} else if (first == '-' || first == '+' || is_digit(first)) {
+		if (ParseNumber(begin, token_end, token)) {
+			return token;
+		}
+	} else if (first != '.' && !IsNumericKeyword(begin, token_end)) {
+		// Keywords and the null and derived attribute values, of which any
+		// separators, e.g. a line break in a long entity name, are omitted
+		// when the keyword is read by TokenFunc::asStringRef().
+		token.type = Token_KEYWORD;
+		return token;
+	}
+
 	//extract token into temp buffer (remove eol-s, no encoding changes)
 	std::string &tokenStr = lexer->GetTempString();
 	RemoveTokenSeparators(lexer->stream, start, end, tokenStr);
 	
 	//determine type of the token
-	char first = lexer->stream->Read(start);
 	if (first == '#') {
 		token.type = Token_IDENTIFIER;
 		if (!ParseInt(tokenStr.c_str() + 1, token.value_int))
 			throw IfcException("Identifier token as not integer");
 	}
-	else if (first == '\'')
-		token.type = Token_STRING;
 	else if (first == '.') {
 		token.type = Token_ENUMERATION;
 		if (ParseBool(tokenStr.c_str(), token.value_bool)) //bool is also enumeration
 			token.type = Token_BOOL;
 	}
-	else if (first == '"')
-		token.type = Token_BINARY;
 	else if (ParseInt(tokenStr.c_str(), token.value_int))
 		token.type = Token_INT;
 	else if (ParseFloat(tokenStr.c_str(), token.value_double))
@@ -536,8 +1006,9 @@ const std::string &TokenFunc::asStringRef(const Token& t) {
     if (t.type == Token_NONE) {
         throw IfcParse::IfcException("Null token encountered, premature end of file?");
     }
-	std::string &str = t.lexer->GetTempString();
-	t.lexer->TokenString(t.startPos, str);
+	IfcSpfLexer* lexer = t.lexer->local();
+	std::string &str = lexer->GetTempString();
+	lexer->TokenString(t.startPos, str);
 	if ((isString(t) || isEnumeration(t) || isBinary(t)) && !str.empty()) {
 		//remove start+end characters in-place
 		str.erase(str.end()-1);
@@ -586,7 +1057,7 @@ boost::dynamic_bitset<> TokenFunc::asBinary(const Token& t) {
 
 std::string TokenFunc::toString(const Token& t) {
 	std::string result;
-	t.lexer->TokenString(t.startPos, result);
+	t.lexer->local()->TokenString(t.startPos, result);
 	return result;
 }
 
@@ -595,20 +1066,22 @@ TokenArgument::TokenArgument(const Token& t) {
 	token = t;
 }
 
-EntityArgument::EntityArgument(const Token& t) {
+EntityArgument::EntityArgument(const Token& t, IfcArena* arena) {
 	IfcParse::IfcFile* file = t.lexer->file;
-	IfcEntityInstanceData* data = read(0, file, t.startPos);
+	IfcEntityInstanceData* data = read(0, file, t.startPos, arena);
 	// Data needs to be loaded, for the tokens
 	// to be consumed and parsing to continue.
 	data->load();
-	entity = IfcSchema::SchemaEntity(data);
+	entity = IfcSchema::SchemaEntity(data, arena);
 }
 
 // 
 // Reads the arguments from a list of token
 // Aditionally, registers the ids (i.e. #[\d]+) in the inverse map
+// The arguments are allocated from the arena, if specified
 //
-void IfcParse::IfcFile::load(unsigned entity_instance_name, std::vector<Argument*>& attributes) {
+void IfcParse::IfcFile::load(unsigned entity_instance_name, std::vector<Argument*>& attributes, IfcArena* arena) {
+	IfcSpfLexer* tokens = this->tokens->local();
 	Token next = tokens->Next();
 	while( next.startPos || next.lexer ) {
 		if ( TokenFunc::isOperator(next,',') ) {
@@ -616,29 +1089,71 @@ void IfcParse::IfcFile::load(unsigned entity_instance_name, std::vector<Argument
 		} else if ( TokenFunc::isOperator(next,')') ) {
 			break;
 		} else if ( TokenFunc::isOperator(next,'(') ) {
-			ArgumentList* alist = new ArgumentList();
-			load(entity_instance_name, alist->arguments());
-			attributes.push_back(alist);
+			attributes.push_back(load_aggregate(entity_instance_name, arena));
 		} else {
 			if ( TokenFunc::isIdentifier(next) ) {
 				if (!parsing_complete_) {
-					register_inverse(entity_instance_name, next);
+					register_inverse(entity_instance_name, next, reference_row::unknown_attribute);
 				}
 			} if ( TokenFunc::isKeyword(next) ) {
 				// tokens->Next();
 				try {
-					attributes.push_back(new EntityArgument(next));
+					attributes.push_back(arena ? new (arena) EntityArgument(next, arena) : new EntityArgument(next));
 				} catch ( IfcException& e ) {
 					Logger::Message(Logger::LOG_ERROR, e.what());
 				}
 			} else {
-				attributes.push_back(new TokenArgument(next));
+				attributes.push_back(arena ? new (arena) TokenArgument(next) : new TokenArgument(next));
+			}
+		}
+		next = tokens->Next();
+	}
+}
+
+//
+// Reads an aggregate, of which the opening parenthesis has already been
+// consumed. Aggregates of simple values are stored as a TokenListArgument,
+// nested aggregates and inline entity instances as an ArgumentList.
+//
+Argument* IfcParse::IfcFile::load_aggregate(unsigned entity_instance_name, IfcArena* arena) {
+	IfcSpfLexer* tokens = this->tokens->local();
+	std::vector<Token> values;
+	Token next = tokens->Next();
+	while( next.startPos || next.lexer ) {
+		if ( TokenFunc::isOperator(next,',') ) {
+			// do nothing
+		} else if ( TokenFunc::isOperator(next,')') ) {
+			break;
+		} else if ( TokenFunc::isOperator(next,'(') || TokenFunc::isKeyword(next) ) {
+			// Not a list of simple values: rewind to the current token and
+			// continue reading into an ArgumentList.
+			std::vector<Argument*> elements;
+			for (std::vector<Token>::const_iterator it = values.begin(); it != values.end(); ++it) {
+				elements.push_back(arena ? new (arena) TokenArgument(*it) : new TokenArgument(*it));
+			}
+			tokens->stream->Seek(next.startPos);
+			load(entity_instance_name, elements, arena);
+			ArgumentList* alist = arena ? new (arena) ArgumentList(arena) : new ArgumentList;
+			alist->arguments().assign(elements.begin(), elements.end());
+			return alist;
+		} else {
+			if ( TokenFunc::isIdentifier(next) && !parsing_complete_ ) {
+				register_inverse(entity_instance_name, next, reference_row::unknown_attribute);
 			}
+			values.push_back(next);
 		}
 		next = tokens->Next();
 	}
+	if (values.empty()) {
+		return arena ? new (arena) ArgumentList(arena) : new ArgumentList;
+	}
+	return arena ? new (arena) TokenListArgument(tokens, values, arena) : new TokenListArgument(tokens, values);
 }
 
+ArgumentList::ArgumentList(IfcArena* arena)
+	: list(arena_allocator<Argument*>(arena))
+{}
+
 IfcUtil::ArgumentType ArgumentList::type() const {
 	if (list.empty()) {
 		return IfcUtil::Argument_EMPTY_AGGREGATE;
@@ -674,20 +1189,20 @@ void ArgumentList::push(Argument* l) {
 
 // templated helper function for reading arguments into a list
 template<typename T>
-std::vector<T> read_aggregate_as_vector(const std::vector<Argument*>& list) {
+std::vector<T> read_aggregate_as_vector(const argument_vector& list) {
 	std::vector<T> return_value;
 	return_value.reserve(list.size());
-	std::vector<Argument*>::const_iterator it = list.begin();
+	argument_vector::const_iterator it = list.begin();
 	for (; it != list.end(); ++it) {
 		return_value.push_back(**it);
 	}
 	return return_value;
 }
 template<typename T>
-std::vector< std::vector<T> > read_aggregate_of_aggregate_as_vector2(const std::vector<Argument*>& list) {
+std::vector< std::vector<T> > read_aggregate_of_aggregate_as_vector2(const argument_vector& list) {
 	std::vector< std::vector<T> > return_value;
 	return_value.reserve(list.size());
-	std::vector<Argument*>::const_iterator it = list.begin();
+	argument_vector::const_iterator it = list.begin();
 	for (; it != list.end(); ++it) {
 		return_value.push_back(**it);
 	}
@@ -715,7 +1230,7 @@ ArgumentList::operator std::vector<boost::dynamic_bitset<> >() const {
 
 ArgumentList::operator IfcEntityList::ptr() const {
 	IfcEntityList::ptr l ( new IfcEntityList() );
-	std::vector<Argument*>::const_iterator it;
+	argument_vector::const_iterator it;
 	for ( it = list.begin(); it != list.end(); ++ it ) {
 		// FIXME: account for $
 		IfcUtil::IfcBaseClass* entity = **it;
@@ -732,15 +1247,59 @@ ArgumentList::operator std::vector< std::vector<double> >() const {
 	return read_aggregate_of_aggregate_as_vector2<double>(list);
 }
 
+//
+// Flattens the aggregates into a single vector. Aggregates of simple values
+// read from a file are stored as TokenListArguments, of which the tokens are
+// decoded directly into the vector, so that no vector is allocated per
+// aggregate.
+//
+namespace {
+	template <typename T>
+	bool flatten_aggregate_of_aggregate(const argument_vector& list, std::vector<T>& values, unsigned int& stride) {
+		values.clear();
+		stride = list.empty() ? 0 : list.front()->size();
+		values.reserve(list.size() * stride);
+		argument_vector::const_iterator it = list.begin();
+		for (; it != list.end(); ++it) {
+			const TokenListArgument* token_list = dynamic_cast<const TokenListArgument*>(*it);
+			if (token_list) {
+				if (token_list->size() != stride) {
+					return false;
+				}
+				token_list->append_to(values);
+			} else {
+				const std::vector<T> aggregate = **it;
+				if (aggregate.size() != stride) {
+					return false;
+				}
+				values.insert(values.end(), aggregate.begin(), aggregate.end());
+			}
+		}
+		return true;
+	}
+}
+
+bool ArgumentList::flatten(std::vector<int>& values, unsigned int& stride) const {
+	return flatten_aggregate_of_aggregate<int>(list, values, stride);
+}
+
+bool ArgumentList::flatten(std::vector<double>& values, unsigned int& stride) const {
+	return flatten_aggregate_of_aggregate<double>(list, values, stride);
+}
+
 ArgumentList::operator IfcEntityListList::ptr() const {
 	IfcEntityListList::ptr l ( new IfcEntityListList() );
-	std::vector<Argument*>::const_iterator it;
+	argument_vector::const_iterator it;
 	for ( it = list.begin(); it != list.end(); ++ it ) {
 		const Argument* arg = *it;
 		const ArgumentList* arg_list;
+		const TokenListArgument* token_list;
 		if ((arg_list = dynamic_cast<const ArgumentList*>(arg)) != 0) {
 			IfcEntityList::ptr e = *arg_list;
 			l->push(e);
+		} else if ((token_list = dynamic_cast<const TokenListArgument*>(arg)) != 0) {
+			IfcEntityList::ptr e = *token_list;
+			l->push(e);
 		}
 	}
 	return l;
@@ -770,7 +1329,7 @@ void ArgumentList::set(unsigned int i, Argument* argument) {
 std::string ArgumentList::toString(bool upper) const {
 	std::stringstream ss;
 	ss << "(";
-	for( std::vector<Argument*>::const_iterator it = list.begin(); it != list.end(); it ++ ) {
+	for( argument_vector::const_iterator it = list.begin(); it != list.end(); it ++ ) {
 		if ( it != list.begin() ) ss << ",";
 		ss << (*it)->toString(upper);
 	}
@@ -781,48 +1340,204 @@ std::string ArgumentList::toString(bool upper) const {
 bool ArgumentList::isNull() const { return false; }
 
 ArgumentList::~ArgumentList() {
-	for( std::vector<Argument*>::iterator it = list.begin(); it != list.end(); it ++ ) {
+	for( argument_vector::iterator it = list.begin(); it != list.end(); it ++ ) {
 		delete (*it);
 	}
 	list.clear();
 }
 
+CompactToken::CompactToken(const Token& t)
+	: startPos(t.startPos)
+	, type(t.type)
+{
+	memcpy(&value_double, &t.value_double, sizeof(double));
+}
 
-IfcUtil::ArgumentType TokenArgument::type() const {
-	if (TokenFunc::isInt(token)) {
-		return IfcUtil::Argument_INT;
-	} else if (TokenFunc::isBool(token)) {
-		return IfcUtil::Argument_BOOL;
-	} else if (TokenFunc::isFloat(token)) {
-		return IfcUtil::Argument_DOUBLE;
-	} else if (TokenFunc::isString(token)) {
-		return IfcUtil::Argument_STRING;
-	} else if (TokenFunc::isEnumeration(token)) {
-		return IfcUtil::Argument_ENUMERATION;
-	} else if (TokenFunc::isIdentifier(token)) {
-		return IfcUtil::Argument_ENTITY_INSTANCE;
-	} else if (TokenFunc::isBinary(token)) {
-		return IfcUtil::Argument_BINARY;
-	} else if (TokenFunc::isOperator(token, '$')) {
-		return IfcUtil::Argument_NULL;
-	} else if (TokenFunc::isOperator(token, '*')) {
-		return IfcUtil::Argument_DERIVED;
+Token CompactToken::token(IfcSpfLexer* lexer) const {
+	Token t(lexer, (size_t) startPos, 0, (TokenType) type);
+	memcpy(&t.value_double, &value_double, sizeof(double));
+	return t;
+}
+
+TokenListArgument::TokenListArgument(IfcSpfLexer* lexer, const std::vector<Token>& tokens, IfcArena* arena)
+	: lexer(lexer)
+	, arena(arena)
+	, count((unsigned int) tokens.size())
+	, elements(0)
+{
+	if (arena) {
+		values = static_cast<CompactToken*>(arena->allocate(count * sizeof(CompactToken)));
 	} else {
-		return IfcUtil::Argument_UNKNOWN;
+		values = static_cast<CompactToken*>(::operator new(count * sizeof(CompactToken)));
+	}
+	for (unsigned int i = 0; i < count; ++i) {
+		new (values + i) CompactToken(tokens[i]);
 	}
 }
 
-//
-// Functions for casting the TokenArgument to other types
-//
-TokenArgument::operator int() const { return TokenFunc::asInt(token); }
-TokenArgument::operator bool() const { return TokenFunc::asBool(token); }
-TokenArgument::operator double() const { return TokenFunc::asFloat(token); }
-TokenArgument::operator std::string() const { return TokenFunc::asString(token); }
-TokenArgument::operator boost::dynamic_bitset<>() const { return TokenFunc::asBinary(token); }
-TokenArgument::operator IfcUtil::IfcBaseClass*() const { return token.lexer->file->entityById(TokenFunc::asIdentifier(token)); }
-unsigned int TokenArgument::size() const { return 1; }
-Argument* TokenArgument::operator [] (unsigned int /*i*/) const { throw IfcException("Argument is not a list of attributes"); }
+TokenListArgument::~TokenListArgument() {
+	// Only called for instances not allocated from an arena
+	Argument** elems = elements.load();
+	if (elems) {
+		for (unsigned int i = 0; i < count; ++i) {
+			delete elems[i];
+		}
+		delete[] elems;
+	}
+	::operator delete(values);
+}
+
+IfcUtil::ArgumentType TokenListArgument::type() const {
+	const IfcUtil::ArgumentType elem_type = TokenArgument(token(0)).type();
+	if (elem_type == IfcUtil::Argument_INT) {
+		return IfcUtil::Argument_AGGREGATE_OF_INT;
+	} else if (elem_type == IfcUtil::Argument_DOUBLE) {
+		return IfcUtil::Argument_AGGREGATE_OF_DOUBLE;
+	} else if (elem_type == IfcUtil::Argument_STRING) {
+		return IfcUtil::Argument_AGGREGATE_OF_STRING;
+	} else if (elem_type == IfcUtil::Argument_BINARY) {
+		return IfcUtil::Argument_AGGREGATE_OF_BINARY;
+	} else if (elem_type == IfcUtil::Argument_ENTITY_INSTANCE) {
+		return IfcUtil::Argument_AGGREGATE_OF_ENTITY_INSTANCE;
+	} else {
+		return IfcUtil::Argument_UNKNOWN;
+	}
+}
+
+//
+// Functions for casting the TokenListArgument to other types
+//
+TokenListArgument::operator std::vector<int>() const {
+	std::vector<int> return_value(count);
+	for (unsigned int i = 0; i < count; ++i) {
+		return_value[i] = TokenFunc::asInt(token(i));
+	}
+	return return_value;
+}
+
+TokenListArgument::operator std::vector<double>() const {
+	std::vector<double> return_value(count);
+	for (unsigned int i = 0; i < count; ++i) {
+		return_value[i] = TokenFunc::asFloat(token(i));
+	}
+	return return_value;
+}
+
+void TokenListArgument::append_to(std::vector<int>& values) const {
+	for (unsigned int i = 0; i < count; ++i) {
+		values.push_back(TokenFunc::asInt(token(i)));
+	}
+}
+
+void TokenListArgument::append_to(std::vector<double>& values) const {
+	for (unsigned int i = 0; i < count; ++i) {
+		values.push_back(TokenFunc::asFloat(token(i)));
+	}
+}
+
+TokenListArgument::operator std::vector<std::string>() const {
+	std::vector<std::string> return_value;
+	return_value.reserve(count);
+	for (unsigned int i = 0; i < count; ++i) {
+		return_value.push_back(TokenFunc::asString(token(i)));
+	}
+	return return_value;
+}
+
+TokenListArgument::operator std::vector<boost::dynamic_bitset<> >() const {
+	std::vector<boost::dynamic_bitset<> > return_value;
+	return_value.reserve(count);
+	for (unsigned int i = 0; i < count; ++i) {
+		return_value.push_back(TokenFunc::asBinary(token(i)));
+	}
+	return return_value;
+}
+
+TokenListArgument::operator IfcEntityList::ptr() const {
+	IfcEntityList::ptr l ( new IfcEntityList() );
+	for (unsigned int i = 0; i < count; ++i) {
+		// FIXME: account for $
+		l->push(lexer->file->entityById(TokenFunc::asIdentifier(token(i))));
+	}
+	return l;
+}
+
+Argument* TokenListArgument::operator [] (unsigned int i) const {
+	if ( i >= count ) {
+		throw IfcAttributeOutOfRangeException("Argument index out of range");
+	}
+	Argument** elems = elements.load(boost::memory_order_acquire);
+	if (!elems) {
+		if (arena) {
+			elems = static_cast<Argument**>(arena->allocate(count * sizeof(Argument*)));
+		} else {
+			elems = new Argument*[count];
+		}
+		for (unsigned int j = 0; j < count; ++j) {
+			elems[j] = arena ? new (arena) TokenArgument(token(j)) : new TokenArgument(token(j));
+		}
+		Argument** expected = 0;
+		if (!elements.compare_exchange_strong(expected, elems, boost::memory_order_acq_rel)) {
+			// Another thread instantiated the elements first. Elements allocated
+			// from the arena are released along with it.
+			if (!arena) {
+				for (unsigned int j = 0; j < count; ++j) {
+					delete elems[j];
+				}
+				delete[] elems;
+			}
+			elems = expected;
+		}
+	}
+	return elems[i];
+}
+
+std::string TokenListArgument::toString(bool upper) const {
+	std::stringstream ss;
+	ss << "(";
+	for (unsigned int i = 0; i < count; ++i) {
+		if (i) ss << ",";
+		ss << TokenArgument(token(i)).toString(upper);
+	}
+	ss << ")";
+	return ss.str();
+}
+
+IfcUtil::ArgumentType TokenArgument::type() const {
+	if (TokenFunc::isInt(token)) {
+		return IfcUtil::Argument_INT;
+	} else if (TokenFunc::isBool(token)) {
+		return IfcUtil::Argument_BOOL;
+	} else if (TokenFunc::isFloat(token)) {
+		return IfcUtil::Argument_DOUBLE;
+	} else if (TokenFunc::isString(token)) {
+		return IfcUtil::Argument_STRING;
+	} else if (TokenFunc::isEnumeration(token)) {
+		return IfcUtil::Argument_ENUMERATION;
+	} else if (TokenFunc::isIdentifier(token)) {
+		return IfcUtil::Argument_ENTITY_INSTANCE;
+	} else if (TokenFunc::isBinary(token)) {
+		return IfcUtil::Argument_BINARY;
+	} else if (TokenFunc::isOperator(token, '$')) {
+		return IfcUtil::Argument_NULL;
+	} else if (TokenFunc::isOperator(token, '*')) {
+		return IfcUtil::Argument_DERIVED;
+	} else {
+		return IfcUtil::Argument_UNKNOWN;
+	}
+}
+
+//
+// Functions for casting the TokenArgument to other types
+//
+TokenArgument::operator int() const { return TokenFunc::asInt(token); }
+TokenArgument::operator bool() const { return TokenFunc::asBool(token); }
+TokenArgument::operator double() const { return TokenFunc::asFloat(token); }
+TokenArgument::operator std::string() const { return TokenFunc::asString(token); }
+TokenArgument::operator boost::dynamic_bitset<>() const { return TokenFunc::asBinary(token); }
+TokenArgument::operator IfcUtil::IfcBaseClass*() const { return token.lexer->file->entityById(TokenFunc::asIdentifier(token)); }
+unsigned int TokenArgument::size() const { return 1; }
+Argument* TokenArgument::operator [] (unsigned int /*i*/) const { throw IfcException("Argument is not a list of attributes"); }
 std::string TokenArgument::toString(bool upper) const { 
 	if ( upper && TokenFunc::isString(token) ) {
 		return IfcWrite::IfcCharacterEncoder(TokenFunc::asString(token)); 
@@ -852,18 +1567,23 @@ EntityArgument::~EntityArgument() { delete entity->entity; delete entity;}
 //
 // Reads an Entity from the list of Tokens at the specified offset in the file
 //
-IfcEntityInstanceData* IfcParse::read(unsigned int i, IfcFile* f, boost::optional<unsigned> offset) {
+IfcEntityInstanceData* IfcParse::read(unsigned int i, IfcFile* f, boost::optional<size_t> offset, IfcArena* arena) {
+	IfcSpfLexer* tokens = f->tokens->local();
 	if (offset) {
-		f->tokens->stream->Seek(*offset);
+		tokens->stream->Seek(*offset);
 	}
-	Token datatype = f->tokens->Next();
+	Token datatype = tokens->Next();
 	if (!TokenFunc::isKeyword(datatype)) throw IfcException("Unexpected token while parsing entity");
 	IfcSchema::Type::Enum ty = IfcSchema::Type::FromString(TokenFunc::asStringRef(datatype));
-	IfcEntityInstanceData* e = new IfcEntityInstanceData(ty, f, i, offset.get_value_or(0));
+	IfcEntityInstanceData* e = arena
+		? new (arena) IfcEntityInstanceData(ty, f, i, offset.get_value_or(0), arena)
+		: new IfcEntityInstanceData(ty, f, i, offset.get_value_or(0));
 	return e;
 }
 
 void IfcParse::IfcFile::load(const IfcEntityInstanceData& data) {
+	// Every thread reads from its own lexer on the shared file buffer
+	IfcSpfLexer* tokens = this->tokens->local();
 	if (tokens->stream->Tell() != data.offset_in_file()) {
 		tokens->stream->Seek(data.offset_in_file());
 		Token datatype = tokens->Next();
@@ -871,40 +1591,90 @@ void IfcParse::IfcFile::load(const IfcEntityInstanceData& data) {
 	}
 
 	tokens->Next();
-	load(data.id(), data.attributes());
-	unsigned int old_offset = tokens->stream->Tell();
+	// The arguments are first read into a temporary vector, so that
+	// the final storage is allocated only once, with the exact size
+	std::vector<Argument*> attributes;
+	load(data.id(), attributes, data.arena());
+	data.attributes().assign(attributes.begin(), attributes.end());
+	size_t old_offset = tokens->stream->Tell();
 	Token semilocon = tokens->Next();
 	if (!TokenFunc::isOperator(semilocon, ';')) {
 		tokens->stream->Seek(old_offset);
 	}
 }
 
-void IfcParse::IfcFile::register_inverse(unsigned id_from, Token t) {
+void IfcParse::IfcFile::register_inverse(unsigned id_from, Token t, unsigned attribute_index) {
 	// Assume a check on token type has already been performed
-	byref[t.value_int].push_back(id_from);
+	modifiable_references_to(t.value_int).push_back(id_from, attribute_index);
 }
 
-void IfcParse::IfcFile::register_inverse(unsigned id_from, IfcUtil::IfcBaseClass* inst) {
-	byref[inst->entity->id()].push_back(id_from);
+void IfcParse::IfcFile::register_inverse(unsigned id_from, IfcUtil::IfcBaseClass* inst, unsigned attribute_index) {
+	modifiable_references_to(inst->entity->id()).push_back(id_from, attribute_index);
 }
 
-void IfcParse::IfcFile::unregister_inverse(unsigned id_from, IfcUtil::IfcBaseClass* inst) {
-	std::vector<unsigned int>& ids = byref[inst->entity->id()];
-	std::vector<unsigned int>::iterator it = std::find(ids.begin(), ids.end(), id_from);
-	if (it == ids.end()) {
+void IfcParse::IfcFile::unregister_inverse(unsigned id_from, IfcUtil::IfcBaseClass* inst, unsigned attribute_index) {
+	if (!modifiable_references_to(inst->entity->id()).erase(id_from, attribute_index)) {
 		// @todo inverses also need to be populated when multiple instances are added to a new file.
 		// throw IfcParse::IfcException("Instance not found among inverses");
-	} else {
-		ids.erase(it);
 	}
 }
 
+bool IfcParse::reference_row::erase(unsigned int instance, unsigned int attribute) {
+	if (attribute > unknown_attribute) {
+		attribute = unknown_attribute;
+	}
+	std::vector<unsigned int>::iterator found = instances.end();
+	for (std::vector<unsigned int>::iterator it = instances.begin(); it != instances.end(); ++it) {
+		if (*it == instance) {
+			if (found == instances.end()) {
+				found = it;
+			}
+			if (attributes[it - instances.begin()] == attribute) {
+				found = it;
+				break;
+			}
+		}
+	}
+	if (found == instances.end()) {
+		return false;
+	}
+	attributes.erase(attributes.begin() + (found - instances.begin()));
+	instances.erase(found);
+	return true;
+}
+
+void IfcParse::reference_row::erase_all(unsigned int instance) {
+	size_t j = 0;
+	for (size_t i = 0; i < instances.size(); ++i) {
+		if (instances[i] != instance) {
+			instances[j] = instances[i];
+			attributes[j] = attributes[i];
+			++j;
+		}
+	}
+	instances.resize(j);
+	attributes.resize(j);
+}
+
+void IfcParse::reference_row::erase_all(const std::set<unsigned int>& instances_to_erase) {
+	size_t j = 0;
+	for (size_t i = 0; i < instances.size(); ++i) {
+		if (instances_to_erase.find(instances[i]) == instances_to_erase.end()) {
+			instances[j] = instances[i];
+			attributes[j] = attributes[i];
+			++j;
+		}
+	}
+	instances.resize(j);
+	attributes.resize(j);
+}
+
 //
 // Returns a string representation of the entity
 // Note that this initializes the entity if it is not initialized
 //
 std::string IfcEntityInstanceData::toString(bool upper) const {
-	if (!initialized_) {
+	if (!loaded()) {
 		load();
 	}
 
@@ -921,7 +1691,7 @@ std::string IfcEntityInstanceData::toString(bool upper) const {
 	}
 
 	ss << dt << "(";
-	std::vector<Argument*>::const_iterator it = attributes_.begin();
+	argument_vector::const_iterator it = attributes_.begin();
 	for (; it != attributes_.end(); ++it) {
 		if (it != attributes_.begin()) {
 			ss << ",";
@@ -934,7 +1704,7 @@ std::string IfcEntityInstanceData::toString(bool upper) const {
 }
 
 IfcEntityInstanceData::~IfcEntityInstanceData() {
-	std::vector<Argument*>::const_iterator it = attributes_.begin();
+	argument_vector::const_iterator it = attributes_.begin();
 	for (; it != attributes_.end(); ++it) {
 		delete *it;
 	}
@@ -955,8 +1725,98 @@ IfcEntityList::ptr IfcEntityInstanceData::getInverse(IfcSchema::Type::Enum type,
 	return file->getInverse(id_, type, attribute_index);
 }
 
-IfcFile::IfcFile()
+IfcArena::IfcArena()
+	: ptr(0)
+	, end(0)
+	, next_block_size(1 << 16)
+{}
+
+IfcArena::~IfcArena() {
+	for (owned_map_t::const_iterator it = owned.begin(); it != owned.end(); ++it) {
+		it->second(it->first);
+	}
+	for (block_map_t::const_iterator it = blocks.begin(); it != blocks.end(); ++it) {
+		delete[] const_cast<char*>(it->first);
+	}
+}
+
+//
+// Bumps the pointer into the current block. When the current block is full a
+// new block is allocated with twice the size of the previous block, up to a
+// limit. Requests larger than that limit are allocated in a block of their own.
+//
+void* IfcArena::allocate(size_t size) {
+	if (!locals.is_creator()) {
+		return local()->allocate(size);
+	}
+	static const size_t max_block_size = 1 << 24;
+	size = (size + 7) & ~size_t(7);
+	if (size > (size_t) (end - ptr)) {
+		if (size > max_block_size / 2) {
+			char* block = new char[size];
+			blocks[block] = block + size;
+			return block;
+		}
+		while (next_block_size < size) {
+			next_block_size *= 2;
+		}
+		ptr = new char[next_block_size];
+		end = ptr + next_block_size;
+		blocks[ptr] = end;
+		if (next_block_size < max_block_size) {
+			next_block_size *= 2;
+		}
+	}
+	void* p = ptr;
+	ptr += size;
+	return p;
+}
+
+bool IfcArena::owns(const void* p) const {
+	const char* c = static_cast<const char*>(p);
+	block_map_t::const_iterator it = blocks.upper_bound(c);
+	if (it != blocks.begin() && c < (--it)->second) {
+		return true;
+	}
+	return locals.any(boost::bind(&IfcArena::owns, _1, p));
+}
+
+bool IfcArena::disown(void* t) {
+	if (owned.erase(t)) {
+		return true;
+	}
+	return locals.any(boost::bind(&IfcArena::disown, _1, t));
+}
+
+void IfcArena::splice(IfcArena& other) {
+	blocks.insert(other.blocks.begin(), other.blocks.end());
+	owned.insert(other.owned.begin(), other.owned.end());
+	other.blocks.clear();
+	other.owned.clear();
+	other.ptr = other.end = 0;
+
+	std::vector<IfcArena*> other_locals;
+	other.locals.release(other_locals);
+	for (std::vector<IfcArena*>::const_iterator it = other_locals.begin(); it != other_locals.end(); ++it) {
+		splice(**it);
+		delete *it;
+	}
+}
+
+IfcArena* IfcArena::create_local() {
+	return new IfcArena;
+}
+
+IfcArena* IfcArena::local() {
+	return locals.get(&IfcArena::create_local);
+}
+
+IfcFile::IfcFile(bool eager_supertype_index)
 	: parsing_complete_(false)
+	, bytype(IfcSchema::Type::UNDEFINED)
+	, bytype_excl(IfcSchema::Type::UNDEFINED)
+	, eager_supertype_index_(eager_supertype_index)
+	, bytype_complete(IfcSchema::Type::UNDEFINED, true)
 	, MaxId(0)
 	, tokens(0)
 	, stream(0)
@@ -965,8 +1825,26 @@ IfcFile::IfcFile()
 }
 
 void IfcEntityInstanceData::load() const {
-	file->load(*this);
-	initialized_ = true;
+	unsigned char state = load_state_.load(boost::memory_order_acquire);
+	while (state != LOADED) {
+		if (state == NOT_LOADED && load_state_.compare_exchange_weak(state, (unsigned char) LOADING, boost::memory_order_acquire)) {
+			// No lock is held while reading, so that the inline entity
+			// instances in the attributes can be loaded in turn.
+			try {
+				file->load(*this);
+			} catch (...) {
+				load_state_.store(NOT_LOADED, boost::memory_order_release);
+				throw;
+			}
+			load_state_.store(LOADED, boost::memory_order_release);
+			return;
+		}
+		if (state == LOADING) {
+			// Another thread is reading the attributes
+			boost::this_thread::yield();
+			state = load_state_.load(boost::memory_order_acquire);
+		}
+	}
 }
 
 IfcEntityInstanceData::IfcEntityInstanceData(const IfcEntityInstanceData& e) {
@@ -975,7 +1853,7 @@ IfcEntityInstanceData::IfcEntityInstanceData(const IfcEntityInstanceData& e) {
 	id_ = 0;
 
 	// In order not to have the instance read from file
-	initialized_ = true;
+	load_state_ = LOADED;
 
 	const unsigned int count = e.getArgumentCount();
 	for (unsigned int i = 0; i < count; ++i) {
@@ -985,7 +1863,7 @@ IfcEntityInstanceData::IfcEntityInstanceData(const IfcEntityInstanceData& e) {
 
 
 Argument* IfcEntityInstanceData::getArgument(unsigned int i) const {
-	if (!initialized_) {
+	if (!loaded()) {
 		load();
 	}
 	if (i < attributes_.size()) {
@@ -999,14 +1877,15 @@ class unregister_inverse_visitor {
 private:
 	IfcFile& file_;
 	const IfcEntityInstanceData& data_;
+	unsigned attribute_index_;
 
 public:
-	unregister_inverse_visitor(IfcFile& file, const IfcEntityInstanceData& data)
-		: file_(file), data_(data)
+	unregister_inverse_visitor(IfcFile& file, const IfcEntityInstanceData& data, unsigned attribute_index)
+		: file_(file), data_(data), attribute_index_(attribute_index)
 	{}
 
 	void operator()(IfcUtil::IfcBaseClass* inst) {
-		file_.unregister_inverse(data_.id(), inst);
+		file_.unregister_inverse(data_.id(), inst, attribute_index_);
 	}
 };
 
@@ -1014,14 +1893,15 @@ class register_inverse_visitor {
 private:
 	IfcFile& file_;
 	const IfcEntityInstanceData& data_;
+	unsigned attribute_index_;
 
 public:
-	register_inverse_visitor(IfcFile& file, const IfcEntityInstanceData& data)
-		: file_(file), data_(data)
+	register_inverse_visitor(IfcFile& file, const IfcEntityInstanceData& data, unsigned attribute_index)
+		: file_(file), data_(data), attribute_index_(attribute_index)
 	{}
 
 	void operator()(IfcUtil::IfcBaseClass* inst) {
-		file_.register_inverse(data_.id(), inst);
+		file_.register_inverse(data_.id(), inst, attribute_index_);
 	}
 };
 
@@ -1076,7 +1956,7 @@ public:
 	void apply(T& t) const {
 		if (attribute_) {
 			apply_attribute_(t, attribute_);
-		} else {
+		} else if (data_) {
 			for (unsigned i = 0; i < data_->getArgumentCount(); ++i) {
 				Argument* attr = data_->getArgument(i);
 				apply_attribute_(t, attr);
@@ -1087,12 +1967,12 @@ public:
 };
 
 void IfcEntityInstanceData::setArgument(unsigned int i, Argument* a, IfcUtil::ArgumentType attr_type) {
-	if (!initialized_) {
+	if (!loaded()) {
 		load();
 	}
 
 	while (attributes_.size() < i) {
-		attributes_.push_back(new NullArgument());
+		attributes_.push_back(arena() ? new (arena()) NullArgument() : new NullArgument());
 	}
 
 	if (attr_type == IfcUtil::Argument_UNKNOWN) {
@@ -1177,74 +2057,1068 @@ void IfcEntityInstanceData::setArgument(unsigned int i, Argument* a, IfcUtil::Ar
 			}
 			mapped_instances->push(inner);
 		}
-		copy->set(mapped_instances);
-		break; }
-	case IfcUtil::Argument_EMPTY_AGGREGATE:
-	case IfcUtil::Argument_AGGREGATE_OF_EMPTY_AGGREGATE: {
-		IfcUtil::ArgumentType t2 = IfcSchema::Type::GetAttributeType(type(), (unsigned char)i);
-		delete copy;
-		copy = 0;
-		setArgument(i, a, t2);
-		break; }
-	default:
-	case IfcUtil::Argument_UNKNOWN:
-		throw IfcParse::IfcException(std::string("Unknown attribute encountered: '") + a->toString() + "' at index '" + boost::lexical_cast<std::string>(i) + "'");
-		break;
+		copy->set(mapped_instances);
+		break; }
+	case IfcUtil::Argument_EMPTY_AGGREGATE:
+	case IfcUtil::Argument_AGGREGATE_OF_EMPTY_AGGREGATE: {
+		IfcUtil::ArgumentType t2 = IfcSchema::Type::GetAttributeType(type(), (unsigned char)i);
+		delete copy;
+		copy = 0;
+		setArgument(i, a, t2);
+		break; }
+	default:
+	case IfcUtil::Argument_UNKNOWN:
+		throw IfcParse::IfcException(std::string("Unknown attribute encountered: '") + a->toString() + "' at index '" + boost::lexical_cast<std::string>(i) + "'");
+		break;
+	}
+
+	if (!copy) {
+		return;
+	}
+
+	if (i < attributes_.size()) {
+		Argument* current_attribute = attributes_[i];
+		if (this->file) {
+			unregister_inverse_visitor visitor(*this->file, *this, i);
+			apply_individual_instance_visitor(current_attribute).apply(visitor);
+		}
+		// Attributes read into the arena are released along with it. The
+		// ones that have been set here before are allocated on the heap.
+		if (!arena() || !arena()->owns(current_attribute)) {
+			if (arena()) {
+				arena()->disown(current_attribute);
+			}
+			delete current_attribute;
+		}
+	}
+
+	if (arena()) {
+		arena()->own(copy);
+	}
+
+	if (this->file) {
+		register_inverse_visitor visitor(*this->file, *this, i);
+		apply_individual_instance_visitor(copy).apply(visitor);
+
+		this->file->mark_entity_as_modified(id_);
+	}
+
+	if (i < attributes_.size()) {
+		attributes_[i] = copy;
+	} else {
+		// We have asserted above that the size is at least i
+		attributes_.push_back(copy);
+	}
+}
+
+//
+// Parses the IFC file in fn
+// Creates the maps
+//
+#ifdef USE_MMAP
+bool IfcFile::Init(const std::string& fn, bool mmap) {
+	return IfcFile::Init(new IfcSpfStream(fn, mmap));
+}
+#else
+bool IfcFile::Init(const std::string& fn) {
+	return IfcFile::Init(new IfcSpfStream(fn));
+}
+#endif
+
+bool IfcFile::Init(std::istream& f, size_t len) {
+	return IfcFile::Init(new IfcSpfStream(f,len));
+}
+
+bool IfcFile::Init(void* data, size_t len) {
+	return IfcFile::Init(new IfcSpfStream(data,len));
+}
+
+namespace {
+	//
+	// Returns the offsets at which the byte range [begin, end) can be split into num_parts
+	// parts of roughly equal size. Parts are split at the '#' of an instance name that follows
+	// a ';' outside of string literals and comments, so that every part starts with an entity
+	// instance and can be tokenized independently. The offsets returned include begin and end.
+	//
+	std::vector<size_t> find_instance_boundaries(IfcSpfStream* stream, size_t begin, size_t end, unsigned int num_parts) {
+		std::vector<size_t> boundaries;
+		boundaries.push_back(begin);
+
+		const size_t part_size = (end - begin) / num_parts;
+		size_t target = begin + part_size;
+
+		bool in_string = false, in_comment = false;
+		char previous = 0;
+
+		for (size_t i = begin; i < end && boundaries.size() < num_parts; ++i) {
+			const char c = stream->Read(i);
+			if (in_comment) {
+				if (previous == '*' && c == '/') {
+					in_comment = false;
+					previous = 0;
+					continue;
+				}
+			} else if (in_string) {
+				// A quote inside a string literal is escaped by doubling it,
+				// which amounts to leaving and immediately re-entering the string.
+				if (c == '\'') in_string = false;
+			} else if (c == '\'') {
+				in_string = true;
+			} else if (previous == '/' && c == '*') {
+				in_comment = true;
+				previous = 0;
+				continue;
+			} else if (c == ';' && i >= target) {
+				size_t j = i + 1;
+				while (j < end) {
+					const char d = stream->Read(j);
+					if (d != ' ' && d != '\r' && d != '\n' && d != '\t') break;
+					++j;
+				}
+				if (j < end && stream->Read(j) == '#') {
+					boundaries.push_back(j);
+					target = j + part_size;
+					i = j - 1;
+					previous = 0;
+					continue;
+				}
+			}
+			previous = c;
+		}
+
+		boundaries.push_back(end);
+		return boundaries;
+	}
+
+	// The byte range of an entity instance record #id=...; in a file
+	struct instance_record {
+		unsigned int id;
+		// The offsets of the '#' of the instance name, of the keyword and
+		// past the terminating ';'
+		size_t begin, keyword, end;
+		// Of the contents of the record from the keyword onwards
+		boost::uint64_t hash;
+	};
+
+	// A 64-bit hash of a sequence of bytes, which are combined eight at a time
+	class record_hash {
+	private:
+		boost::uint64_t hash_, word_;
+		unsigned int shift_;
+
+		static boost::uint64_t mix(boost::uint64_t h) {
+			h ^= h >> 33;
+			h *= 0xff51afd7ed558ccdULL;
+			h ^= h >> 33;
+			return h;
+		}
+	public:
+		record_hash() : hash_(0), word_(0), shift_(0) {}
+
+		void add(char c) {
+			word_ |= (boost::uint64_t) (unsigned char) c << shift_;
+			if ((shift_ += 8) == 64) {
+				hash_ = mix(hash_ ^ word_) * 0x9e3779b97f4a7c15ULL;
+				word_ = 0;
+				shift_ = 0;
+			}
+		}
+
+		void add(const char* data, size_t n) {
+			size_t i = 0;
+			for (; i < n && shift_; ++i) {
+				add(data[i]);
+			}
+			for (; i + 8 <= n; i += 8) {
+				boost::uint64_t word;
+				std::memcpy(&word, data + i, 8);
+				hash_ = mix(hash_ ^ word) * 0x9e3779b97f4a7c15ULL;
+			}
+			for (; i < n; ++i) {
+				add(data[i]);
+			}
+		}
+
+		boost::uint64_t value() const {
+			return mix(mix(hash_ ^ word_) ^ shift_);
+		}
+	};
+
+	struct instance_record_sorter {
+		bool operator()(const instance_record* a, const instance_record* b) const {
+			return a->id < b->id;
+		}
+	};
+
+	//
+	// Splits the byte range [begin, end) into entity instance records and hashes their
+	// contents. Line breaks and comments are not significant in the exchange structure
+	// and are not included in the hash. Anything outside of records, e.g. the header
+	// section, is skipped. Records are returned in file order.
+	//
+	void find_instance_records(IfcSpfStream* stream, size_t begin, size_t end, std::vector<instance_record>& records) {
+		// The characters that require attention within a record, all
+		// others are only added to the hash
+		bool special[256] = {};
+		special[(unsigned char) '\r'] = special[(unsigned char) '\n'] = true;
+		special[(unsigned char) '\''] = special[(unsigned char) '/'] = special[(unsigned char) ';'] = true;
+
+		instance_record record;
+		record_hash hash;
+		bool in_record = false, in_string = false, in_comment = false;
+
+		for (size_t i = begin; i < end; ++i) {
+			const char c = stream->Read(i);
+			if (in_record && !special[(unsigned char) c]) {
+				hash.add(c);
+				continue;
+			}
+			if (in_comment) {
+				if (c == '*' && i + 1 < end && stream->Read(i + 1) == '/') {
+					in_comment = false;
+					++i;
+				}
+				continue;
+			}
+			if (c == '\r' || c == '\n') {
+				continue;
+			}
+			if (in_string) {
+				// A quote inside a string literal is escaped by doubling it,
+				// which amounts to leaving and immediately re-entering the string.
+				if (c == '\'') in_string = false;
+			} else if (c == '\'') {
+				in_string = true;
+			} else if (c == '/' && i + 1 < end && stream->Read(i + 1) == '*') {
+				in_comment = true;
+				++i;
+				continue;
+			} else if (in_record && c == ';') {
+				hash.add(c);
+				record.end = i + 1;
+				record.hash = hash.value();
+				records.push_back(record);
+				in_record = false;
+				continue;
+			} else if (!in_record && c == '#') {
+				size_t j = i + 1;
+				unsigned int id = 0;
+				char d = 0;
+				while (j < end && (d = stream->Read(j)) >= '0' && d <= '9') {
+					id = id * 10 + (d - '0');
+					++j;
+				}
+				if (j == i + 1) continue;
+				while (j < end && ((d = stream->Read(j)) == ' ' || d == '\t' || d == '\r' || d == '\n')) ++j;
+				if (j == end || d != '=') continue;
+				++j;
+				while (j < end && ((d = stream->Read(j)) == ' ' || d == '\t' || d == '\r' || d == '\n')) ++j;
+				record.id = id;
+				record.begin = i;
+				record.keyword = j;
+				hash = record_hash();
+				in_record = true;
+				i = j - 1;
+				continue;
+			}
+			if (in_record) {
+				hash.add(c);
+			}
+		}
+	}
+
+	//
+	// Returns the records sorted by instance name. When a name occurs more than
+	// once, only the last occurrence is returned, as it overwrites the others.
+	//
+	std::vector<const instance_record*> sort_instance_records(const std::vector<instance_record>& records) {
+		std::vector<const instance_record*> sorted;
+		sorted.reserve(records.size());
+		for (std::vector<instance_record>::const_iterator it = records.begin(); it != records.end(); ++it) {
+			sorted.push_back(&*it);
+		}
+		// Files are commonly written in order of instance names
+		bool in_order = true;
+		for (size_t i = 1; i < sorted.size() && in_order; ++i) {
+			in_order = sorted[i - 1]->id < sorted[i]->id;
+		}
+		if (!in_order) {
+			std::stable_sort(sorted.begin(), sorted.end(), instance_record_sorter());
+		}
+		std::vector<const instance_record*>::iterator jt = sorted.begin();
+		for (std::vector<const instance_record*>::const_iterator it = sorted.begin(); it != sorted.end(); ++it) {
+			if (it + 1 != sorted.end() && (*(it + 1))->id == (*it)->id) continue;
+			*jt++ = *it;
+		}
+		sorted.erase(jt, sorted.end());
+		return sorted;
+	}
+
+	// Appends the names of the instances referenced by the record
+	void referenced_instance_names(IfcSpfStream* stream, const instance_record& record, std::vector<unsigned int>& names) {
+		bool in_string = false;
+		for (size_t i = record.keyword; i < record.end; ++i) {
+			const char c = stream->Read(i);
+			if (c == '\'') {
+				in_string = !in_string;
+			} else if (c == '#' && !in_string) {
+				unsigned int id = 0;
+				char d;
+				while (i + 1 < record.end && (d = stream->Read(i + 1)) >= '0' && d <= '9') {
+					id = id * 10 + (d - '0');
+					++i;
+				}
+				names.push_back(id);
+			}
+		}
+	}
+
+}
+
+//
+// Tokenizes the file from the current position of the lexer onwards and
+// creates (uninitialized) entity instances for every #id=KEYWORD encountered.
+// The instances are allocated from arena, the instances and references are
+// stored in result. Only the lexer, result and arena are modified so that
+// multiple parts can be scanned concurrently.
+//
+void IfcFile::scan(IfcSpfLexer* lexer, bool report_progress, scan_result& result, IfcArena& arena) {
+	boost::circular_buffer<Token> token_stream(3, Token());
+
+	IfcEntityInstanceData* data;
+	IfcUtil::IfcBaseClass* instance = 0;
+	IfcSchema::IfcRoot* pending_root = 0;
+
+	unsigned current_id = 0;
+	int progress = 0;
+
+	// The nesting level of parentheses within the current instance, the index
+	// of the attribute being read and, when reading the attributes of an inline
+	// entity instance, the nesting level at which these are read.
+	unsigned depth = 0, attribute = 0, inline_depth = 0;
+
+	// Tokens are processed with a lookahead of two tokens. When the end of the
+	// stream is reached, the remaining tokens are shifted out by empty tokens,
+	// because a part of a file scanned in parallel ends directly after the last
+	// instance, of which the trailing references would otherwise be dropped.
+	bool at_end = false;
+	int remaining = 2;
+
+	for (;;) {
+		// The GlobalId of an IfcRoot is its first attribute, which is read directly from
+		// the token following the opening parenthesis, so that the instance does not
+		// need to be loaded in its entirety to populate the GlobalId map.
+		if (pending_root && token_stream[0].startPos == pending_root->entity->offset_in_file()) {
+			boost::optional<std::string> guid;
+			if (token_stream[1].type == IfcParse::Token_OPERATOR &&
+				token_stream[1].value_char == '(' &&
+				token_stream[2].type == IfcParse::Token_STRING)
+			{
+				try {
+					guid = TokenFunc::asString(token_stream[2]);
+				} catch (const IfcException&) {}
+			}
+			result.guids.push_back(std::make_pair(pending_root, guid));
+			pending_root = 0;
+		}
+
+		if (token_stream[0].type == IfcParse::Token_IDENTIFIER &&
+			token_stream[1].type == IfcParse::Token_OPERATOR &&
+			token_stream[1].value_char == '=' &&
+			token_stream[2].type == IfcParse::Token_KEYWORD)
+		{
+			current_id = (unsigned) TokenFunc::asIdentifier(token_stream[0]);
+			depth = attribute = inline_depth = 0;
+			IfcSchema::Type::Enum entity_type;
+			try {
+				entity_type = IfcSchema::Type::FromString(TokenFunc::asStringRef(token_stream[2]));
+			} catch (const IfcException& ex) {
+				result.messages.push_back(std::make_pair(Logger::LOG_ERROR, std::string(ex.what())));
+				goto advance;
+			}
+
+			// The instance is allocated from the arena of the scan, which on completion is
+			// spliced into the arena of the file. Hence, the instance attributes, which are
+			// only read after scanning, are directly allocated from the arena of the file.
+			data = new (&arena) IfcEntityInstanceData(entity_type, this, current_id, token_stream[2].startPos, &arena_);
+			instance = IfcSchema::SchemaEntity(data, &arena);
+			result.instances.push_back(instance);
+
+			if (instance->is(IfcSchema::Type::IfcRoot)) {
+				pending_root = (IfcSchema::IfcRoot*) instance;
+			}
+
+            /// @todo Printing to stdout in a library class feels weird. Maybe move the progress prints to the client code?
+			// Update the status after every 1000 instances parsed
+			if (report_progress && !((++progress) % 1000)) {
+				std::stringstream ss; ss << "\r#" << current_id;
+				Logger::Status(ss.str(), false);
+			}
+		} else if (token_stream[0].type == IfcParse::Token_IDENTIFIER && instance) {
+			scanned_reference reference;
+			reference.referenced = (unsigned) token_stream[0].value_int;
+			reference.referencing = current_id;
+			reference.attribute = (inline_depth || attribute >= reference_row::unknown_attribute)
+				? reference_row::unknown_attribute
+				: (unsigned char) attribute;
+			result.references.push_back(reference);
+		} else if (token_stream[0].type == IfcParse::Token_OPERATOR) {
+			if (token_stream[0].value_char == '(') {
+				++depth;
+			} else if (token_stream[0].value_char == ')') {
+				if (depth) --depth;
+				if (depth < inline_depth) inline_depth = 0;
+			} else if (token_stream[0].value_char == ',' && depth == 1) {
+				++attribute;
+			}
+		} else if (token_stream[0].type == IfcParse::Token_KEYWORD && depth && !inline_depth) {
+			// An inline entity instance, e.g. IFCLABEL('...'), of which the
+			// attributes are read at the next level of nesting
+			inline_depth = depth + 1;
+		}
+
+	advance:
+		Token next_token;
+		if (!at_end && !lexer->stream->eof) {
+			try {
+				next_token = lexer->Next();
+			} catch (const IfcException& e) {
+				result.messages.push_back(std::make_pair(Logger::LOG_ERROR, std::string(e.what()) + ". Parsing terminated"));
+			} catch (...) {
+				result.messages.push_back(std::make_pair(Logger::LOG_ERROR, std::string("Parsing terminated")));
+			}
+		}
+
+		if (next_token.type == Token_NONE) {
+			at_end = true;
+			if (remaining-- == 0) break;
+		}
+
+		token_stream.push_back(next_token);
+	}
+
+	if (pending_root) {
+		result.guids.push_back(std::make_pair(pending_root, boost::optional<std::string>()));
+	}
+}
+
+//
+// Scans a part of the file on the calling thread. The arena and the lexer are
+// created here, so that the allocations and lexer state are local to the thread.
+//
+void IfcFile::scan_part(size_t begin, size_t end, scan_result& result, IfcArena*& arena) {
+	arena = new IfcArena;
+	IfcSpfStream part(*stream, begin, end);
+	IfcSpfLexer lexer(&part, this);
+	scan(&lexer, false, result, *arena);
+}
+
+//
+// Adds the instances and references from a scan to the maps
+//
+void IfcFile::merge(const scan_result& result) {
+	for (std::vector< std::pair<Logger::Severity, std::string> >::const_iterator it = result.messages.begin(); it != result.messages.end(); ++it) {
+		Logger::Message(it->first, it->second);
+	}
+
+	for (std::vector<IfcUtil::IfcBaseClass*>::const_iterator it = result.instances.begin(); it != result.instances.end(); ++it) {
+		IfcUtil::IfcBaseClass* instance = *it;
+		const unsigned current_id = instance->entity->id();
+		IfcSchema::Type::Enum ty = instance->type();
+
+		{
+			IfcEntityList::ptr instances_by_type = entitiesByTypeExclSubtypes(ty);
+			if (!instances_by_type) {
+				instances_by_type = IfcEntityList::ptr(new IfcEntityList());
+				bytype_excl[ty] = instances_by_type;
+			}
+			instances_by_type->push(instance);
+		}
+
+		while (eager_supertype_index_) {
+			IfcEntityList::ptr instances_by_type = entitiesByType(ty);
+			if (!instances_by_type) {
+				instances_by_type = IfcEntityList::ptr(new IfcEntityList());
+				bytype[ty] = instances_by_type;
+			}
+			instances_by_type->push(instance);
+			boost::optional<IfcSchema::Type::Enum> pt = IfcSchema::Type::Parent(ty);
+			if (pt) {
+				ty = *pt;
+			} else {
+				break;
+			}
+		}
+
+		if (byid.find(current_id) != byid.end()) {
+			std::stringstream ss;
+			ss << "Overwriting instance with name #" << current_id;
+			Logger::Message(Logger::LOG_WARNING,ss.str());
+		}
+		byid[current_id] = instance;
+
+		MaxId = (std::max)(MaxId, current_id);
+	}
+}
+
+namespace {
+	struct referenced_id_sorter {
+		bool operator()(const scanned_reference& a, const scanned_reference& b) const {
+			return a.referenced < b.referenced;
+		}
+	};
+}
+
+//
+// Builds the table of references from the scans of the parts of the file.
+// When the instance names are reasonably dense the rows are counted in an
+// array indexed by instance name, otherwise the references are sorted. In
+// both cases the order of the references within a row is the order in
+// which they were encountered in the file.
+//
+void IfcFile::build_reference_index(const std::vector<scan_result>& results) {
+	size_t num_references = 0;
+	unsigned int max_referenced_id = 0;
+	for (std::vector<scan_result>::const_iterator it = results.begin(); it != results.end(); ++it) {
+		num_references += it->references.size();
+		for (std::vector<scanned_reference>::const_iterator jt = it->references.begin(); jt != it->references.end(); ++jt) {
+			max_referenced_id = (std::max)(max_referenced_id, jt->referenced);
+		}
+	}
+
+	byref_ids.clear();
+	byref_offsets.clear();
+	byref_values.clear();
+	byref_attributes.clear();
+	byref_modified.clear();
+
+	if (num_references == 0) {
+		byref_offsets.push_back(0);
+		return;
+	}
+
+	byref_values.resize(num_references);
+	byref_attributes.resize(num_references);
+
+	if (max_referenced_id / 4 <= num_references + byid.size()) {
+		// The number of references to every instance name, which is then
+		// turned into the position at which the next reference is written.
+		std::vector<unsigned int> positions((size_t) max_referenced_id + 1);
+		for (std::vector<scan_result>::const_iterator it = results.begin(); it != results.end(); ++it) {
+			for (std::vector<scanned_reference>::const_iterator jt = it->references.begin(); jt != it->references.end(); ++jt) {
+				++positions[jt->referenced];
+			}
+		}
+
+		unsigned int offset = 0;
+		for (unsigned int id = 0; id <= max_referenced_id; ++id) {
+			const unsigned int count = positions[id];
+			positions[id] = offset;
+			if (count) {
+				byref_ids.push_back(id);
+				byref_offsets.push_back(offset);
+				offset += count;
+			}
+		}
+		byref_offsets.push_back(offset);
+
+		for (std::vector<scan_result>::const_iterator it = results.begin(); it != results.end(); ++it) {
+			for (std::vector<scanned_reference>::const_iterator jt = it->references.begin(); jt != it->references.end(); ++jt) {
+				const unsigned int position = positions[jt->referenced]++;
+				byref_values[position] = jt->referencing;
+				byref_attributes[position] = jt->attribute;
+			}
+		}
+	} else {
+		std::vector<scanned_reference> references;
+		references.reserve(num_references);
+		for (std::vector<scan_result>::const_iterator it = results.begin(); it != results.end(); ++it) {
+			references.insert(references.end(), it->references.begin(), it->references.end());
+		}
+		std::stable_sort(references.begin(), references.end(), referenced_id_sorter());
+
+		for (size_t i = 0; i < references.size(); ++i) {
+			if (i == 0 || references[i].referenced != references[i - 1].referenced) {
+				byref_ids.push_back(references[i].referenced);
+				byref_offsets.push_back((unsigned int) i);
+			}
+			byref_values[i] = references[i].referencing;
+			byref_attributes[i] = references[i].attribute;
+		}
+		byref_offsets.push_back((unsigned int) references.size());
+	}
+}
+
+bool IfcFile::references_to(unsigned int id, const unsigned int*& begin, const unsigned int*& end, const unsigned char*& attributes) const {
+	entities_by_ref_t::const_iterator it = byref_modified.find(id);
+	if (it != byref_modified.end()) {
+		if (it->second.empty()) {
+			return false;
+		}
+		begin = &it->second.instances.front();
+		end = begin + it->second.size();
+		attributes = &it->second.attributes.front();
+		return true;
+	}
+	std::vector<unsigned int>::const_iterator jt = std::lower_bound(byref_ids.begin(), byref_ids.end(), id);
+	if (jt == byref_ids.end() || *jt != id) {
+		return false;
+	}
+	const size_t row = jt - byref_ids.begin();
+	begin = &byref_values[0] + byref_offsets[row];
+	end = &byref_values[0] + byref_offsets[row + 1];
+	attributes = &byref_attributes[0] + byref_offsets[row];
+	return true;
+}
+
+reference_row& IfcFile::modifiable_references_to(unsigned int id) {
+	// The row is returned to be modified, so the list of referencing
+	// instances assembled from it is no longer valid.
+	by_ref_cached_.erase(id);
+	entities_by_ref_t::iterator it = byref_modified.find(id);
+	if (it == byref_modified.end()) {
+		// The row is copied from the table before it is inserted, as
+		// references_to() gives precedence to the modified rows.
+		reference_row row;
+		const unsigned int *begin, *end;
+		const unsigned char* attributes;
+		if (references_to(id, begin, end, attributes)) {
+			row.instances.assign(begin, end);
+			row.attributes.assign(attributes, attributes + (end - begin));
+		}
+		it = byref_modified.insert(entities_by_ref_t::value_type(id, row)).first;
+	}
+	return it->second;
+}
+
+bool IfcFile::Init(IfcParse::IfcSpfStream* s, unsigned num_threads) {
+	// Initialize a "C" locale for locale-independent
+	// number parsing. See comment above on line 41.
+	init_locale();
+
+	stream = s;
+	if (!stream->valid) {
+		return false;
+	}
+
+	tokens = new IfcSpfLexer(stream, this);
+	if (!read_header()) {
+		return false;
+	}
+
+	scan_file(num_threads);
+
+	return true;
+}
+
+//
+// Scans the data section of the file, from the position of the lexer after
+// reading the header, and builds the indices of the instances from it.
+//
+void IfcFile::scan_file(unsigned num_threads) {
+	if (num_threads == 0) {
+		num_threads = (std::max)(boost::thread::hardware_concurrency(), 1U);
+	}
+
+	Logger::Status("Scanning file...");
+
+	stream->Advise(IfcSpfStream::ACCESS_SEQUENTIAL);
+
+	std::vector<scan_result> results;
+
+	if (num_threads == 1 || stream->eof) {
+		results.resize(1);
+		scan(tokens, true, results.front(), arena_);
+	} else {
+		const std::vector<size_t> boundaries = find_instance_boundaries(stream, stream->Tell(), stream->size, num_threads);
+		const size_t num_parts = boundaries.size() - 1;
+		results.resize(num_parts);
+
+		// Every thread allocates instances from its own arena
+		std::vector<IfcArena*> arenas(num_parts);
+
+		boost::thread_group threads;
+		for (size_t i = 0; i < num_parts; ++i) {
+			threads.create_thread(boost::bind(&IfcFile::scan_part, this, boundaries[i], boundaries[i + 1], boost::ref(results[i]), boost::ref(arenas[i])));
+		}
+		threads.join_all();
+
+		for (std::vector<IfcArena*>::const_iterator it = arenas.begin(); it != arenas.end(); ++it) {
+			arena_.splice(**it);
+			delete *it;
+		}
+	}
+
+	size_t num_instances = 0, num_guids = 0;
+	for (std::vector<scan_result>::const_iterator it = results.begin(); it != results.end(); ++it) {
+		num_instances += it->instances.size();
+		num_guids += it->guids.size();
+	}
+	byid.reserve(byid.size() + num_instances);
+	byguid.reserve(byguid.size() + num_guids);
+
+	for (std::vector<scan_result>::const_iterator it = results.begin(); it != results.end(); ++it) {
+		merge(*it);
+	}
+
+	build_reference_index(results);
+
+	if (!eager_supertype_index_) {
+		create_supertype_lists();
+	}
+
+	// After scanning, instances are loaded in arbitrary order
+	stream->Advise(IfcSpfStream::ACCESS_RANDOM);
+
+	// Parsing is marked as complete prior to reading the GlobalIds below, so
+	// that loading the attributes does not register the references again.
+	parsing_complete_ = true;
+
+	for (std::vector<scan_result>::const_iterator it = results.begin(); it != results.end(); ++it) {
+		index_guids(*it);
+	}
+
+	Logger::Status("\rDone scanning file   ");
+}
+
+void IfcFile::create_supertype_lists() {
+	for (size_t i = 0; i < bytype_excl.size(); ++i) {
+		if (!bytype_excl[i]) continue;
+		for (boost::optional<IfcSchema::Type::Enum> ty = (IfcSchema::Type::Enum) i; ty; ty = IfcSchema::Type::Parent(*ty)) {
+			if (!bytype[*ty]) {
+				bytype[*ty] = IfcEntityList::ptr(new IfcEntityList());
+				bytype_complete[*ty] = false;
+			}
+		}
+	}
+}
+
+bool IfcFile::read_header() {
+	_header.file(this);
+	_header.tryRead();
+
+	std::vector<std::string> schemas;
+	try {
+		schemas = _header.file_schema().schema_identifiers();
+	} catch (...) {
+		// Purposely empty catch block
+	}
+
+	if (schemas.size() != 1 || schemas[0] != IfcSchema::Identifier) {
+		Logger::Message(Logger::LOG_ERROR, "File schema encountered ("
+			+ boost::algorithm::join(schemas, ", ") + ") different from expected "
+			+ std::string(IfcSchema::Identifier) + ".");
+		return false;
+	}
+
+	return true;
+}
+
+void IfcFile::index_guids(const scan_result& result) {
+	for (std::vector< std::pair<IfcSchema::IfcRoot*, boost::optional<std::string> > >::const_iterator it = result.guids.begin(); it != result.guids.end(); ++it) {
+		IfcSchema::IfcRoot* ifc_root = it->first;
+		try {
+			// Only instances for which the GlobalId could not be read from
+			// the token stream, e.g. due to invalid data, are loaded here.
+			const std::string guid = it->second ? *it->second : ifc_root->GlobalId();
+			if ( index_guid(guid, ifc_root) ) {
+				std::stringstream ss;
+				ss << "Instance encountered with non-unique GlobalId " << guid;
+				Logger::Message(Logger::LOG_WARNING,ss.str());
+			}
+		} catch (const IfcException& ex) {
+			Logger::Message(Logger::LOG_ERROR,ex.what());
+		}
+	}
+}
+
+//
+// The records of both versions are matched by instance name and compared by the
+// hash of their contents. The records of the current version are found in its
+// buffer at this point rather than while scanning, so that reading files that
+// are never updated does not take any longer.
+//
+bool IfcFile::update(IfcParse::IfcSpfStream* s, change_set& changes) {
+	init_locale();
+
+	changes = change_set();
+
+	if (!s->valid) {
+		delete s;
+		return false;
+	}
+
+	std::vector<instance_record> previous_records, records;
+	if (stream) {
+		find_instance_records(stream, 0, stream->size, previous_records);
+	}
+	find_instance_records(s, 0, s->size, records);
+
+	const std::vector<const instance_record*> previous_sorted = sort_instance_records(previous_records);
+	const std::vector<const instance_record*> sorted = sort_instance_records(records);
+
+	// The records of the new version to be parsed, indexed like records
+	std::vector<bool> parse(records.size(), false);
+	// The instances of unchanged records and of removed or modified records
+	std::vector< std::pair<IfcUtil::IfcBaseClass*, const instance_record*> > unchanged, previous_instances;
+
+	std::vector<const instance_record*>::const_iterator it = previous_sorted.begin(), jt = sorted.begin();
+	while (it != previous_sorted.end() || jt != sorted.end()) {
+		const instance_record* previous = 0;
+		const instance_record* current = 0;
+		if (jt == sorted.end() || (it != previous_sorted.end() && (*it)->id < (*jt)->id)) {
+			previous = *it++;
+			changes.removed.push_back(previous->id);
+		} else if (it == previous_sorted.end() || (*jt)->id < (*it)->id) {
+			current = *jt++;
+			changes.added.push_back(current->id);
+		} else {
+			previous = *it++;
+			current = *jt++;
+		}
+
+		entity_by_id_t::const_iterator instance = previous ? byid.find(previous->id) : byid.end();
+		if (previous && current) {
+			if (previous->hash == current->hash) {
+				if (instance != byid.end()) {
+					unchanged.push_back(std::make_pair(instance->second, current));
+				}
+				continue;
+			}
+			changes.modified.push_back(current->id);
+		}
+		if (instance != byid.end()) {
+			previous_instances.push_back(std::make_pair(instance->second, previous));
+		}
+		if (current) {
+			parse[current - &records.front()] = true;
+		}
+	}
+
+	// The GlobalIds and references of the instances to be removed are read while
+	// the previous version is still the one instances are loaded from.
+	std::vector< std::pair<std::string, IfcSchema::IfcRoot*> > previous_guids;
+	std::set<unsigned int> previous_ids, previously_referenced;
+	std::vector<unsigned int> names;
+	for (std::vector< std::pair<IfcUtil::IfcBaseClass*, const instance_record*> >::const_iterator kt = previous_instances.begin(); kt != previous_instances.end(); ++kt) {
+		if (kt->first->is(IfcSchema::Type::IfcRoot)) {
+			IfcSchema::IfcRoot* ifc_root = (IfcSchema::IfcRoot*) kt->first;
+			try {
+				const std::string guid = ifc_root->GlobalId();
+				if (find_guid(guid) == ifc_root) {
+					previous_guids.push_back(std::make_pair(guid, ifc_root));
+				}
+			} catch (const IfcException&) {}
+		}
+		names.clear();
+		referenced_instance_names(stream, *kt->second, names);
+		previously_referenced.insert(names.begin(), names.end());
+		previous_ids.insert(kt->first->entity->id());
+	}
+
+	IfcSpfLexer* previous_tokens = tokens;
+	IfcSpfStream* previous_stream = stream;
+
+	stream = s;
+	tokens = new IfcSpfLexer(stream, this);
+	if (!read_header()) {
+		delete stream;
+		delete tokens;
+		stream = previous_stream;
+		tokens = previous_tokens;
+		if (stream) {
+			stream->Seek(0);
+			read_header();
+		}
+		changes = change_set();
+		return false;
+	}
+
+	// Instances of unchanged records are now read from the new version. The
+	// attributes of instances that are already loaded refer to the previous
+	// version, which is therefore retained if there are any.
+	bool retain_previous_version = false;
+	for (std::vector< std::pair<IfcUtil::IfcBaseClass*, const instance_record*> >::const_iterator kt = unchanged.begin(); kt != unchanged.end(); ++kt) {
+		kt->first->entity->offset_in_file(kt->second->keyword);
+		retain_previous_version = retain_previous_version || kt->first->entity->loaded();
+	}
+	if (retain_previous_version) {
+		previous_versions_.push_back(std::make_pair(previous_tokens, previous_stream));
+	} else {
+		delete previous_stream;
+		delete previous_tokens;
+	}
+
+	// Rows can be referenced by many of the instances removed, e.g. the row of
+	// an IfcOwnerHistory, so every row is filtered in a single pass.
+	for (std::set<unsigned int>::const_iterator kt = previously_referenced.begin(); kt != previously_referenced.end(); ++kt) {
+		modifiable_references_to(*kt).erase_all(previous_ids);
+	}
+	for (std::vector< std::pair<std::string, IfcSchema::IfcRoot*> >::const_iterator kt = previous_guids.begin(); kt != previous_guids.end(); ++kt) {
+		erase_guid(kt->first);
+	}
+
+	// The types of which the lists including subtypes are affected
+	std::set<IfcSchema::Type::Enum> affected_types;
+	std::set<IfcUtil::IfcBaseClass*> removed;
+	std::set<IfcSchema::Type::Enum> removed_types;
+	for (std::vector< std::pair<IfcUtil::IfcBaseClass*, const instance_record*> >::const_iterator kt = previous_instances.begin(); kt != previous_instances.end(); ++kt) {
+		byid.erase(kt->first->entity->id());
+		removed.insert(kt->first);
+		removed_types.insert(kt->first->type());
+	}
+	for (std::set<IfcSchema::Type::Enum>::const_iterator kt = removed_types.begin(); kt != removed_types.end(); ++kt) {
+		IfcEntityList::ptr instances_of_same_type = bytype_excl[*kt];
+		instances_of_same_type->remove(removed);
+		if (instances_of_same_type->size() == 0) {
+			bytype_excl[*kt].reset();
+		}
+		for (boost::optional<IfcSchema::Type::Enum> ty = *kt; ty; ty = IfcSchema::Type::Parent(*ty)) {
+			affected_types.insert(*ty);
+		}
+	}
+	for (entity_entity_map_t::iterator kt = entity_file_map.begin(); kt != entity_file_map.end();) {
+		if (removed.find(kt->second) != removed.end()) {
+			entity_file_map.erase(kt++);
+		} else {
+			++kt;
+		}
 	}
 
-	if (!copy) {
-		return;
+	if (eager_supertype_index_) {
+		for (std::set<IfcSchema::Type::Enum>::const_iterator kt = affected_types.begin(); kt != affected_types.end(); ++kt) {
+			IfcEntityList::ptr instances_of_type = bytype[*kt];
+			instances_of_type->remove(removed);
+			if (instances_of_type->size() == 0) {
+				bytype[*kt].reset();
+			}
+		}
 	}
 
-	if (i < attributes_.size()) {
-		Argument* current_attribute = attributes_[i];
-		if (this->file) {
-			unregister_inverse_visitor visitor(*this->file, *this);
-			apply_individual_instance_visitor(current_attribute).apply(visitor);
+	// Consecutive records to be parsed are scanned at once
+	scan_result result;
+	for (size_t i = 0; i < records.size();) {
+		if (!parse[i]) {
+			++i;
+			continue;
 		}
-		delete attributes_[i];
+		size_t j = i + 1;
+		while (j < records.size() && parse[j]) ++j;
+		IfcSpfStream part(*stream, records[i].begin, records[j - 1].end);
+		IfcSpfLexer lexer(&part, this);
+		scan(&lexer, false, result, arena_);
+		i = j;
 	}
 
-	if (this->file) {
-		register_inverse_visitor visitor(*this->file, *this);
-		apply_individual_instance_visitor(copy).apply(visitor);
+	merge(result);
 
-		this->file->mark_entity_as_modified(id_);
+	for (std::vector<scanned_reference>::const_iterator kt = result.references.begin(); kt != result.references.end(); ++kt) {
+		modifiable_references_to(kt->referenced).push_back(kt->referencing, kt->attribute);
 	}
 
-	if (i < attributes_.size()) {
-		attributes_[i] = copy;
-	} else {
-		// We have asserted above that the size is at least i
-		attributes_.push_back(copy);
+	if (!eager_supertype_index_) {
+		// The lists including subtypes of the affected types are assembled
+		// again on demand, starting from empty lists as after scanning.
+		for (std::vector<IfcUtil::IfcBaseClass*>::const_iterator kt = result.instances.begin(); kt != result.instances.end(); ++kt) {
+			for (boost::optional<IfcSchema::Type::Enum> ty = (*kt)->type(); ty; ty = IfcSchema::Type::Parent(*ty)) {
+				affected_types.insert(*ty);
+			}
+		}
+		for (std::set<IfcSchema::Type::Enum>::const_iterator kt = affected_types.begin(); kt != affected_types.end(); ++kt) {
+			bytype[*kt].reset();
+			bytype_complete[*kt] = false;
+		}
+		create_supertype_lists();
 	}
-}
 
-//
-// Parses the IFC file in fn
-// Creates the maps
-//
-#ifdef USE_MMAP
-bool IfcFile::Init(const std::string& fn, bool mmap) {
-	return IfcFile::Init(new IfcSpfStream(fn, mmap));
-}
-#else
-bool IfcFile::Init(const std::string& fn) {
-	return IfcFile::Init(new IfcSpfStream(fn));
-}
-#endif
+	stream->Advise(IfcSpfStream::ACCESS_RANDOM);
+	parsing_complete_ = true;
 
-bool IfcFile::Init(std::istream& f, int len) {
-	return IfcFile::Init(new IfcSpfStream(f,len));
+	index_guids(result);
+
+	return true;
 }
 
-bool IfcFile::Init(void* data, int len) {
-	return IfcFile::Init(new IfcSpfStream(data,len));
+namespace {
+	// Identifies the files written by IfcFile::writeIndex(), the version is to
+	// be incremented whenever the layout of the index changes.
+	const char index_magic[8] = { 'I', 'F', 'C', 'I', 'N', 'D', 'E', 'X' };
+	const boost::uint32_t index_version = 1;
+
+	template <typename T>
+	void write_index_value(std::ostream& os, const T& t) {
+		os.write((const char*) &t, sizeof(T));
+	}
+
+	// The tables are added to a checksum, which is verified before the index
+	// is used, as an index that is corrupt would otherwise only be noticed when
+	// the instances are read.
+	template <typename T>
+	void write_index_vector(std::ostream& os, const std::vector<T>& v, record_hash& checksum) {
+		const boost::uint64_t n = v.size();
+		write_index_value(os, n);
+		checksum.add((const char*) &n, sizeof(n));
+		if (!v.empty()) {
+			os.write((const char*) &v.front(), v.size() * sizeof(T));
+			checksum.add((const char*) &v.front(), v.size() * sizeof(T));
+		}
+	}
+
+	template <typename T>
+	bool read_index_value(std::istream& is, T& t) {
+		return !!is.read((char*) &t, sizeof(T));
+	}
+
+	// The number of elements is checked against the size of the index, so that
+	// a corrupt index does not result in an excessive allocation.
+	template <typename T>
+	bool read_index_vector(std::istream& is, boost::uint64_t index_size, std::vector<T>& v, record_hash& checksum) {
+		boost::uint64_t n;
+		if (!read_index_value(is, n) || n > index_size / sizeof(T)) {
+			return false;
+		}
+		checksum.add((const char*) &n, sizeof(n));
+		v.resize((size_t) n);
+		if (n != 0 && !is.read((char*) &v.front(), (std::streamsize) (n * sizeof(T)))) {
+			return false;
+		}
+		if (n != 0) {
+			checksum.add((const char*) &v.front(), v.size() * sizeof(T));
+		}
+		return true;
+	}
+
+	//
+	// Returns a hash of blocks of the contents of the file evenly spread over the
+	// file, including the first and the last, so that an index can be matched to
+	// the file without reading the file in its entirety.
+	//
+	boost::uint64_t file_fingerprint(IfcSpfStream* stream) {
+		const size_t block_size = 4096, num_blocks = 64;
+		record_hash hash;
+		if (stream->size <= block_size * num_blocks) {
+			for (size_t i = 0; i < stream->size; ++i) {
+				hash.add(stream->Read(i));
+			}
+		} else {
+			const size_t stride = (stream->size - block_size) / (num_blocks - 1);
+			for (size_t i = 0; i < num_blocks; ++i) {
+				for (size_t j = i * stride; j < i * stride + block_size; ++j) {
+					hash.add(stream->Read(j));
+				}
+			}
+		}
+		return hash.value();
+	}
+
+	struct instance_offset_sorter {
+		bool operator()(const IfcUtil::IfcBaseClass* a, const IfcUtil::IfcBaseClass* b) const {
+			return a->entity->offset_in_file() < b->entity->offset_in_file();
+		}
+	};
 }
 
-bool IfcFile::Init(IfcParse::IfcSpfStream* s) {
-	// Initialize a "C" locale for locale-independent
-	// number parsing. See comment above on line 41.
+bool IfcFile::Init(IfcParse::IfcSpfStream* s, const std::string& index_fn, bool write_index, unsigned num_threads) {
 	init_locale();
 
 	stream = s;
@@ -1253,127 +3127,270 @@ bool IfcFile::Init(IfcParse::IfcSpfStream* s) {
 	}
 
 	tokens = new IfcSpfLexer(stream, this);
-	_header.file(this);
-	_header.tryRead();
-
-	std::vector<std::string> schemas;
-	try {
-		schemas = _header.file_schema().schema_identifiers();
-	} catch (...) {
-		// Purposely empty catch block
+	if (!read_header()) {
+		return false;
 	}
 
-	if (schemas.size() != 1 || schemas[0] != IfcSchema::Identifier) {
-		Logger::Message(Logger::LOG_ERROR, "File schema encountered ("
-			+ boost::algorithm::join(schemas, ", ") + ") different from expected "
-			+ std::string(IfcSchema::Identifier) + ".");
-		return false;
+	if (read_index(index_fn)) {
+		return true;
 	}
 
-	boost::circular_buffer<Token> token_stream(3, Token());
+	scan_file(num_threads);
 
-	IfcEntityInstanceData* data;
-	IfcUtil::IfcBaseClass* instance = 0;
+	if (write_index && !writeIndex(index_fn)) {
+		Logger::Message(Logger::LOG_WARNING, "Failed to write index " + index_fn);
+	}
 
-	unsigned current_id = 0;
-	int progress = 0;
-	Logger::Status("Scanning file...");
-	
-	while (!stream->eof) {
-		if (token_stream[0].type == IfcParse::Token_IDENTIFIER &&
-			token_stream[1].type == IfcParse::Token_OPERATOR &&
-			token_stream[1].value_char == '=' &&
-			token_stream[2].type == IfcParse::Token_KEYWORD)
-		{
-			current_id = (unsigned) TokenFunc::asIdentifier(token_stream[0]);
-			IfcSchema::Type::Enum entity_type;
-			try {
-				entity_type = IfcSchema::Type::FromString(TokenFunc::asStringRef(token_stream[2]));
-			} catch (const IfcException& ex) {
-				Logger::Message(Logger::LOG_ERROR, ex.what());
-				goto advance;
-			}		
-				
-			data = new IfcEntityInstanceData(entity_type, this, current_id, token_stream[2].startPos);
-			instance = IfcSchema::SchemaEntity(data);
+	return true;
+}
 
-            /// @todo Printing to stdout in a library class feels weird. Maybe move the progress prints to the client code?
-			// Update the status after every 1000 instances parsed
-			if (!((++progress) % 1000)) {
-				std::stringstream ss; ss << "\r#" << current_id;
-				Logger::Status(ss.str(), false);
-			}
+//
+// The index consists of the key by which it is matched to the file, followed by
+// the instances in the order in which they occur in the file, the table of
+// references and the GlobalIds. Every table is written as a number of elements
+// followed by the elements as they are laid out in memory, so the index is only
+// to be read on a platform of the same endianness, which is not checked.
+//
+bool IfcFile::writeIndex(const std::string& index_fn) {
+	if (!stream) {
+		return false;
+	}
 
-			if (instance->is(IfcSchema::Type::IfcRoot)) {
-				IfcSchema::IfcRoot* ifc_root = (IfcSchema::IfcRoot*) instance;
-				try {
-					const std::string guid = ifc_root->GlobalId();
-					if ( byguid.find(guid) != byguid.end() ) {
-						std::stringstream ss;
-						ss << "Instance encountered with non-unique GlobalId " << guid;
-						Logger::Message(Logger::LOG_WARNING,ss.str());
-					}
-					byguid[guid] = ifc_root;
-				} catch (const IfcException& ex) {
-					Logger::Message(Logger::LOG_ERROR,ex.what());
-				}
-			}
+	std::vector<IfcUtil::IfcBaseClass*> instances;
+	instances.reserve(byid.size());
+	for (entity_by_id_t::const_iterator it = byid.begin(); it != byid.end(); ++it) {
+		// Instances added after reading the file are not located in the file
+		if (!arena_.owns(it->second) || it->second->entity->offset_in_file() == 0) {
+			return false;
+		}
+		instances.push_back(it->second);
+	}
+	std::sort(instances.begin(), instances.end(), instance_offset_sorter());
+
+	std::vector<boost::uint32_t> ids, types;
+	std::vector<boost::uint64_t> offsets;
+	ids.reserve(instances.size());
+	types.reserve(instances.size());
+	offsets.reserve(instances.size());
+	for (std::vector<IfcUtil::IfcBaseClass*>::const_iterator it = instances.begin(); it != instances.end(); ++it) {
+		ids.push_back((*it)->entity->id());
+		types.push_back((*it)->type());
+		offsets.push_back((*it)->entity->offset_in_file());
+	}
 
-			IfcSchema::Type::Enum ty = instance->type();
+	// The rows that were modified after building the table are merged into it
+	std::vector<unsigned int> modified_ids, row_ids;
+	for (entities_by_ref_t::const_iterator it = byref_modified.begin(); it != byref_modified.end(); ++it) {
+		modified_ids.push_back(it->first);
+	}
+	std::set_union(byref_ids.begin(), byref_ids.end(), modified_ids.begin(), modified_ids.end(), std::back_inserter(row_ids));
+
+	std::vector<unsigned int> ref_ids, ref_offsets(1, 0), ref_values;
+	std::vector<unsigned char> ref_attributes;
+	ref_ids.reserve(row_ids.size());
+	ref_offsets.reserve(row_ids.size() + 1);
+	ref_values.reserve(byref_values.size());
+	ref_attributes.reserve(byref_attributes.size());
+	for (std::vector<unsigned int>::const_iterator it = row_ids.begin(); it != row_ids.end(); ++it) {
+		const unsigned int *begin, *end;
+		const unsigned char* attributes;
+		if (references_to(*it, begin, end, attributes)) {
+			ref_ids.push_back(*it);
+			ref_values.insert(ref_values.end(), begin, end);
+			ref_attributes.insert(ref_attributes.end(), attributes, attributes + (end - begin));
+			ref_offsets.push_back((unsigned int) ref_values.size());
+		}
+	}
 
-			{
-				IfcEntityList::ptr instances_by_type = entitiesByTypeExclSubtypes(ty);
-				if (!instances_by_type) {
-					instances_by_type = IfcEntityList::ptr(new IfcEntityList());
-					bytype_excl[ty] = instances_by_type;
-				}
-				instances_by_type->push(instance);
-			}
+	std::vector<boost::uint64_t> guid_high, guid_low;
+	std::vector<boost::uint32_t> guid_ids;
+	guid_high.reserve(byguid.size());
+	guid_low.reserve(byguid.size());
+	guid_ids.reserve(byguid.size());
+	for (entity_by_guid_t::const_iterator it = byguid.begin(); it != byguid.end(); ++it) {
+		guid_high.push_back(it->first.high);
+		guid_low.push_back(it->first.low);
+		guid_ids.push_back(it->second->entity->id());
+	}
 
-			for (;;) {
-				IfcEntityList::ptr instances_by_type = entitiesByType(ty);
-				if (!instances_by_type) {
-					instances_by_type = IfcEntityList::ptr(new IfcEntityList());
-					bytype[ty] = instances_by_type;
-				}
-				instances_by_type->push(instance);
-				boost::optional<IfcSchema::Type::Enum> pt = IfcSchema::Type::Parent(ty);
-				if (pt) {
-					ty = *pt;
-				} else {
-					break;
-				}
-			}
+	std::vector<char> unpacked_guids;
+	std::vector<boost::uint32_t> unpacked_guid_lengths, unpacked_guid_ids;
+	for (entity_by_unpacked_guid_t::const_iterator it = byguid_unpacked.begin(); it != byguid_unpacked.end(); ++it) {
+		unpacked_guids.insert(unpacked_guids.end(), it->first.begin(), it->first.end());
+		unpacked_guid_lengths.push_back((boost::uint32_t) it->first.size());
+		unpacked_guid_ids.push_back(it->second->entity->id());
+	}
 
-			if (byid.find(current_id) != byid.end()) {
-				std::stringstream ss;
-				ss << "Overwriting instance with name #" << current_id;
-				Logger::Message(Logger::LOG_WARNING,ss.str());
-			}
-			byid[current_id] = instance;
-			
-			MaxId = (std::max)(MaxId, current_id);
-		} else if (token_stream[0].type == IfcParse::Token_IDENTIFIER && instance) {
-			register_inverse(current_id, token_stream[0]);
+	const std::string schema = IfcSchema::Identifier;
+
+	// The index is written to a temporary file first, so that a partially
+	// written index is never encountered
+	const std::string temp_fn = index_fn + ".tmp";
+	{
+		std::ofstream os(IfcUtil::path::from_utf8(temp_fn).c_str(), std::ios_base::binary);
+		if (!os) {
+			return false;
 		}
 
-	advance:
-		Token next_token;
-		try {
-			next_token = tokens->Next();
-		} catch (const IfcException& e) {
-			Logger::Message(Logger::LOG_ERROR, std::string(e.what()) + ". Parsing terminated");
-		} catch (...) {
-			Logger::Message(Logger::LOG_ERROR, "Parsing terminated");
+		os.write(index_magic, sizeof(index_magic));
+		write_index_value(os, index_version);
+		record_hash checksum;
+		write_index_vector(os, std::vector<char>(schema.begin(), schema.end()), checksum);
+		write_index_value(os, (boost::uint64_t) stream->size);
+		write_index_value(os, (boost::int64_t) stream->modification_time);
+		write_index_value(os, file_fingerprint(stream));
+
+		write_index_vector(os, ids, checksum);
+		write_index_vector(os, types, checksum);
+		write_index_vector(os, offsets, checksum);
+
+		write_index_vector(os, ref_ids, checksum);
+		write_index_vector(os, ref_offsets, checksum);
+		write_index_vector(os, ref_values, checksum);
+		write_index_vector(os, ref_attributes, checksum);
+
+		write_index_vector(os, guid_high, checksum);
+		write_index_vector(os, guid_low, checksum);
+		write_index_vector(os, guid_ids, checksum);
+		write_index_vector(os, unpacked_guids, checksum);
+		write_index_vector(os, unpacked_guid_lengths, checksum);
+		write_index_vector(os, unpacked_guid_ids, checksum);
+
+		write_index_value(os, checksum.value());
+		os.write(index_magic, sizeof(index_magic));
+
+		if (!os.flush()) {
+			return false;
 		}
+	}
 
-		if (next_token.type == Token_NONE) break;
+	return IfcUtil::path::rename_file(temp_fn, index_fn);
+}
 
-		token_stream.push_back(next_token);
+//
+// The index is read and validated in its entirety before any of the indices of
+// the file are populated from it, so that the file can still be scanned when it
+// turns out to be invalid.
+//
+bool IfcFile::read_index(const std::string& index_fn) {
+	std::ifstream is(IfcUtil::path::from_utf8(index_fn).c_str(), std::ios_base::binary);
+	if (!is) {
+		return false;
 	}
 
-	Logger::Status("\rDone scanning file   ");
+	is.seekg(0, std::ios_base::end);
+	const boost::uint64_t index_size = (boost::uint64_t) is.tellg();
+	is.seekg(0, std::ios_base::beg);
+
+	char magic[sizeof(index_magic)];
+	boost::uint32_t version;
+	std::vector<char> schema;
+	boost::uint64_t file_size, fingerprint;
+	boost::int64_t modification_time;
+	record_hash checksum;
+
+	if (!is.read(magic, sizeof(magic)) || std::memcmp(magic, index_magic, sizeof(magic)) != 0 ||
+		!read_index_value(is, version) || version != index_version ||
+		!read_index_vector(is, index_size, schema, checksum) || std::string(schema.begin(), schema.end()) != IfcSchema::Identifier ||
+		!read_index_value(is, file_size) || file_size != stream->size ||
+		!read_index_value(is, modification_time) || modification_time != (boost::int64_t) stream->modification_time ||
+		!read_index_value(is, fingerprint))
+	{
+		return false;
+	}
+
+	// The contents of the file are only hashed when the other properties match
+	if (fingerprint != file_fingerprint(stream)) {
+		return false;
+	}
+
+	std::vector<boost::uint32_t> ids, types;
+	std::vector<boost::uint64_t> offsets;
+	std::vector<unsigned int> ref_ids, ref_offsets, ref_values;
+	std::vector<unsigned char> ref_attributes;
+	std::vector<boost::uint64_t> guid_high, guid_low;
+	std::vector<boost::uint32_t> guid_ids;
+	std::vector<char> unpacked_guids;
+	std::vector<boost::uint32_t> unpacked_guid_lengths, unpacked_guid_ids;
+	boost::uint64_t stored_checksum;
+
+	if (!read_index_vector(is, index_size, ids, checksum) ||
+		!read_index_vector(is, index_size, types, checksum) ||
+		!read_index_vector(is, index_size, offsets, checksum) ||
+		!read_index_vector(is, index_size, ref_ids, checksum) ||
+		!read_index_vector(is, index_size, ref_offsets, checksum) ||
+		!read_index_vector(is, index_size, ref_values, checksum) ||
+		!read_index_vector(is, index_size, ref_attributes, checksum) ||
+		!read_index_vector(is, index_size, guid_high, checksum) ||
+		!read_index_vector(is, index_size, guid_low, checksum) ||
+		!read_index_vector(is, index_size, guid_ids, checksum) ||
+		!read_index_vector(is, index_size, unpacked_guids, checksum) ||
+		!read_index_vector(is, index_size, unpacked_guid_lengths, checksum) ||
+		!read_index_vector(is, index_size, unpacked_guid_ids, checksum) ||
+		!read_index_value(is, stored_checksum) ||
+		!is.read(magic, sizeof(magic)) || std::memcmp(magic, index_magic, sizeof(magic)) != 0)
+	{
+		Logger::Message(Logger::LOG_WARNING, "Ignoring truncated index " + index_fn);
+		return false;
+	}
 
+	bool consistent = stored_checksum == checksum.value() &&
+		types.size() == ids.size() && offsets.size() == ids.size() &&
+		ref_offsets.size() == ref_ids.size() + 1 && ref_offsets.front() == 0 && ref_offsets.back() == ref_values.size() &&
+		ref_attributes.size() == ref_values.size() &&
+		guid_low.size() == guid_high.size() && guid_ids.size() == guid_high.size() &&
+		unpacked_guid_ids.size() == unpacked_guid_lengths.size();
+	for (size_t i = 0; consistent && i < ids.size(); ++i) {
+		consistent = types[i] < bytype_excl.size() && offsets[i] > 0 && offsets[i] < stream->size;
+	}
+	size_t unpacked_guids_length = 0;
+	for (size_t i = 0; consistent && i < unpacked_guid_lengths.size(); ++i) {
+		unpacked_guids_length += unpacked_guid_lengths[i];
+	}
+	if (!consistent || unpacked_guids_length != unpacked_guids.size()) {
+		Logger::Message(Logger::LOG_WARNING, "Ignoring inconsistent index " + index_fn);
+		return false;
+	}
+
+	scan_result result;
+	result.instances.reserve(ids.size());
+	for (size_t i = 0; i < ids.size(); ++i) {
+		IfcEntityInstanceData* data = new (&arena_) IfcEntityInstanceData((IfcSchema::Type::Enum) types[i], this, ids[i], (size_t) offsets[i], &arena_);
+		result.instances.push_back(IfcSchema::SchemaEntity(data, &arena_));
+	}
+	byid.reserve(byid.size() + ids.size());
+	merge(result);
+
+	byref_ids.swap(ref_ids);
+	byref_offsets.swap(ref_offsets);
+	byref_values.swap(ref_values);
+	byref_attributes.swap(ref_attributes);
+
+	byguid.reserve(byguid.size() + guid_ids.size());
+	for (size_t i = 0; i < guid_ids.size(); ++i) {
+		entity_by_id_t::const_iterator it = byid.find(guid_ids[i]);
+		if (it != byid.end() && it->second->is(IfcSchema::Type::IfcRoot)) {
+			packed_guid packed;
+			packed.high = guid_high[i];
+			packed.low = guid_low[i];
+			byguid[packed] = (IfcSchema::IfcRoot*) it->second;
+		}
+	}
+	std::vector<char>::const_iterator unpacked_guid = unpacked_guids.begin();
+	for (size_t i = 0; i < unpacked_guid_ids.size(); ++i) {
+		const std::string guid(unpacked_guid, unpacked_guid + unpacked_guid_lengths[i]);
+		unpacked_guid += unpacked_guid_lengths[i];
+		entity_by_id_t::const_iterator it = byid.find(unpacked_guid_ids[i]);
+		if (it != byid.end() && it->second->is(IfcSchema::Type::IfcRoot)) {
+			byguid_unpacked[guid] = (IfcSchema::IfcRoot*) it->second;
+		}
+	}
+
+	if (!eager_supertype_index_) {
+		create_supertype_lists();
+	}
+
+	stream->Advise(IfcSpfStream::ACCESS_RANDOM);
 	parsing_complete_ = true;
 
 	return true;
@@ -1428,7 +3445,8 @@ IfcEntityList::ptr IfcFile::traverse(IfcUtil::IfcBaseClass* instance, int max_le
 
 void IfcFile::mark_entity_as_modified(int /*id*/)
 {
-	by_ref_cached_.clear();
+	// The cached lists of referencing instances are invalidated by
+	// modifiable_references_to() for the rows that are modified.
 }
 
 void IfcFile::addEntities(IfcEntityList::ptr es) {
@@ -1569,12 +3587,11 @@ IfcUtil::IfcBaseClass* IfcFile::addEntity(IfcUtil::IfcBaseClass* entity) {
 		IfcSchema::IfcRoot* ifc_root = (IfcSchema::IfcRoot*) new_entity;
 		try {
 			const std::string guid = ifc_root->GlobalId();
-			if ( byguid.find(guid) != byguid.end() ) {
+			if ( index_guid(guid, ifc_root) ) {
 				std::stringstream ss;
 				ss << "Overwriting entity with guid " << guid;
 				Logger::Message(Logger::LOG_WARNING,ss.str());
 			}
-			byguid[guid] = ifc_root;
 		} catch (const IfcException& ex) {
 			Logger::Message(Logger::LOG_ERROR,ex.what());
 		}
@@ -1593,12 +3610,16 @@ IfcUtil::IfcBaseClass* IfcFile::addEntity(IfcUtil::IfcBaseClass* entity) {
 	}
 
 	for (;;) {
-		IfcEntityList::ptr instances_by_type = entitiesByType(ty);
+		IfcEntityList::ptr& instances_by_type = bytype[ty];
 		if (!instances_by_type) {
 			instances_by_type = IfcEntityList::ptr(new IfcEntityList());
-			bytype[ty] = instances_by_type;
+			bytype_complete[ty] = true;
+		}
+		// Lists that are not populated yet will include the instance
+		// by means of the list of its exact type.
+		if (bytype_complete[ty]) {
+			instances_by_type->push(new_entity);
 		}
-		instances_by_type->push(new_entity);
 		boost::optional<IfcSchema::Type::Enum> pt = IfcSchema::Type::Parent(ty);
 		if (pt) {
 			ty = *pt;
@@ -1629,25 +3650,30 @@ IfcUtil::IfcBaseClass* IfcFile::addEntity(IfcUtil::IfcBaseClass* entity) {
 		byid[new_id] = new_entity;
 	}
 
-	// The mapping by reference is updated.
-	IfcEntityList::ptr entity_attributes(new IfcEntityList);
+	// The mapping by reference is updated, once for every instance
+	// referenced by an attribute.
 	try {
-		entity_attributes = traverse(new_entity, 1);
-	} catch (const std::exception& e) {
-		Logger::Error(e);
-	}
-
-	for (IfcEntityList::it it = entity_attributes->begin(); it != entity_attributes->end(); ++it) {
-		IfcUtil::IfcBaseClass* entity_attribute = *it;
-		if (*it == new_entity) continue;
-		try {
-			if (!IfcSchema::Type::IsSimple(entity_attribute->type())) {
-				unsigned entity_attribute_id = entity_attribute->entity->id();
-				byref[entity_attribute_id].push_back(new_entity->entity->id());
+		const unsigned new_id = new_entity->entity->id();
+		const unsigned count = new_entity->entity->getArgumentCount();
+		for (unsigned i = 0; i < count; ++i) {
+			IfcEntityList::ptr entity_attributes(new IfcEntityList);
+			add_to_instance_list_visitor visitor(entity_attributes);
+			apply_individual_instance_visitor(new_entity->entity->getArgument(i)).apply(visitor);
+			std::set<IfcUtil::IfcBaseClass*> visited;
+			for (IfcEntityList::it it = entity_attributes->begin(); it != entity_attributes->end(); ++it) {
+				IfcUtil::IfcBaseClass* entity_attribute = *it;
+				if (entity_attribute == new_entity || !visited.insert(entity_attribute).second) continue;
+				try {
+					if (!IfcSchema::Type::IsSimple(entity_attribute->type())) {
+						modifiable_references_to(entity_attribute->entity->id()).push_back(new_id, i);
+					}
+				} catch (const std::exception& e) {
+					Logger::Error(e);
+				}
 			}
-		} catch (const std::exception& e) {
-			Logger::Error(e);
 		}
+	} catch (const std::exception& e) {
+		Logger::Error(e);
 	}
 
 	return new_entity;
@@ -1724,7 +3750,7 @@ void IfcFile::removeEntity(IfcUtil::IfcBaseClass* entity) {
 				}
 			}
 		}
-		byref.erase(byref.find(id));
+		modifiable_references_to(id).clear();
 	}
 
 	IfcEntityList::ptr entity_attributes = traverse(entity, 1);
@@ -1734,17 +3760,17 @@ void IfcFile::removeEntity(IfcUtil::IfcBaseClass* entity) {
 		const unsigned int name = entity_attribute->entity->id();
 		// Do not update inverses for simple types (which have id()==0 in IfcOpenShell).
 		if (name != 0) {
-			entities_by_ref_t::iterator byref_it = byref.find(name);
-			if (byref_it != byref.end()) {
-				std::vector<unsigned>& ids = byref_it->second;
-				ids.erase(std::remove(ids.begin(), ids.end(), id), ids.end());
+			const unsigned int *begin, *end;
+			const unsigned char* attributes;
+			if (references_to(name, begin, end, attributes)) {
+				modifiable_references_to(name).erase_all(id);
 			}
 		}
 	}
 
 	if (entity->is(IfcSchema::Type::IfcRoot)) {
 		const std::string global_id = ((IfcSchema::IfcRoot*) entity)->GlobalId();
-		byguid.erase(byguid.find(global_id));
+		erase_guid(global_id);
 	}
 	
 	byid.erase(byid.find(id));
@@ -1755,7 +3781,7 @@ void IfcFile::removeEntity(IfcUtil::IfcBaseClass* entity) {
 		IfcEntityList::ptr instances_of_same_type = entitiesByTypeExclSubtypes(ty);
 		instances_of_same_type->remove(entity);
 		if (instances_of_same_type->size() == 0) {
-			bytype_excl.erase(ty);
+			bytype_excl[ty].reset();
 		}
 	}
 
@@ -1765,7 +3791,7 @@ void IfcFile::removeEntity(IfcUtil::IfcBaseClass* entity) {
 			instances_of_same_type->remove(entity);
 		}
 		if (instances_of_same_type->size() == 0) {
-			bytype.erase(ty);
+			bytype[ty].reset();
 		}
 		boost::optional<IfcSchema::Type::Enum> pt = IfcSchema::Type::Parent(ty);
 		if (pt) {
@@ -1775,18 +3801,72 @@ void IfcFile::removeEntity(IfcUtil::IfcBaseClass* entity) {
 		}
 	}
 	
-	delete entity->entity;
-	delete entity;
+	// Instances read from the file are released along with the arena
+	if (!arena_.owns(entity)) {
+		delete entity->entity;
+		delete entity;
+	}
+}
+
+namespace {
+	std::vector< std::vector<IfcSchema::Type::Enum> > build_direct_subtypes() {
+		std::vector< std::vector<IfcSchema::Type::Enum> > subtypes(IfcSchema::Type::UNDEFINED);
+		for (int i = 0; i < IfcSchema::Type::UNDEFINED; ++i) {
+			boost::optional<IfcSchema::Type::Enum> pt = IfcSchema::Type::Parent((IfcSchema::Type::Enum) i);
+			if (pt) {
+				subtypes[*pt].push_back((IfcSchema::Type::Enum) i);
+			}
+		}
+		return subtypes;
+	}
+
+	// Returns the direct subtypes of all types in the schema
+	const std::vector< std::vector<IfcSchema::Type::Enum> >& direct_subtypes() {
+		static const std::vector< std::vector<IfcSchema::Type::Enum> > subtypes = build_direct_subtypes();
+		return subtypes;
+	}
+
+	// Collects the lists of instances of the type and its subtypes
+	void collect_instances_by_type(const IfcFile::entities_by_type_t& bytype_excl, IfcSchema::Type::Enum t, std::vector<IfcEntityList*>& lists) {
+		if (bytype_excl[t]) {
+			lists.push_back(bytype_excl[t].get());
+		}
+		const std::vector<IfcSchema::Type::Enum>& subtypes = direct_subtypes()[t];
+		for (std::vector<IfcSchema::Type::Enum>::const_iterator it = subtypes.begin(); it != subtypes.end(); ++it) {
+			collect_instances_by_type(bytype_excl, *it, lists);
+		}
+	}
 }
 
 IfcEntityList::ptr IfcFile::entitiesByType(IfcSchema::Type::Enum t) {
-	entities_by_type_t::const_iterator it = bytype.find(t);
-	return (it == bytype.end()) ? IfcEntityList::ptr() : it->second;
+	if ((size_t) t >= bytype.size()) {
+		return IfcEntityList::ptr();
+	}
+	if (eager_supertype_index_) {
+		return bytype[t];
+	}
+	boost::mutex::scoped_lock lock(index_mutex_);
+	const IfcEntityList::ptr& instances_by_type = bytype[t];
+	if (instances_by_type && !bytype_complete[t]) {
+		std::vector<IfcEntityList*> lists;
+		collect_instances_by_type(bytype_excl, t, lists);
+		unsigned size = 0;
+		for (std::vector<IfcEntityList*>::const_iterator it = lists.begin(); it != lists.end(); ++it) {
+			size += (*it)->size();
+		}
+		instances_by_type->reserve(size);
+		for (std::vector<IfcEntityList*>::const_iterator it = lists.begin(); it != lists.end(); ++it) {
+			for (IfcEntityList::it jt = (*it)->begin(); jt != (*it)->end(); ++jt) {
+				instances_by_type->push(*jt);
+			}
+		}
+		bytype_complete[t] = true;
+	}
+	return instances_by_type;
 }
 
 IfcEntityList::ptr IfcFile::entitiesByTypeExclSubtypes(IfcSchema::Type::Enum t) {
-	entities_by_type_t::const_iterator it = bytype_excl.find(t);
-	return (it == bytype_excl.end()) ? IfcEntityList::ptr() : it->second;
+	return ((size_t) t < bytype_excl.size()) ? bytype_excl[t] : IfcEntityList::ptr();
 }
 
 IfcEntityList::ptr IfcFile::entitiesByType(const std::string& t) {
@@ -1794,24 +3874,26 @@ IfcEntityList::ptr IfcFile::entitiesByType(const std::string& t) {
 }
 
 IfcEntityList::ptr IfcFile::entitiesByReference(int t) {
-	entities_by_ref_t::const_iterator it = byref.find(t);
 	IfcEntityList::ptr ret;
-	if (it != byref.end()) {
-        ref_map_t::const_iterator cached_it = by_ref_cached_.find(t);
-        if (cached_it != by_ref_cached_.end()) {
-            ret = cached_it->second;
-        }
-        else {
-            if (it->second.size()) {
-                ret.reset(new IfcEntityList);            
-                ret->reserve((unsigned)it->second.size());
-                const std::vector<unsigned>& ids = it->second;
-                for (std::vector<unsigned>::const_iterator jt = ids.begin(); jt != ids.end(); ++jt) {
-                    ret->push(entityById(*jt));
-                }
-            }
-            by_ref_cached_[t] = ret;
-        }
+	const unsigned int *begin, *end;
+	const unsigned char* attributes;
+	if (references_to(t, begin, end, attributes)) {
+		{
+			boost::mutex::scoped_lock lock(index_mutex_);
+			ref_map_t::const_iterator cached_it = by_ref_cached_.find(t);
+			if (cached_it != by_ref_cached_.end()) {
+				return cached_it->second;
+			}
+		}
+		// The list is built without holding the lock. When multiple threads
+		// build the same list, the list inserted first is returned by all.
+		ret.reset(new IfcEntityList);
+		ret->reserve((unsigned)(end - begin));
+		for (const unsigned int* it = begin; it != end; ++it) {
+			ret->push(entityById(*it));
+		}
+		boost::mutex::scoped_lock lock(index_mutex_);
+		ret = by_ref_cached_.insert(std::make_pair((unsigned int) t, ret)).first->second;
 	}
 	return ret;
 }
@@ -1825,22 +3907,95 @@ IfcUtil::IfcBaseClass* IfcFile::entityById(int id) {
 }
 
 IfcSchema::IfcRoot* IfcFile::entityByGuid(const std::string& guid) {
-	entity_by_guid_t::const_iterator it = byguid.find(guid);
-	if ( it == byguid.end() ) {
+	IfcSchema::IfcRoot* instance = find_guid(guid);
+	if ( !instance ) {
 		throw IfcException("Instance with GlobalId '" + guid + "' not found");
 	} else {
-		return it->second;
+		return instance;
+	}
+}
+
+namespace {
+	// Returns the value of a character in the base64 encoding of GlobalIds,
+	// or -1 for characters outside of the encoding.
+	inline int guid_character_value(char c) {
+		if (c >= '0' && c <= '9') return c - '0';
+		if (c >= 'A' && c <= 'Z') return c - 'A' + 10;
+		if (c >= 'a' && c <= 'z') return c - 'a' + 36;
+		if (c == '_') return 62;
+		if (c == '$') return 63;
+		return -1;
+	}
+
+	bool pack_guid(const std::string& guid, IfcFile::packed_guid& packed) {
+		if (guid.size() != 22 || guid_character_value(guid[0]) > 3) {
+			return false;
+		}
+		packed.high = packed.low = 0;
+		for (std::string::const_iterator it = guid.begin(); it != guid.end(); ++it) {
+			const int v = guid_character_value(*it);
+			if (v < 0) {
+				return false;
+			}
+			packed.high = (packed.high << 6) | (packed.low >> 58);
+			packed.low = (packed.low << 6) | (boost::uint64_t) v;
+		}
+		return true;
+	}
+}
+
+IfcSchema::IfcRoot* IfcFile::index_guid(const std::string& guid, IfcSchema::IfcRoot* instance) {
+	IfcSchema::IfcRoot* previous;
+	packed_guid packed;
+	if (pack_guid(guid, packed)) {
+		std::pair<entity_by_guid_t::iterator, bool> inserted = byguid.insert(entity_by_guid_t::value_type(packed, instance));
+		previous = inserted.second ? 0 : inserted.first->second;
+		inserted.first->second = instance;
+	} else {
+		std::pair<entity_by_unpacked_guid_t::iterator, bool> inserted = byguid_unpacked.insert(entity_by_unpacked_guid_t::value_type(guid, instance));
+		previous = inserted.second ? 0 : inserted.first->second;
+		inserted.first->second = instance;
+	}
+	return previous;
+}
+
+IfcSchema::IfcRoot* IfcFile::find_guid(const std::string& guid) const {
+	packed_guid packed;
+	if (pack_guid(guid, packed)) {
+		entity_by_guid_t::const_iterator it = byguid.find(packed);
+		return it == byguid.end() ? 0 : it->second;
+	} else {
+		entity_by_unpacked_guid_t::const_iterator it = byguid_unpacked.find(guid);
+		return it == byguid_unpacked.end() ? 0 : it->second;
+	}
+}
+
+void IfcFile::erase_guid(const std::string& guid) {
+	packed_guid packed;
+	if (pack_guid(guid, packed)) {
+		byguid.erase(packed);
+	} else {
+		byguid_unpacked.erase(guid);
 	}
 }
 
 // FIXME: Test destructor to delete entity and arg allocations
 IfcFile::~IfcFile() {
+	// Only the instances that have been added to the file after reading need
+	// to be deleted, the instances read from the file are released at once
+	// along with the arena.
 	for( entity_by_id_t::const_iterator it = byid.begin(); it != byid.end(); ++ it ) {
-		delete it->second->entity;
-		delete it->second;
+		if (!arena_.owns(it->second)) {
+			delete it->second->entity;
+			delete it->second;
+		}
 	}
 	delete stream;
 	delete tokens;
+	for (std::vector< std::pair<IfcSpfLexer*, IfcSpfStream*> >::const_iterator it = previous_versions_.begin(); it != previous_versions_.end(); ++it) {
+		delete it->second;
+		delete it->first;
+	}
 }
 
 IfcFile::entity_by_id_t::const_iterator IfcFile::begin() const {
@@ -1852,19 +4007,19 @@ IfcFile::entity_by_id_t::const_iterator IfcFile::end() const {
 }
 
 IfcFile::type_iterator IfcFile::types_begin() const {
-	return bytype_excl.begin();
+	return type_iterator(bytype_excl, 0);
 }
 
 IfcFile::type_iterator IfcFile::types_end() const {
-	return bytype_excl.end();
+	return type_iterator(bytype_excl, bytype_excl.size());
 }
 
 IfcFile::type_iterator IfcFile::types_incl_super_begin() const {
-	return bytype.begin();
+	return type_iterator(bytype, 0);
 }
 
 IfcFile::type_iterator IfcFile::types_incl_super_end() const {
-	return bytype.end();
+	return type_iterator(bytype, bytype.size());
 }
 
 namespace {
@@ -1911,18 +4066,35 @@ std::string IfcFile::createTimestamp() const {
 	return result;
 }
 
+//
+// Returns the instances referencing the instance, optionally only those of
+// the specified type and referring to it through the specified attribute.
+// The attribute index of a reference is recorded in the reference table, so
+// that the attributes of the referencing instances do not need to be read,
+// unless the attribute of the reference is unknown. The referencing instances
+// are taken from the cached list of entitiesByReference(), which is in the
+// order of the row in the reference table.
+//
 IfcEntityList::ptr IfcFile::getInverse(int instance_id, IfcSchema::Type::Enum type, int attribute_index) {
 	IfcUtil::IfcBaseClass* instance = entityById(instance_id);
 
 	IfcEntityList::ptr l = IfcEntityList::ptr(new IfcEntityList);
 	IfcEntityList::ptr all = entitiesByReference(instance_id);
-	if (!all) return l;
-
-	for(IfcEntityList::it it = all->begin(); it != all->end(); ++it) {
-		bool valid = type == IfcSchema::Type::UNDEFINED || (*it)->is(type);
-		if (valid && attribute_index >= 0) {
+	const unsigned int *begin, *end;
+	const unsigned char* attributes;
+	if (!all || !references_to(instance_id, begin, end, attributes)) return l;
+
+	unsigned i = 0;
+	for (IfcEntityList::it it = all->begin(); it != all->end(); ++it, ++i) {
+		const unsigned char attribute = attributes[i];
+		if (attribute_index >= 0 && attribute != reference_row::unknown_attribute && attribute != attribute_index) {
+			continue;
+		}
+		IfcUtil::IfcBaseClass* referencing = *it;
+		bool valid = type == IfcSchema::Type::UNDEFINED || referencing->is(type);
+		if (valid && attribute_index >= 0 && attribute == reference_row::unknown_attribute) {
 			try {
-				Argument* arg = (*it)->entity->getArgument(attribute_index);
+				Argument* arg = referencing->entity->getArgument(attribute_index);
 				if (arg->type() == IfcUtil::Argument_ENTITY_INSTANCE) {
 					valid = instance == *arg;
 				} else if (arg->type() == IfcUtil::Argument_AGGREGATE_OF_ENTITY_INSTANCE) {
@@ -1938,7 +4110,7 @@ IfcEntityList::ptr IfcFile::getInverse(int instance_id, IfcSchema::Type::Enum ty
 			}
 		}
 		if (valid) {
-			l->push(*it);
+			l->push(referencing);
 		}
 	}
 
@@ -37,8 +37,10 @@
 #include <cstring>
 #include <map>
 
+#include <boost/atomic.hpp>
 #include <boost/shared_ptr.hpp>
 #include <boost/dynamic_bitset.hpp>
+#include <boost/cstdint.hpp>
 
 #include "ifc_parse_api.h"
 
@@ -54,6 +56,7 @@
 #endif
 
 #include "../ifcparse/IfcSpfStream.h"
+#include "../ifcparse/IfcPerThread.h"
 
 namespace IfcParse {
 
@@ -75,7 +78,7 @@ namespace IfcParse {
 
 	struct Token {
 		IfcSpfLexer* lexer; //TODO: remove it from here
-		unsigned startPos;
+		size_t startPos;
 		TokenType type;
 		union {
 			bool value_bool;      //types: BOOL
@@ -85,10 +88,27 @@ namespace IfcParse {
 		};
 
 		Token() : lexer(0), startPos(0), type(Token_NONE) {}
-		Token(IfcSpfLexer* _lexer, unsigned _startPos, unsigned /*_endPos*/, TokenType _type)
+		Token(IfcSpfLexer* _lexer, size_t _startPos, size_t /*_endPos*/, TokenType _type)
 			: lexer(_lexer), startPos(_startPos), type(_type) {}
 	};
 
+	/// A Token without the reference to the lexer, packed into 16 bytes. Used
+	/// to store the elements of aggregates, which share a single lexer.
+	struct CompactToken {
+		boost::uint64_t startPos : 56;
+		boost::uint64_t type : 8;
+		union {
+			bool value_bool;
+			char value_char;
+			int value_int;
+			double value_double;
+		};
+
+		CompactToken() : startPos(0), type(Token_NONE), value_double(0.) {}
+		explicit CompactToken(const Token& t);
+		Token token(IfcSpfLexer* lexer) const;
+	};
+
 	/// Provides functions to convert Tokens to binary data
 	/// Tokens are merely offsets to where they can be read in the file
 	class IFC_PARSE_API TokenFunc {
@@ -139,8 +159,8 @@ namespace IfcParse {
 	// Functions for creating Tokens from an arbitary file offset
 	// The first 4 bits are reserved for Tokens of type ()=,;$*
 	//
-	Token OperatorTokenPtr(IfcSpfLexer* tokens, unsigned start, unsigned end);
-	Token GeneralTokenPtr(IfcSpfLexer* tokens, unsigned start, unsigned end);
+	Token OperatorTokenPtr(IfcSpfLexer* tokens, size_t start, size_t end);
+	Token GeneralTokenPtr(IfcSpfLexer* tokens, size_t start, size_t end);
 	Token NoneTokenPtr();
 
 	/// A stream of tokens to be read from a IfcSpfStream.
@@ -149,8 +169,15 @@ namespace IfcParse {
 		IfcCharacterDecoder* decoder;
 		//storage for temporary string without allocation
 		mutable std::string _tempString;
+		/// The lexer this lexer is a copy of, if any
+		IfcSpfLexer* parent;
+		per_thread_instances<IfcSpfLexer> copies;
 		unsigned int skipWhitespace();
 		unsigned int skipComment();
+		IfcSpfLexer(IfcSpfLexer* parent);
+		static IfcSpfLexer* copy(IfcSpfLexer* parent);
+		IfcSpfLexer(const IfcSpfLexer&); //N/A
+		IfcSpfLexer& operator =(const IfcSpfLexer&); //N/A
 	public:
 		std::string &GetTempString() const { return _tempString; }
 		IfcSpfStream* stream;
@@ -158,7 +185,12 @@ namespace IfcParse {
 		IfcSpfLexer(IfcSpfStream* s, IfcFile* f);
 		Token Next();
 		~IfcSpfLexer();
-		void TokenString(unsigned int offset, std::string &result);
+		void TokenString(size_t offset, std::string &result);
+		/// Returns the lexer to be used by the calling thread. This is the lexer
+		/// itself for the thread that created it. Other threads obtain a copy
+		/// of their own, which reads from the same buffer with a separate
+		/// cursor, character decoder and temporary string.
+		IfcSpfLexer* local();
 	};
 
 	/// Argument of type list, e.g.
@@ -166,9 +198,10 @@ namespace IfcParse {
 	///                 ==========
 	class IFC_PARSE_API ArgumentList: public Argument {
 	private:
-		std::vector<Argument*> list;
+		argument_vector list;
 		void push(Argument* l);
 	public:
+		ArgumentList(IfcArena* arena = 0);
 		~ArgumentList();
 
 		void read(IfcSpfLexer* t, std::vector<unsigned int>& ids);
@@ -185,6 +218,9 @@ namespace IfcParse {
 		operator std::vector< std::vector<double> >() const;
 		operator IfcEntityListList::ptr() const;
 
+		bool flatten(std::vector<int>& values, unsigned int& stride) const;
+		bool flatten(std::vector<double>& values, unsigned int& stride) const;
+
 		bool isNull() const;
 		unsigned int size() const;
 
@@ -193,10 +229,51 @@ namespace IfcParse {
 
 		std::string toString(bool upper=false) const;
 
-		std::vector<Argument*>& arguments() { return list; }
+		argument_vector& arguments() { return list; }
 	};
 
 
+	/// Argument of type list of which all elements are simple values, e.g.
+	/// #1=IfcCartesianPoint((0.,0.,0.));
+	///                      ==========
+	/// The elements are stored as CompactTokens rather than as individual
+	/// TokenArguments. Elements are only instantiated as Arguments when
+	/// accessed by index.
+	class IFC_PARSE_API TokenListArgument : public Argument {
+	private:
+		IfcSpfLexer* lexer;
+		IfcArena* arena;
+		CompactToken* values;
+		unsigned int count;
+		/// Instantiated on first access, possibly by multiple threads at once
+		mutable boost::atomic<Argument**> elements;
+		Token token(unsigned int i) const { return values[i].token(lexer); }
+		TokenListArgument(const TokenListArgument&);
+		TokenListArgument& operator=(const TokenListArgument&);
+	public:
+		/// The values and elements are allocated from the arena, if specified
+		TokenListArgument(IfcSpfLexer* lexer, const std::vector<Token>& tokens, IfcArena* arena = 0);
+		~TokenListArgument();
+
+		IfcUtil::ArgumentType type() const;
+
+		operator std::vector<int>() const;
+		operator std::vector<double>() const;
+		operator std::vector<std::string>() const;
+		operator std::vector<boost::dynamic_bitset<> >() const;
+		operator IfcEntityList::ptr() const;
+
+		/// Appends the elements to the vector, without instantiating them
+		void append_to(std::vector<int>& values) const;
+		void append_to(std::vector<double>& values) const;
+
+		bool isNull() const { return false; }
+		unsigned int size() const { return count; }
+
+		Argument* operator [] (unsigned int i) const;
+		std::string toString(bool upper=false) const;
+	};
+
 	/// Argument being null, e.g. '$'
 	///              == ===
 	class IFC_PARSE_API NullArgument : public Argument {
@@ -242,7 +319,7 @@ namespace IfcParse {
 	private:		
 		IfcUtil::IfcBaseClass* entity;
 	public:
-		EntityArgument(const Token& t);
+		EntityArgument(const Token& t, IfcArena* arena = 0);
 		~EntityArgument();
 
 		IfcUtil::ArgumentType type() const;
@@ -256,7 +333,7 @@ namespace IfcParse {
 		std::string toString(bool upper=false) const;
 	};
 	
-	IFC_PARSE_API IfcEntityInstanceData* read(unsigned int i, IfcFile* t, boost::optional<unsigned> offset = boost::none);
+	IFC_PARSE_API IfcEntityInstanceData* read(unsigned int i, IfcFile* t, boost::optional<size_t> offset = boost::none, IfcArena* arena = 0);
 
 	IFC_PARSE_API IfcEntityList::ptr traverse(IfcUtil::IfcBaseClass* instance, int max_level = -1);
 }
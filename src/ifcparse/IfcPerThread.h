@@ -0,0 +1,139 @@
+/********************************************************************************
+ *                                                                              *
+ * This file is part of IfcOpenShell.                                           *
+ *                                                                              *
+ * IfcOpenShell is free software: you can redistribute it and/or modify         *
+ * it under the terms of the Lesser GNU General Public License as published by  *
+ * the Free Software Foundation, either version 3.0 of the License, or          *
+ * (at your option) any later version.                                          *
+ *                                                                              *
+ * IfcOpenShell is distributed in the hope that it will be useful,              *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of               *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                 *
+ * Lesser GNU General Public License for more details.                          *
+ *                                                                              *
+ * You should have received a copy of the Lesser GNU General Public License     *
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.         *
+ *                                                                              *
+ ********************************************************************************/
+
+#ifndef IFCPERTHREAD_H
+#define IFCPERTHREAD_H
+
+#include <map>
+#include <vector>
+
+#include <boost/atomic.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/thread/tss.hpp>
+
+namespace IfcParse {
+
+	/// Provides a separate instance of T to every thread that uses an object
+	/// which itself cannot be used concurrently. The thread that created the
+	/// object is expected to use the object itself. The instances for other
+	/// threads are created on first use and deleted along with this object.
+	template <typename T>
+	class per_thread_instances {
+	private:
+		typedef std::map<boost::thread::id, T*> instance_map_t;
+
+		struct cache_entry {
+			const per_thread_instances* owner;
+			unsigned int generation;
+			T* instance;
+		};
+
+		boost::thread::id creator_;
+		// Distinguishes this object from objects previously allocated at the
+		// same address, for which the cache of a thread may still hold an entry
+		unsigned int generation_;
+		mutable boost::mutex mutex_;
+		instance_map_t instances_;
+
+		static unsigned int next_generation() {
+			static boost::atomic<unsigned int> generation(0);
+			return ++generation;
+		}
+
+		// The instance last returned to the calling thread, so that the mutex
+		// only needs to be locked when a thread alternates between objects
+		static boost::thread_specific_ptr<cache_entry>& cache() {
+			static boost::thread_specific_ptr<cache_entry> entry;
+			return entry;
+		}
+
+		per_thread_instances(const per_thread_instances&); //N/A
+		per_thread_instances& operator =(const per_thread_instances&); //N/A
+	public:
+		per_thread_instances()
+			: creator_(boost::this_thread::get_id())
+			, generation_(next_generation())
+		{}
+
+		~per_thread_instances() {
+			for (typename instance_map_t::const_iterator it = instances_.begin(); it != instances_.end(); ++it) {
+				delete it->second;
+			}
+		}
+
+		/// Returns whether the calling thread created this object
+		bool is_creator() const {
+			return boost::this_thread::get_id() == creator_;
+		}
+
+		/// Returns the instance for the calling thread. If the thread does not
+		/// have an instance yet, it is created by calling create().
+		template <typename F>
+		T* get(F create) {
+			cache_entry* entry = cache().get();
+			if (entry && entry->owner == this && entry->generation == generation_) {
+				return entry->instance;
+			}
+			T* instance;
+			{
+				boost::mutex::scoped_lock lock(mutex_);
+				T*& slot = instances_[boost::this_thread::get_id()];
+				if (!slot) {
+					slot = create();
+				}
+				instance = slot;
+			}
+			if (!entry) {
+				entry = new cache_entry;
+				cache().reset(entry);
+			}
+			entry->owner = this;
+			entry->generation = generation_;
+			entry->instance = instance;
+			return instance;
+		}
+
+		/// Returns whether pred() is true for any of the instances
+		template <typename F>
+		bool any(F pred) const {
+			boost::mutex::scoped_lock lock(mutex_);
+			for (typename instance_map_t::const_iterator it = instances_.begin(); it != instances_.end(); ++it) {
+				if (pred(it->second)) {
+					return true;
+				}
+			}
+			return false;
+		}
+
+		/// Moves the instances out of this object, the caller is responsible
+		/// for deleting them. Should not be called concurrently with get().
+		void release(std::vector<T*>& instances) {
+			boost::mutex::scoped_lock lock(mutex_);
+			for (typename instance_map_t::const_iterator it = instances_.begin(); it != instances_.end(); ++it) {
+				instances.push_back(it->second);
+			}
+			instances_.clear();
+			generation_ = next_generation();
+		}
+	};
+
+}
+
+#endif
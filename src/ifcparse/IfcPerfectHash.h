@@ -0,0 +1,68 @@
+/********************************************************************************
+ *                                                                              *
+ * This file is part of IfcOpenShell.                                           *
+ *                                                                              *
+ * IfcOpenShell is free software: you can redistribute it and/or modify         *
+ * it under the terms of the Lesser GNU General Public License as published by  *
+ * the Free Software Foundation, either version 3.0 of the License, or          *
+ * (at your option) any later version.                                          *
+ *                                                                              *
+ * IfcOpenShell is distributed in the hope that it will be useful,              *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of               *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                 *
+ * Lesser GNU General Public License for more details.                          *
+ *                                                                              *
+ * You should have received a copy of the Lesser GNU General Public License     *
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.         *
+ *                                                                              *
+ ********************************************************************************/
+
+/********************************************************************************
+ *                                                                              *
+ * Lookup in the minimal perfect hash tables that are generated for the entity  *
+ * names and enumerations of a schema by src/ifcexpressparser/perfect_hash.py.  *
+ * A key is first hashed into a bucket. The displacement of the bucket is       *
+ * either the seed with which the key is hashed again to obtain its slot, or,   *
+ * if negative, the slot itself. The hash function is to be kept in sync with   *
+ * the generator.                                                               *
+ *                                                                              *
+ ********************************************************************************/
+
+#ifndef IFCPERFECTHASH_H
+#define IFCPERFECTHASH_H
+
+#include <string>
+
+#include <boost/cstdint.hpp>
+
+namespace IfcParse {
+	namespace perfect_hash {
+
+		/// FNV-1a with the seed mixed into the offset basis, followed by the
+		/// finalizer of MurmurHash3 for a better distribution of the low bits
+		inline boost::uint32_t hash(const char* s, size_t n, boost::uint32_t seed) {
+			boost::uint32_t h = 2166136261U ^ seed;
+			for (size_t i = 0; i < n; ++i) {
+				h ^= (unsigned char) s[i];
+				h *= 16777619U;
+			}
+			h ^= h >> 16;
+			h *= 0x85ebca6bU;
+			h ^= h >> 13;
+			h *= 0xc2b2ae35U;
+			h ^= h >> 16;
+			return h;
+		}
+
+		/// Returns the slot of the key in a table of num_keys keys, or -1 if
+		/// the key is not in the table
+		inline int lookup(const std::string& key, const int* displacements, unsigned int num_displacements, const char* const* keys, unsigned int num_keys) {
+			const int d = displacements[hash(key.data(), key.size(), 0) % num_displacements];
+			const int slot = d < 0 ? -d - 1 : (int) (hash(key.data(), key.size(), (boost::uint32_t) d) % num_keys);
+			return key.compare(keys[slot]) == 0 ? slot : -1;
+		}
+
+	}
+}
+
+#endif
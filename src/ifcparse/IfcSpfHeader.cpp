@@ -42,7 +42,7 @@ HeaderEntity::HeaderEntity(const char * const datatype, IfcFile* file)
 		offset_in_file_ = file->stream->Tell();
 		load();
 	} else {
-		initialized_ = true;
+		load_state_ = LOADED;
 	}
 }
 
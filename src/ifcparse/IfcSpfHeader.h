@@ -54,7 +54,7 @@ public:
 		std::stringstream ss;
 		// Unfortunately this is duplicated from IfcEntityInstanceData::toString()
 		ss << _datatype << "(";
-		std::vector<Argument*>::const_iterator it = attributes_.begin();
+		IfcParse::argument_vector::const_iterator it = attributes_.begin();
 		for (; it != attributes_.end(); ++it) {
 			if (it != attributes_.begin()) {
 				ss << ",";
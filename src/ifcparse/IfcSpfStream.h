@@ -27,6 +27,7 @@
 #ifndef IFCSPFSTREAM_H
 #define IFCSPFSTREAM_H
 
+#include <ctime>
 #include <fstream>
 #include <string>
 
@@ -34,6 +35,12 @@
 #include <boost/iostreams/device/mapped_file.hpp>
 #endif
 
+// On POSIX systems files are memory-mapped natively by default,
+// so that the file contents are not copied from the page cache.
+#if (defined(__unix__) || defined(__APPLE__)) && !defined(HAVE_POSIX_MMAP)
+#define HAVE_POSIX_MMAP
+#endif
+
 #include "ifc_parse_api.h"
 
 namespace IfcParse {
@@ -47,31 +54,66 @@ namespace IfcParse {
 #endif
 		FILE* stream;
 		const char* buffer;
-		unsigned int ptr;
-		unsigned int len;
+		size_t ptr;
+		size_t len;
+		bool owns_buffer;
+#ifdef HAVE_POSIX_MMAP
+		bool mapped;
+		bool map(const std::string& fn);
+#endif
 	public:
+		enum access_pattern { ACCESS_SEQUENTIAL, ACCESS_RANDOM };
+		/// The instructions used to compare blocks of characters in SkipTo()
+		enum instruction_set { INSTRUCTIONS_SCALAR, INSTRUCTIONS_SSE2, INSTRUCTIONS_AVX2 };
+
 		bool valid;
 		bool eof;
-		unsigned int size;
+		size_t size;
+		/// The time at which the file was last modified, if the stream is read
+		/// from a file and the time can be determined, otherwise zero
+		std::time_t modification_time;
 #ifdef USE_MMAP
 		IfcSpfStream(const std::string& fn, bool mmap=false);
 #else
 		IfcSpfStream(const std::string& fn);
 #endif
-		IfcSpfStream(std::istream& f, int len);
-		IfcSpfStream(void* data, int len);
+		IfcSpfStream(std::istream& f, size_t len);
+		IfcSpfStream(void* data, size_t len);
+		/// Creates a stream that shares the buffer of another stream, restricted
+		/// to the byte range [begin, end). Offsets remain relative to the start of
+		/// the file. The buffer is not released when this stream is closed.
+		IfcSpfStream(const IfcSpfStream& other, size_t begin, size_t end);
 		~IfcSpfStream();
 		/// Returns the character at the cursor 
 		char Peek();
 		/// Returns the character at specified offset
-		char Read(unsigned int offset);
+		char Read(size_t offset);
+		/// Returns a pointer to the character at specified offset, the
+		/// characters up to the size of the stream follow contiguously
+		const char* Data(size_t offset);
 		/// Increment the file cursor and reads new page if necessary
 		void Inc();
 		void Close();
 		/// Moves the file cursor to an arbitrary offset in the file
-		void Seek(unsigned int offset);
+		void Seek(size_t offset);
+		/// Moves the file cursor forward to the first occurrence of any of the
+		/// characters in the null-terminated string, or to the end of the file.
+		/// The characters are searched for in blocks of 16 or 32 bytes when SSE2
+		/// or AVX2 instructions are available. Carriage returns and line feeds
+		/// are skipped by Inc() and should not be searched for.
+		void SkipTo(const char* characters);
+		/// Returns the widest instruction set SkipTo() has been compiled for
+		static instruction_set SupportedInstructionSet();
+		/// Returns a pointer to the first occurrence in [begin, end) of any of the
+		/// characters in the null-terminated string, or end if there is none, using
+		/// the specified instructions if available. Used by SkipTo() with the
+		/// supported instruction set, the others are available for comparison.
+		static const char* FindFirstOf(const char* begin, const char* end, const char* characters, instruction_set instructions);
 		/// Returns the cursor position
-		unsigned int Tell();
+		size_t Tell();
+		/// Informs the operating system of the expected access pattern of
+		/// a memory-mapped file. Has no effect if the file is not mapped.
+		void Advise(access_pattern pattern);
 	};
 }
 
@@ -0,0 +1,213 @@
+/********************************************************************************
+ *                                                                              *
+ * This file is part of IfcOpenShell.                                           *
+ *                                                                              *
+ * IfcOpenShell is free software: you can redistribute it and/or modify         *
+ * it under the terms of the Lesser GNU General Public License as published by  *
+ * the Free Software Foundation, either version 3.0 of the License, or          *
+ * (at your option) any later version.                                          *
+ *                                                                              *
+ * IfcOpenShell is distributed in the hope that it will be useful,              *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of               *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                 *
+ * Lesser GNU General Public License for more details.                          *
+ *                                                                              *
+ * You should have received a copy of the Lesser GNU General Public License     *
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.         *
+ *                                                                              *
+ ********************************************************************************/
+
+#include <cstring>
+#include <algorithm>
+
+#include <boost/algorithm/string/join.hpp>
+
+#include "../ifcparse/IfcSpfStreamReader.h"
+#include "../ifcparse/IfcException.h"
+#include "../ifcparse/IfcLogger.h"
+
+using namespace IfcParse;
+
+IfcSpfStreamReader::IfcSpfStreamReader(std::istream& input, size_t window_size)
+	: input(input)
+	, buffer(0)
+	, capacity((std::max)(window_size, (size_t) 1))
+	, filled(0)
+	, pos(0)
+	, in_data(false)
+	, at_end(false)
+	, valid_(true)
+	, window(0)
+	, view(0)
+	, lexer(0)
+	, current(0)
+{
+	buffer = new char[capacity];
+	// The window stream takes ownership of the buffer
+	window = new IfcSpfStream((void*) buffer, capacity);
+	// Instances are not retained, so references do not need to be registered
+	file.parsing_complete_ = true;
+}
+
+IfcSpfStreamReader::~IfcSpfStreamReader() {
+	delete current;
+	// The lexer and stream are owned by the reader, not by the file
+	file.tokens = 0;
+	file.stream = 0;
+	delete lexer;
+	delete view;
+	delete window;
+}
+
+//
+// Moves the unread part of the buffer to the front and appends data
+// from the input, returns false when no more data could be read
+//
+bool IfcSpfStreamReader::fill() {
+	file.tokens = 0;
+	file.stream = 0;
+	delete lexer;
+	delete view;
+	lexer = 0;
+	view = 0;
+
+	if (pos) {
+		std::memmove(buffer, buffer + pos, filled - pos);
+		filled -= pos;
+		pos = 0;
+	}
+
+	// The buffer is grown when a single statement does not fit
+	if (filled == capacity) {
+		char* new_buffer = new char[capacity * 2];
+		std::memcpy(new_buffer, buffer, filled);
+		delete window;
+		buffer = new_buffer;
+		capacity *= 2;
+		window = new IfcSpfStream((void*) buffer, capacity);
+	}
+
+	input.read(buffer + filled, capacity - filled);
+	const size_t num_read = (size_t) input.gcount();
+	if (num_read == 0) {
+		return false;
+	}
+	filled += num_read;
+
+	view = new IfcSpfStream(*window, 0, filled);
+	lexer = new IfcSpfLexer(view, &file);
+	file.tokens = lexer;
+	file.stream = view;
+	return true;
+}
+
+//
+// Finds the terminating semicolon of the statement at the current
+// position, ignoring semicolons in string literals and comments
+//
+bool IfcSpfStreamReader::find_statement(size_t& end) const {
+	bool in_string = false, in_comment = false;
+	char previous = 0;
+	for (size_t i = pos; i < filled; ++i) {
+		const char c = buffer[i];
+		if (in_comment) {
+			if (previous == '*' && c == '/') {
+				in_comment = false;
+				previous = 0;
+				continue;
+			}
+		} else if (in_string) {
+			// A quote inside a string literal is escaped by doubling it,
+			// which amounts to leaving and immediately re-entering the string.
+			if (c == '\'') in_string = false;
+		} else if (c == '\'') {
+			in_string = true;
+		} else if (previous == '/' && c == '*') {
+			in_comment = true;
+			previous = 0;
+			continue;
+		} else if (c == ';') {
+			end = i + 1;
+			return true;
+		}
+		previous = c;
+	}
+	return false;
+}
+
+//
+// Reads the schema identifiers of the FILE_SCHEMA header entity
+//
+bool IfcSpfStreamReader::check_schema() {
+	std::vector<std::string> schemas;
+	for (;;) {
+		const Token token = lexer->Next();
+		if (token.type == Token_NONE || TokenFunc::isOperator(token, ';')) {
+			break;
+		}
+		if (TokenFunc::isString(token)) {
+			schemas.push_back(TokenFunc::asString(token));
+		}
+	}
+
+	if (schemas.size() != 1 || schemas[0] != IfcSchema::Identifier) {
+		Logger::Message(Logger::LOG_ERROR, "File schema encountered ("
+			+ boost::algorithm::join(schemas, ", ") + ") different from expected "
+			+ std::string(IfcSchema::Identifier) + ".");
+		return false;
+	}
+	return true;
+}
+
+IfcEntityInstanceData* IfcSpfStreamReader::next() {
+	delete current;
+	current = 0;
+
+	while (valid_ && !at_end) {
+		size_t end;
+		if (!lexer || !find_statement(end)) {
+			if (!fill()) {
+				at_end = true;
+			}
+			continue;
+		}
+
+		const size_t begin = pos;
+		pos = end;
+
+		try {
+			lexer->stream->Seek(begin);
+			const Token name = lexer->Next();
+
+			if (TokenFunc::isKeyword(name)) {
+				const std::string& keyword = TokenFunc::asStringRef(name);
+				if (keyword == "DATA") {
+					in_data = true;
+				} else if (keyword == "ENDSEC") {
+					at_end = in_data;
+				} else if (keyword == "FILE_SCHEMA") {
+					valid_ = check_schema();
+				}
+				continue;
+			}
+
+			if (!in_data || !TokenFunc::isIdentifier(name)) {
+				continue;
+			}
+
+			const Token op = lexer->Next();
+			const Token datatype = lexer->Next();
+			if (!TokenFunc::isOperator(op, '=') || !TokenFunc::isKeyword(datatype)) {
+				throw IfcException("Unexpected token while parsing entity instance");
+			}
+
+			const IfcSchema::Type::Enum ty = IfcSchema::Type::FromString(TokenFunc::asStringRef(datatype));
+			current = new IfcEntityInstanceData(ty, &file, (unsigned) TokenFunc::asIdentifier(name), datatype.startPos);
+			return current;
+		} catch (const IfcException& ex) {
+			Logger::Message(Logger::LOG_ERROR, ex.what());
+		}
+	}
+
+	return 0;
+}
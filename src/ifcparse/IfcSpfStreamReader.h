@@ -0,0 +1,72 @@
+/********************************************************************************
+ *                                                                              *
+ * This file is part of IfcOpenShell.                                           *
+ *                                                                              *
+ * IfcOpenShell is free software: you can redistribute it and/or modify         *
+ * it under the terms of the Lesser GNU General Public License as published by  *
+ * the Free Software Foundation, either version 3.0 of the License, or          *
+ * (at your option) any later version.                                          *
+ *                                                                              *
+ * IfcOpenShell is distributed in the hope that it will be useful,              *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of               *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                 *
+ * Lesser GNU General Public License for more details.                          *
+ *                                                                              *
+ * You should have received a copy of the Lesser GNU General Public License     *
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.         *
+ *                                                                              *
+ ********************************************************************************/
+
+#ifndef IFCSPFSTREAMREADER_H
+#define IFCSPFSTREAMREADER_H
+
+#include <istream>
+
+#include "ifc_parse_api.h"
+
+#include "../ifcparse/IfcFile.h"
+
+namespace IfcParse {
+
+	/// The IfcSpfStreamReader class reads the entity instances of an ISO 10303-21
+	/// IFC-SPF file in a single forward pass from an arbitrary input stream, such
+	/// as a pipe or the standard input. The input is read in windows of a fixed
+	/// size, which only grow when a single instance does not fit. Instances are
+	/// not retained and no indices are built, so that memory usage does not
+	/// depend on the size of the file. As a consequence, instance references in
+	/// the attributes can not be resolved to instances and need to be read as
+	/// instance names, e.g. TokenFunc::asIdentifier() on the argument token.
+	class IFC_PARSE_API IfcSpfStreamReader {
+	private:
+		std::istream& input;
+		char* buffer;
+		size_t capacity;
+		size_t filled;
+		size_t pos;
+		bool in_data;
+		bool at_end;
+		bool valid_;
+		IfcSpfStream* window;
+		IfcSpfStream* view;
+		IfcSpfLexer* lexer;
+		IfcFile file;
+		IfcEntityInstanceData* current;
+		bool fill();
+		bool find_statement(size_t& end) const;
+		bool check_schema();
+	public:
+		IfcSpfStreamReader(std::istream& input, size_t window_size = 1 << 20);
+		~IfcSpfStreamReader();
+		/// Returns the next entity instance of the data section in file order or
+		/// a null pointer when the end of the data section is reached. Attributes
+		/// are parsed on first access. The instance is owned by the reader and
+		/// is only valid until the next call to next().
+		IfcEntityInstanceData* next();
+		/// Returns false when the file schema differs from the schema
+		/// IfcOpenShell is compiled for, in which case no instances are read.
+		bool valid() const { return valid_; }
+	};
+
+}
+
+#endif
@@ -99,6 +99,16 @@ void IfcEntityList::remove(IfcUtil::IfcBaseClass* instance) {
 	}
 }
 
+void IfcEntityList::remove(const std::set<IfcUtil::IfcBaseClass*>& instances) {
+	std::vector<IfcUtil::IfcBaseClass*>::iterator jt = ls.begin();
+	for (std::vector<IfcUtil::IfcBaseClass*>::const_iterator it = ls.begin(); it != ls.end(); ++it) {
+		if (instances.find(*it) == instances.end()) {
+			*jt++ = *it;
+		}
+	}
+	ls.erase(jt, ls.end());
+}
+
 IfcEntityList::ptr IfcEntityList::filtered(const std::set<IfcSchema::Type::Enum>& entities) {
 	IfcEntityList::ptr return_value(new IfcEntityList);
 	for (it it = begin(); it != end(); ++it) {
@@ -150,6 +160,32 @@ Argument::operator std::vector< std::vector<int> >() const { throw IfcParse::Ifc
 Argument::operator std::vector< std::vector<double> >() const { throw IfcParse::IfcException("Argument is not a list of list of floats"); }
 Argument::operator IfcEntityListList::ptr() const { throw IfcParse::IfcException("Argument is not a list of list of entity instances"); }
 
+namespace {
+	template <typename T>
+	bool flatten_aggregate_of_aggregate(const std::vector< std::vector<T> >& aggregates, std::vector<T>& values, unsigned int& stride) {
+		values.clear();
+		stride = aggregates.empty() ? 0 : (unsigned int) aggregates.front().size();
+		values.reserve(aggregates.size() * stride);
+		for (typename std::vector< std::vector<T> >::const_iterator it = aggregates.begin(); it != aggregates.end(); ++it) {
+			if (it->size() != stride) {
+				return false;
+			}
+			values.insert(values.end(), it->begin(), it->end());
+		}
+		return true;
+	}
+}
+
+// The aggregates are converted to nested vectors first, derived classes
+// decode the elements directly where possible.
+bool Argument::flatten(std::vector<int>& values, unsigned int& stride) const {
+	return flatten_aggregate_of_aggregate<int>(*this, values, stride);
+}
+
+bool Argument::flatten(std::vector<double>& values, unsigned int& stride) const {
+	return flatten_aggregate_of_aggregate<double>(*this, values, stride);
+}
+
 
 static const char* const argument_type_string[] = {
 	"NULL",
@@ -43,8 +43,16 @@ private:
 %ignore IfcParse::HeaderEntity::is;
 
 %ignore IfcParse::IfcFile::type_iterator;
+%ignore IfcParse::IfcFile::packed_guid;
+%ignore IfcParse::scan_result;
+%ignore IfcParse::scanned_reference;
+%ignore IfcParse::reference_row;
+%ignore IfcParse::change_set;
+%ignore IfcParse::IfcFile::update(IfcParse::IfcSpfStream*, IfcParse::change_set&);
 
 %ignore IfcUtil::IfcBaseClass::is;
+%ignore IfcUtil::IfcBaseClass::operator new;
+%ignore IfcUtil::IfcBaseClass::operator delete;
 
 %rename("by_id") entityById;
 %rename("by_type") entitiesByType;
@@ -73,6 +81,26 @@ private:
 		f << (*$self);
 	}
 
+	void write_binary(const std::string& fn) {
+		std::ofstream f(fn.c_str(), std::ios_base::binary);
+		$self->writeBinary(f);
+	}
+
+	// Replaces the file by a new version of it, see IfcFile::update(). Returns
+	// the names of the added, modified and removed instances as a tuple of
+	// three tuples, or None when the file could not be read.
+	PyObject* update(const std::string& fn) {
+		IfcParse::change_set changes;
+		if (!$self->update(new IfcParse::IfcSpfStream(fn), changes)) {
+			Py_RETURN_NONE;
+		}
+		std::vector< std::vector<unsigned int> > names;
+		names.push_back(changes.added);
+		names.push_back(changes.modified);
+		names.push_back(changes.removed);
+		return pythonize_vector2(names);
+	}
+
 	std::vector<unsigned> entity_names() const {
 		std::vector<unsigned> keys;
 		keys.reserve(std::distance($self->begin(), $self->end()));
@@ -408,6 +436,7 @@ private:
 // The IfcFile* returned by open() is to be freed by SWIG/Python
 %newobject open;
 %newobject read;
+%newobject open_binary;
 
 %inline %{
 	IfcParse::IfcFile* open(const std::string& fn) {
@@ -415,6 +444,17 @@ private:
 		f->Init(fn);
 		return f;
 	}
+	IfcParse::IfcFile* open(const std::string& fn, const std::string& index_fn) {
+		IfcParse::IfcFile* f = new IfcParse::IfcFile();
+		f->Init(new IfcParse::IfcSpfStream(fn), index_fn);
+		return f;
+	}
+	IfcParse::IfcFile* open_binary(const std::string& fn) {
+		IfcParse::IfcFile* f = new IfcParse::IfcFile();
+		std::ifstream stream(fn.c_str(), std::ios_base::binary);
+		f->InitBinary(stream);
+		return f;
+	}
     IfcParse::IfcFile* read(const std::string& data) {
 		char* copiedData = new char[data.length()];
 		memcpy(copiedData, data.c_str(), data.length());
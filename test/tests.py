@@ -20,6 +20,7 @@
 # Some basic tests. Currently only covering basic I/O.
 
 import os
+import re
 import uuid
 
 import ifcopenshell
@@ -88,10 +89,102 @@ assert num_connections_2 == num_connections_1 + 1
 assert f[288].ConnectedTo == ()
 rel = f.createIfcRelConnectsPathElements(RelatingElement=f[288])
 assert f[288].ConnectedTo == (rel,)
+# An instance referenced through two attributes of the same relationship
+rel2 = f.createIfcRelConnectsPathElements(RelatingElement=f[340], RelatedElement=f[340])
+assert f[340].ConnectedTo.count(rel2) == 1
+assert f[340].ConnectedFrom.count(rel2) == 1
 
 # Some operations on ifcopenshell.guid
 assert len(ifcopenshell.guid.compress(uuid.uuid1().hex)) == 22
 
+# Concurrent read access to a shared file, on which instances are
+# loaded on first access from whichever thread happens to be first
+import threading
+
+def read_all(fn):
+    h = ifcopenshell.open(fn)
+    return [(str(inst), [str(i) for i in h.get_inverse(inst)]) for inst in h.by_type("IfcRoot")]
+
+reference = read_all("input/acad2010_walls.ifc")
+shared = ifcopenshell.open("input/acad2010_walls.ifc")
+results = {}
+
+def read_shared(n):
+    results[n] = [(str(inst), [str(i) for i in shared.get_inverse(inst)]) for inst in shared.by_type("IfcRoot")]
+
+threads = [threading.Thread(target=read_shared, args=(n,)) for n in range(8)]
+for th in threads: th.start()
+for th in threads: th.join()
+assert len(results) == 8
+assert all(r == reference for r in results.values())
+
+# Updating a file to a modified version of it, in which a record is
+# changed, one is removed and one is added before all others, so that
+# the unchanged records are located elsewhere in the new version.
+g = ifcopenshell.open("input/acad2010_walls.ifc")
+rel_id = g[288].ConnectedTo[0].id()
+new_guid = ifcopenshell.guid.compress(uuid.uuid1().hex)
+with open("input/acad2010_walls.ifc") as txt:
+    lines = txt.read().split("\n")
+for i, line in enumerate(lines):
+    if line.startswith("#48="):
+        lines[i] = re.sub("'[^']*'", "'%s'" % new_guid, line, 1)
+    elif line.startswith("#%d=" % rel_id):
+        lines[i] = ""
+    elif line.strip() == "DATA;":
+        lines[i] = "DATA;\n#1000000=IFCCARTESIANPOINT((1.,2.,3.));"
+with open("updated.ifc", "w") as txt:
+    txt.write("\n".join(lines))
+assert g.update("updated.ifc") == ((1000000,), (48,), (rel_id,))
+assert g[new_guid] == g[48]
+assert g[288].ConnectedTo == ()
+assert g[1000000].Coordinates == (1., 2., 3.)
+assert len(g.by_type("IfcWall")) == len(f.by_type("IfcWall"))
+os.unlink("updated.ifc")
+
+# Reading a file using an index, which is written on the first read and
+# used on the second, yields the same instances, types, inverses and
+# GlobalIds as reading the file without an index.
+def describe(h):
+    return [(str(inst), [str(i) for i in h.get_inverse(inst)], h.by_guid(inst.GlobalId).id())
+            for inst in h.by_type("IfcRoot")] + \
+           [(t, len(h.by_type(t))) for t in h.types_with_super()]
+
+reference = describe(ifcopenshell.open("input/acad2010_walls.ifc"))
+for i in range(2):
+    h = ifcopenshell.open("input/acad2010_walls.ifc", index="acad2010_walls.idx")
+    assert os.path.exists("acad2010_walls.idx")
+    assert describe(h) == reference
+    assert h[16] in h.get_inverse(h[15])
+del h
+os.unlink("acad2010_walls.idx")
+
+# A file written in binary form and read back has the same instances,
+# attribute values, inverses and GlobalIds as the file it was written
+# from, and is smaller than that file written as text. Real numbers are
+# compared as values, as they are written to text with fewer digits.
+def values(h):
+    def value(v):
+        if isinstance(v, ifcopenshell.entity_instance):
+            return v.id() or (v.is_a(), value(v[0]))
+        elif isinstance(v, tuple):
+            return tuple(map(value, v))
+        return v
+    return sorted((inst.id(), inst.is_a(), [value(a) for a in inst], sorted(i.id() for i in h.get_inverse(inst)))
+                  for inst in h)
+
+h = ifcopenshell.open("input/acad2010_walls.ifc")
+h.write("text.ifc")
+h.write_binary("binary.ifcb")
+b = ifcopenshell.open_binary("binary.ifcb")
+assert values(b) == values(h)
+assert all(b.by_guid(inst.GlobalId) == inst for inst in b.by_type("IfcRoot"))
+assert b.header.file_name.name == h.header.file_name.name
+assert os.path.getsize("binary.ifcb") < os.path.getsize("text.ifc")
+del h, b
+for fn in ("text.ifc", "binary.ifcb"):
+    os.unlink(fn)
+
 # Test the BVH tree
 tree_settings = ifcopenshell.geom.settings()
 tree_settings.set(tree_settings.DISABLE_OPENING_SUBTRACTIONS, True)
@@ -104,3 +197,27 @@ f.write("output.ifc")
 with open("output.ifc") as txt:
     assert '123' in txt.read()
 os.unlink("output.ifc")
+
+# Test files beyond 4GB, in which instances are located at offsets that
+# do not fit in 32 bits. As this writes and reads a file of several GB
+# it only runs when IFCOPENSHELL_TEST_LARGE_FILES is set.
+if os.environ.get("IFCOPENSHELL_TEST_LARGE_FILES"):
+    with open("large.ifc", "w") as large:
+        large.write("ISO-10303-21;\nHEADER;\n")
+        large.write("FILE_DESCRIPTION(('ViewDefinition [CoordinationView]'),'2;1');\n")
+        large.write("FILE_NAME('large.ifc','',(''),(''),'','','');\n")
+        large.write("FILE_SCHEMA(('IFC2X3'));\nENDSEC;\nDATA;\n")
+        large.write("#1=IFCCARTESIANPOINT((0.,0.,0.));\n/*")
+        padding = ("x" * 1023 + "\n") * 1024
+        for i in range(4400):
+            large.write(padding)
+        large.write("*/\n#2=IFCCARTESIANPOINT((1.,2.,3.));\n")
+        large.write("#3=IFCPERSON($,$,'J\\S\\ohn',$,$,$,$,$);\n")
+        large.write("ENDSEC;\nEND-ISO-10303-21;\n")
+    assert os.path.getsize("large.ifc") > 2 ** 32
+    g = ifcopenshell.open("large.ifc")
+    assert len(g.by_type("IfcCartesianPoint")) == 2
+    assert g[2].Coordinates == (1., 2., 3.)
+    assert g[3].GivenName == u"J\u00efhn"
+    del g
+    os.unlink("large.ifc")
@@ -0,0 +1,103 @@
+###############################################################################
+#                                                                             #
+# This file is part of IfcOpenShell.                                          #
+#                                                                             #
+# IfcOpenShell is free software: you can redistribute it and/or modify        #
+# it under the terms of the Lesser GNU General Public License as published by #
+# the Free Software Foundation, either version 3.0 of the License, or         #
+# (at your option) any later version.                                         #
+#                                                                             #
+# IfcOpenShell is distributed in the hope that it will be useful,             #
+# but WITHOUT ANY WARRANTY; without even the implied warranty of              #
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                #
+# Lesser GNU General Public License for more details.                         #
+#                                                                             #
+# You should have received a copy of the Lesser GNU General Public License    #
+# along with this program. If not, see <http://www.gnu.org/licenses/>.        #
+#                                                                             #
+###############################################################################
+
+###############################################################################
+#                                                                             #
+# Converts IFC files to Wavefront OBJ with IfcConvert using an increasing     #
+# number of threads. The output is expected to be identical, byte for byte,   #
+# to the output of a single thread, as the elements are written in the order  #
+# of the iterator. Prints the wall time and speedup for every number of       #
+# threads. By default the files downloaded by run.py into the input directory #
+# are converted, with IfcConvert from PATH.                                   #
+#                                                                             #
+# Usage: python threads.py [--ifcconvert <path>] [--threads 1,2,4,8]          #
+#                          [<filename.ifc> ...]                               #
+#                                                                             #
+###############################################################################
+
+import os
+import sys
+import time
+import glob
+import shutil
+import inspect
+import argparse
+import filecmp
+import subprocess
+import multiprocessing
+
+cwd = os.path.abspath(os.path.dirname(inspect.getfile(inspect.currentframe())))
+
+def default_thread_counts():
+    counts, n = [], 1
+    while n < multiprocessing.cpu_count():
+        counts.append(n)
+        n *= 2
+    return counts + [multiprocessing.cpu_count()]
+
+parser = argparse.ArgumentParser(description="Compares the output of IfcConvert for a number of threads")
+parser.add_argument("--ifcconvert", default="IfcConvert")
+parser.add_argument("--threads", default=",".join(map(str, default_thread_counts())))
+parser.add_argument("files", nargs="*")
+args = parser.parse_args()
+
+thread_counts = sorted(set([1] + [int(n) for n in args.threads.split(",")]))
+if thread_counts[-1] > multiprocessing.cpu_count():
+    # The output is still compared, but the speedup is meaningless beyond the number of cores
+    print("[Warning] Using up to %d threads on %d cores" % (thread_counts[-1], multiprocessing.cpu_count()))
+files = args.files or sorted(glob.glob(os.path.join(cwd, "input", "*.ifc")))
+if not files:
+    print("[Error] No input files, run run.py first or specify files")
+    sys.exit(1)
+
+output_dir = os.path.join(cwd, "output", "threads")
+failed = []
+
+for fn in files:
+    name = os.path.splitext(os.path.basename(fn))[0]
+    times = {}
+    for n in thread_counts:
+        # The output files have the same name for every number of threads, as
+        # the name of the material library is written to the OBJ file
+        d = os.path.join(output_dir, str(n))
+        if not os.path.exists(d): os.makedirs(d)
+        obj = os.path.join(d, name + ".obj")
+        t0 = time.time()
+        code = subprocess.call([args.ifcconvert, "-q", "-y", "--threads", str(n), fn, obj], stdout=subprocess.DEVNULL)
+        times[n] = time.time() - t0
+        if code != 0:
+            print("[Error] IfcConvert failed on %s with %d threads" % (fn, n))
+            failed.append(fn)
+            break
+        elif n != 1:
+            reference = os.path.join(output_dir, "1", name)
+            for ext in (".obj", ".mtl"):
+                if not filecmp.cmp(reference + ext, os.path.join(d, name + ext), shallow=False):
+                    print("[Error] Output of %s with %d threads differs from a single thread (%s)" % (fn, n, ext))
+                    failed.append(fn)
+    else:
+        print("[Notice] %s: %s" % (os.path.basename(fn), ", ".join(
+            "%d threads %.2fs (%.2fx)" % (n, times[n], times[1] / times[n] if times[n] else 0.) for n in thread_counts)))
+
+if failed:
+    print("[Error] %d of %d files failed:" % (len(set(failed)), len(files)))
+    print("\n".join(sorted(set(failed))))
+    sys.exit(1)
+
+shutil.rmtree(output_dir, ignore_errors=True)